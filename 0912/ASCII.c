@@ -1,18 +1,34 @@
 #include <stdio.h>
-#include <conio.h>
+#include "keyinput.h"
+// 누른 키를 보여준다. 방향키/기능키는 이름으로, 함께 누른 Shift/Alt/Ctrl 과
+// 앞 키와의 시간 간격(ms)도 함께 보여준다. (keyinput.h 가 Windows 확장키(0/0xE0 + 코드)와
+// 리눅스 터미널의 ESC [ A 같은 제어 문자열을 같은 키 코드로 바꿔 준다)  q 를 누르면 끝
 int main(void)
 {
-    int chr;
-    do
+    struct key_input input;
+    struct key_event ev[64];
+    uint64_t last = 0;
+    int i, n, done = 0;
+
+    key_open(&input);
+    while (!done && (n = key_wait(&input, ev, 64, -1)) >= 0)
     {
-        chr = getch();
-        if (chr == 0 || chr == 0xe0)
+        for (i = 0; i < n; i++)
         {
-            chr = getch();
-            printf("확장키 code=%d\n", chr);
+            const char *name = key_name(ev[i].key);
+            if (name != NULL)
+                printf("확장키 %-9s", name);
+            else
+                printf("아스키 code=%-4d", ev[i].key);
+            printf("%s%s%s  +%.1fms\r\n", ev[i].mod & KEY_MOD_SHIFT ? " Shift" : "",
+                   ev[i].mod & KEY_MOD_ALT ? " Alt" : "", ev[i].mod & KEY_MOD_CTRL ? " Ctrl" : "",
+                   last ? (ev[i].time_us - last) / 1000.0 : 0.0);
+            last = ev[i].time_us;
+            if (ev[i].key == 'q')
+                done = 1;
         }
-        else
-            printf("아스키 code=%d\n", chr);
-    } while (1);
+        fflush(stdout);
+    }
+    key_close(&input);
     return 0;
 }
@@ -0,0 +1,78 @@
+// 화면 지우기 속도 비교: system("cls") 대 term_clear()
+//
+// 구구단 한 단(bufferClear2.c 의 화면)을 지우고 다시 쓰는 것을 한 화면으로 보고
+// 1초에 몇 화면을 그릴 수 있는지 잰다.
+//
+// 컴파일 예: gcc -O2 ClearBench.c -o ClearBench
+// 실행 예:   ClearBench 100 20000   (system 방식 화면 수, term_clear 방식 화면 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "term.h"
+
+#ifdef _WIN32
+#define CLEAR_COMMAND "cls"
+#else
+#define CLEAR_COMMAND "clear"
+#include <sys/time.h>
+#endif
+
+double now_sec(void);
+void draw_table(int j);
+double run(int screens, int use_system);
+
+int main(int argc, char *argv[])
+{
+    int system_screens = argc > 1 ? atoi(argv[1]) : 100;
+    int term_screens = argc > 2 ? atoi(argv[2]) : 20000;
+    double before, after;
+
+    term_init();
+    before = run(system_screens, 1);
+    after = run(term_screens, 0);
+    term_clear();
+    printf("system(\"%s\") : %10.1f 화면/초 (%d 화면)\n", CLEAR_COMMAND, before, system_screens);
+    printf("term_clear()   : %10.1f 화면/초 (%d 화면)\n", after, term_screens);
+    printf("%.1f 배\n", after / before);
+    return 0;
+}
+
+double now_sec(void)
+{
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC; // Windows 의 clock() 은 벽시계 시간
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+void draw_table(int j)
+{
+    int i;
+    for (i = 1; i <= 9; i++)
+        printf("%d*%d=%d\n", j, i, j * i);
+}
+
+// 1초당 화면 수
+double run(int screens, int use_system)
+{
+    double t = now_sec();
+    int k;
+    for (k = 0; k < screens; k++)
+    {
+        if (use_system)
+        {
+            fflush(stdout);
+            system(CLEAR_COMMAND);
+        }
+        else
+            term_clear();
+        draw_table(k % 9 + 1);
+    }
+    fflush(stdout);
+    t = now_sec() - t;
+    return t > 0 ? screens / t : 0;
+}
@@ -0,0 +1,225 @@
+// keyinput.h 검사와 속도
+//
+//   1) 자체 검사: 제어 문자열을 한 바이트씩, 임의 길이로 나눠 넣어도 한 번에 넣은 것과 같은 키가 나오는지
+//      Windows getch 바이트(0/0xE0 + 코드), ESC 단독 입력 판단(시간 초과)
+//   2) 해석 속도: 방향키/기능키/문자가 섞인 바이트열 (ns/바이트, 백만 키/초)
+//   3) 깨어나는 시간 (리눅스): 다른 스레드가 파이프에 키를 쓴 뒤 key_wait 가 돌려줄 때까지
+//      (kbhit + Sleep(100) 반복은 평균 50ms 늦다)
+//
+// 컴파일 예: gcc -O2 KeyInputBench.c -o KeyInputBench -lpthread
+// 실행 예:   KeyInputBench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "keyinput.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+struct key_case
+{
+    const char *bytes;
+    int len;
+    int key[4], mod[4], count;
+};
+
+// 바이트열과 나와야 하는 키
+static const struct key_case cases[] = {
+    {"\x1b[A\x1b[B\x1b[C\x1b[D", 12, {KEY_UP, KEY_DOWN, KEY_RIGHT, KEY_LEFT}, {0, 0, 0, 0}, 4},
+    {"\x1bOA\x1bOH\x1bOP", 9, {KEY_UP, KEY_HOME, KEY_F1}, {0, 0, 0}, 3},
+    {"\x1b[1;5C\x1b[1;2A", 12, {KEY_RIGHT, KEY_UP}, {KEY_MOD_CTRL, KEY_MOD_SHIFT}, 2},
+    {"\x1b[3~\x1b[5~\x1b[6~\x1b[2~", 16, {KEY_DELETE, KEY_PAGE_UP, KEY_PAGE_DOWN, KEY_INSERT}, {0, 0, 0, 0}, 4},
+    {"\x1b[15~\x1b[24~\x1b[H\x1b[F", 16, {KEY_F5, KEY_F12, KEY_HOME, KEY_END}, {0, 0, 0, 0}, 4},
+    {"a\x1b" "b\x1b\x1b[A", 7, {'a', 'b', KEY_ESC, KEY_UP}, {0, KEY_MOD_ALT, 0, 0}, 4},
+    {"\x1b\r\x7f ", 4, {KEY_ESC, KEY_ENTER, KEY_BACKSPACE, KEY_SPACE}, {0, 0, 0, 0}, 4},
+    {"\x1b[99~x", 6, {'x'}, {0}, 1}, // 모르는 키는 버린다
+    {"\x1b[3000000000~\x1b[99999999999A", 27, {KEY_UP}, {0}, 1}, // 아주 긴 숫자도 넘치지 않는다
+};
+
+static int same(const struct key_event *ev, int n, const struct key_case *c)
+{
+    int i;
+    if (n != c->count)
+        return 0;
+    for (i = 0; i < n; i++)
+        if (ev[i].key != c->key[i] || ev[i].mod != c->mod[i])
+            return 0;
+    return 1;
+}
+
+int self_check(void)
+{
+    struct key_decoder d;
+    struct key_event ev[64];
+    unsigned char getch_bytes[] = {0xe0, 72, 0, 59, 'z', 0xe0, 77, 0, 134};
+    int expect[] = {KEY_UP, KEY_F1, 'z', KEY_RIGHT, KEY_F12};
+    int fail = 0, c, split, i, n;
+    unsigned int seed = 1;
+
+    for (c = 0; c < (int)(sizeof(cases) / sizeof(cases[0])); c++)
+    {
+        const unsigned char *b = (const unsigned char *)cases[c].bytes;
+        int len = cases[c].len;
+
+        // 한 번에
+        key_decoder_init(&d, 0);
+        fail |= !same(ev, key_decode(&d, b, len, 0, ev, 64), &cases[c]);
+
+        // 두 조각으로 나눈 모든 경우
+        for (split = 0; split <= len; split++)
+        {
+            key_decoder_init(&d, 0);
+            n = key_decode(&d, b, split, 0, ev, 64);
+            n += key_decode(&d, b + split, len - split, 0, ev + n, 64 - n);
+            fail |= !same(ev, n, &cases[c]);
+        }
+
+        // 임의 길이 조각
+        for (split = 0; split < 100; split++)
+        {
+            key_decoder_init(&d, 0);
+            for (i = n = 0; i < len;)
+            {
+                int k;
+                seed = seed * 1103515245 + 12345;
+                k = 1 + (int)(seed >> 16) % 3;
+                if (k > len - i)
+                    k = len - i;
+                n += key_decode(&d, b + i, k, 0, ev + n, 64 - n);
+                i += k;
+            }
+            fail |= !same(ev, n, &cases[c]);
+        }
+        if (fail)
+        {
+            printf("틀림: %d 번째 바이트열\n", c);
+            break;
+        }
+    }
+
+    // ESC 단독: 시간이 지나기 전에는 나오지 않고, 지나면 나온다
+    key_decoder_init(&d, 0);
+    n = key_decode(&d, (const unsigned char *)"\x1b", 1, 1000, ev, 64);
+    n += key_decode_idle(&d, 1000 + KEY_ESC_TIMEOUT - 1, ev);
+    fail |= n != 0;
+    n = key_decode_idle(&d, 1000 + KEY_ESC_TIMEOUT, ev);
+    fail |= n != 1 || ev[0].key != KEY_ESC || ev[0].time_us != 1000;
+
+    // 남은 ESC 뒤의 제어 문자는 한 바이트에서 키 두 개: out 자리(max)를 넘겨 쓰지 않는다
+    key_decoder_init(&d, 0);
+    key_decode(&d, (const unsigned char *)"\x1b", 1, 1000, ev, 64);
+    ev[1].key = -1;
+    n = key_decode(&d, (const unsigned char *)"\r", 1, 2000, ev, 1);
+    fail |= n != 1 || ev[0].key != KEY_ESC || ev[1].key != -1;
+    key_decoder_init(&d, 0);
+    key_decode(&d, (const unsigned char *)"\x1b", 1, 1000, ev, 64);
+    n = key_decode(&d, (const unsigned char *)"\r", 1, 2000, ev, 2);
+    fail |= n != 2 || ev[0].key != KEY_ESC || ev[1].key != '\r';
+
+    // Windows getch 바이트
+    key_decoder_init(&d, 1);
+    n = key_decode(&d, getch_bytes, sizeof(getch_bytes), 0, ev, 64);
+    fail |= n != 5;
+    for (i = 0; i < n && i < 5; i++)
+        fail |= ev[i].key != expect[i];
+
+    printf("자체 검사: %s\n\n", fail ? "실패" : "통과");
+    return !fail;
+}
+
+#ifndef _WIN32
+struct writer
+{
+    int fd, count;
+    uint64_t sent[1000];
+};
+
+static void *write_keys(void *arg)
+{
+    struct writer *w = (struct writer *)arg;
+    int i;
+    for (i = 0; i < w->count; i++)
+    {
+        struct timespec ts = {0, 2000000}; // 2ms 마다 방향키 하나
+        nanosleep(&ts, NULL);
+        w->sent[i] = key_now_us();
+        if (write(w->fd, "\x1b[A", 3) != 3)
+            break;
+    }
+    close(w->fd);
+    return NULL;
+}
+#endif
+
+int main(void)
+{
+    static unsigned char stream[1 << 22];
+    static struct key_event ev[1 << 22];
+    const char *pieces[] = {"\x1b[A", "\x1b[B", "\x1b[1;5C", "\x1b[D", "\x1bOP", "\x1b[15~", "a", "b", " ", "\r"};
+    int len = 0, events = 0, r, rounds = 20, n;
+    unsigned int seed = 7;
+    struct key_decoder d;
+    uint64_t t;
+
+    if (!self_check())
+        return 1;
+
+    // 2) 해석 속도
+    while (len < (int)sizeof(stream) - 8)
+    {
+        const char *p;
+        seed = seed * 1103515245 + 12345;
+        p = pieces[(seed >> 16) % 10];
+        memcpy(stream + len, p, strlen(p));
+        len += (int)strlen(p);
+    }
+    key_decoder_init(&d, 0);
+    t = key_now_us();
+    for (r = 0; r < rounds; r++)
+    {
+        // read() 한 번에 들어오는 정도(256 바이트)씩 나눠서
+        int i;
+        for (i = events = 0; i < len; i += 256)
+            events += key_decode(&d, stream + i, len - i < 256 ? len - i : 256, 0, ev + events,
+                                 (int)(sizeof(ev) / sizeof(ev[0])) - events);
+    }
+    t = key_now_us() - t;
+    printf("해석: %d 바이트 -> %d 키, %.2f ns/바이트, %.1f 백만 키/초\n", len, events,
+           t * 1000.0 / ((double)len * rounds), (double)events * rounds / t);
+
+#ifndef _WIN32
+    // 3) 깨어나는 시간
+    {
+        struct key_input in;
+        struct writer w;
+        pthread_t tid;
+        int fds[2], got = 0;
+        double sum = 0, worst = 0;
+
+        if (pipe(fds) != 0)
+            return 1;
+        key_decoder_init(&in.dec, 0);
+        in.fd = fds[0];
+        in.raw = 0;
+        w.fd = fds[1];
+        w.count = 500;
+        pthread_create(&tid, NULL, write_keys, &w);
+        while ((n = key_wait(&in, ev, 64, -1)) > 0)
+        {
+            for (r = 0; r < n && got < w.count; r++, got++)
+            {
+                double late = (ev[r].time_us - w.sent[got]) / 1000.0;
+                sum += late;
+                worst = late > worst ? late : worst;
+            }
+        }
+        pthread_join(tid, NULL);
+        close(fds[0]);
+        printf("깨어나는 시간: 키 %d 개, 평균 %.3f ms, 최대 %.3f ms (kbhit + Sleep(100) 은 평균 약 50 ms)\n",
+               got, got ? sum / got : 0, worst);
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,220 @@
+// 로또 번호 생성 속도와 통계
+//
+//   1) 한 장씩: 예전 방식(겹치면 다시 뽑기 + 선택 정렬) / Floyd + 정렬망 / Floyd 마스크
+//   2) 여러 장: lotto_batch 로 count 장을 버퍼에 채우고 1 스레드와 N 스레드 속도 비교
+//   3) 통계: 번호별 횟수 카이제곱, 같은 조합이 다시 나온 횟수(충돌), 추첨 한 번에 대한 등수별 당첨 수
+//
+// 컴파일 예: gcc -O2 LottoBench.c -o LottoBench -lpthread -lm
+// 실행 예:   LottoBench 100000000 4   (표 수, 스레드 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "lotto.h"
+
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+double now_sec(void);
+int self_check(void);
+void old_pick(int lotto[6]);
+void old_selection_sort(int r[], int n);
+
+int main(int argc, char *argv[])
+{
+    long long count = argc > 1 ? atoll(argv[1]) : 10000000;
+    int threads = argc > 2 ? atoi(argv[2]) : 4, i, k;
+    long long freq[LOTTO_N + 1], freq2[LOTTO_N + 1], n, hits[LOTTO_K + 1] = {0};
+    unsigned char *tickets, *tickets2, win[LOTTO_K];
+    unsigned short *seen;
+    long long collisions = 0;
+    double t, t1, chi = 0, expect;
+    uint64_t rng, sink = 0;
+    int v[LOTTO_K];
+
+    if (!self_check())
+        return 1;
+
+    // 1) 한 장씩
+    n = 10000000;
+    srand(1);
+    t = now_sec();
+    for (k = 0; k < n; k++)
+    {
+        old_pick(v);
+        old_selection_sort(v, 6);
+        sink += v[0];
+    }
+    t = now_sec() - t;
+    printf("겹치면 다시 뽑기 + 선택 정렬 : %6.1f ns/장\n", t * 1e9 / n);
+
+    lotto_seed(&rng, 1);
+    t = now_sec();
+    for (k = 0; k < n; k++)
+    {
+        unsigned char p[LOTTO_K];
+        lotto_pick_unsorted(&rng, p);
+        for (i = 0; i < LOTTO_K; i++)
+            v[i] = p[i];
+        lotto_sort6(v);
+        sink += v[0];
+    }
+    t = now_sec() - t;
+    printf("Floyd + 정렬망               : %6.1f ns/장\n", t * 1e9 / n);
+
+    t = now_sec();
+    for (k = 0; k < n; k++)
+    {
+        unsigned char p[LOTTO_K];
+        lotto_pick(&rng, p);
+        sink += p[0];
+    }
+    t = now_sec() - t;
+    printf("Floyd 마스크 (비트 순서 정렬) : %6.1f ns/장\n\n", t * 1e9 / n);
+
+    // 2) 여러 장
+    tickets = (unsigned char *)malloc((size_t)count * LOTTO_K);
+    tickets2 = (unsigned char *)malloc((size_t)count * LOTTO_K);
+    if (tickets == NULL || tickets2 == NULL)
+    {
+        printf("메모리 부족 (%lld 장)\n", count);
+        return 1;
+    }
+    t1 = now_sec();
+    lotto_batch(tickets, count, 2024, 1, freq);
+    t1 = now_sec() - t1;
+    t = now_sec();
+    lotto_batch(tickets2, count, 2024, threads, freq2);
+    t = now_sec() - t;
+    printf("%lld 장: 1 스레드 %.3f 초 (%.1f 백만 장/초), %d 스레드 %.3f 초 (%.1f 백만 장/초)\n",
+           count, t1, count / t1 / 1e6, threads, t, count / t / 1e6);
+    printf("스레드 수와 관계없이 같은 결과: %s\n\n",
+           memcmp(tickets, tickets2, (size_t)count * LOTTO_K) == 0 && memcmp(freq, freq2, sizeof(freq)) == 0
+               ? "예"
+               : "아니오 (오류)");
+    free(tickets2);
+
+    // 3) 통계
+    expect = (double)count * LOTTO_K / LOTTO_N;
+    for (i = 1; i <= LOTTO_N; i++)
+        chi += (freq[i] - expect) * (freq[i] - expect) / expect;
+    printf("번호별 횟수 카이제곱 = %.1f (자유도 44, 평균 44)\n", chi);
+
+    seen = (unsigned short *)calloc(LOTTO_COMBINATIONS, sizeof(unsigned short));
+    lotto_seed(&rng, 777);
+    lotto_pick(&rng, win);
+    for (n = 0; n < count; n++)
+    {
+        const unsigned char *tk = tickets + n * LOTTO_K;
+        hits[lotto_match(lotto_mask(tk), lotto_mask(win))]++;
+        if (seen != NULL)
+        {
+            uint32_t r = lotto_rank(tk);
+            if (seen[r])
+                collisions++;
+            if (seen[r] < 0xffff)
+                seen[r]++;
+        }
+    }
+    if (seen != NULL)
+        printf("같은 조합이 다시 나온 표: %lld 장 (기대값 %.0f)\n", collisions,
+               count - LOTTO_COMBINATIONS * (1 - exp((double)-count / LOTTO_COMBINATIONS)));
+    printf("당첨 번호 %d %d %d %d %d %d\n", win[0], win[1], win[2], win[3], win[4], win[5]);
+    for (k = LOTTO_K; k >= 3; k--)
+        printf("  %d개 일치: %lld 장\n", k, hits[k]);
+    printf("(sink %llu)\n", (unsigned long long)sink);
+    free(seen);
+    free(tickets);
+    return 0;
+}
+
+double now_sec(void)
+{
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+// random3.c 의 예전 방식
+void old_pick(int lotto[6])
+{
+    int i, j;
+    for (i = 0; i <= 5; i++)
+    {
+        lotto[i] = rand() % 45 + 1;
+        for (j = 0; j < i; j++)
+        {
+            if (lotto[i] == lotto[j])
+            {
+                i--;
+                break;
+            }
+        }
+    }
+}
+
+void old_selection_sort(int r[], int n)
+{
+    int i, j, min, temp;
+    for (i = 0; i < n - 1; i++)
+    {
+        min = i;
+        for (j = i + 1; j < n; j++)
+            if (r[j] < r[min])
+                min = j;
+        temp = r[min];
+        r[min] = r[i];
+        r[i] = temp;
+    }
+}
+
+int self_check(void)
+{
+    int v[LOTTO_K], perm[LOTTO_K], fail = 0, i, m, k;
+    uint64_t rng;
+    unsigned char p[LOTTO_K], q[LOTTO_K];
+
+    // 정렬망: 0/1 원리 - 0과 1로 된 모든 입력(64가지)을 정렬하면 모든 입력을 정렬한다
+    for (m = 0; m < 64; m++)
+    {
+        for (i = 0; i < LOTTO_K; i++)
+            v[i] = m >> i & 1;
+        lotto_sort6(v);
+        for (i = 1; i < LOTTO_K; i++)
+            fail |= v[i - 1] > v[i];
+    }
+    // 같은 값이 섞인 입력
+    for (i = 0; i < LOTTO_K; i++)
+        perm[i] = (i * 7) % 4;
+    lotto_sort6(perm);
+    for (i = 1; i < LOTTO_K; i++)
+        fail |= perm[i - 1] > perm[i];
+
+    // 뽑은 표: 서로 다르고 1 ~ 45, 정렬됨, 마스크/순위 왕복
+    lotto_seed(&rng, 99);
+    for (k = 0; k < 1000000 && !fail; k++)
+    {
+        lotto_pick(&rng, p);
+        for (i = 0; i < LOTTO_K; i++)
+            fail |= p[i] < 1 || p[i] > LOTTO_N || (i > 0 && p[i - 1] >= p[i]);
+        fail |= lotto_popcount(lotto_mask(p)) != LOTTO_K || lotto_rank(p) >= LOTTO_COMBINATIONS;
+        lotto_pick_unsorted(&rng, q);
+        fail |= lotto_popcount(lotto_mask(q)) != LOTTO_K;
+    }
+    // 가장 작은 조합과 가장 큰 조합의 순위
+    for (i = 0; i < LOTTO_K; i++)
+    {
+        p[i] = (unsigned char)(i + 1);
+        q[i] = (unsigned char)(LOTTO_N - LOTTO_K + 1 + i);
+    }
+    fail |= lotto_rank(p) != 0 || lotto_rank(q) != LOTTO_COMBINATIONS - 1;
+    printf("자체 검사: %s\n\n", fail ? "실패" : "통과");
+    return !fail;
+}
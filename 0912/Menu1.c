@@ -1,6 +1,6 @@
 #include <stdio.h>
 #include <conio.h>
-#include <stdlib.h>
+#include "term.h"
 int menu_display(void);
 void hamburger(void);
 void spaghetti(void);
@@ -27,7 +27,7 @@ int main(void)
 int menu_display(void)
 {
     int select;
-    system("cls");
+    term_clear();
     printf("간식 만들기\n\n");
     printf("1. 햄버거 \n");
     printf("2. 스파게티\n");
@@ -38,14 +38,14 @@ int menu_display(void)
 }
 void hamburger(void)
 {
-    system("cls");
+    term_clear();
     printf("햄버거 만드는 방법\n");
     printf("중략\n");
     press_any_key();
 }
 void spaghetti(void)
 {
-    system("cls");
+    term_clear();
     printf("스파게티 만드는 방법\n");
     printf("중략\n");
     press_any_key();
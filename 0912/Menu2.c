@@ -1,133 +1,115 @@
 #include <stdio.h>
 #include <conio.h>
-#include <stdlib.h>
-int menu_display(void);
-int sub_menu_display01(void); // 햄버거에 대한 서브 메뉴 출력과 번호 입력
-int sub_menu_display02(void); // 스파게티에 대한 서브 메뉴 출력과 번호 입력
-void sub_main01(void);        // 햄버거에 대한 서브 메뉴 제어
-void sub_main02(void);        // 스파게티에 대한 서브 메뉴 제어
-void chicken_burger(void);
-void cheese_burger(void);
-void tomato_spaghetti(void);
-void cream_spaghetti(void);
+#include "term.h"
+
+// 메뉴 구조를 표로 만든다. 메뉴 하나가 늘어나도 함수를 새로 만들 필요 없이 표에 줄만 추가한다.
+// 항목 종류
+//   MENU_SUB  : next 번 메뉴로 들어감
+//   MENU_PAGE : page 글을 보여 주고 아무 키나 누르면 돌아옴
+//   MENU_BACK : 이전 메뉴로 (맨 위 메뉴에서는 프로그램 종료)
+#define MENU_MAX_ITEMS 9
+#define MENU_MAX_DEPTH 16
+
+enum menu_kind
+{
+    MENU_SUB,
+    MENU_PAGE,
+    MENU_BACK
+};
+
+struct menu_item
+{
+    const char *label;
+    enum menu_kind kind;
+    int next;         // MENU_SUB 일 때 들어갈 메뉴 번호
+    const char *page; // MENU_PAGE 일 때 보여 줄 글
+};
+
+struct menu
+{
+    const char *title;
+    int count;
+    struct menu_item item[MENU_MAX_ITEMS];
+};
+
+enum
+{
+    MAIN_MENU,
+    BURGER_MENU,
+    SPAGHETTI_MENU
+};
+
+static const struct menu menus[] = {
+    {"간식 만들기", 3,
+     {{"햄버거", MENU_SUB, BURGER_MENU, NULL},
+      {"스파게티", MENU_SUB, SPAGHETTI_MENU, NULL},
+      {"프로그램 종료", MENU_BACK, 0, NULL}}},
+    {"햄버거 만들기", 3,
+     {{"치킨버거", MENU_PAGE, 0, "치킨버거 만드는 방법\n중략\n"},
+      {"치즈버거", MENU_PAGE, 0, "치즈버거 만드는 방법\n중략\n"},
+      {"메인 메뉴로 이동", MENU_BACK, 0, NULL}}},
+    {"스파게티 만들기", 3,
+     {{"토마토 스파게티", MENU_PAGE, 0, "토마토 스파게티 만드는 방법\n중략\n"},
+      {"크림 스파게티", MENU_PAGE, 0, "크림 스파게티 만드는 방법\n중략\n"},
+      {"메인 메뉴로 이동", MENU_BACK, 0, NULL}}},
+};
+
+int menu_display(const struct menu *m);
+void run_menu(int start);
+void show_page(const char *page);
 void press_any_key(void); // 아무키나 누르면 이전 메뉴로
+
 int main(void)
 {
-    int c;
-    while ((c = menu_display()) != 3)
-    {
-        switch (c)
-        {
-        case 1:
-            sub_main01();
-            break;
-        case 2:
-            sub_main02();
-            break;
-        default:
-            break;
-        }
-    }
+    term_init();
+    run_menu(MAIN_MENU);
     return 0;
 }
-int menu_display(void)
-{
-    int select;
-    system("cls");
-    printf("간식 만들기\n\n");
-    printf("1. 햄버거 \n");
-    printf("2. 스파게티\n");
-    printf("3. 프로그램 종료\n\n");
-    printf("메뉴번호 입력>");
-    select = getch() - 48;
-    return select;
-}
-void sub_main01(void)
-{
-    int c;
-    while ((c = sub_menu_display01()) != 3)
-    {
-        switch (c)
-        {
-        case 1:
-            chicken_burger();
-            break;
-        case 2:
-            cheese_burger();
-            break;
-        default:
-            break;
-        }
-    }
-}
-int sub_menu_display01(void)
+// 메뉴 출력과 번호 입력 (1 ~ count, 그 밖의 키는 0)
+int menu_display(const struct menu *m)
 {
-    int select;
-    system("cls");
-    printf("햄버거 만들기\n\n");
-    printf("1. 치킨버거\n");
-    printf("2. 치즈버거\n");
-    printf("3. 메인 메뉴로 이동\n\n");
-    printf("메뉴번호 입력>");
+    int select, i;
+    term_clear();
+    printf("%s\n\n", m->title);
+    for (i = 0; i < m->count; i++)
+        printf("%d. %s\n", i + 1, m->item[i].label);
+    printf("\n메뉴번호 입력>");
     select = getch() - 48;
+    if (select < 1 || select > m->count)
+        return 0;
     return select;
 }
-void chicken_burger(void)
+// 들어간 메뉴 번호를 스택에 쌓아 두고 MENU_BACK 이면 하나 꺼낸다
+void run_menu(int start)
 {
-    system("cls");
-    printf("치킨버거 만드는 방법\n");
-    printf("중략\n");
-    press_any_key();
-}
-void cheese_burger(void)
-{
-    system("cls");
-    printf("치즈버거 만드는 방법\n");
-    printf("중략\n");
-    press_any_key();
-}
-void sub_main02(void)
-{
-    int c;
-    while ((c = sub_menu_display02()) != 3)
+    int stack[MENU_MAX_DEPTH], depth = 0, c;
+    stack[0] = start;
+    while (depth >= 0)
     {
-        switch (c)
+        const struct menu *m = &menus[stack[depth]];
+        const struct menu_item *item;
+        if ((c = menu_display(m)) == 0)
+            continue;
+        item = &m->item[c - 1];
+        switch (item->kind)
         {
-        case 1:
-            tomato_spaghetti();
+        case MENU_SUB:
+            if (depth + 1 < MENU_MAX_DEPTH)
+                stack[++depth] = item->next;
             break;
-        case 2:
-            cream_spaghetti();
+        case MENU_PAGE:
+            show_page(item->page);
             break;
-        default:
+        case MENU_BACK:
+            depth--;
             break;
         }
     }
 }
-int sub_menu_display02(void)
-{
-    int select;
-    system("cls");
-    printf("스파게티 만들기\n\n");
-    printf("1. 토마토 스파게티 \n");
-    printf("2. 크림 스파게티 \n");
-    printf("3. 메인 메뉴로 이동\n\n");
-    printf("메뉴번호 입력>");
-    select = getch() - 48;
-    return select;
-}
-void tomato_spaghetti(void)
+void show_page(const char *page)
 {
-    system("cls");
-    printf("토마토 스파게티 만드는 방법\n");
-    printf("중략\n");
-    press_any_key();
-}
-void cream_spaghetti(void)
-{
-    system("cls");
-    printf("크림 스파게티 만드는 방법\n");
-    printf("중략\n");
+    term_clear();
+    fputs(page, stdout);
     press_any_key();
 }
 void press_any_key(void)
@@ -135,4 +117,4 @@ void press_any_key(void)
     printf("\n\n");
     printf("아무키나 누르면 이전 메뉴로...");
     getch();
-}
\ No newline at end of file
+}
@@ -1,53 +1,52 @@
 #include <stdio.h>
-#include <conio.h>
-#include <windows.h>
+#include "term.h"
+#include "move.h"
 #define X_MAX 79 // 가로(열)방향의 최대값
 #define Y_MAX 24 // 세로(행)방향의 최대값
-void move_arrow_key(char chr, int *x, int *y, int x_b, int y_b);
-void gotoxy(int x, int y);
+void draw_move(const struct move_result *r);
 int main(void)
 {
-    char key;
-    int x = 10, y = 5;
-    do
+    struct key_input input;
+    struct key_event ev[64];
+    struct mover cursor;
+    struct move_result r;
+    int i, n, done = 0;
+
+    term_init();
+    term_clear();
+    term_cursor(0);
+    key_open(&input);
+    mover_init(&cursor, 10, 5, 1, 1, X_MAX, Y_MAX); // 방향키: 누르고 있으면 빨라진다 (move.h)
+    term_goto(10, 5);
+    printf("A");
+    fflush(stdout);
+    while (!done)
     {
-        gotoxy(x, y);
-        printf("A");
-        key = getch();
-        move_arrow_key(key, &x, &y, X_MAX, Y_MAX);
-    } while (key != 27);
+        // 키를 누르고 있으면 다음 자동 이동 시각까지만, 아니면 키가 올 때까지 기다린다
+        n = key_wait(&input, ev, 64, mover_wait_ms(&cursor, key_now_us()));
+        if (n < 0)
+            break;
+        for (i = 0; i < n; i++)
+        {
+            if (ev[i].key == KEY_ESC)
+                done = 1;
+            else if (mover_key(&cursor, &ev[i], &r) && move_changed(&r))
+                draw_move(&r);
+        }
+        if (mover_update(&cursor, key_now_us(), &r))
+            draw_move(&r);
+    }
+    key_close(&input);
+    term_cursor(1);
+    term_goto(1, Y_MAX + 1);
     return 0;
 }
-void move_arrow_key(char key, int *x1, int *y1, int x_b, int y_b)
+// 움직인 두 칸만 다시 그린다: 이전 자리는 지우고 새 자리에 A
+void draw_move(const struct move_result *r)
 {
-    switch (key)
-    {
-    case 72: // 위쪽(상) 방향의 화살표 키 입력
-        *y1 = *y1 - 1;
-        if (*y1 < 1)
-            *y1 = 1; // y좌표의 최소값
-        break;
-    case 75: // 왼쪽(좌) 방향의 화살표 키 입력
-        *x1 = *x1 - 1;
-        if (*x1 < 1)
-            *x1 = 1; // x좌표의 최소값
-        break;
-    case 77: // 오른쪽(우) 방향의 화살표 키 입력
-        *x1 = *x1 + 1;
-        if (*x1 > x_b)
-            *x1 = x_b; // x좌표의 최대값
-        break;
-    case 80: // 아래쪽(하) 방향의 화살표 키 입력
-        *y1 = *y1 + 1;
-        if (*y1 > y_b)
-            *y1 = y_b; // y좌표의 최대값
-        break;
-    default:
-        return;
-    }
+    term_goto(r->old_x, r->old_y);
+    printf(" ");
+    term_goto(r->x, r->y);
+    printf("A");
+    fflush(stdout);
 }
-void gotoxy(int x, int y)
-{
-    COORD Pos = {x - 1, y - 1};
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Pos);
-}
\ No newline at end of file
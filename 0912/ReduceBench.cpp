@@ -0,0 +1,220 @@
+// reduce.h 속도와 정확도
+//
+//   1) 가변 인자: va.c 의 sum(int count, ...) 대 reduce::sum(a, b, c, ...)
+//   2) 배열 10^3 ~ 10^max 개: 단순 반복 / reduce::sum / sum_kahan / minimum / maximum / dot
+//      오차는 long double 보정 합계와 비교한 상대 오차
+//   버퍼는 a, b 각각 최대 2^26 개(둘이 합쳐 1GB)까지만 만들고, 그보다 긴 배열은 같은 버퍼를 여러 번 이어서
+//   처리한다 (마지막 조각은 남은 개수만큼이라 10^8, 10^9 도 정확히 그 개수)
+//
+// 컴파일 예: g++ -std=c++17 -O2 -mavx2 -mfma ReduceBench.cpp -o ReduceBench
+// 실행 예:   ReduceBench 9   (최대 10^9 개, 기본 8)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdarg>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "reduce.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// va.c 의 sum
+static double va_sum(int count, ...)
+{
+    double total = 0, number;
+    int i = 0;
+    va_list ap;
+    va_start(ap, count);
+    while (i < count)
+    {
+        number = va_arg(ap, double);
+        total += number;
+        i++;
+    }
+    va_end(ap);
+    return total;
+}
+
+static double naive_sum(const double *p, std::size_t n)
+{
+    double s = 0;
+    for (std::size_t i = 0; i < n; i++)
+        s += p[i];
+    return s;
+}
+
+// 정답 기준: long double Kahan
+static long double exact_sum(const double *p, std::size_t n)
+{
+    long double s = 0, c = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        long double y = p[i] - c;
+        long double t = s + y;
+        c = (t - s) - y;
+        s = t;
+    }
+    return s;
+}
+
+static bool self_check()
+{
+    bool ok = true;
+    // 가변 인자
+    ok &= reduce::sum(1, 2, 3) == 6;
+    ok &= reduce::sum(10.5, 20.23) == va_sum(2, 10.5, 20.23);
+    static_assert(reduce::sum(1, 2, 3, 4) == 10, "컴파일할 때 계산");
+
+    // 길이별 (블록 경계 앞뒤, 4/16 의 나머지)
+    for (std::size_t n = 0; n < 5000; n += (n < 40 ? 1 : 97))
+    {
+        std::vector<double> a(n), b(n);
+        double mn = INFINITY, mx = -INFINITY;
+        long double d = 0;
+        for (std::size_t i = 0; i < n; i++)
+        {
+            a[i] = (double)((i * 37) % 101) - 50;
+            b[i] = (double)((i * 11) % 7) - 3;
+            mn = a[i] < mn ? a[i] : mn;
+            mx = a[i] > mx ? a[i] : mx;
+            d += a[i] * b[i];
+        }
+        // 정수 값이라 순서와 관계없이 정확히 같아야 한다
+        ok &= reduce::sum(a) == (double)exact_sum(a.data(), n);
+        ok &= reduce::sum_kahan(a) == (double)exact_sum(a.data(), n);
+        ok &= reduce::minimum(a) == mn && reduce::maximum(a) == mx;
+        ok &= reduce::dot(a, b) == (double)d;
+        if (!ok)
+        {
+            std::printf("틀림: n = %zu\n", n);
+            break;
+        }
+    }
+    double arr[3] = {1, 2, 3.5};
+    ok &= reduce::sum(arr) == 6.5 && reduce::sum(reduce::span<double>(arr, 2)) == 3;
+    std::printf("자체 검사: %s\n\n", ok ? "통과" : "실패");
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_exp = argc > 1 ? std::atoi(argv[1]) : 8;
+    const std::size_t cap = (std::size_t)1 << 26;
+    double sink = 0;
+
+    if (!self_check())
+        return 1;
+
+    // 1) 가변 인자
+    {
+        const long loops = 100000000;
+        volatile double x = 1.25; // 상수로 접히지 않게
+        double t = now_sec();
+        for (long i = 0; i < loops; i++)
+            sink += va_sum(5, x, 245.67, 0.51, 198345.764, (double)i);
+        double t_va = now_sec() - t;
+        t = now_sec();
+        for (long i = 0; i < loops; i++)
+            sink += reduce::sum(x, 245.67, 0.51, 198345.764, (double)i);
+        double t_fold = now_sec() - t;
+        std::printf("5개 합계: va_list %.2f ns, 가변 인자 템플릿 %.2f ns\n\n",
+                    t_va * 1e9 / loops, t_fold * 1e9 / loops);
+    }
+
+    // 2) 배열: 크기가 매우 다른 값이 섞이면 단순 반복의 오차가 커진다
+    std::size_t largest = 1;
+    for (int e = 0; e < max_exp; e++)
+        largest *= 10;
+    std::size_t len = largest < cap ? largest : cap;
+    std::vector<double> a(len), b(len);
+    unsigned long long s = 88172645463325252ULL;
+    for (std::size_t i = 0; i < len; i++)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        a[i] = (double)(s >> 11) / 9007199254740992.0 * (i % 3 == 0 ? 1e8 : 1e-3);
+        b[i] = (double)(s & 0xffff) / 65536.0;
+    }
+
+    std::printf("%12s %10s %10s %10s %10s %10s %10s | %9s %9s %9s\n", "개수", "단순", "pairwise", "kahan",
+                "min", "max", "dot", "오차단순", "오차pair", "오차kahan");
+    std::size_t n = 1000;
+    for (int e = 3; e <= max_exp; e++, n *= 10)
+    {
+        std::size_t chunk = n < cap ? n : cap, rounds = (n + chunk - 1) / chunk;
+        // r 번째 조각의 길이 (마지막은 남은 만큼)
+        auto piece = [=](std::size_t r) { return r + 1 < rounds ? chunk : n - r * chunk; };
+        // 짧은 배열은 여러 번 돌려 시간을 잰다
+        std::size_t repeat = n < 10000000 ? 100000000 / n : 1, done = n;
+        // 같은 버퍼를 되풀이해도 컴파일러가 한 번 계산한 결과를 재사용하지 않도록 volatile 로 읽는다
+        const double *volatile pa = a.data();
+        const double *volatile pb = b.data();
+        double t[6], r_naive = 0, r_pair = 0, r_kahan = 0;
+        long double exact = 0;
+
+        for (std::size_t r = 0; r < rounds; r++)
+            exact += exact_sum(pa, piece(r));
+
+        double start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+        {
+            r_naive = 0;
+            for (std::size_t r = 0; r < rounds; r++)
+                r_naive += naive_sum(pa, piece(r));
+            sink += r_naive;
+        }
+        t[0] = now_sec() - start;
+
+        start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+        {
+            r_pair = 0;
+            for (std::size_t r = 0; r < rounds; r++)
+                r_pair += reduce::sum(reduce::span<double>(pa, piece(r)));
+            sink += r_pair;
+        }
+        t[1] = now_sec() - start;
+
+        start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+        {
+            r_kahan = 0;
+            for (std::size_t r = 0; r < rounds; r++)
+                r_kahan += reduce::sum_kahan(reduce::span<double>(pa, piece(r)));
+            sink += r_kahan;
+        }
+        t[2] = now_sec() - start;
+
+        start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+            for (std::size_t r = 0; r < rounds; r++)
+                sink += reduce::minimum(reduce::span<double>(pa, piece(r)));
+        t[3] = now_sec() - start;
+
+        start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+            for (std::size_t r = 0; r < rounds; r++)
+                sink += reduce::maximum(reduce::span<double>(pa, piece(r)));
+        t[4] = now_sec() - start;
+
+        start = now_sec();
+        for (std::size_t k = 0; k < repeat; k++)
+            for (std::size_t r = 0; r < rounds; r++)
+                sink += reduce::dot(reduce::span<double>(pa, piece(r)), reduce::span<double>(pb, piece(r)));
+        t[5] = now_sec() - start;
+
+        std::printf("%12zu", done);
+        for (int k = 0; k < 6; k++)
+            std::printf(" %8.3fns", t[k] * 1e9 / ((double)done * repeat));
+        std::printf(" | %9.1e %9.1e %9.1e\n", (double)std::fabs((r_naive - exact) / exact),
+                    (double)std::fabs((r_pair - exact) / exact), (double)std::fabs((r_kahan - exact) / exact));
+    }
+    std::printf("(값 하나당 시간, sink %g)\n", sink);
+    return 0;
+}
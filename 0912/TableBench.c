@@ -0,0 +1,170 @@
+// table.h 화면 없이 페이지 쓰기 속도
+//
+//   페이지 하나 = 화면 지우기 + 구구단 9x9 격자 (칸마다 위치 지정) + 페이지 번호
+//   1) 예전 방식: 칸마다 커서 이동 + fprintf (gotoxy + printf 를 흉내)
+//   2) table.h : 페이지를 버퍼 하나에 만들고 fwrite 한 번
+//   둘 다 버퍼 없는(_IONBF) 파일에 써서, 콘솔처럼 출력 호출 한 번이 쓰기 한 번이 되게 한다.
+//
+// 컴파일 예: gcc -O2 TableBench.c -o TableBench
+// 실행 예:   TableBench 10000 pages.txt   (페이지 수, 파일)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "table.h"
+
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+
+#define PAGE_X 5
+#define PAGE_Y 3
+
+double now_sec(void);
+int self_check(void);
+long old_page(FILE *fp, int page);
+void new_page(struct table_buf *b, int page);
+
+// 같은 레이아웃: 9줄(곱하는 수) x 9칸(단), 칸 너비 8, 칸 사이 1
+static const struct table_layout grid = {PAGE_X, PAGE_Y, 9, 9, 8, 1, 1};
+
+int main(int argc, char *argv[])
+{
+    int pages = argc > 1 ? atoi(argv[1]) : 10000, k;
+    const char *path = argc > 2 ? argv[2] : "table_pages.txt";
+    size_t cap = table_size(&grid) + 64, bytes;
+    char *mem = (char *)malloc(cap);
+    struct table_buf page;
+    long calls;
+    double t;
+    FILE *fp;
+
+    if (mem == NULL || !self_check())
+        return 1;
+
+    // 1) 예전 방식
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        printf("%s 를 열 수 없습니다\n", path);
+        return 1;
+    }
+    setvbuf(fp, NULL, _IONBF, 0);
+    calls = 0;
+    t = now_sec();
+    for (k = 0; k < pages; k++)
+        calls += old_page(fp, k);
+    t = now_sec() - t;
+    bytes = (size_t)ftell(fp);
+    fclose(fp);
+    printf("칸마다 fprintf : %8.0f 페이지/초, %6.1f MB/초, 페이지당 출력 %ld 번\n", pages / t, bytes / t / 1e6,
+           calls / pages);
+
+    // 2) table.h
+    fp = fopen(path, "wb");
+    setvbuf(fp, NULL, _IONBF, 0);
+    table_buf_init(&page, mem, cap);
+    bytes = 0;
+    t = now_sec();
+    for (k = 0; k < pages; k++)
+    {
+        new_page(&page, k);
+        bytes += table_flush(&page, fp);
+    }
+    t = now_sec() - t;
+    fclose(fp);
+    printf("table.h        : %8.0f 페이지/초, %6.1f MB/초, 페이지당 출력 1 번 (%zu 바이트)\n", pages / t,
+           bytes / t / 1e6, bytes / pages);
+    printf("%d 페이지를 %s 에 썼습니다\n", pages, path);
+    free(mem);
+    return 0;
+}
+
+double now_sec(void)
+{
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+// 출력 호출 횟수를 돌려준다
+long old_page(FILE *fp, int page)
+{
+    int r, c;
+    long calls = 1;
+    fprintf(fp, "\x1b[2J\x1b[H");
+    for (r = 0; r < 9; r++)
+        for (c = 0; c < 9; c++)
+        {
+            fprintf(fp, "\x1b[%d;%dH", PAGE_Y + r, PAGE_X + c * 9); // gotoxy
+            fprintf(fp, "%d*%d=%d", c + 1, r + 1, (c + 1) * (r + 1));
+            calls += 2;
+        }
+    fprintf(fp, "\x1b[%d;%dH%d 쪽\n", PAGE_Y + 10, PAGE_X, page + 1);
+    return calls + 1;
+}
+
+void new_page(struct table_buf *b, int page)
+{
+    char num[NUM_FORMAT_MAX];
+    table_clear(b);
+    table_grid(b, &grid, table_times_cell, NULL);
+    table_goto(b, PAGE_X, PAGE_Y + 10);
+    num_format_i32(num, page + 1);
+    table_text(b, num);
+    table_text(b, " 쪽\n");
+}
+
+// table.h 결과를 snprintf 로 만든 것과 비교
+int self_check(void)
+{
+    static char mem[4096], expect[4096];
+    struct table_buf b;
+    struct table_layout line = {0, 0, 9, 1, 8, 0, 1};
+    int opt[2] = {3, 2}, wide[2] = {1, 1000}, r, c, n = 0, fail = 0;
+    const char *product[2] = {"81", "-2147483646"};
+    char cell[32], guard[TABLE_CELL_MAX + 1];
+
+    table_buf_init(&b, mem, sizeof(mem));
+    table_grid(&b, &grid, table_times_cell, NULL);
+    for (r = 0; r < 9; r++)
+    {
+        n += snprintf(expect + n, sizeof(expect) - n, "\x1b[%d;%dH", PAGE_Y + r, PAGE_X);
+        for (c = 0; c < 9; c++)
+        {
+            snprintf(cell, sizeof(cell), "%d*%d=%d", c + 1, r + 1, (c + 1) * (r + 1));
+            n += snprintf(expect + n, sizeof(expect) - n, c < 8 ? "%-8s " : "%s", cell);
+        }
+    }
+    fail |= b.len != (size_t)n || memcmp(mem, expect, n) != 0 || b.len > table_size(&grid);
+
+    // 위치 없이 줄바꿈, 곱의 너비 2 (cursor2.c 의 %2d)
+    table_buf_init(&b, mem, sizeof(mem));
+    table_grid(&b, &line, table_times_cell, opt);
+    for (r = n = 0; r < 9; r++)
+        n += snprintf(expect + n, sizeof(expect) - n, "3*%d=%2d\n", r + 1, 3 * (r + 1));
+    fail |= b.len != (size_t)n || memcmp(mem, expect, n) != 0;
+
+    // 모자란 버퍼는 넘치지 않고 표시만 한다
+    table_buf_init(&b, mem, 10);
+    table_grid(&b, &grid, table_times_cell, NULL);
+    fail |= !b.full || b.len > 10;
+
+    // 곱의 너비가 칸보다 커도 칸 하나(TABLE_CELL_MAX)를 넘겨 쓰지 않는다 (11 자리 곱과 끝의 '\0' 까지)
+    for (c = 0; c < 2; c++)
+    {
+        int len = (int)strlen(product[c]);
+        wide[0] = c == 0 ? 9 : -238609294;
+        guard[TABLE_CELL_MAX] = 'x';
+        n = table_times_cell(guard, 8, 0, wide);
+        fail |= n >= TABLE_CELL_MAX || guard[TABLE_CELL_MAX] != 'x' || memcmp(guard + n - len, product[c], len) != 0;
+    }
+
+    printf("자체 검사: %s\n\n", fail ? "실패" : "통과");
+    return !fail;
+}
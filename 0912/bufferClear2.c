@@ -1,15 +1,24 @@
 #include <stdio.h>
-#include <stdlib.h>
 #include <conio.h>
+#include "term.h"
+#include "table.h"
 int main(void)
 {
-    int i, j;
+    static char mem[1024];
+    struct table_buf page;
+    struct table_layout layout = {0, 0, 9, 1, 8, 0, 1}; // 위치 지정 없이 9줄 1칸
+    int j, opt[2];
+    term_init();
+    table_buf_init(&page, mem, sizeof(mem));
     for (j = 1; j <= 9; j++)
     {
-        system("cls");
-        for (i = 1; i <= 9; i++)
-            printf("%d*%d=%d\n", j, i, j * i);
-        printf("아무키나 누르시오.\n");
+        // 화면 지우기 + j단 9줄 + 안내문을 버퍼에 모아 한 번에 쓴다
+        opt[0] = j;
+        opt[1] = 0;
+        table_clear(&page);
+        table_grid(&page, &layout, table_times_cell, opt);
+        table_text(&page, "아무키나 누르시오.\n");
+        table_flush(&page, stdout);
         getch();
     }
     return 0;
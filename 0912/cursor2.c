@@ -1,20 +1,19 @@
 #include <stdio.h>
-#include <windows.h>
-void gotoxy(int x, int y);
+#include "term.h"
+#include "table.h"
 
 int main(void)
 {
-    for (int i = 1; i <= 9; i++)
-    {
-        gotoxy(35, 5 + i);
-        printf("%d*%d=%2d", 3, i, 3 * i);
-    }
-    printf("\n");
+    char mem[512];
+    struct table_buf buf;
+    struct table_layout layout = {35, 6, 9, 1, 8, 0, 1}; // (35, 6) 부터 9줄
+    int opt[2] = {3, 2};                                 // 3단, 곱은 %2d 처럼 두 칸
+
+    term_init();
+    table_buf_init(&buf, mem, sizeof(mem));
+    table_grid(&buf, &layout, table_times_cell, opt); // 줄마다 ESC[행;열H 하나
+    table_text(&buf, "\n");
+    table_flush(&buf, stdout); // 한 번에 출력
     return 0;
 }
 // 3단 출력
-void gotoxy(int x, int y)
-{
-    COORD Pos = {x - 1, y - 1};
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Pos);
-}
\ No newline at end of file
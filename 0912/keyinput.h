@@ -0,0 +1,551 @@
+// 키 입력 (방향키, 기능키, 일반 문자) - Windows 콘솔 / 리눅스 터미널 공용
+//
+// ASCII.c 에서 본 것처럼 Windows 의 getch() 는 방향키를 0 또는 0xE0 뒤에 코드(72/75/77/80)로 보내고,
+// 리눅스 터미널은 ESC [ A 같은 ANSI/VT 제어 문자열로 보낸다. 게임마다 72/75/77/80 을 직접
+// 비교하지 않도록 여기서 KEY_UP 같은 키 코드로 바꾼다.
+//
+// - 키 코드: 0 ~ 255 는 문자(바이트) 그대로, 방향키/기능키는 256 부터 (KEY_UP ...)
+// - 해석은 표(key_table)로 움직이는 상태 기계이다. 제어 문자열이 read 두 번에 나뉘어 와도
+//   상태가 남아 있으므로 이어서 해석된다. ESC 하나만 눌렀는지는 KEY_ESC_TIMEOUT 동안
+//   다음 바이트가 오지 않는 것으로 판단한다.
+// - key_wait 는 키가 올 때까지(또는 시간이 다 될 때까지) 잠들어 있다가 그동안 들어온 키를
+//   한꺼번에 돌려준다. 바쁜 대기(kbhit 반복 + Sleep)가 없다. 키마다 단조 증가 시각(마이크로초)이 붙는다.
+// - 리눅스는 key_open 이 터미널을 raw 모드(한 글자씩, 화면에 안 보이게)로 바꾸고 key_close 가 되돌린다.
+
+#ifndef KEYINPUT_H
+#define KEYINPUT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+enum key_code
+{
+    KEY_BACKSPACE = 8,
+    KEY_TAB = 9,
+    KEY_ENTER = 13,
+    KEY_ESC = 27,
+    KEY_SPACE = 32,
+    KEY_UP = 256,
+    KEY_DOWN,
+    KEY_LEFT,
+    KEY_RIGHT,
+    KEY_HOME,
+    KEY_END,
+    KEY_INSERT,
+    KEY_DELETE,
+    KEY_PAGE_UP,
+    KEY_PAGE_DOWN,
+    KEY_F1,
+    KEY_F2,
+    KEY_F3,
+    KEY_F4,
+    KEY_F5,
+    KEY_F6,
+    KEY_F7,
+    KEY_F8,
+    KEY_F9,
+    KEY_F10,
+    KEY_F11,
+    KEY_F12,
+    KEY_CODE_END
+};
+
+// 함께 눌린 키
+#define KEY_MOD_SHIFT 1
+#define KEY_MOD_ALT 2
+#define KEY_MOD_CTRL 4
+
+#define KEY_ESC_TIMEOUT 30000 // ESC 단독 입력으로 보는 시간 (마이크로초)
+#define KEY_MAX_PARAMS 4
+#define KEY_PARAM_CAP 9999 // CSI 숫자가 이보다 커지면 더 쌓지 않는다 (그런 키는 없다)
+
+struct key_event
+{
+    int key;          // 문자 또는 enum key_code
+    int mod;          // KEY_MOD_*
+    uint64_t time_us; // 단조 증가 시각 (key_now_us 와 같은 기준)
+};
+
+// ---- 단조 시각 ----
+
+static inline uint64_t key_now_us(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&t);
+    return (uint64_t)(t.QuadPart / freq.QuadPart * 1000000 + t.QuadPart % freq.QuadPart * 1000000 / freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+#endif
+}
+
+// ---- 제어 문자열 해석 상태 기계 ----
+
+enum key_state
+{
+    KS_GROUND, // 보통 문자
+    KS_ESC,    // ESC 다음
+    KS_CSI,    // ESC [ 다음 (숫자;숫자... 끝 문자)
+    KS_SS3,    // ESC O 다음 (끝 문자 하나)
+    KS_PREFIX, // Windows getch 의 0 / 0xE0 다음 (코드 하나)
+    KS_COUNT
+};
+
+enum key_class
+{
+    KC_ESC,    // 0x1B
+    KC_BRACKET,// '['
+    KC_O,      // 'O'
+    KC_DIGIT,  // '0' ~ '9'
+    KC_SEMI,   // ';'
+    KC_FINAL,  // 0x40 ~ 0x7E (위에 없는 것)
+    KC_PREFIX, // 0x00, 0xE0 (Windows getch 바이트를 해석할 때만)
+    KC_OTHER,
+    KC_COUNT
+};
+
+enum key_action
+{
+    KA_NONE,
+    KA_CHAR,     // 바이트를 문자로
+    KA_ESC,      // 앞의 ESC 를 단독 ESC 로 내보냄
+    KA_ALT,      // ESC + 문자 = Alt + 문자
+    KA_CLEAR,    // 숫자 인자 비우기
+    KA_DIGIT,    // 숫자 인자에 한 자리 더하기
+    KA_NEXT,     // 다음 숫자 인자
+    KA_CSI,      // ESC [ ... 끝
+    KA_SS3,      // ESC O x 끝
+    KA_PREFIX,   // 0/0xE0 + 코드 끝
+    KA_ESC_CHAR, // 앞의 ESC 를 내보내고 이 바이트는 문자로
+    KA_CANCEL    // 잘못된 문자열은 버림
+};
+
+struct key_transition
+{
+    unsigned char action, next;
+};
+
+#define KT(a, s) {KA_##a, KS_##s}
+
+// key_table[상태][바이트 종류]
+static const struct key_transition key_table[KS_COUNT][KC_COUNT] = {
+    //            ESC           [                 O              숫자             ;               끝 문자          0/0xE0             그 밖
+    /* GROUND */ {KT(NONE, ESC), KT(CHAR, GROUND), KT(CHAR, GROUND), KT(CHAR, GROUND), KT(CHAR, GROUND), KT(CHAR, GROUND), KT(NONE, PREFIX), KT(CHAR, GROUND)},
+    /* ESC    */ {KT(ESC, ESC), KT(CLEAR, CSI), KT(NONE, SS3), KT(ALT, GROUND), KT(ALT, GROUND), KT(ALT, GROUND), KT(ESC, PREFIX), KT(ESC_CHAR, GROUND)},
+    /* CSI    */ {KT(CANCEL, ESC), KT(CSI, GROUND), KT(CSI, GROUND), KT(DIGIT, CSI), KT(NEXT, CSI), KT(CSI, GROUND), KT(CANCEL, PREFIX), KT(CANCEL, GROUND)},
+    /* SS3    */ {KT(CANCEL, ESC), KT(SS3, GROUND), KT(SS3, GROUND), KT(CANCEL, GROUND), KT(CANCEL, GROUND), KT(SS3, GROUND), KT(CANCEL, PREFIX), KT(CANCEL, GROUND)},
+    /* PREFIX */ {KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND), KT(PREFIX, GROUND)},
+};
+
+#undef KT
+
+struct key_decoder
+{
+    unsigned char state;
+    unsigned char getch_bytes; // 1 이면 0/0xE0 을 Windows getch 의 확장키 접두어로 본다
+    int param[KEY_MAX_PARAMS], params;
+    uint64_t esc_time; // ESC 를 받은 시각
+};
+
+static inline void key_decoder_init(struct key_decoder *d, int getch_bytes)
+{
+    memset(d, 0, sizeof(*d));
+    d->getch_bytes = (unsigned char)getch_bytes;
+}
+
+static inline int key_class_of(const struct key_decoder *d, unsigned char c)
+{
+    if (c == 0x1b)
+        return KC_ESC;
+    if (c == '[')
+        return KC_BRACKET;
+    if (c == 'O')
+        return KC_O;
+    if (c >= '0' && c <= '9')
+        return KC_DIGIT;
+    if (c == ';')
+        return KC_SEMI;
+    if (c >= 0x40 && c <= 0x7e)
+        return KC_FINAL;
+    if (d->getch_bytes && (c == 0 || c == 0xe0))
+        return KC_PREFIX;
+    return KC_OTHER;
+}
+
+// ESC [ 인자 끝문자 -> 키 코드 (모르는 것은 0)
+static inline int key_from_csi(const struct key_decoder *d, unsigned char final)
+{
+    static const int tilde[25] = {0, KEY_HOME, KEY_INSERT, KEY_DELETE, KEY_END, KEY_PAGE_UP, KEY_PAGE_DOWN,
+                                  KEY_HOME, KEY_END, 0, 0, KEY_F1, KEY_F2, KEY_F3, KEY_F4, KEY_F5, 0,
+                                  KEY_F6, KEY_F7, KEY_F8, KEY_F9, KEY_F10, 0, KEY_F11, KEY_F12};
+    switch (final)
+    {
+    case 'A':
+        return KEY_UP;
+    case 'B':
+        return KEY_DOWN;
+    case 'C':
+        return KEY_RIGHT;
+    case 'D':
+        return KEY_LEFT;
+    case 'H':
+        return KEY_HOME;
+    case 'F':
+        return KEY_END;
+    case 'P':
+        return KEY_F1;
+    case 'Q':
+        return KEY_F2;
+    case 'R':
+        return KEY_F3;
+    case 'S':
+        return KEY_F4;
+    case '~':
+        return d->params > 0 && d->param[0] >= 0 && d->param[0] < 25 ? tilde[d->param[0]] : 0;
+    }
+    return 0;
+}
+
+// Windows getch 확장키 코드 -> 키 코드
+static inline int key_from_getch(unsigned char c)
+{
+    switch (c)
+    {
+    case 72:
+        return KEY_UP;
+    case 80:
+        return KEY_DOWN;
+    case 75:
+        return KEY_LEFT;
+    case 77:
+        return KEY_RIGHT;
+    case 71:
+        return KEY_HOME;
+    case 79:
+        return KEY_END;
+    case 82:
+        return KEY_INSERT;
+    case 83:
+        return KEY_DELETE;
+    case 73:
+        return KEY_PAGE_UP;
+    case 81:
+        return KEY_PAGE_DOWN;
+    case 133:
+        return KEY_F11;
+    case 134:
+        return KEY_F12;
+    }
+    if (c >= 59 && c <= 68)
+        return KEY_F1 + (c - 59);
+    return 0;
+}
+
+static inline int key_emit(struct key_event *out, int n, int key, int mod, uint64_t t)
+{
+    if (key == 0x7f)
+        key = KEY_BACKSPACE; // 리눅스 터미널의 백스페이스(DEL)를 Windows 와 같게
+    out[n].key = key;
+    out[n].mod = mod;
+    out[n].time_us = t;
+    return n + 1;
+}
+
+// 바이트 buf[0..len) 을 해석해 out 에 키를 최대 max 개 넣고 개수를 돌려준다.
+// 대개 한 바이트에서 키가 많아야 하나지만, 앞 호출에서 받은 ESC 가 남아 있을 때(d->state == KS_ESC)
+// 뒤에 Enter 같은 제어 문자가 오면 첫 바이트에서 ESC 와 그 문자 두 개가 나온다.
+// 그래서 out 은 len + 1 개면 모자라지 않다. 자리가 없으면 거기서 멈추고 남은 바이트는 버린다.
+static inline int key_decode(struct key_decoder *d, const unsigned char *buf, int len, uint64_t t,
+                             struct key_event *out, int max)
+{
+    int i, n = 0;
+    for (i = 0; i < len && n < max; i++)
+    {
+        unsigned char c = buf[i];
+        const struct key_transition *tr = &key_table[d->state][key_class_of(d, c)];
+        int key, mod = 0;
+
+        switch (tr->action)
+        {
+        case KA_CHAR:
+            n = key_emit(out, n, c, 0, t);
+            break;
+        case KA_ESC:
+            n = key_emit(out, n, KEY_ESC, 0, d->esc_time);
+            break;
+        case KA_ALT:
+            n = key_emit(out, n, c, KEY_MOD_ALT, t);
+            break;
+        case KA_ESC_CHAR:
+            // ESC 바로 뒤에 Enter 같은 제어 문자: 둘 다 내보낸다 (자리가 하나뿐이면 ESC 만)
+            n = key_emit(out, n, KEY_ESC, 0, d->esc_time);
+            if (n < max)
+                n = key_emit(out, n, c, 0, t);
+            break;
+        case KA_CLEAR:
+            d->params = 0;
+            d->param[0] = 0;
+            break;
+        case KA_DIGIT:
+            if (d->params == 0)
+                d->params = 1;
+            // 숫자가 아무리 길어도 int 를 넘지 않게
+            if (d->params <= KEY_MAX_PARAMS && d->param[d->params - 1] <= KEY_PARAM_CAP)
+                d->param[d->params - 1] = d->param[d->params - 1] * 10 + (c - '0');
+            break;
+        case KA_NEXT:
+            if (d->params == 0)
+                d->params = 1;
+            if (d->params < KEY_MAX_PARAMS)
+                d->param[d->params] = 0;
+            d->params++;
+            break;
+        case KA_CSI:
+            key = key_from_csi(d, c);
+            // 두 번째 인자가 있으면 xterm 의 조합 키 (2 = Shift, 3 = Alt, 5 = Ctrl ...)
+            if (d->params >= 2 && d->param[1] > 1)
+                mod = (d->param[1] - 1) & 7;
+            if (key)
+                n = key_emit(out, n, key, mod, t);
+            break;
+        case KA_SS3:
+            d->params = 0;
+            key = key_from_csi(d, c);
+            if (key)
+                n = key_emit(out, n, key, 0, t);
+            break;
+        case KA_PREFIX:
+            key = key_from_getch(c);
+            if (key)
+                n = key_emit(out, n, key, 0, t);
+            break;
+        default:
+            break;
+        }
+        if (tr->next == KS_ESC)
+            d->esc_time = t;
+        d->state = tr->next;
+    }
+    return n;
+}
+
+// ESC 다음에 KEY_ESC_TIMEOUT 동안 아무것도 오지 않았으면 단독 ESC 로 내보낸다 (0 또는 1개)
+static inline int key_decode_idle(struct key_decoder *d, uint64_t now, struct key_event *out)
+{
+    if (d->state == KS_ESC && now - d->esc_time >= KEY_ESC_TIMEOUT)
+    {
+        d->state = KS_GROUND;
+        return key_emit(out, 0, KEY_ESC, 0, d->esc_time);
+    }
+    return 0;
+}
+
+// ---- 키보드 ----
+
+struct key_input
+{
+    struct key_decoder dec;
+#ifdef _WIN32
+    HANDLE handle;
+    DWORD saved_mode;
+#else
+    int fd, raw;
+    struct termios saved;
+#endif
+};
+
+// 리눅스: 터미널을 raw 모드로 (표준 입력이 터미널이 아니면 그대로 읽는다)
+static inline int key_open(struct key_input *in)
+{
+#ifdef _WIN32
+    key_decoder_init(&in->dec, 1);
+    in->handle = GetStdHandle(STD_INPUT_HANDLE);
+    if (GetConsoleMode(in->handle, &in->saved_mode))
+        SetConsoleMode(in->handle, in->saved_mode & ~(ENABLE_LINE_INPUT | ENABLE_ECHO_INPUT));
+    return 1;
+#else
+    struct termios raw;
+    key_decoder_init(&in->dec, 0);
+    in->fd = STDIN_FILENO;
+    in->raw = 0;
+    if (tcgetattr(in->fd, &in->saved) == 0)
+    {
+        raw = in->saved;
+        raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+        raw.c_iflag &= ~(ICRNL | IXON); // Enter 를 13 으로 (Windows getch 와 같게), Ctrl+S/Q 도 키로
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        in->raw = tcsetattr(in->fd, TCSANOW, &raw) == 0;
+    }
+    return 1;
+#endif
+}
+
+static inline void key_close(struct key_input *in)
+{
+#ifdef _WIN32
+    SetConsoleMode(in->handle, in->saved_mode);
+#else
+    if (in->raw)
+        tcsetattr(in->fd, TCSANOW, &in->saved);
+    in->raw = 0;
+#endif
+}
+
+#ifdef _WIN32
+static inline int key_from_vk(WORD vk)
+{
+    switch (vk)
+    {
+    case VK_UP:
+        return KEY_UP;
+    case VK_DOWN:
+        return KEY_DOWN;
+    case VK_LEFT:
+        return KEY_LEFT;
+    case VK_RIGHT:
+        return KEY_RIGHT;
+    case VK_HOME:
+        return KEY_HOME;
+    case VK_END:
+        return KEY_END;
+    case VK_INSERT:
+        return KEY_INSERT;
+    case VK_DELETE:
+        return KEY_DELETE;
+    case VK_PRIOR:
+        return KEY_PAGE_UP;
+    case VK_NEXT:
+        return KEY_PAGE_DOWN;
+    }
+    if (vk >= VK_F1 && vk <= VK_F12)
+        return KEY_F1 + (vk - VK_F1);
+    return 0;
+}
+#endif
+
+// 키가 들어올 때까지 최대 timeout_ms 밀리초 기다린다 (음수면 무한정).
+// 들어온 키들을 out 에 최대 max 개 넣고 개수를 돌려준다. 시간이 다 되면 0, 입력이 끝났으면 -1.
+static inline int key_wait(struct key_input *in, struct key_event *out, int max, int timeout_ms)
+{
+    uint64_t start = key_now_us();
+    for (;;)
+    {
+        uint64_t now = key_now_us();
+        long long left = timeout_ms < 0 ? -1 : (long long)timeout_ms * 1000 - (long long)(now - start);
+        int n = 0;
+
+        if (max <= 0)
+            return 0;
+        n = key_decode_idle(&in->dec, now, out);
+        if (n > 0)
+            return n;
+        if (timeout_ms >= 0 && left <= 0)
+            return 0;
+        // ESC 를 받은 상태면 ESC 판단 시각까지만 잔다
+        if (in->dec.state == KS_ESC)
+        {
+            long long esc_left = (long long)KEY_ESC_TIMEOUT - (long long)(now - in->dec.esc_time);
+            if (left < 0 || esc_left < left)
+                left = esc_left < 0 ? 0 : esc_left;
+        }
+#ifdef _WIN32
+        {
+            INPUT_RECORD rec[64];
+            DWORD count = 0, i, r;
+            if (WaitForSingleObject(in->handle, left < 0 ? INFINITE : (DWORD)((left + 999) / 1000)) != WAIT_OBJECT_0)
+                continue;
+            if (!ReadConsoleInputA(in->handle, rec, max < 64 ? (DWORD)max : 64, &count))
+                return -1;
+            now = key_now_us();
+            for (i = 0; i < count && n < max; i++)
+            {
+                KEY_EVENT_RECORD *k = &rec[i].Event.KeyEvent;
+                int key, mod = 0;
+                if (rec[i].EventType != KEY_EVENT || !k->bKeyDown)
+                    continue;
+                key = key_from_vk(k->wVirtualKeyCode);
+                if (key == 0)
+                    key = (unsigned char)k->uChar.AsciiChar;
+                if (key == 0)
+                    continue; // Shift 같은 조합 키만 눌림
+                if (k->dwControlKeyState & SHIFT_PRESSED)
+                    mod |= KEY_MOD_SHIFT;
+                if (k->dwControlKeyState & (LEFT_ALT_PRESSED | RIGHT_ALT_PRESSED))
+                    mod |= KEY_MOD_ALT;
+                if (k->dwControlKeyState & (LEFT_CTRL_PRESSED | RIGHT_CTRL_PRESSED))
+                    mod |= KEY_MOD_CTRL;
+                // 키를 누르고 있어 반복 입력된 횟수만큼
+                for (r = 0; r < k->wRepeatCount && n < max; r++)
+                    n = key_emit(out, n, key, mod, now);
+            }
+        }
+#else
+        {
+            struct pollfd p;
+            unsigned char buf[256];
+            int got, room, ready;
+            p.fd = in->fd;
+            p.events = POLLIN;
+            p.revents = 0;
+            ready = poll(&p, 1, left < 0 ? -1 : (int)((left + 999) / 1000));
+            if (ready < 0 && errno != EINTR)
+                return -1; // 시그널이 아닌 오류는 다시 해도 같다
+            if (ready <= 0)
+                continue;
+            room = max - (in->dec.state == KS_ESC); // 남은 ESC 가 키 하나를 더 낼 수 있다
+            if (room < 1)
+                room = 1;
+            if (room > (int)sizeof(buf))
+                room = (int)sizeof(buf);
+            got = (int)read(in->fd, buf, (size_t)room);
+            if (got <= 0)
+                return -1;
+            n = key_decode(&in->dec, buf, got, key_now_us(), out, max);
+        }
+#endif
+        if (n > 0)
+            return n;
+    }
+}
+
+// 키 이름 (화면 표시용)
+static inline const char *key_name(int key)
+{
+    static const char *name[KEY_CODE_END - KEY_UP] = {
+        "UP", "DOWN", "LEFT", "RIGHT", "HOME", "END", "INSERT", "DELETE", "PAGE_UP", "PAGE_DOWN",
+        "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12"};
+    if (key >= KEY_UP && key < KEY_CODE_END)
+        return name[key - KEY_UP];
+    switch (key)
+    {
+    case KEY_ESC:
+        return "ESC";
+    case KEY_ENTER:
+        return "ENTER";
+    case KEY_TAB:
+        return "TAB";
+    case KEY_BACKSPACE:
+        return "BACKSPACE";
+    case KEY_SPACE:
+        return "SPACE";
+    }
+    return NULL;
+}
+
+#endif
@@ -0,0 +1,318 @@
+// 로또 번호 생성 (45개 중 6개)
+//
+// random3.c 는 뽑은 번호를 앞의 번호들과 모두 비교하고 겹치면 다시 뽑는다.
+// 여기서는 Floyd 표본 추출로 정확히 6번만 난수를 뽑는다.
+//   j = 40 ~ 45 에 대해 t 를 1 ~ j 중에서 뽑고, t 가 이미 뽑혔으면 j 를 대신 고른다.
+//   뽑힌 번호는 64비트 마스크의 비트로 표시하므로 "이미 뽑혔나" 가 비트 검사 한 번이다.
+// 마스크의 비트를 낮은 쪽부터 꺼내면 번호가 이미 정렬되어 나온다.
+// 직접 입력한 번호처럼 순서가 섞인 6개는 lotto_sort6 (분기 없는 정렬망)으로 정렬한다.
+//
+// lotto_batch 는 표 여러 장(6바이트씩)을 평평한 버퍼 하나에 여러 스레드로 채우고
+// 번호별로 몇 번 나왔는지 센다. k 번째 표는 seed 와 k 로만 정해지므로 스레드 수와 관계없이 같다.
+
+#ifndef LOTTO_H
+#define LOTTO_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define LOTTO_N 45
+#define LOTTO_K 6
+#define LOTTO_MAX_THREADS 64
+
+// splitmix64: 시드 하나로 서로 겹치지 않는 난수 상태를 만들 때 사용
+static inline uint64_t lotto_splitmix(uint64_t *s)
+{
+    uint64_t z = (*s += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// xorshift64*
+static inline uint32_t lotto_random(uint64_t *s)
+{
+    uint64_t x = *s;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *s = x;
+    return (uint32_t)((x * 0x2545f4914f6cdd1dULL) >> 32);
+}
+
+// 0 ~ n-1 의 치우치지 않은 난수 (Lemire 방식)
+static inline uint32_t lotto_bounded(uint64_t *s, uint32_t n)
+{
+    uint64_t m = (uint64_t)lotto_random(s) * n;
+    if ((uint32_t)m < n)
+    {
+        uint32_t threshold = (uint32_t)-n % n;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)lotto_random(s) * n;
+    }
+    return (uint32_t)(m >> 32);
+}
+
+static inline void lotto_seed(uint64_t *s, uint64_t seed)
+{
+    uint64_t t = seed;
+    *s = lotto_splitmix(&t) | 1; // xorshift 상태는 0이면 안 된다
+}
+
+// 가장 낮은 1비트의 위치
+static inline int lotto_ctz(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(v);
+#else
+    int n = 0;
+    while (!(v & 1))
+    {
+        v >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+static inline int lotto_popcount(uint64_t v)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(v);
+#else
+    int n = 0;
+    for (; v; v &= v - 1)
+        n++;
+    return n;
+#endif
+}
+
+// Floyd 표본 추출: 1 ~ 45 중 6개를 비트 마스크로 (비트 i = 번호 i)
+static inline uint64_t lotto_pick_mask(uint64_t *rng)
+{
+    uint64_t mask = 0;
+    uint32_t j;
+    for (j = LOTTO_N - LOTTO_K + 1; j <= LOTTO_N; j++)
+    {
+        uint32_t t = lotto_bounded(rng, j) + 1;
+        uint64_t bit = 1ULL << t;
+        // t 가 이미 있으면 j 를 고른다 (j 는 아직 나올 수 없던 번호라 항상 비어 있다)
+        mask |= (mask & bit) ? 1ULL << j : bit;
+    }
+    return mask;
+}
+
+// 뽑은 순서 그대로 6개 (정렬 안 됨)
+static inline void lotto_pick_unsorted(uint64_t *rng, unsigned char out[LOTTO_K])
+{
+    uint64_t mask = 0;
+    uint32_t j;
+    for (j = LOTTO_N - LOTTO_K + 1; j <= LOTTO_N; j++)
+    {
+        uint32_t t = lotto_bounded(rng, j) + 1;
+        uint32_t pick = (mask >> t & 1) ? j : t;
+        mask |= 1ULL << pick;
+        out[j - (LOTTO_N - LOTTO_K + 1)] = (unsigned char)pick;
+    }
+}
+
+// 마스크 -> 정렬된 번호 6개
+static inline void lotto_unpack(uint64_t mask, unsigned char out[LOTTO_K])
+{
+    int i;
+    for (i = 0; i < LOTTO_K; i++)
+    {
+        out[i] = (unsigned char)lotto_ctz(mask);
+        mask &= mask - 1;
+    }
+}
+
+static inline uint64_t lotto_mask(const unsigned char ticket[LOTTO_K])
+{
+    uint64_t mask = 0;
+    int i;
+    for (i = 0; i < LOTTO_K; i++)
+        mask |= 1ULL << ticket[i];
+    return mask;
+}
+
+// 정렬된 표 한 장
+static inline void lotto_pick(uint64_t *rng, unsigned char out[LOTTO_K])
+{
+    lotto_unpack(lotto_pick_mask(rng), out);
+}
+
+// 두 표에서 같은 번호 개수
+static inline int lotto_match(uint64_t a, uint64_t b)
+{
+    return lotto_popcount(a & b);
+}
+
+// 분기 없는 비교-교환: a 에 작은 값, b 에 큰 값
+#define LOTTO_CSWAP(v, a, b)                          \
+    {                                                 \
+        int lo_ = v[a] < v[b] ? v[a] : v[b];          \
+        int hi_ = v[a] ^ v[b] ^ lo_;                  \
+        v[a] = lo_;                                   \
+        v[b] = hi_;                                   \
+    }
+
+// 6개 정렬망 (비교-교환 12번, 입력과 관계없이 같은 순서로 실행)
+static inline void lotto_sort6(int v[LOTTO_K])
+{
+    LOTTO_CSWAP(v, 0, 5);
+    LOTTO_CSWAP(v, 1, 3);
+    LOTTO_CSWAP(v, 2, 4);
+    LOTTO_CSWAP(v, 1, 2);
+    LOTTO_CSWAP(v, 3, 4);
+    LOTTO_CSWAP(v, 0, 3);
+    LOTTO_CSWAP(v, 2, 5);
+    LOTTO_CSWAP(v, 0, 1);
+    LOTTO_CSWAP(v, 2, 3);
+    LOTTO_CSWAP(v, 4, 5);
+    LOTTO_CSWAP(v, 1, 2);
+    LOTTO_CSWAP(v, 3, 4);
+}
+
+// nCk
+static inline uint32_t lotto_binom(uint32_t n, uint32_t k)
+{
+    uint32_t r = 1, i;
+    if (k > n)
+        return 0;
+    for (i = 0; i < k; i++)
+        r = r * (n - i) / (i + 1); // 앞의 i+1 개 곱은 항상 (i+1)! 로 나누어떨어진다
+    return r;
+}
+
+// 정렬된 표 -> 조합 번호 0 ~ 8145059 (같은 조합이 몇 번 나왔는지 셀 때 배열 첨자로 사용)
+// 조합수 체계(combinadic): 번호 c_i (0부터) 에 대해 C(c_i, i+1) 의 합
+static inline uint32_t lotto_rank(const unsigned char ticket[LOTTO_K])
+{
+    uint32_t r = 0;
+    int i;
+    for (i = 0; i < LOTTO_K; i++)
+        r += lotto_binom(ticket[i] - 1, i + 1);
+    return r;
+}
+
+#define LOTTO_COMBINATIONS 8145060u
+
+// ---- 여러 장 한꺼번에 ----
+
+struct lotto_batch
+{
+    unsigned char *out; // 표 count 장 (6 * count 바이트), NULL 이면 통계만
+    long long first, count;
+    uint64_t seed;
+    long long freq[LOTTO_N + 1]; // 번호별 나온 횟수
+};
+
+static inline void lotto_batch_run(struct lotto_batch *b)
+{
+    uint64_t s = b->seed + (uint64_t)b->first * 0x9e3779b97f4a7c15ULL;
+    unsigned char ticket[LOTTO_K];
+    uint32_t freq[LOTTO_N + 1];
+    long long k;
+    int i;
+
+    memset(b->freq, 0, sizeof(b->freq));
+    memset(freq, 0, sizeof(freq));
+    for (k = 0; k < b->count; k++)
+    {
+        uint64_t rng = lotto_splitmix(&s) | 1;
+        unsigned char *t = b->out ? b->out + (b->first + k) * LOTTO_K : ticket;
+        lotto_pick(&rng, t);
+        for (i = 0; i < LOTTO_K; i++)
+            freq[t[i]]++;
+        // 32비트 카운터가 넘치기 전에 옮긴다
+        if ((k & 0xffffff) == 0xffffff)
+        {
+            for (i = 1; i <= LOTTO_N; i++)
+                b->freq[i] += freq[i];
+            memset(freq, 0, sizeof(freq));
+        }
+    }
+    for (i = 1; i <= LOTTO_N; i++)
+        b->freq[i] += freq[i];
+}
+
+#ifdef _WIN32
+static DWORD WINAPI lotto_batch_thread(LPVOID arg)
+{
+    lotto_batch_run((struct lotto_batch *)arg);
+    return 0;
+}
+#else
+static void *lotto_batch_thread(void *arg)
+{
+    lotto_batch_run((struct lotto_batch *)arg);
+    return NULL;
+}
+#endif
+
+// out 에 count 장을 채우고 (out 이 NULL 이면 버리고) 번호별 횟수를 freq[1..45] 에 돌려준다
+static inline void lotto_batch(unsigned char *out, long long count, uint64_t seed, int threads,
+                               long long freq[LOTTO_N + 1])
+{
+    struct lotto_batch job[LOTTO_MAX_THREADS];
+#ifdef _WIN32
+    HANDLE tid[LOTTO_MAX_THREADS];
+#else
+    pthread_t tid[LOTTO_MAX_THREADS];
+#endif
+    char started[LOTTO_MAX_THREADS];
+    long long per;
+    int t, i;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > LOTTO_MAX_THREADS)
+        threads = LOTTO_MAX_THREADS;
+    per = (count + threads - 1) / threads;
+
+    for (t = 0; t < threads; t++)
+    {
+        job[t].out = out;
+        job[t].first = per * t < count ? per * t : count;
+        job[t].count = job[t].first + per < count ? per : count - job[t].first;
+        job[t].seed = seed;
+    }
+    for (t = 1; t < threads; t++)
+    {
+#ifdef _WIN32
+        tid[t] = CreateThread(NULL, 0, lotto_batch_thread, &job[t], 0, NULL);
+        started[t] = tid[t] != NULL;
+#else
+        started[t] = pthread_create(&tid[t], NULL, lotto_batch_thread, &job[t]) == 0;
+#endif
+        if (!started[t])
+            lotto_batch_run(&job[t]); // 스레드를 못 만들면 호출한 스레드가 대신
+    }
+    lotto_batch_run(&job[0]);
+    for (t = 1; t < threads; t++)
+    {
+        if (!started[t])
+            continue;
+#ifdef _WIN32
+        WaitForSingleObject(tid[t], INFINITE);
+        CloseHandle(tid[t]);
+#else
+        pthread_join(tid[t], NULL);
+#endif
+    }
+    for (i = 0; i <= LOTTO_N; i++)
+    {
+        freq[i] = 0;
+        for (t = 0; t < threads; t++)
+            freq[i] += job[t].freq[i];
+    }
+}
+
+#endif
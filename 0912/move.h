@@ -0,0 +1,196 @@
+// 방향키로 위치 옮기기 (MoveCursor.c, 0926/SlideBar.c, 0926/TETRIS.c 공용)
+//
+// 예전 move_arrow_key() 는 getch() 한 번에 한 칸이라, 키를 누르고 있으면 운영체제의 자동 반복
+// 속도(초당 약 30번, 처음 0.5초 대기)로만 움직였다. 여기서는 테트리스에서 쓰는 DAS/ARR 방식으로 움직인다.
+//   누르는 순간 한 칸 -> das 동안 기다림 -> 그 뒤로 arr 마다 한 칸 (arr 이 0 이면 끝까지 한 번에)
+// 시간은 keyinput.h 의 키 시각(time_us)으로 잰다. 터미널은 키를 뗀 것을 알려 주지 않으므로,
+// 같은 방향키가 hold 시간 안의 간격으로 이어서(운영체제 자동 반복으로) 들어오면 누르고 있는 것으로 보고,
+// 더 오지 않으면 뗀 것으로 본다. 자동 이동(arr)이 시작되기 전에는 예전처럼 키 하나에 한 칸이다.
+// 그래서 자동 이동은 누른 뒤 das 가 지나고, 운영체제 자동 반복이 시작된 뒤에 시작한다.
+//
+// 움직일 때마다 이전 위치와 새 위치(struct move_result)를 돌려주므로 화면은 그 두 칸만 다시 그리면 된다.
+
+#ifndef MOVE_H
+#define MOVE_H
+
+#include "keyinput.h"
+
+#define MOVE_DAS_MS 170 // 자동 이동 시작까지
+#define MOVE_ARR_MS 30  // 자동 이동 간격
+#define MOVE_HOLD_MS 80   // 같은 키가 이 간격 안에 다시 오면 자동 반복 (운영체제 반복 간격은 30~40ms)
+#define MOVE_DELAY_MS 700 // 처음 누른 뒤 운영체제 자동 반복이 시작될 때까지 기다리는 시간
+
+struct mover
+{
+    int x, y; // 현재 위치
+    int x_min, y_min, x_max, y_max;
+    int dx, dy;      // 누르고 있는 방향 (0 이면 안 누름)
+    int steps;       // 이번에 누른 뒤 움직인 칸 수 (처음 한 칸 포함)
+    int taps;        // 자동 이동 전에 들어온 같은 방향키 수 (키 하나에 한 칸)
+    int repeating;   // 자동 반복 중
+    uint64_t down_us; // 처음 누른 시각
+    uint64_t last_us; // 마지막으로 키가 들어온 시각
+    uint64_t auto_us; // 자동 이동 시작 시각: 누른 뒤 das, 운영체제 자동 반복이 그보다 늦으면 그 시각
+    uint32_t das_us, arr_us, hold_us, delay_us;
+};
+
+struct move_result
+{
+    int old_x, old_y; // 지울 칸
+    int x, y;         // 새로 그릴 칸
+};
+
+static inline void mover_init(struct mover *m, int x, int y, int x_min, int y_min, int x_max, int y_max)
+{
+    memset(m, 0, sizeof(*m));
+    m->x = x;
+    m->y = y;
+    m->x_min = x_min;
+    m->y_min = y_min;
+    m->x_max = x_max;
+    m->y_max = y_max;
+    m->das_us = MOVE_DAS_MS * 1000;
+    m->arr_us = MOVE_ARR_MS * 1000;
+    m->hold_us = MOVE_HOLD_MS * 1000;
+    m->delay_us = MOVE_DELAY_MS * 1000;
+}
+
+// das, arr 바꾸기 (밀리초)
+static inline void mover_timing(struct mover *m, int das_ms, int arr_ms)
+{
+    m->das_us = (uint32_t)das_ms * 1000;
+    m->arr_us = (uint32_t)arr_ms * 1000;
+}
+
+// 게임이 위치를 직접 바꿨을 때 (예: 테트리스 블록이 벽이 아닌 다른 블록에 막힘)
+static inline void mover_set(struct mover *m, int x, int y)
+{
+    m->x = x;
+    m->y = y;
+}
+
+static inline int mover_clamp(int v, int lo, int hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+// 누른 뒤 t 까지 움직였어야 하는 칸 수
+static inline int mover_target_steps(const struct mover *m, uint64_t t)
+{
+    if (!m->repeating || t < m->auto_us)
+        return m->taps;
+    if (m->arr_us == 0)
+        return 1 << 20; // 끝까지
+    return m->taps + 1 + (int)((t - m->auto_us) / m->arr_us);
+}
+
+// 이 시각이 지나도록 같은 키가 오지 않으면 뗀 것
+static inline uint64_t mover_release_us(const struct mover *m)
+{
+    return m->last_us + (m->repeating ? m->hold_us : m->delay_us);
+}
+
+// steps 를 target 까지 늘리며 움직인다 (경계에서 멈춤)
+static inline void mover_advance(struct mover *m, int target)
+{
+    int n = target - m->steps;
+    if (n > 0)
+    {
+        m->steps = target;
+        m->x = mover_clamp(m->x + m->dx * n, m->x_min, m->x_max);
+        m->y = mover_clamp(m->y + m->dy * n, m->y_min, m->y_max);
+    }
+}
+
+static inline int move_changed(const struct move_result *r)
+{
+    return r->x != r->old_x || r->y != r->old_y;
+}
+
+// 시간 now 까지 자동 이동한다. 움직였으면 1 (r 에 이전/새 위치)
+static inline int mover_update(struct mover *m, uint64_t now, struct move_result *r)
+{
+    uint64_t release = mover_release_us(m);
+    r->old_x = m->x;
+    r->old_y = m->y;
+    if (m->dx != 0 || m->dy != 0)
+    {
+        // 뗀 것으로 보는 시각까지만 움직인다
+        mover_advance(m, mover_target_steps(m, now < release ? now : release));
+        if (now >= release)
+            m->dx = m->dy = 0; // 뗐음
+    }
+    r->x = m->x;
+    r->y = m->y;
+    return move_changed(r);
+}
+
+// 방향키이면 처리하고 1 (움직였는지는 move_changed(r)), 다른 키는 0
+static inline int mover_key(struct mover *m, const struct key_event *ev, struct move_result *r)
+{
+    int dx = 0, dy = 0, old_x = m->x, old_y = m->y;
+    switch (ev->key)
+    {
+    case KEY_UP:
+        dy = -1;
+        break;
+    case KEY_DOWN:
+        dy = 1;
+        break;
+    case KEY_LEFT:
+        dx = -1;
+        break;
+    case KEY_RIGHT:
+        dx = 1;
+        break;
+    default:
+        return 0;
+    }
+    // 앞서 누르던 키는 이 키 시각까지 움직인다
+    mover_update(m, ev->time_us, r);
+    if (dx == m->dx && dy == m->dy)
+    {
+        if (!m->repeating && ev->time_us - m->last_us <= m->hold_us)
+        {
+            // 짧은 간격으로 이어서 옴: 누르고 있음. 누른 뒤 das 가 지나면 arr 간격으로 움직인다
+            m->repeating = 1;
+            m->auto_us = m->down_us + m->das_us > ev->time_us ? m->down_us + m->das_us : ev->time_us;
+        }
+        if (!m->repeating || ev->time_us < m->auto_us)
+            m->taps++; // 그 전까지는 예전처럼 키 하나에 한 칸
+        m->last_us = ev->time_us;
+    }
+    else
+    {
+        // 새로 누름: 바로 한 칸
+        m->dx = dx;
+        m->dy = dy;
+        m->down_us = m->last_us = ev->time_us;
+        m->steps = 0;
+        m->taps = 1;
+        m->repeating = 0;
+    }
+    mover_advance(m, mover_target_steps(m, ev->time_us));
+    r->old_x = old_x;
+    r->old_y = old_y;
+    r->x = m->x;
+    r->y = m->y;
+    return 1;
+}
+
+// 다음 자동 이동까지 남은 시간 (key_wait 의 시간 제한으로 쓴다). 누르고 있지 않으면 -1
+static inline int mover_wait_ms(const struct mover *m, uint64_t now)
+{
+    uint64_t next, step;
+    if (m->dx == 0 && m->dy == 0)
+        return -1;
+    next = mover_release_us(m); // 같은 키가 더 오지 않으면 뗀 것으로 정리
+    if (m->repeating && m->arr_us > 0)
+    {
+        step = m->auto_us + (uint64_t)(m->steps - m->taps) * m->arr_us;
+        next = step < next ? step : next;
+    }
+    return next <= now ? 0 : (int)((next - now + 999) / 1000);
+}
+
+#endif
@@ -1,22 +1,14 @@
 #include <stdio.h>
-#include <stdlib.h>
 #include <time.h>
+#include "lotto.h"
 int main(void)
 {
-    int i, j, lotto[6];
-    srand(time(NULL));
-    for (i = 0; i <= 5; i++)
-    {
-        lotto[i] = rand() % 45 + 1;
-        for (j = 0; j < i; j++)
-        {
-            if (lotto[i] == lotto[j])
-            {
-                i--;
-                break;
-            }
-        }
-    }
+    int i;
+    unsigned char lotto[6];
+    uint64_t rng;
+    lotto_seed(&rng, (uint64_t)time(NULL));
+    // 겹치면 다시 뽑는 대신 Floyd 표본 추출로 6번만 뽑는다 (결과는 정렬되어 나온다)
+    lotto_pick(&rng, lotto);
     for (i = 0; i <= 5; i++)
         printf("%2d\n", lotto[i]);
     return 0;
@@ -1,39 +1,32 @@
 #include <stdio.h>
-#include <stdlib.h>
 #include <time.h>
+#include "lotto.h"
 void selection_sort(int r[], int n);
 int main(void)
 {
-    int i, j, lotto[6];
-    srand(time(NULL));
+    int i, lotto[6];
+    unsigned char picked[6];
+    uint64_t rng;
+    lotto_seed(&rng, (uint64_t)time(NULL));
+    lotto_pick_unsorted(&rng, picked);
     for (i = 0; i <= 5; i++)
-    {
-        lotto[i] = rand() % 45 + 1;
-        for (j = 0; j < i; j++)
-        {
-            if (lotto[i] == lotto[j])
-            {
-                i--;
-                break;
-            }
-        }
-    }
+        lotto[i] = picked[i];
     selection_sort(lotto, 6);
     return 0;
 }
 void selection_sort(int r[], int n)
 {
     int i, j, min, temp;
-    for (i = 0; i <= n; i++)
+    for (i = 0; i < n - 1; i++) // 마지막 칸은 자동으로 제자리 (i <= n 이면 배열 끝을 넘는다)
     {
         min = i;
-        for (j = i + 1; j <= n; j++)
+        for (j = i + 1; j < n; j++)
             if (r[j] < r[min])
                 min = j;
         temp = r[min];
         r[min] = r[i];
         r[i] = temp;
     }
-    for (i = 0; i <= 5; i++)
+    for (i = 0; i < n; i++)
         printf("%2d\n", r[i]);
-}
\ No newline at end of file
+}
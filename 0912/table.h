@@ -0,0 +1,157 @@
+// 표(격자) 출력: 한 화면을 버퍼 하나에 만들어 한 번에 쓴다
+//
+// bufferClear2.c, cursor2.c 는 구구단 한 줄마다 gotoxy + printf 를 불러서, 화면 하나에
+// 콘솔 호출이 수십 번 일어난다. 여기서는
+//   - 칸마다 내용(콜백)을 정해진 너비로 맞춰 미리 크기를 잡아 둔 버퍼에 이어 붙이고
+//   - 줄의 시작 위치는 ESC[행;열H 하나로 정하고 (줄 안에서는 공백으로 맞춤)
+//   - 화면 지우기(ESC[2J)까지 같은 버퍼에 넣어 한 화면을 fwrite 한 번으로 쓴다.
+// 파일에 쓰면 화면 없이 많은 페이지를 만들어 속도를 잴 수 있다 (TableBench.c).
+// Windows 콘솔에서는 term_init() 을 먼저 불러 ANSI 제어 문자열을 켠다.
+
+#ifndef TABLE_H
+#define TABLE_H
+
+#include <stdio.h>
+#include <string.h>
+#include "../0926/num_format.h"
+
+struct table_buf
+{
+    char *data;
+    size_t len, cap;
+    int full; // 공간이 모자라 버린 내용이 있음
+};
+
+// 칸의 내용을 out 에 쓰고 길이를 돌려준다 (width 보다 길면 잘린다)
+typedef int (*table_cell_fn)(char *out, int row, int col, void *ctx);
+
+struct table_layout
+{
+    int x, y;      // 왼쪽 위 (1부터). 0 이면 위치를 정하지 않고 줄마다 '\n'
+    int rows, cols;
+    int width;     // 칸 너비 (문자 수)
+    int gap;       // 칸 사이 공백
+    int row_step;  // 다음 줄까지 행 수 (1 이면 붙여서)
+};
+
+#define TABLE_CELL_MAX 64 // 칸 하나의 최대 길이
+#define TABLE_GOTO_MAX 16 // ESC[행;열H 최대 길이
+
+static inline void table_buf_init(struct table_buf *b, char *mem, size_t cap)
+{
+    b->data = mem;
+    b->cap = cap;
+    b->len = 0;
+    b->full = 0;
+}
+
+// 격자 하나에 필요한 최대 바이트 수 (버퍼 크기를 미리 잡을 때)
+static inline size_t table_size(const struct table_layout *t)
+{
+    return (size_t)t->rows * (TABLE_GOTO_MAX + (size_t)t->cols * ((size_t)t->width + t->gap));
+}
+
+static inline void table_put(struct table_buf *b, const char *s, size_t n)
+{
+    if (b->len + n > b->cap)
+    {
+        b->full = 1;
+        return;
+    }
+    memcpy(b->data + b->len, s, n);
+    b->len += n;
+}
+
+static inline void table_text(struct table_buf *b, const char *s)
+{
+    table_put(b, s, strlen(s));
+}
+
+static inline void table_spaces(struct table_buf *b, int n)
+{
+    if (n <= 0)
+        return;
+    if (b->len + (size_t)n > b->cap)
+    {
+        b->full = 1;
+        return;
+    }
+    memset(b->data + b->len, ' ', (size_t)n);
+    b->len += (size_t)n;
+}
+
+// 커서 이동 ESC[y;xH
+static inline void table_goto(struct table_buf *b, int x, int y)
+{
+    char s[TABLE_GOTO_MAX];
+    int n = 2;
+    s[0] = 0x1b;
+    s[1] = '[';
+    n += num_format_u32(s + n, (uint32_t)y);
+    s[n++] = ';';
+    n += num_format_u32(s + n, (uint32_t)x);
+    s[n++] = 'H';
+    table_put(b, s, (size_t)n);
+}
+
+// 화면 지우고 왼쪽 위로
+static inline void table_clear(struct table_buf *b)
+{
+    table_put(b, "\x1b[2J\x1b[H", 7);
+}
+
+// 격자 전체를 버퍼에 이어 붙인다
+static inline void table_grid(struct table_buf *b, const struct table_layout *t, table_cell_fn cell, void *ctx)
+{
+    char text[TABLE_CELL_MAX];
+    int r, c, n;
+    for (r = 0; r < t->rows; r++)
+    {
+        if (t->x > 0)
+            table_goto(b, t->x, t->y + r * t->row_step);
+        else if (r > 0)
+            table_put(b, "\n", 1);
+        for (c = 0; c < t->cols; c++)
+        {
+            n = cell(text, r, c, ctx);
+            if (n > t->width)
+                n = t->width;
+            table_put(b, text, (size_t)n);
+            if (c + 1 < t->cols) // 마지막 칸 뒤에는 채우지 않는다
+                table_spaces(b, t->width - n + t->gap);
+        }
+    }
+    if (t->x <= 0)
+        table_put(b, "\n", 1);
+}
+
+// 버퍼를 한 번에 쓰고 비운다. 쓴 바이트 수
+static inline size_t table_flush(struct table_buf *b, FILE *fp)
+{
+    size_t n = fwrite(b->data, 1, b->len, fp);
+    fflush(fp);
+    b->len = 0;
+    b->full = 0;
+    return n;
+}
+
+// ---- 구구단 칸 ----
+
+// "a*b=ab" : 행 = 곱하는 수(1~9), 열 = 단. ctx 가 있으면 int[2] {첫 단, 곱하는 수의 최소 칸 너비}
+static inline int table_times_cell(char *out, int row, int col, void *ctx)
+{
+    const int *opt = (const int *)ctx;
+    int dan = (opt ? opt[0] : 1) + col, i = row + 1, n = 0, w;
+    n += num_format_i32(out + n, dan);
+    out[n++] = '*';
+    n += num_format_i32(out + n, i);
+    out[n++] = '=';
+    w = num_count_u32((uint32_t)(dan * i));
+    // cursor2.c 의 %2d 처럼 곱의 너비를 맞춘다 (곱을 쓸 자리 NUM_FORMAT_MAX 는 남긴다: 끝의 '\0' 까지)
+    for (; opt && w < opt[1] && n < TABLE_CELL_MAX - NUM_FORMAT_MAX; w++)
+        out[n++] = ' ';
+    n += num_format_i32(out + n, dan * i);
+    return n;
+}
+
+#endif
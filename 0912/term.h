@@ -0,0 +1,103 @@
+// 화면 제어 (지우기, 창 크기, 커서 숨기기/보이기, 커서 이동)
+//
+// system("cls"), system("mode con: ...") 은 부를 때마다 cmd.exe 프로세스를 새로 띄운다.
+// (한 번에 수~수십 ms, Windows 전용) 여기서는 같은 일을 프로그램 안에서 바로 한다.
+//   Windows : 콘솔 API (FillConsoleOutputCharacter, SetConsoleScreenBufferSize ...)
+//   그 밖   : ANSI/VT 제어 문자열 (ESC[2J, ESC[8;행;열t, ESC[?25l ...)
+
+#ifndef TERM_H
+#define TERM_H
+
+#include <stdio.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// Windows 10 이상 콘솔에서 ANSI 제어 문자열도 쓸 수 있게 한다
+static inline void term_init(void)
+{
+#ifdef _WIN32
+    HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode;
+    if (GetConsoleMode(out, &mode))
+        SetConsoleMode(out, mode | 0x0004); // ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#endif
+}
+
+// 화면 전체를 지우고 커서를 왼쪽 위로
+static inline void term_clear(void)
+{
+#ifdef _WIN32
+    HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    COORD home = {0, 0};
+    DWORD cells, written;
+
+    fflush(stdout);
+    if (!GetConsoleScreenBufferInfo(out, &info))
+        return;
+    cells = (DWORD)info.dwSize.X * info.dwSize.Y;
+    FillConsoleOutputCharacterA(out, ' ', cells, home, &written);
+    FillConsoleOutputAttribute(out, info.wAttributes, cells, home, &written);
+    SetConsoleCursorPosition(out, home);
+#else
+    fputs("\x1b[2J\x1b[H", stdout);
+    fflush(stdout);
+#endif
+}
+
+// 창(화면 버퍼) 크기를 cols 열, lines 행으로
+static inline void term_resize(int cols, int lines)
+{
+#ifdef _WIN32
+    HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    SMALL_RECT window = {0, 0, 1, 1};
+    COORD size;
+
+    size.X = (SHORT)cols;
+    size.Y = (SHORT)lines;
+    // 버퍼는 창보다 작을 수 없으므로 창을 먼저 줄이고, 버퍼를 바꾼 다음 창을 키운다
+    SetConsoleWindowInfo(out, TRUE, &window);
+    SetConsoleScreenBufferSize(out, size);
+    window.Right = (SHORT)(cols - 1);
+    window.Bottom = (SHORT)(lines - 1);
+    SetConsoleWindowInfo(out, TRUE, &window);
+#else
+    printf("\x1b[8;%d;%dt", lines, cols);
+    fflush(stdout);
+#endif
+}
+
+// 커서 보이기(1) / 숨기기(0)
+static inline void term_cursor(int visible)
+{
+#ifdef _WIN32
+    HANDLE out = GetStdHandle(STD_OUTPUT_HANDLE);
+    CONSOLE_CURSOR_INFO info;
+    if (GetConsoleCursorInfo(out, &info))
+    {
+        info.bVisible = visible ? TRUE : FALSE;
+        SetConsoleCursorInfo(out, &info);
+    }
+#else
+    fputs(visible ? "\x1b[?25h" : "\x1b[?25l", stdout);
+    fflush(stdout);
+#endif
+}
+
+// 커서를 (x, y) 로 (1부터)
+static inline void term_goto(int x, int y)
+{
+#ifdef _WIN32
+    COORD pos;
+    fflush(stdout);
+    pos.X = (SHORT)(x - 1);
+    pos.Y = (SHORT)(y - 1);
+    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), pos);
+#else
+    printf("\x1b[%d;%dH", y, x);
+#endif
+}
+
+#endif
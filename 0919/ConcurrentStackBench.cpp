@@ -0,0 +1,133 @@
+// 여러 스레드에서 같은 스택에 push/pop 할 때의 처리량 비교
+//   뮤텍스 스택 / 락 프리 스택 / 락 프리 + 소거 백오프
+// 스레드 수 1 ~ 64 (또는 인수로 준 최대값) 에서 스레드마다 push, pop 을 번갈아 하고
+// 초당 연산 수(백만)를 출력한다. 먼저 값이 빠지거나 두 번 나오지 않는지 검사한다.
+// 컴파일 예: g++ -std=c++11 -O2 -pthread ConcurrentStackBench.cpp -o ConcurrentStackBench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "lockfree_stack.h"
+
+// 비교용: 뮤텍스 하나로 감싼 스택
+class MutexStack
+{
+public:
+    void push(const long long &value)
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        items_.push_back(value);
+    }
+
+    bool pop(long long &out)
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        if (items_.empty())
+            return false;
+        out = items_.back();
+        items_.pop_back();
+        return true;
+    }
+
+private:
+    std::mutex m_;
+    std::vector<long long> items_;
+};
+
+// 스레드 threads 개가 각각 ops 번 (push 1번 + pop 1번) 하는 시간 -> 초당 백만 연산
+template <typename S>
+double run(S &stack, int threads, long long ops)
+{
+    std::vector<std::thread> pool;
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+
+    for (int t = 0; t < threads; t++)
+    {
+        pool.push_back(std::thread([&, t]() {
+            long long v;
+            ready++;
+            while (!go.load())
+                std::this_thread::yield();
+            for (long long i = 0; i < ops; i++)
+            {
+                stack.push(i * threads + t);
+                stack.pop(v);
+            }
+        }));
+    }
+    while (ready.load() < threads)
+        std::this_thread::yield();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    go = true;
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].join();
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return 2.0 * ops * threads / sec / 1e6;
+}
+
+// 스레드마다 서로 다른 값을 넣고, 모든 값이 정확히 한 번씩 나오는지 확인
+bool check(LockFreeStack<long long> &stack, int threads, long long per_thread)
+{
+    std::vector<std::atomic<int> > seen(threads * per_thread);
+    std::vector<std::thread> pool;
+
+    for (size_t i = 0; i < seen.size(); i++)
+        seen[i].store(0);
+    for (int t = 0; t < threads; t++)
+    {
+        pool.push_back(std::thread([&, t]() {
+            long long v;
+            for (long long i = 0; i < per_thread; i++)
+            {
+                stack.push(t * per_thread + i);
+                if (i % 2 == 1 && stack.pop(v))
+                    seen[v]++;
+            }
+        }));
+    }
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].join();
+
+    long long v;
+    while (stack.pop(v))
+        seen[v]++;
+    for (size_t i = 0; i < seen.size(); i++)
+        if (seen[i].load() != 1)
+            return false;
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_threads = argc > 1 ? atoi(argv[1]) : 64;
+    long long total = 4000000; // 스레드 수와 상관없이 전체 push 횟수는 같게
+
+    {
+        LockFreeStack<long long> plain(0), elim;
+        if (!check(plain, 8, 200000) || !check(elim, 8, 200000))
+        {
+            printf("락 프리 스택 검사 실패: 값이 빠지거나 중복되었습니다.\n");
+            return 1;
+        }
+    }
+
+    printf("하드웨어 스레드: %u\n", std::thread::hardware_concurrency());
+    printf("%6s %14s %14s %14s  (백만 연산/초)\n", "스레드", "뮤텍스", "락프리", "락프리+소거");
+    for (int threads = 1; threads <= max_threads; threads *= 2)
+    {
+        MutexStack m;
+        LockFreeStack<long long> plain(0), elim;
+        long long ops = total / threads;
+        double a = run(m, threads, ops);
+        double b = run(plain, threads, ops);
+        double c = run(elim, threads, ops);
+        printf("%6d %14.2f %14.2f %14.2f\n", threads, a, b, c);
+    }
+    return 0;
+}
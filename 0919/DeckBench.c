@@ -0,0 +1,132 @@
+// 덱 섞기 검사와 속도 측정
+//  1) 여러 덱을 평평한 버퍼에 섞고 초당 덱 수를 잰다 (스레드 1개 / N개)
+//  2) 스레드 수가 달라도 같은 결과인지, 모든 덱이 52장 순열인지 확인
+//  3) 위치별 카드 분포의 카이제곱으로 기존 shuffle_card(rand() % 52 교환)의 치우침과 비교
+// 사용법: DeckBench [덱 수(백만)] [스레드 수]
+// 컴파일 예: gcc -O2 DeckBench.c -o DeckBench -pthread
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "card.h"
+
+#ifdef _WIN32
+double now_sec(void)
+{
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double)c.QuadPart / f.QuadPart;
+}
+#else
+double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+#endif
+
+// 기존 TrumpCatd.c 의 섞기: 모든 위치를 0 ~ 51 중 아무 곳과 교환
+void old_shuffle(unsigned char deck[])
+{
+    int i, rnd;
+    unsigned char temp;
+    for (i = 0; i < 52; i++)
+    {
+        rnd = rand() % 52;
+        temp = deck[i];
+        deck[i] = deck[rnd];
+        deck[rnd] = temp;
+    }
+}
+
+// 위치 x 카드 52x52 칸의 카이제곱 (고르면 자유도 2652 근처, 표준편차 약 73)
+double chi_square(long long count[52][52], long long decks)
+{
+    double expect = decks / 52.0, chi = 0;
+    int i, j;
+    for (i = 0; i < 52; i++)
+        for (j = 0; j < 52; j++)
+            chi += (count[i][j] - expect) * (count[i][j] - expect) / expect;
+    return chi;
+}
+
+int is_permutation(const unsigned char deck[])
+{
+    unsigned long long seen = 0;
+    int i;
+    for (i = 0; i < 52; i++)
+    {
+        if (deck[i] >= 52 || (seen >> deck[i] & 1))
+            return 0;
+        seen |= 1ULL << deck[i];
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    long long decks = (argc > 1 ? atoll(argv[1]) : 4) * 1000000LL;
+    int threads = argc > 2 ? atoi(argv[2]) : 8;
+    long long sample = decks < 1000000 ? decks : 1000000;
+    static long long count[52][52];
+    unsigned char *a, *b, deck[52];
+    double t;
+    long long k;
+    int i;
+
+    a = (unsigned char *)malloc((size_t)decks * CARD_COUNT);
+    b = (unsigned char *)malloc((size_t)decks * CARD_COUNT);
+    if (a == NULL || b == NULL)
+    {
+        printf("메모리가 부족합니다.\n");
+        return 1;
+    }
+
+    t = now_sec();
+    deck_shuffle_batch(a, decks, 2025, 1);
+    t = now_sec() - t;
+    printf("스레드  1개: %lld 덱 %.3f초, 초당 %.1f백만 덱\n", decks, t, decks / t / 1e6);
+
+    t = now_sec();
+    deck_shuffle_batch(b, decks, 2025, threads);
+    t = now_sec() - t;
+    printf("스레드 %2d개: %lld 덱 %.3f초, 초당 %.1f백만 덱\n", threads, decks, t, decks / t / 1e6);
+
+    if (memcmp(a, b, (size_t)decks * CARD_COUNT) != 0)
+    {
+        printf("실패: 스레드 수에 따라 결과가 다릅니다.\n");
+        return 1;
+    }
+    for (k = 0; k < decks; k++)
+    {
+        if (!is_permutation(a + k * CARD_COUNT))
+        {
+            printf("실패: %lld 번째 덱이 52장 순열이 아닙니다.\n", k);
+            return 1;
+        }
+    }
+    printf("스레드 수와 관계없이 같은 결과, 모든 덱이 올바른 순열\n\n");
+
+    for (k = 0; k < sample; k++)
+        for (i = 0; i < 52; i++)
+            count[i][a[k * CARD_COUNT + i]]++;
+    printf("카이제곱 (덱 %lld개, 기대값 약 2652 +- 73)\n", sample);
+    printf("  Fisher-Yates        : %.0f\n", chi_square(count, sample));
+
+    memset(count, 0, sizeof(count));
+    srand((unsigned)time(NULL));
+    for (k = 0; k < sample; k++)
+    {
+        deck_init(deck);
+        old_shuffle(deck);
+        for (i = 0; i < 52; i++)
+            count[i][deck[i]]++;
+    }
+    printf("  기존 rand() %% 52 교환: %.0f\n", chi_square(count, sample));
+
+    free(a);
+    free(b);
+    return 0;
+}
@@ -0,0 +1,198 @@
+// 보이스 믹서 오프라인 렌더링 벤치마크
+// Play_Song.c 의 학교종 멜로디와 64보이스 스트레스 악보를 소리 없이 버퍼에 렌더링하고
+// 기준(스칼라) 경로와 SIMD 경로의 속도(실시간 대비 배수)와 출력 차이를 비교한다.
+// 컴파일 예: gcc -O2 -mavx2 MixerBench.c -o MixerBench (SSE2 는 x64 기본)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "note_table.h"
+#include "voice_mixer.h"
+
+#define SAMPLE_RATE 44100
+#define BLOCK 256        // 한 번에 믹싱하는 샘플 수 (음 시작은 블록 단위로 맞춘다)
+#define MAX_VOICES 128
+#define ATTACK 441       // 10ms
+#define RELEASE 6615     // 150ms, 다음 음과 겹치게 된다
+
+struct note_event
+{
+    int start;  // 시작 샘플
+    int length; // 누르고 있는 샘플 수 (릴리즈 제외)
+    float freq;
+    float gain;
+};
+
+typedef void (*mix_func)(float out[], int frames, struct voice v[], int count);
+
+int make_song(struct note_event ev[]);
+int make_stress(struct note_event ev[], int seconds);
+float env_at(int t, int length);
+float render(struct note_event ev[], int count, float out[], int frames, mix_func mix);
+double bench(const char *name, struct note_event ev[], int count, int frames, int repeat);
+
+int index_table[] = {0, 2, 4, 5, 7, 9, 11, 12};
+
+int main(void)
+{
+    static struct note_event ev[4096];
+    int count, frames;
+
+#if defined(__AVX2__)
+    printf("SIMD 경로: AVX2 (8샘플)\n");
+#elif defined(__SSE2__) || defined(_M_X64)
+    printf("SIMD 경로: SSE2 (4샘플)\n");
+#else
+    printf("SIMD 경로: 없음 (스칼라)\n");
+#endif
+    printf("허용 오차: 샘플당 %g x (gain 합)\n\n", MIX_TOLERANCE);
+
+    count = make_song(ev);
+    frames = ev[count - 1].start + ev[count - 1].length + RELEASE;
+    if (bench("학교종이 땡땡땡", ev, count, frames, 20) < 0)
+        return 1;
+
+    count = make_stress(ev, 30);
+    frames = 30 * SAMPLE_RATE;
+    if (bench("64보이스 스트레스", ev, count, frames, 1) < 0)
+        return 1;
+
+    return 0;
+}
+
+// Play_Song.c 와 같은 멜로디: 한 박자 400ms + 음 사이 간격 50ms
+int make_song(struct note_event ev[])
+{
+    int song[] = {
+        0, 0, 4, 4, 5, 5, 4,
+        3, 3, 2, 2, 1, 1, 0,
+        4, 4, 3, 3, 2, 2, 1,
+        4, 4, 3, 3, 2, 2, 1,
+        0, 0, 4, 4, 5, 5, 4,
+        3, 3, 2, 2, 1, 1, 0};
+    int length = sizeof(song) / sizeof(song[0]);
+    int beat = 400 * SAMPLE_RATE / 1000;
+    int gap = 50 * SAMPLE_RATE / 1000;
+    int i;
+
+    for (i = 0; i < length; i++)
+    {
+        ev[i].start = i * (beat + gap);
+        ev[i].length = beat;
+        ev[i].freq = (float)note_freq[NOTE_NUMBER(4, index_table[song[i]])];
+        ev[i].gain = 0.5f;
+    }
+    return length;
+}
+
+// 8옥타브 x 8음 = 64개의 음을 조금씩 어긋나게 시작해서 끝까지 유지
+int make_stress(struct note_event ev[], int seconds)
+{
+    int i;
+    for (i = 0; i < 64; i++)
+    {
+        ev[i].start = i * BLOCK;
+        ev[i].length = seconds * SAMPLE_RATE - ev[i].start - RELEASE;
+        ev[i].freq = (float)note_freq[NOTE_NUMBER(i / 8, index_table[i % 8])];
+        ev[i].gain = 1.0f / 64;
+    }
+    return 64;
+}
+
+// 음 시작 후 t 샘플 시점의 엔벨로프 (어택 -> 유지 -> 릴리즈)
+float env_at(int t, int length)
+{
+    if (t < ATTACK)
+        return (float)t / ATTACK;
+    if (t < length)
+        return 1.0f;
+    if (t < length + RELEASE)
+        return 1.0f - (float)(t - length) / RELEASE;
+    return 0.0f;
+}
+
+// 악보 전체를 out 에 렌더링하고, 동시에 울린 보이스의 gain 합 최대값을 돌려준다
+float render(struct note_event ev[], int count, float out[], int frames, mix_func mix)
+{
+    struct voice v[MAX_VOICES];
+    int owner[MAX_VOICES]; // 보이스가 연주 중인 음 번호
+    int active = 0, next = 0, pos, n;
+    float max_gain = 0;
+
+    memset(out, 0, sizeof(float) * frames);
+    for (pos = 0; pos < frames; pos += BLOCK)
+    {
+        int len = frames - pos < BLOCK ? frames - pos : BLOCK;
+        float gain_sum = 0;
+
+        // 이 블록에서 시작하는 음을 보이스로 등록
+        while (next < count && ev[next].start < pos + len && active < MAX_VOICES)
+        {
+            v[active].phase = 0;
+            v[active].inc = ev[next].freq / SAMPLE_RATE;
+            v[active].gain = ev[next].gain;
+            owner[active++] = next++;
+        }
+
+        // 블록 안의 엔벨로프를 직선으로 근사하고, 끝난 보이스는 뒤의 것으로 덮어쓴다
+        for (n = 0; n < active; n++)
+        {
+            struct note_event *e = &ev[owner[n]];
+            int t = pos - e->start;
+            if (t >= e->length + RELEASE)
+            {
+                active--;
+                v[n] = v[active];
+                owner[n] = owner[active];
+                n--;
+                continue;
+            }
+            v[n].env = env_at(t, e->length);
+            v[n].env_step = (env_at(t + len, e->length) - v[n].env) / len;
+            gain_sum += v[n].gain;
+        }
+        if (gain_sum > max_gain)
+            max_gain = gain_sum;
+
+        mix(out + pos, len, v, active);
+    }
+    return max_gain;
+}
+
+// 스칼라와 SIMD 경로로 각각 repeat 번 렌더링하고 결과를 비교한다
+double bench(const char *name, struct note_event ev[], int count, int frames, int repeat)
+{
+    float *ref = (float *)malloc(sizeof(float) * frames);
+    float *out = (float *)malloc(sizeof(float) * frames);
+    double audio_sec = (double)frames / SAMPLE_RATE * repeat;
+    double t_scalar, t_simd, max_diff = 0;
+    float max_gain = 0;
+    clock_t start;
+    int i;
+
+    start = clock();
+    for (i = 0; i < repeat; i++)
+        max_gain = render(ev, count, ref, frames, mix_voices_scalar);
+    t_scalar = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (i = 0; i < repeat; i++)
+        render(ev, count, out, frames, mix_voices);
+    t_simd = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    for (i = 0; i < frames; i++)
+        if (fabs(out[i] - ref[i]) > max_diff)
+            max_diff = fabs(out[i] - ref[i]);
+
+    printf("=== %s (%d음, %.1f초 x %d회) ===\n", name, count, (double)frames / SAMPLE_RATE, repeat);
+    printf("스칼라: %8.3f초  실시간의 %8.1f배\n", t_scalar, audio_sec / (t_scalar > 0 ? t_scalar : 1e-9));
+    printf("SIMD  : %8.3f초  실시간의 %8.1f배\n", t_simd, audio_sec / (t_simd > 0 ? t_simd : 1e-9));
+    printf("최대 오차: %g (허용 %g) -> %s\n\n", max_diff, MIX_TOLERANCE * max_gain,
+           max_diff <= MIX_TOLERANCE * max_gain ? "통과" : "실패");
+
+    free(ref);
+    free(out);
+    return max_diff <= MIX_TOLERANCE * max_gain ? max_diff : -1;
+}
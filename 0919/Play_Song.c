@@ -1,15 +1,49 @@
 #include <stdio.h>
-#include <math.h>
 #include <conio.h>
 #include <windows.h>
+#include "note_table.h"
+#include "score.h"
 
 // 음계 index (도, 레, 미, 파, 솔, 라, 시, 도)
 int index_table[] = {0, 2, 4, 5, 7, 9, 11, 12};
 
-// 주파수 계산 함수
+// 학교종이 땡땡땡 악보 (score.h 형식, 템포 150 = 한 박자 400ms)
+const unsigned char school_bell[] = {
+    'S', 'O', 'N', 'G', SCORE_VERSION, 1, 150, 0, 1, 0, 0, 0,
+    20, 0, 0, 0, 84, 0, 0, 0, // 트랙 0: 20번째 바이트부터 42음 x 2바이트
+    60, 1, 60, 1, 67, 1, 67, 1, 69, 1, 69, 1, 67, 1, // 도도솔솔라라솔
+    65, 1, 65, 1, 64, 1, 64, 1, 62, 1, 62, 1, 60, 1, // 파파미미레레도
+    67, 1, 67, 1, 65, 1, 65, 1, 64, 1, 64, 1, 62, 1, // 솔솔파파미미레
+    67, 1, 67, 1, 65, 1, 65, 1, 64, 1, 64, 1, 62, 1, // 솔솔파파미미레
+    60, 1, 60, 1, 67, 1, 67, 1, 69, 1, 69, 1, 67, 1, // 도도솔솔라라솔
+    65, 1, 65, 1, 64, 1, 64, 1, 62, 1, 62, 1, 60, 1  // 파파미미레레도
+};
+
+// 주파수 계산 함수 (미리 계산된 표에서 찾기)
 double calc_frequency(int octave, int index)
 {
-    return 440.0 * pow(2.0, (index - 9 + (octave - 4) * 12) / 12.0);
+    return note_freq[NOTE_NUMBER(octave, index)];
+}
+
+// 악보의 한 트랙을 Beep 으로 연주
+void play_score(struct score *s, int track)
+{
+    struct score_cursor cursor;
+    struct score_event ev;
+
+    if (score_track(s, track, &cursor) != 0)
+    {
+        printf("없는 트랙입니다.\n");
+        return;
+    }
+    while (score_next(&cursor, &ev))
+    {
+        if (ev.note < 0)
+            Sleep(ev.ms); // 쉼표
+        else
+            Beep((int)note_freq[ev.note], ev.ms);
+        Sleep(50); // 음 사이 간격
+    }
 }
 
 // 직접 연주 모드
@@ -39,32 +73,38 @@ void practice_piano(void)
 // 학교종이 땡땡땡 자동 연주
 void play_song(void)
 {
-    int freq[8], i;
-    for (i = 0; i < 8; i++)
-    {
-        freq[i] = (int)calc_frequency(4, index_table[i]);
-    }
+    struct score s;
+    score_from_memory(&s, school_bell, sizeof(school_bell));
 
-    int beat = 400; // 한 박자(ms)
+    printf("🔔 학교종이 땡땡땡 자동 연주 시작!\n");
+    play_score(&s, 0);
+    printf("✅ 연주 완료!\n");
+}
 
-    // 도=0, 레=1, 미=2, 파=3, 솔=4, 라=5, 시=6, 도=7
-    int song[] = {
-        0, 0, 4, 4, 5, 5, 4, // 도도솔솔라라솔
-        3, 3, 2, 2, 1, 1, 0, // 파파미미레레도
-        4, 4, 3, 3, 2, 2, 1, // 솔솔파파미미레
-        4, 4, 3, 3, 2, 2, 1, // 솔솔파파미미레
-        0, 0, 4, 4, 5, 5, 4, // 도도솔솔라라솔
-        3, 3, 2, 2, 1, 1, 0  // 파파미미레레도
-    };
-    int length = sizeof(song) / sizeof(song[0]);
+// 악보 파일 자동 연주
+void play_file(void)
+{
+    struct score s;
+    char path[260];
+    int track = 0;
 
-    printf("🔔 학교종이 땡땡땡 자동 연주 시작!\n");
-    for (i = 0; i < length; i++)
+    printf("악보 파일 이름: ");
+    scanf("%259s", path);
+    if (score_open(&s, path) != 0)
     {
-        Beep(freq[song[i]], beat);
-        Sleep(50); // 음 사이 간격
+        printf("악보 파일을 열 수 없습니다.\n");
+        return;
+    }
+    if (s.tracks > 1)
+    {
+        printf("연주할 트랙 (0~%d): ", s.tracks - 1);
+        scanf("%d", &track);
     }
+
+    printf("🎼 %s 연주 시작! (템포 %d)\n", path, s.tempo);
+    play_score(&s, track);
     printf("✅ 연주 완료!\n");
+    score_close(&s);
 }
 
 int main(void)
@@ -76,7 +116,8 @@ int main(void)
         printf("\n=== 메뉴 선택 ===\n");
         printf("1. 직접 연주 모드\n");
         printf("2. 학교종이 땡땡땡 자동 연주\n");
-        printf("3. 종료\n");
+        printf("3. 악보 파일 연주\n");
+        printf("4. 종료\n");
         printf("선택: ");
         scanf("%d", &menu);
 
@@ -89,6 +130,10 @@ int main(void)
             play_song();
         }
         else if (menu == 3)
+        {
+            play_file();
+        }
+        else if (menu == 4)
         {
             break;
         }
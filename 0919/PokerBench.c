@@ -0,0 +1,189 @@
+// 포커 족보 판정 검사와 속도 측정
+//  1) 5장 조합 2,598,960 가지를 모두 판정해 족보별 개수와 7462 등급을 확인
+//  2) 7장 판정이 21가지 5장 조합 중 최고값과 같은지 무작위로 확인
+//     (인수에 all 을 주면 7장 조합 133,784,560 가지를 모두 판정해 족보별 개수 확인)
+//  3) 판정 속도 (초당 패 수)와 AA 대 KK 프리플랍 승률 계산 속도 (초당 보드 수)
+// 사용법: PokerBench [스레드 수] [all]
+// 컴파일 예: gcc -O2 PokerBench.c -o PokerBench -pthread
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "poker.h"
+
+#ifdef _WIN32
+double now_sec(void)
+{
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double)c.QuadPart / f.QuadPart;
+}
+#else
+double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+#endif
+
+int check_five(void);
+int check_seven_sampled(long long n);
+int check_seven_all(void);
+int best_of_21(const unsigned char c[7]);
+
+int main(int argc, char *argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 8;
+    struct poker_equity e;
+    double t;
+
+    if (!check_five() || !check_seven_sampled(1000000))
+        return 1;
+    if (argc > 2 && strcmp(argv[2], "all") == 0 && !check_seven_all())
+        return 1;
+
+    // AA(♠A ♥A) 대 KK(◆K ♣K), 보드 5장 무작위 (정답 약 81%)
+    memset(&e, 0, sizeof(e));
+    e.hero[0] = CARD_MAKE(0, 1);
+    e.hero[1] = CARD_MAKE(2, 1);
+    e.villain[0] = CARD_MAKE(1, 13);
+    e.villain[1] = CARD_MAKE(3, 13);
+    e.has_villain = 1;
+    e.trials = 10000000;
+    e.seed = 2025;
+
+    t = now_sec();
+    poker_equity(&e, threads);
+    t = now_sec() - t;
+    printf("\nAA 대 KK 승률 (%d 스레드): 승 %.2f%% 무 %.2f%% 패 %.2f%%\n", threads,
+           100.0 * e.win / e.trials, 100.0 * e.tie / e.trials, 100.0 * e.lose / e.trials);
+    printf("보드 %lld개 %.3f초, 초당 %.1f백만 보드 (7장 판정 2번씩)\n", e.trials, t, e.trials / t / 1e6);
+    return 0;
+}
+
+// 5장 조합 전부: 족보별 개수와 서로 다른 값이 7462 가지인지
+int check_five(void)
+{
+    static const long long expect[9] = {1302540, 1098240, 123552, 54912, 10200, 5108, 3744, 624, 40};
+    static char seen[7463];
+    long long count[9] = {0}, total = 0;
+    unsigned char c[5];
+    int a, b, d, e, f, k, distinct = 0;
+    double t = now_sec();
+
+    for (a = 0; a < 48; a++)
+        for (b = a + 1; b < 49; b++)
+            for (d = b + 1; d < 50; d++)
+                for (e = d + 1; e < 51; e++)
+                    for (f = e + 1; f < 52; f++)
+                    {
+                        int v;
+                        c[0] = a, c[1] = b, c[2] = d, c[3] = e, c[4] = f;
+                        v = poker_eval5(c);
+                        count[poker_category_of(v)]++;
+                        seen[v] = 1;
+                        total++;
+                    }
+    t = now_sec() - t;
+
+    printf("5장 조합 %lld 가지: %.3f초, 초당 %.1f백만 패\n", total, t, total / t / 1e6);
+    for (k = 8; k >= 0; k--)
+    {
+        printf("  %-18s %9lld %s\n", poker_category_name((enum poker_category)k), count[k],
+               count[k] == expect[k] ? "" : "<- 틀림");
+        if (count[k] != expect[k])
+            return 0;
+    }
+    for (k = 1; k <= 7462; k++)
+        distinct += seen[k];
+    printf("  서로 다른 족보 값 %d 가지\n", distinct);
+    return distinct == 7462;
+}
+
+int best_of_21(const unsigned char c[7])
+{
+    unsigned char h[5];
+    int best = 7463, i, j, k, n;
+    for (i = 0; i < 7; i++)
+        for (j = i + 1; j < 7; j++)
+        {
+            int v;
+            for (k = 0, n = 0; k < 7; k++)
+                if (k != i && k != j)
+                    h[n++] = c[k];
+            v = poker_eval5(h);
+            if (v < best)
+                best = v;
+        }
+    return best;
+}
+
+// 무작위 7장 n 개: poker_eval7 == 21가지 5장 중 최고값, 그리고 7장 판정 속도
+int check_seven_sampled(long long n)
+{
+    unsigned char *hands = (unsigned char *)malloc((size_t)n * 7), deck[52];
+    uint64_t rng;
+    long long k, sum = 0;
+    double t;
+
+    card_seed(&rng, 7);
+    for (k = 0; k < n; k++)
+    {
+        deck_init(deck);
+        deck_shuffle(deck, 52, &rng);
+        memcpy(hands + k * 7, deck, 7);
+        if (poker_eval7(deck) != best_of_21(deck))
+        {
+            printf("7장 판정이 틀렸습니다 (%lld 번째)\n", k);
+            free(hands);
+            return 0;
+        }
+    }
+
+    t = now_sec();
+    for (k = 0; k < n; k++)
+        sum += poker_eval7(hands + k * 7);
+    t = now_sec() - t;
+    printf("무작위 7장 %lld 개: 21조합 최고값과 일치, 초당 %.1f백만 패 (합 %lld)\n", n, n / t / 1e6, sum);
+    free(hands);
+    return 1;
+}
+
+// 7장 조합 전부 (133,784,560 가지)
+int check_seven_all(void)
+{
+    static const long long expect[9] = {23294460, 58627800, 31433400, 6461620, 6180020,
+                                        4047644, 3473184, 224848, 41584};
+    long long count[9] = {0}, total = 0;
+    unsigned char c[7];
+    int a, b, d, e, f, g, h, k;
+    double t = now_sec();
+
+    for (a = 0; a < 46; a++)
+        for (b = a + 1; b < 47; b++)
+            for (d = b + 1; d < 48; d++)
+                for (e = d + 1; e < 49; e++)
+                    for (f = e + 1; f < 50; f++)
+                        for (g = f + 1; g < 51; g++)
+                            for (h = g + 1; h < 52; h++)
+                            {
+                                c[0] = a, c[1] = b, c[2] = d, c[3] = e;
+                                c[4] = f, c[5] = g, c[6] = h;
+                                count[poker_category_of(poker_eval7(c))]++;
+                                total++;
+                            }
+    t = now_sec() - t;
+
+    printf("7장 조합 %lld 가지: %.3f초, 초당 %.1f백만 패\n", total, t, total / t / 1e6);
+    for (k = 8; k >= 0; k--)
+    {
+        printf("  %-18s %9lld %s\n", poker_category_name((enum poker_category)k), count[k],
+               count[k] == expect[k] ? "" : "<- 틀림");
+        if (count[k] != expect[k])
+            return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,275 @@
+// 포커 족보 표 생성기 -> poker_tables.h
+//
+// 빌드할 때 한 번 실행해서 표를 헤더로 만들어 두면 poker.h 는 실행 중에 표를 만들지 않는다.
+//   gcc -O2 PokerTableGen.c -o PokerTableGen && PokerTableGen > poker_tables.h
+//
+// 족보 값은 Cactus Kev 방식: 5장 조합의 7462 가지 등급을 1(로열 스트레이트 플러시)부터
+// 7462(7-5-4-3-2 하이카드)까지 번호로 매긴다. 작을수록 강하다.
+//
+// 만드는 표
+//   poker_flush[8192]     : 같은 모양 카드들의 숫자 비트(13비트) -> 가장 좋은 5장 값 (5~7비트)
+//   poker_noflush5[6175]  : 숫자별 장수(0~4) 13자리 5진수의 완전 해시 -> 값 (5장)
+//   poker_noflush7[49205] : 같은 방식 (7장, 가장 좋은 5장)
+//   poker_dp[5][13][8]    : 완전 해시 계산용 표
+// 숫자 번호는 0=2, 1=3, ..., 8=10, 9=J, 10=Q, 11=K, 12=A
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RANKS 13
+#define CLASSES 7462
+
+long long ways[RANKS + 1][8]; // ways[n][k]: 숫자 n 개에 장수(0~4)를 나눠 합이 k 인 경우의 수
+int dp[5][RANKS][8];
+long long keys[CLASSES + 100];
+int key_count = 0;
+
+unsigned short flush_table[8192];
+unsigned short noflush5[6175];
+unsigned short noflush7[49205];
+
+// 완전 해시: 장수 배열 q 를 합이 k 인 모든 배열 중 사전순 번호로
+int hash_quinary(const int q[], int k)
+{
+    int sum = 0, i;
+    for (i = 0; i < RANKS; i++)
+    {
+        sum += dp[q[i]][RANKS - i - 1][k];
+        k -= q[i];
+        if (k <= 0)
+            break;
+    }
+    return sum;
+}
+
+void make_dp(void)
+{
+    int n, k, v, q;
+    ways[0][0] = 1;
+    for (n = 1; n <= RANKS; n++)
+        for (k = 0; k < 8; k++)
+            for (v = 0; v <= 4 && v <= k; v++)
+                ways[n][k] += ways[n - 1][k - v];
+    for (q = 0; q < 5; q++)
+        for (n = 0; n < RANKS; n++)
+            for (k = 0; k < 8; k++)
+            {
+                dp[q][n][k] = 0;
+                for (v = 0; v < q && v <= k; v++)
+                    dp[q][n][k] += (int)ways[n][k - v];
+            }
+}
+
+// 5장(숫자별 장수 q, 플러시 여부)의 비교용 키. 클수록 강하다.
+long long hand_key(const int q[], int flush)
+{
+    int order[5], n = 0, c, r, i, straight = -1, category;
+    long long key;
+
+    // 장수가 많은 순, 같으면 높은 숫자 순으로 나열
+    for (c = 4; c >= 1; c--)
+        for (r = RANKS - 1; r >= 0; r--)
+            if (q[r] == c)
+                order[n++] = r;
+
+    if (n == 5)
+    {
+        for (r = RANKS - 1; r >= 4; r--)
+            if (q[r] && q[r - 1] && q[r - 2] && q[r - 3] && q[r - 4])
+            {
+                straight = r;
+                break;
+            }
+        if (straight < 0 && q[12] && q[0] && q[1] && q[2] && q[3])
+            straight = 3; // A-2-3-4-5 (5 하이)
+    }
+
+    if (straight >= 0 && flush)
+        category = 8;
+    else if (q[order[0]] == 4)
+        category = 7;
+    else if (q[order[0]] == 3 && q[order[1]] == 2)
+        category = 6;
+    else if (flush)
+        category = 5;
+    else if (straight >= 0)
+        category = 4;
+    else if (q[order[0]] == 3)
+        category = 3;
+    else if (q[order[0]] == 2 && q[order[1]] == 2)
+        category = 2;
+    else if (q[order[0]] == 2)
+        category = 1;
+    else
+        category = 0;
+
+    key = category;
+    if (category == 8 || category == 4)
+        return key * 371293 + straight;
+    for (i = 0; i < n; i++)
+        key = key * 13 + order[i];
+    for (; i < 5; i++)
+        key = key * 13;
+    return key;
+}
+
+int class_of(long long key)
+{
+    int lo = 0, hi = key_count - 1;
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (keys[mid] == key)
+            return mid + 1;
+        if (keys[mid] > key)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    fprintf(stderr, "없는 키 %lld\n", key);
+    exit(1);
+}
+
+int compare_desc(const void *a, const void *b)
+{
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+// 장수 배열 q (합 total) 에서 5장을 고르는 모든 경우 중 가장 좋은 값
+int best_of(int q[], int r, int left, int sub[])
+{
+    int best = CLASSES + 1, v, s;
+    if (left == 0)
+        return class_of(hand_key(sub, 0));
+    if (r == RANKS)
+        return best;
+    for (v = q[r] < left ? q[r] : left; v >= 0; v--)
+    {
+        sub[r] = v;
+        s = best_of(q, r + 1, left - v, sub);
+        if (s < best)
+            best = s;
+    }
+    sub[r] = 0;
+    return best;
+}
+
+// 합이 total 인 모든 장수 배열을 돌면서 f 호출
+void each_quinary(int q[], int r, int left, void (*f)(int q[], int total), int total)
+{
+    int v;
+    if (r == RANKS)
+    {
+        if (left == 0)
+            f(q, total);
+        return;
+    }
+    for (v = 0; v <= 4 && v <= left; v++)
+    {
+        q[r] = v;
+        each_quinary(q, r + 1, left - v, f, total);
+    }
+    q[r] = 0;
+}
+
+void collect(int q[], int total)
+{
+    int r, distinct = 0;
+    (void)total;
+    keys[key_count++] = hand_key(q, 0);
+    for (r = 0; r < RANKS; r++)
+        distinct += q[r] == 1;
+    if (distinct == 5)
+        keys[key_count++] = hand_key(q, 1);
+}
+
+void fill_noflush(int q[], int total)
+{
+    int sub[RANKS] = {0};
+    if (total == 5)
+        noflush5[hash_quinary(q, 5)] = (unsigned short)class_of(hand_key(q, 0));
+    else
+        noflush7[hash_quinary(q, 7)] = (unsigned short)best_of(q, 0, 5, sub);
+}
+
+void fill_flush(void)
+{
+    int mask, r, bits, q[RANKS];
+    for (mask = 0; mask < 8192; mask++)
+    {
+        int best = 0;
+        for (r = 0, bits = 0; r < RANKS; r++)
+            bits += mask >> r & 1;
+        if (bits < 5 || bits > 7)
+            continue;
+        // 5비트짜리 부분 집합 중 가장 좋은 것
+        {
+            int sub;
+            best = CLASSES + 1;
+            for (sub = mask; sub > 0; sub = (sub - 1) & mask)
+            {
+                int n = 0, v;
+                for (r = 0; r < RANKS; r++)
+                {
+                    q[r] = sub >> r & 1;
+                    n += q[r];
+                }
+                if (n != 5)
+                    continue;
+                v = class_of(hand_key(q, 1));
+                if (v < best)
+                    best = v;
+            }
+        }
+        flush_table[mask] = (unsigned short)best;
+    }
+}
+
+void print_table(const char *decl, const unsigned short t[], int n)
+{
+    int i;
+    printf("static const unsigned short %s = {\n", decl);
+    for (i = 0; i < n; i++)
+        printf("%s%d%s", i % 16 == 0 ? "    " : "", t[i], i == n - 1 ? "\n" : (i % 16 == 15 ? ",\n" : ", "));
+    printf("};\n\n");
+}
+
+int main(void)
+{
+    int q[RANKS] = {0}, a, b, c;
+
+    make_dp();
+    each_quinary(q, 0, 5, collect, 5);
+    qsort(keys, key_count, sizeof(keys[0]), compare_desc);
+    if (key_count != CLASSES)
+    {
+        fprintf(stderr, "등급 수가 %d 입니다 (7462 이어야 함)\n", key_count);
+        return 1;
+    }
+    each_quinary(q, 0, 5, fill_noflush, 5);
+    each_quinary(q, 0, 7, fill_noflush, 7);
+    fill_flush();
+
+    printf("// PokerTableGen.c 가 만든 파일입니다. 직접 고치지 마세요.\n\n");
+    printf("#ifndef POKER_TABLES_H\n#define POKER_TABLES_H\n\n");
+    printf("static const int poker_dp[5][13][8] = {\n");
+    for (a = 0; a < 5; a++)
+    {
+        printf("    {");
+        for (b = 0; b < RANKS; b++)
+        {
+            printf("%s{", b == 0 ? "" : "     ");
+            for (c = 0; c < 8; c++)
+                printf("%d%s", dp[a][b][c], c == 7 ? "" : ", ");
+            printf("}%s", b == RANKS - 1 ? "" : ",\n");
+        }
+        printf("}%s\n", a == 4 ? "" : ",");
+    }
+    printf("};\n\n");
+    print_table("poker_flush[8192]", flush_table, 8192);
+    print_table("poker_noflush5[6175]", noflush5, 6175);
+    print_table("poker_noflush7[49205]", noflush7, 49205);
+    printf("#endif\n");
+    return 0;
+}
@@ -0,0 +1,53 @@
+// push, pop - PoolStack 이용 (Stack.c 와 같은 사용법)
+// struct Stack 안의 원소가 노드 대신 pool_stack.h 의 연속 메모리에 쌓인다.
+
+#include <stdio.h>
+#include "pool_stack.h"
+
+struct Stack
+{
+    PoolStack<int> items;
+};
+
+void push(struct Stack *stack, int data)
+{
+    stack->items.push(std::move(data));
+}
+
+void pop(struct Stack *stack)
+{
+    if (stack->items.empty()) // 스택이 비어있을 때
+    {
+        printf("Stack is empty. Cannot pop.\n");
+        return;
+    }
+    stack->items.pop();
+}
+
+void ReleaseStack(struct Stack *stack)
+{
+    stack->items.clear();
+}
+
+void ShowStack(struct Stack *stack)
+{
+    stack->items.for_each([](int data) { printf("%d\n", data); });
+}
+
+int main(void)
+{
+    struct Stack stack;
+
+    push(&stack, 10);
+    push(&stack, 20);
+    push(&stack, 30);
+
+    ShowStack(&stack);
+
+    pop(&stack);
+    printf("After pop:\n");
+    ShowStack(&stack);
+
+    ReleaseStack(&stack);
+    return 0;
+}
@@ -0,0 +1,172 @@
+// 텍스트 악보를 .song 악보 파일(score.h)로 변환
+//
+// 텍스트 악보 예)
+//   # 학교종이 땡땡땡
+//   tempo 150       기본 템포 (BPM)
+//   ticks 1         한 박자의 틱 수 (4 이면 16분음표까지)
+//   track           새 트랙 시작 (최대 16개)
+//   C4:1 C4:1 G4:1 G4:1 A4:1 A4:1 G4:2
+//   R:1             쉼표 1틱
+//   T:120           이 트랙의 템포 변경 (1바이트라 1~255, 기본 tempo 는 65535 까지)
+//
+// 음은 음이름(C D E F G A B) + 샵(#)/플랫(b) + 옥타브(-1~9) + ':' + 틱 수(1~255)
+// 사용법: ScoreCompile 입력.txt 출력.song
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "note_table.h"
+#include "score.h"
+
+#define MAX_EVENTS 65536 // 트랙당 최대 이벤트 수
+
+int parse_token(const char *tok, unsigned char ev[2]);
+
+int main(int argc, char *argv[])
+{
+    static unsigned char data[SCORE_MAX_TRACKS][MAX_EVENTS * 2];
+    const unsigned char *track[SCORE_MAX_TRACKS];
+    int length[SCORE_MAX_TRACKS] = {0};
+    int tempo = 120, ticks = 1, count = 0, line_no = 0, i;
+    char line[1024], *tok;
+    FILE *fp;
+
+    if (argc != 3)
+    {
+        printf("사용법: %s 입력.txt 출력.song\n", argv[0]);
+        return 1;
+    }
+    fp = fopen(argv[1], "r");
+    if (fp == NULL)
+    {
+        printf("%s 파일을 열 수 없습니다.\n", argv[1]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        line_no++;
+        for (i = 0; line[i] != '\0'; i++) // 주석 제거 (C#4 의 #은 주석이 아님)
+        {
+            if (line[i] == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t'))
+            {
+                line[i] = '\0';
+                break;
+            }
+        }
+        tok = strtok(line, " \t\r\n");
+        while (tok != NULL)
+        {
+            if (strcmp(tok, "tempo") == 0 || strcmp(tok, "ticks") == 0)
+            {
+                char *value = strtok(NULL, " \t\r\n");
+                int n = value != NULL ? atoi(value) : 0;
+                if (n < 1 || n > 65535)
+                {
+                    printf("%d번째 줄: 잘못된 %s 값\n", line_no, tok);
+                    fclose(fp);
+                    return 1;
+                }
+                if (strcmp(tok, "tempo") == 0)
+                    tempo = n;
+                else
+                    ticks = n;
+            }
+            else if (strcmp(tok, "track") == 0)
+            {
+                if (count == SCORE_MAX_TRACKS)
+                {
+                    printf("%d번째 줄: 트랙은 최대 %d개입니다.\n", line_no, SCORE_MAX_TRACKS);
+                    fclose(fp);
+                    return 1;
+                }
+                count++;
+            }
+            else
+            {
+                unsigned char ev[2];
+                if (count == 0)
+                    count = 1; // track 없이 시작하면 트랙 0
+                if (parse_token(tok, ev) != 0)
+                {
+                    printf("%d번째 줄: 잘못된 음 '%s'\n", line_no, tok);
+                    fclose(fp);
+                    return 1;
+                }
+                if (length[count - 1] == MAX_EVENTS * 2)
+                {
+                    printf("%d번째 줄: 트랙이 너무 깁니다.\n", line_no);
+                    fclose(fp);
+                    return 1;
+                }
+                memcpy(&data[count - 1][length[count - 1]], ev, 2);
+                length[count - 1] += 2;
+            }
+            tok = strtok(NULL, " \t\r\n");
+        }
+    }
+    fclose(fp);
+
+    if (count == 0)
+    {
+        printf("음이 하나도 없습니다.\n");
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+        track[i] = data[i];
+    if (score_save(argv[2], tempo, ticks, track, length, count) != 0)
+    {
+        printf("%s 파일을 저장할 수 없습니다.\n", argv[2]);
+        return 1;
+    }
+    printf("%s: 트랙 %d개, 템포 %d 저장 완료\n", argv[2], count, tempo);
+    return 0;
+}
+
+// "C#4:2", "R:1", "T:120" 한 토큰을 2바이트 이벤트로 (0: 성공, -1: 오류)
+int parse_token(const char *tok, unsigned char ev[2])
+{
+    // C D E F G A B 의 도부터의 반음 수
+    static const int semitone[7] = {9, 11, 0, 2, 4, 5, 7}; // A B C D E F G
+    const char *colon = strchr(tok, ':');
+    int duration, note, octave;
+    char *end;
+
+    if (colon == NULL)
+        return -1;
+    duration = (int)strtol(colon + 1, &end, 10);
+    if (*end != '\0' || duration < 1 || duration > 255)
+        return -1;
+
+    if (tok[0] == 'R' && colon == tok + 1)
+    {
+        ev[0] = SCORE_REST;
+        ev[1] = (unsigned char)duration;
+        return 0;
+    }
+    if (tok[0] == 'T' && colon == tok + 1)
+    {
+        ev[0] = SCORE_TEMPO;
+        ev[1] = (unsigned char)duration;
+        return 0;
+    }
+    if (tok[0] < 'A' || tok[0] > 'G')
+        return -1;
+
+    note = semitone[tok[0] - 'A'];
+    tok++;
+    if (*tok == '#')
+        note++, tok++;
+    else if (*tok == 'b')
+        note--, tok++;
+    octave = (int)strtol(tok, &end, 10);
+    if (end != colon || end == tok || octave < -1 || octave > 9)
+        return -1;
+
+    note = NOTE_NUMBER(octave, note);
+    if (note < 0 || note > 127)
+        return -1;
+    ev[0] = (unsigned char)note;
+    ev[1] = (unsigned char)duration;
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Stack.c 의 연결 리스트 스택과 PoolStack 의 속도 비교
+// 원소 10^3 ~ 10^8 개를 push -> 전체 순회(ShowStack 과 같은 순서) -> pop 하는 시간을 잰다.
+// 10^8 에서 연결 리스트는 노드 malloc 으로 3GB 안팎을 쓴다. 메모리가 부족하면
+// 최대 지수를 인수로 준다. 예) StackBench 7
+// 컴파일 예: g++ -std=c++11 -O2 StackBench.cpp -o StackBench
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "pool_stack.h"
+
+struct Node
+{
+    int data;
+    struct Node *next;
+};
+
+struct Stack
+{
+    struct Node *top;
+};
+
+// Stack.c 와 같은 노드 방식
+void list_push(struct Stack *stack, int data)
+{
+    struct Node *newNode = (struct Node *)malloc(sizeof(struct Node));
+    newNode->data = data;
+    newNode->next = stack->top;
+    stack->top = newNode;
+}
+
+void list_pop(struct Stack *stack)
+{
+    struct Node *temp = stack->top;
+    stack->top = stack->top->next;
+    free(temp);
+}
+
+long long list_run(long long n)
+{
+    struct Stack stack;
+    struct Node *current;
+    long long i, sum = 0;
+
+    stack.top = NULL;
+    for (i = 0; i < n; i++)
+        list_push(&stack, (int)i);
+    for (current = stack.top; current != NULL; current = current->next)
+        sum += current->data;
+    while (stack.top != NULL)
+        list_pop(&stack);
+    return sum;
+}
+
+template <typename S>
+long long pool_run(long long n)
+{
+    S stack;
+    long long i, sum = 0;
+
+    for (i = 0; i < n; i++)
+        stack.push((int)i);
+    stack.for_each([&sum](int data) { sum += data; });
+    while (!stack.empty())
+        stack.pop();
+    return sum;
+}
+
+template <typename F>
+double ns_per_element(F run, long long n, long long repeat, long long *sum)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long long r = 0; r < repeat; r++)
+        *sum = run(n);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / (double)(n * repeat);
+}
+
+// 작은 청크로 구간 경계를 많이 지나가게 해서 순서와 합을 확인
+int self_check(void)
+{
+    PoolStack<int, 3, 5> stack;
+    int expect = 999, ok = 1, i;
+
+    stack.reserve(40);
+    for (i = 0; i < 1000; i++)
+        stack.emplace(i);
+    for (i = 0; i < 500; i++)
+        stack.pop();
+    for (i = 500; i < 1000; i++)
+        stack.push((int)i);
+    stack.for_each([&](int data) {
+        if (data != expect--)
+            ok = 0;
+    });
+    return ok && stack.size() == 1000 && stack.top() == 999;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_exp = argc > 1 ? atoi(argv[1]) : 8;
+    long long n = 1000;
+    int e;
+
+    if (!self_check())
+    {
+        printf("PoolStack 자체 검사 실패\n");
+        return 1;
+    }
+
+    printf("%12s %14s %14s %8s\n", "원소 수", "연결리스트 ns", "PoolStack ns", "배율");
+    for (e = 3; e <= max_exp; e++, n *= 10)
+    {
+        long long repeat = n >= 10000000 ? 1 : 10000000 / n;
+        long long list_sum, pool_sum;
+        double t_list = ns_per_element(list_run, n, repeat, &list_sum);
+        double t_pool = ns_per_element(pool_run<PoolStack<int> >, n, repeat, &pool_sum);
+
+        if (list_sum != pool_sum)
+        {
+            printf("10^%d: 합이 다릅니다 (%lld != %lld)\n", e, list_sum, pool_sum);
+            return 1;
+        }
+        printf("%12lld %14.2f %14.2f %7.1fx\n", n, t_list, t_pool, t_list / t_pool);
+    }
+    return 0;
+}
@@ -1,89 +1,70 @@
 #include <stdio.h>
-#include <string.h>
-#include <stdlib.h>
 #include <time.h>
+#include "card.h"
 
-struct trump
-{
-    int order;
-    char shape[3];
-    int number;
-};
-
-void make_card(struct trump m_card[]);
-void display_card(struct trump m_card[]);
-void shuffle_card(struct trump m_card[]);
+// 카드 한 장 = 1바이트 (card.h 참고)
+void make_card(unsigned char m_card[]);
+void display_card(unsigned char m_card[]);
+void shuffle_card(unsigned char m_card[], uint64_t *rng);
 
 int main(void)
 {
-    struct trump card[52];
+    unsigned char card[52];
+    uint64_t rng;
+    card_seed(&rng, (uint64_t)time(NULL)); // 프로그램 시작 때 한 번만
     make_card(card);
-    shuffle_card(card);
+    shuffle_card(card, &rng);
     display_card(card);
     return 0;
 }
 
-void make_card(struct trump m_card[])
+void make_card(unsigned char m_card[])
 {
-    int i, j = 0;
-    char shape[4][3] = {"♠", "◆", "♥", "♣"};
+    int i, j;
 
     for (i = 0; i < 4; i++)
     {
-        for (j = i * 13; j < i * 13 + 13; j++)
+        for (j = 1; j <= 13; j++)
         {
-            m_card[j].order = i;
-            strcpy(m_card[j].shape, shape[i]);
-            m_card[j].number = j % 13 + 1;
-
-            switch (m_card[j].number)
-            {
-            case 1:
-                m_card[j].number = 'A';
-                break;
-            case 11:
-                m_card[j].number = 'J';
-                break;
-            case 12:
-                m_card[j].number = 'Q';
-                break;
-            case 13:
-                m_card[j].number = 'K';
-                break;
-            }
+            m_card[i * 13 + j - 1] = CARD_MAKE(i, j);
         }
     }
 }
-void display_card(struct trump m_card[])
+void display_card(unsigned char m_card[])
 {
-    int i, count = 0;
+    int i, number;
 
     for (i = 0; i < 52; i++)
     {
-        printf("%s", m_card[i].shape);
-        if (10 < m_card[i].number)
-            printf("%-2c  ", m_card[i].number);
-        else
-            printf("%-2d  ", m_card[i].number);
-        count++;
+        printf("%s", card_shape_name(m_card[i]));
+        number = CARD_NUMBER(m_card[i]);
+        switch (number)
+        {
+        case 1:
+            printf("%-2c  ", 'A');
+            break;
+        case 11:
+            printf("%-2c  ", 'J');
+            break;
+        case 12:
+            printf("%-2c  ", 'Q');
+            break;
+        case 13:
+            printf("%-2c  ", 'K');
+            break;
+        default:
+            printf("%-2d  ", number);
+            break;
+        }
         if (i % 13 + 1 == 13)
         {
             printf("\n");
-            count = 0;
         }
     }
 }
 
-void shuffle_card(struct trump m_card[])
+// Fisher–Yates 섞기 (한 번 뽑을 때 치우침 없음. 64비트 난수 상태라 52! 가지 순서가 전부 나오지는 않는다)
+void shuffle_card(unsigned char m_card[], uint64_t *rng)
 {
-    int i, rnd;
-    struct trump temp;
-    srand(time(NULL));
-    for (i = 0; i < 52; i++)
-    {
-        rnd = rand() % 52;
-        temp = m_card[i];
-        m_card[i] = m_card[rnd];
-        m_card[rnd] = temp;
-    }
+    deck_shuffle(m_card, 52, rng);
 }
@@ -0,0 +1,192 @@
+// 1바이트 카드와 덱 섞기
+//
+// 카드 한 장은 unsigned char 하나: 값 = 모양 * 13 + (숫자 - 1)   (0 ~ 51)
+//   모양: 0=♠ 1=◆ 2=♥ 3=♣,  숫자: 1=A, 2~10, 11=J, 12=Q, 13=K
+// 덱 52장이 52바이트라 덱 여러 개를 평평한 버퍼 하나에 이어 붙일 수 있다.
+//
+// 섞기는 Fisher–Yates: 뒤에서부터 i 번째 카드를 0 ~ i 중 하나와 바꾼다.
+// 난수 범위는 rand() % n 대신 곱셈 후 상위 비트를 쓰고 치우친 구간은 다시 뽑아서
+// 한 번 뽑을 때 0 ~ i 가 정확히 같은 확률이다 (rand() % n 의 치우침이 없다).
+// 다만 난수 상태가 64비트라 나올 수 있는 순서는 많아야 2^64 가지로, 52! 가지 전부는 아니다.
+// 난수 상태는 호출하는 쪽이 가지고 있어 스레드마다 따로 쓸 수 있고 섞을 때마다 srand 를 다시 부르지 않는다.
+
+#ifndef CARD_H
+#define CARD_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define CARD_COUNT 52
+#define CARD_MAX_THREADS 64
+
+#define CARD_MAKE(shape, number) ((unsigned char)((shape) * 13 + (number) - 1))
+#define CARD_SHAPE(c) ((c) / 13)
+#define CARD_NUMBER(c) ((c) % 13 + 1)
+
+// 카드 모양 문자열 (♠◆♥♣)
+static inline const char *card_shape_name(unsigned char c)
+{
+    static const char *name[4] = {"♠", "◆", "♥", "♣"};
+    return name[CARD_SHAPE(c)];
+}
+
+// splitmix64: 시드 하나로 서로 겹치지 않는 난수 상태를 만들 때 사용
+static inline uint64_t card_splitmix(uint64_t *s)
+{
+    uint64_t z = (*s += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// 난수 상태 (xorshift64*)
+static inline uint32_t card_random(uint64_t *s)
+{
+    uint64_t x = *s;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *s = x;
+    return (uint32_t)((x * 0x2545f4914f6cdd1dULL) >> 32);
+}
+
+// 0 ~ n-1 의 치우치지 않은 난수 (Lemire 방식)
+static inline uint32_t card_bounded(uint64_t *s, uint32_t n)
+{
+    uint64_t m = (uint64_t)card_random(s) * n;
+    if ((uint32_t)m < n)
+    {
+        uint32_t threshold = (uint32_t)-n % n;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)card_random(s) * n;
+    }
+    return (uint32_t)(m >> 32);
+}
+
+static inline void card_seed(uint64_t *s, uint64_t seed)
+{
+    uint64_t t = seed;
+    *s = card_splitmix(&t);
+    if (*s == 0)
+        *s = 1; // xorshift 상태는 0이면 안 된다
+}
+
+// 정렬된 덱 (♠A ~ ♣K)
+static inline void deck_init(unsigned char deck[CARD_COUNT])
+{
+    int i;
+    for (i = 0; i < CARD_COUNT; i++)
+        deck[i] = (unsigned char)i;
+}
+
+// Fisher–Yates 섞기
+static inline void deck_shuffle(unsigned char deck[], int n, uint64_t *rng)
+{
+    int i;
+    for (i = n - 1; i > 0; i--)
+    {
+        int j = (int)card_bounded(rng, (uint32_t)i + 1);
+        unsigned char t = deck[i];
+        deck[i] = deck[j];
+        deck[j] = t;
+    }
+}
+
+// ---- 여러 덱을 한꺼번에 섞기 ----
+// out 에 덱 count 개(52 * count 바이트)를 채운다.
+// k 번째 덱은 seed 와 k 로만 정해지므로 스레드 수가 달라도 같은 결과가 나온다.
+
+struct deck_batch
+{
+    unsigned char *out;
+    long long first, count;
+    uint64_t seed;
+};
+
+static inline void deck_batch_run(struct deck_batch *b)
+{
+    unsigned char sorted[CARD_COUNT];
+    uint64_t s = b->seed + (uint64_t)b->first * 0x9e3779b97f4a7c15ULL;
+    long long k;
+
+    deck_init(sorted);
+    for (k = 0; k < b->count; k++)
+    {
+        unsigned char *deck = b->out + (b->first + k) * CARD_COUNT;
+        uint64_t rng = card_splitmix(&s) | 1;
+        memcpy(deck, sorted, CARD_COUNT);
+        deck_shuffle(deck, CARD_COUNT, &rng);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI deck_batch_thread(LPVOID arg)
+{
+    deck_batch_run((struct deck_batch *)arg);
+    return 0;
+}
+#else
+static void *deck_batch_thread(void *arg)
+{
+    deck_batch_run((struct deck_batch *)arg);
+    return NULL;
+}
+#endif
+
+static inline void deck_shuffle_batch(unsigned char *out, long long count, uint64_t seed, int threads)
+{
+    struct deck_batch job[CARD_MAX_THREADS];
+#ifdef _WIN32
+    HANDLE tid[CARD_MAX_THREADS];
+#else
+    pthread_t tid[CARD_MAX_THREADS];
+#endif
+    char started[CARD_MAX_THREADS];
+    long long per;
+    int t;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > CARD_MAX_THREADS)
+        threads = CARD_MAX_THREADS;
+    per = (count + threads - 1) / threads;
+
+    for (t = 0; t < threads; t++)
+    {
+        job[t].out = out;
+        job[t].first = per * t < count ? per * t : count;
+        job[t].count = job[t].first + per < count ? per : count - job[t].first;
+        job[t].seed = seed;
+    }
+    for (t = 1; t < threads; t++)
+    {
+#ifdef _WIN32
+        tid[t] = CreateThread(NULL, 0, deck_batch_thread, &job[t], 0, NULL);
+        started[t] = tid[t] != NULL;
+#else
+        started[t] = pthread_create(&tid[t], NULL, deck_batch_thread, &job[t]) == 0;
+#endif
+        if (!started[t])
+            deck_batch_run(&job[t]); // 스레드를 못 만들면 호출한 스레드가 대신
+    }
+    deck_batch_run(&job[0]); // 첫 번째 몫은 호출한 스레드가 직접
+    for (t = 1; t < threads; t++)
+    {
+        if (!started[t])
+            continue;
+#ifdef _WIN32
+        WaitForSingleObject(tid[t], INFINITE);
+        CloseHandle(tid[t]);
+#else
+        pthread_join(tid[t], NULL);
+#endif
+    }
+}
+
+#endif
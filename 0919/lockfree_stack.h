@@ -0,0 +1,223 @@
+// 여러 스레드가 함께 쓰는 락 프리 스택 (Treiber 스택, C++11)
+//
+// Stack.c 의 struct Stack 은 push/pop 이 stack->top 을 동시에 고치면 깨진다.
+// LockFreeStack 은 top 을 CAS(compare_exchange) 한 번으로 바꾼다.
+//
+// ABA 방지: 노드를 포인터 대신 32비트 번호로 가리키고, top 에는 번호와 함께
+//   바뀔 때마다 1씩 늘어나는 32비트 태그를 64비트 하나로 묶어 둔다.
+//   그 사이 같은 노드가 빠졌다 다시 들어와도 태그가 달라 CAS 가 실패한다.
+// 메모리 회수: pop 된 노드는 free 하지 않고 노드 자유 리스트(같은 방식의 태그 스택)로
+//   돌아가 재사용된다. 노드 블록은 스택이 없어질 때만 해제되므로, 늦게 도착한
+//   스레드가 이미 빠진 노드의 next 를 읽어도 안전하다 (읽은 값은 CAS 실패로 버려진다).
+// 소거(elimination) 백오프: CAS 가 실패하면 소거 배열의 임의 칸에서 반대 연산을 기다린다.
+//   push 가 놓은 노드를 pop 이 가져가면 두 연산은 top 을 건드리지 않고 끝난다.
+
+#ifndef LOCKFREE_STACK_H
+#define LOCKFREE_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+template <typename T>
+class LockFreeStack
+{
+public:
+    // slots: 소거 배열 칸 수 (0이면 소거 없이 재시도만), spin: 칸에서 기다리는 횟수
+    explicit LockFreeStack(unsigned slots = 16, unsigned spin = 64)
+        : top_(pack(NIL, 0)), free_(pack(NIL, 0)), fresh_(0),
+          slots_(slots), spin_(spin), slot_(NULL)
+    {
+        for (unsigned i = 0; i < MAX_BLOCKS; i++)
+            blocks_[i].store(NULL, std::memory_order_relaxed);
+        if (slots_ > 0)
+        {
+            slot_ = new Slot[slots_];
+            for (unsigned i = 0; i < slots_; i++)
+                slot_[i].v.store(pack(NIL, 0), std::memory_order_relaxed);
+        }
+    }
+
+    ~LockFreeStack()
+    {
+        for (unsigned i = 0; i < MAX_BLOCKS; i++)
+            delete[] blocks_[i].load(std::memory_order_relaxed);
+        delete[] slot_;
+    }
+
+    void push(const T &value)
+    {
+        uint32_t idx = alloc_node();
+        Node &n = node(idx);
+        n.value = value;
+        for (;;)
+        {
+            if (try_link(top_, idx))
+                return;
+            if (slots_ > 0 && eliminate_push(idx))
+                return;
+        }
+    }
+
+    // 꺼낸 값을 out 에 넣고 true, 비어 있으면 false
+    bool pop(T &out)
+    {
+        for (;;)
+        {
+            uint32_t idx;
+            int r = try_unlink(top_, idx);
+            if (r < 0)
+                return false;
+            if (r == 0 && (slots_ == 0 || !eliminate_pop(idx)))
+                continue;
+            out = node(idx).value;
+            free_node(idx);
+            return true;
+        }
+    }
+
+    bool empty() const
+    {
+        return index(top_.load(std::memory_order_acquire)) == NIL;
+    }
+
+private:
+    LockFreeStack(const LockFreeStack &);
+    LockFreeStack &operator=(const LockFreeStack &);
+
+    static const uint32_t NIL = 0xffffffffu;
+    static const unsigned BLOCK_BITS = 16;
+    static const unsigned BLOCK_SIZE = 1u << BLOCK_BITS;
+    static const unsigned MAX_BLOCKS = 1u << (32 - BLOCK_BITS);
+
+    struct Node
+    {
+        std::atomic<uint32_t> next;
+        T value;
+    };
+
+    // 소거 배열 칸: 64바이트씩 띄워서 서로 다른 칸끼리 캐시 라인을 나눠 쓰지 않게 한다
+    struct Slot
+    {
+        std::atomic<uint64_t> v;
+        char pad[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static uint64_t pack(uint32_t idx, uint32_t tag) { return (uint64_t)tag << 32 | idx; }
+    static uint32_t index(uint64_t v) { return (uint32_t)v; }
+    static uint32_t tag(uint64_t v) { return (uint32_t)(v >> 32); }
+
+    Node &node(uint32_t idx)
+    {
+        return blocks_[idx >> BLOCK_BITS].load(std::memory_order_acquire)[idx & (BLOCK_SIZE - 1)];
+    }
+
+    // head 가 가리키는 태그 스택 맨 위에 idx 노드를 한 번 연결 시도
+    bool try_link(std::atomic<uint64_t> &head, uint32_t idx)
+    {
+        uint64_t old = head.load(std::memory_order_relaxed);
+        node(idx).next.store(index(old), std::memory_order_relaxed);
+        return head.compare_exchange_weak(old, pack(idx, tag(old) + 1),
+                                          std::memory_order_release, std::memory_order_relaxed);
+    }
+
+    // 맨 위 노드를 한 번 떼어 내기 시도 (1: 성공, 0: CAS 실패, -1: 비어 있음)
+    int try_unlink(std::atomic<uint64_t> &head, uint32_t &idx)
+    {
+        uint64_t old = head.load(std::memory_order_acquire);
+        idx = index(old);
+        if (idx == NIL)
+            return -1;
+        uint32_t next = node(idx).next.load(std::memory_order_relaxed);
+        return head.compare_exchange_weak(old, pack(next, tag(old) + 1),
+                                          std::memory_order_acquire, std::memory_order_relaxed)
+                   ? 1
+                   : 0;
+    }
+
+    uint32_t alloc_node()
+    {
+        uint32_t idx;
+        int r;
+        while ((r = try_unlink(free_, idx)) == 0)
+            ;
+        if (r > 0)
+            return idx;
+
+        // 자유 리스트가 비면 새 번호를 받고, 블록이 없으면 만든다
+        idx = fresh_.fetch_add(1, std::memory_order_relaxed);
+        if (idx == NIL)
+            throw std::bad_alloc();
+        std::atomic<Node *> &block = blocks_[idx >> BLOCK_BITS];
+        if (block.load(std::memory_order_acquire) == NULL)
+        {
+            Node *fresh = new Node[BLOCK_SIZE];
+            Node *expected = NULL;
+            if (!block.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel))
+                delete[] fresh; // 다른 스레드가 먼저 만들었다
+        }
+        return idx;
+    }
+
+    void free_node(uint32_t idx)
+    {
+        while (!try_link(free_, idx))
+            ;
+    }
+
+    static unsigned random_slot(unsigned n)
+    {
+        static thread_local uint32_t x = 2463534242u ^ (uint32_t)(uintptr_t)&x;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x % n;
+    }
+
+    // 소거 칸에 노드를 놓고 기다린다 (true: pop 이 가져감)
+    bool eliminate_push(uint32_t idx)
+    {
+        std::atomic<uint64_t> &s = slot_[random_slot(slots_)].v;
+        uint64_t old = s.load(std::memory_order_relaxed);
+        if (index(old) != NIL)
+            return false;
+        uint64_t offer = pack(idx, tag(old) + 1);
+        if (!s.compare_exchange_strong(old, offer, std::memory_order_release, std::memory_order_relaxed))
+            return false;
+        for (unsigned i = 0; i < spin_; i++)
+            if (s.load(std::memory_order_relaxed) != offer)
+                return true;
+        // 아무도 안 가져갔으면 회수, 실패하면 그 사이 pop 이 가져간 것
+        return !s.compare_exchange_strong(offer, pack(NIL, tag(offer) + 1),
+                                          std::memory_order_relaxed, std::memory_order_relaxed);
+    }
+
+    // 소거 칸에서 push 가 놓은 노드를 가져온다
+    bool eliminate_pop(uint32_t &idx)
+    {
+        std::atomic<uint64_t> &s = slot_[random_slot(slots_)].v;
+        for (unsigned i = 0; i < spin_; i++)
+        {
+            uint64_t old = s.load(std::memory_order_acquire);
+            if (index(old) == NIL)
+                continue;
+            if (s.compare_exchange_strong(old, pack(NIL, tag(old) + 1),
+                                          std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                idx = index(old);
+                return true;
+            }
+            return false;
+        }
+        return false;
+    }
+
+    alignas(64) std::atomic<uint64_t> top_;  // 스택 맨 위 (번호 + 태그)
+    alignas(64) std::atomic<uint64_t> free_; // 노드 자유 리스트 맨 위
+    alignas(64) std::atomic<uint32_t> fresh_; // 아직 한 번도 쓰지 않은 첫 노드 번호
+    std::atomic<Node *> blocks_[MAX_BLOCKS];
+    unsigned slots_, spin_;
+    Slot *slot_;
+};
+
+#endif
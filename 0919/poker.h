@@ -0,0 +1,251 @@
+// 포커 족보 판정과 승률 계산 (card.h 의 1바이트 카드 사용)
+//
+// poker_eval5 / poker_eval7 은 족보 값 1 ~ 7462 를 돌려준다. 작을수록 강하다.
+//   (1 = 로열 스트레이트 플러시, 7462 = 7-5-4-3-2 하이카드)
+// 플러시면 같은 모양 카드의 숫자 비트(13비트)로 poker_flush 표를,
+// 아니면 숫자별 장수를 5진수로 보고 완전 해시한 번호로 poker_noflush5/7 표를 찾는다.
+// 표는 PokerTableGen.c 가 빌드할 때 만든 poker_tables.h 에 들어 있다.
+//
+// poker_equity 는 남은 카드에서 보드(와 상대 패)를 무작위로 돌려 승/무/패 횟수를 센다.
+
+#ifndef POKER_H
+#define POKER_H
+
+#include "card.h"
+#include "poker_tables.h"
+
+enum poker_category
+{
+    HIGH_CARD,
+    ONE_PAIR,
+    TWO_PAIR,
+    THREE_OF_A_KIND,
+    STRAIGHT,
+    FLUSH,
+    FULL_HOUSE,
+    FOUR_OF_A_KIND,
+    STRAIGHT_FLUSH
+};
+
+// 카드 -> 포커 숫자 번호 (0=2 ... 12=A). card.h 의 숫자는 1=A, 2~13
+#define POKER_RANK(c) ((CARD_NUMBER(c) + 11) % 13)
+
+static inline int poker_hash(const unsigned char q[13], int k)
+{
+    int sum = 0, i;
+    for (i = 0; i < 13; i++)
+    {
+        sum += poker_dp[q[i]][12 - i][k];
+        k -= q[i];
+        if (k <= 0)
+            break;
+    }
+    return sum;
+}
+
+static inline int poker_eval5(const unsigned char c[5])
+{
+    unsigned char q[13] = {0};
+    int i, mask = 0, suit = CARD_SHAPE(c[0]), flush = 1;
+
+    for (i = 0; i < 5; i++)
+    {
+        int r = POKER_RANK(c[i]);
+        q[r]++;
+        mask |= 1 << r;
+        flush &= CARD_SHAPE(c[i]) == suit;
+    }
+    if (flush)
+        return poker_flush[mask];
+    return poker_noflush5[poker_hash(q, 5)];
+}
+
+// 7장 중 가장 좋은 5장의 값
+static inline int poker_eval7(const unsigned char c[7])
+{
+    unsigned char q[13] = {0};
+    int mask[4] = {0, 0, 0, 0}, count[4] = {0, 0, 0, 0};
+    int i, s;
+
+    for (i = 0; i < 7; i++)
+    {
+        int r = POKER_RANK(c[i]);
+        s = CARD_SHAPE(c[i]);
+        q[r]++;
+        mask[s] |= 1 << r;
+        count[s]++;
+    }
+    // 같은 모양이 5장 이상이면 풀하우스/포카드가 나올 수 없어 플러시 쪽만 보면 된다
+    for (s = 0; s < 4; s++)
+        if (count[s] >= 5)
+            return poker_flush[mask[s]];
+    return poker_noflush7[poker_hash(q, 7)];
+}
+
+static inline enum poker_category poker_category_of(int value)
+{
+    if (value > 6185)
+        return HIGH_CARD;
+    if (value > 3325)
+        return ONE_PAIR;
+    if (value > 2467)
+        return TWO_PAIR;
+    if (value > 1609)
+        return THREE_OF_A_KIND;
+    if (value > 1599)
+        return STRAIGHT;
+    if (value > 322)
+        return FLUSH;
+    if (value > 166)
+        return FULL_HOUSE;
+    if (value > 10)
+        return FOUR_OF_A_KIND;
+    return STRAIGHT_FLUSH;
+}
+
+static inline const char *poker_category_name(enum poker_category c)
+{
+    static const char *name[9] = {"하이카드", "원페어", "투페어", "트리플", "스트레이트",
+                                  "플러시", "풀하우스", "포카드", "스트레이트 플러시"};
+    return name[c];
+}
+
+// ---- 승률 계산 ----
+// hero: 내 패 2장, villain: 상대 패 2장 (NULL 이면 매번 무작위 패)
+// board/known: 이미 나온 공용 카드 (0 ~ 5장)
+// trials 번 나머지 카드를 돌려 win/tie/lose 에 더한다.
+
+struct poker_equity
+{
+    unsigned char hero[2], villain[2], board[5];
+    int has_villain, known;
+    long long trials, win, tie, lose;
+    uint64_t seed;
+};
+
+static inline void poker_equity_run(struct poker_equity *e)
+{
+    unsigned char deck[52], h[7], v[7];
+    int n = 0, c, i, used[52] = {0};
+    uint64_t rng;
+    long long t;
+
+    card_seed(&rng, e->seed);
+    used[e->hero[0]] = used[e->hero[1]] = 1;
+    if (e->has_villain)
+        used[e->villain[0]] = used[e->villain[1]] = 1;
+    for (i = 0; i < e->known; i++)
+        used[e->board[i]] = 1;
+    for (c = 0; c < 52; c++)
+        if (!used[c])
+            deck[n++] = (unsigned char)c;
+
+    h[0] = e->hero[0];
+    h[1] = e->hero[1];
+    for (i = 0; i < e->known; i++)
+        h[2 + i] = v[2 + i] = e->board[i];
+
+    e->win = e->tie = e->lose = 0;
+    for (t = 0; t < e->trials; t++)
+    {
+        int need = 5 - e->known + (e->has_villain ? 0 : 2), a, b;
+        // 필요한 장수만큼만 Fisher–Yates 를 앞에서부터 진행 (부분 섞기)
+        for (i = 0; i < need; i++)
+        {
+            int j = i + (int)card_bounded(&rng, (uint32_t)(n - i));
+            unsigned char tmp = deck[i];
+            deck[i] = deck[j];
+            deck[j] = tmp;
+        }
+        for (i = e->known; i < 5; i++)
+            h[2 + i] = v[2 + i] = deck[i - e->known];
+        if (e->has_villain)
+        {
+            v[0] = e->villain[0];
+            v[1] = e->villain[1];
+        }
+        else
+        {
+            v[0] = deck[5 - e->known];
+            v[1] = deck[6 - e->known];
+        }
+        a = poker_eval7(h);
+        b = poker_eval7(v);
+        if (a < b)
+            e->win++;
+        else if (a == b)
+            e->tie++;
+        else
+            e->lose++;
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI poker_equity_thread(LPVOID arg)
+{
+    poker_equity_run((struct poker_equity *)arg);
+    return 0;
+}
+#else
+static void *poker_equity_thread(void *arg)
+{
+    poker_equity_run((struct poker_equity *)arg);
+    return NULL;
+}
+#endif
+
+// e 의 trials 를 threads 개 스레드로 나눠 계산하고 결과를 e 에 합친다
+static inline void poker_equity(struct poker_equity *e, int threads)
+{
+    struct poker_equity job[CARD_MAX_THREADS];
+#ifdef _WIN32
+    HANDLE tid[CARD_MAX_THREADS];
+#else
+    pthread_t tid[CARD_MAX_THREADS];
+#endif
+    char started[CARD_MAX_THREADS];
+    int t;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > CARD_MAX_THREADS)
+        threads = CARD_MAX_THREADS;
+    for (t = 0; t < threads; t++)
+    {
+        job[t] = *e;
+        job[t].trials = e->trials / threads + (t < e->trials % threads);
+        job[t].seed = e->seed + (uint64_t)t * 0x9e3779b97f4a7c15ULL;
+    }
+    for (t = 1; t < threads; t++)
+    {
+#ifdef _WIN32
+        tid[t] = CreateThread(NULL, 0, poker_equity_thread, &job[t], 0, NULL);
+        started[t] = tid[t] != NULL;
+#else
+        started[t] = pthread_create(&tid[t], NULL, poker_equity_thread, &job[t]) == 0;
+#endif
+        if (!started[t])
+            poker_equity_run(&job[t]); // 스레드를 못 만들면 호출한 스레드가 대신
+    }
+    poker_equity_run(&job[0]);
+    e->win = job[0].win;
+    e->tie = job[0].tie;
+    e->lose = job[0].lose;
+    for (t = 1; t < threads; t++)
+    {
+        if (started[t])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(tid[t], INFINITE);
+            CloseHandle(tid[t]);
+#else
+            pthread_join(tid[t], NULL);
+#endif
+        }
+        e->win += job[t].win;
+        e->tie += job[t].tie;
+        e->lose += job[t].lose;
+    }
+}
+
+#endif
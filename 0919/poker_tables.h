@@ -0,0 +1,4057 @@
+// PokerTableGen.c 가 만든 파일입니다. 직접 고치지 마세요.
+
+#ifndef POKER_TABLES_H
+#define POKER_TABLES_H
+
+static const int poker_dp[5][13][8] = {
+    {{0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0},
+     {0, 0, 0, 0, 0, 0, 0, 0}},
+    {{1, 0, 0, 0, 0, 0, 0, 0},
+     {1, 1, 1, 1, 1, 0, 0, 0},
+     {1, 2, 3, 4, 5, 4, 3, 2},
+     {1, 3, 6, 10, 15, 18, 19, 18},
+     {1, 4, 10, 20, 35, 52, 68, 80},
+     {1, 5, 15, 35, 70, 121, 185, 255},
+     {1, 6, 21, 56, 126, 246, 426, 666},
+     {1, 7, 28, 84, 210, 455, 875, 1520},
+     {1, 8, 36, 120, 330, 784, 1652, 3144},
+     {1, 9, 45, 165, 495, 1278, 2922, 6030},
+     {1, 10, 55, 220, 715, 1992, 4905, 10890},
+     {1, 11, 66, 286, 1001, 2992, 7887, 18722},
+     {1, 12, 78, 364, 1365, 4356, 12232, 30888}},
+    {{1, 1, 0, 0, 0, 0, 0, 0},
+     {1, 2, 2, 2, 2, 1, 0, 0},
+     {1, 3, 5, 7, 9, 9, 7, 5},
+     {1, 4, 9, 16, 25, 33, 37, 37},
+     {1, 5, 14, 30, 55, 87, 120, 148},
+     {1, 6, 20, 50, 105, 191, 306, 440},
+     {1, 7, 27, 77, 182, 372, 672, 1092},
+     {1, 8, 35, 112, 294, 665, 1330, 2395},
+     {1, 9, 44, 156, 450, 1114, 2436, 4796},
+     {1, 10, 54, 210, 660, 1773, 4200, 8952},
+     {1, 11, 65, 275, 935, 2707, 6897, 15795},
+     {1, 12, 77, 352, 1287, 3993, 10879, 26609},
+     {1, 13, 90, 442, 1729, 5721, 16588, 43120}},
+    {{1, 1, 1, 0, 0, 0, 0, 0},
+     {1, 2, 3, 3, 3, 2, 1, 0},
+     {1, 3, 6, 9, 12, 13, 12, 9},
+     {1, 4, 10, 19, 31, 43, 52, 55},
+     {1, 5, 15, 34, 65, 107, 155, 200},
+     {1, 6, 21, 55, 120, 226, 376, 561},
+     {1, 7, 28, 83, 203, 428, 798, 1338},
+     {1, 8, 36, 119, 322, 749, 1540, 2850},
+     {1, 9, 45, 164, 486, 1234, 2766, 5580},
+     {1, 10, 55, 219, 705, 1938, 4695, 10230},
+     {1, 11, 66, 285, 990, 2927, 7612, 17787},
+     {1, 12, 78, 363, 1353, 4279, 11880, 29601},
+     {1, 13, 91, 454, 1807, 6085, 17953, 47476}},
+    {{1, 1, 1, 1, 0, 0, 0, 0},
+     {1, 2, 3, 4, 4, 3, 2, 1},
+     {1, 3, 6, 10, 14, 16, 16, 14},
+     {1, 4, 10, 20, 34, 49, 62, 70},
+     {1, 5, 15, 35, 69, 117, 175, 235},
+     {1, 6, 21, 56, 125, 241, 411, 631},
+     {1, 7, 28, 84, 209, 449, 854, 1464},
+     {1, 8, 36, 120, 329, 777, 1624, 3060},
+     {1, 9, 45, 165, 494, 1270, 2886, 5910},
+     {1, 10, 55, 220, 714, 1983, 4860, 10725},
+     {1, 11, 66, 286, 1000, 2982, 7832, 18502},
+     {1, 12, 78, 364, 1364, 4345, 12166, 30602},
+     {1, 13, 91, 455, 1819, 6163, 18317, 48841}}
+};
+
+static const unsigned short poker_flush[8192] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1599,
+    0, 0, 0, 0, 0, 0, 0, 1598, 0, 0, 0, 1597, 0, 1596, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1595,
+    0, 0, 0, 0, 0, 0, 0, 1594, 0, 0, 0, 1593, 0, 1592, 1591, 9,
+    0, 0, 0, 0, 0, 0, 0, 1590, 0, 0, 0, 1589, 0, 1588, 1587, 1587,
+    0, 0, 0, 1586, 0, 1585, 1584, 1584, 0, 1583, 1582, 1582, 7, 7, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1581,
+    0, 0, 0, 0, 0, 0, 0, 1580, 0, 0, 0, 1579, 0, 1578, 1577, 9,
+    0, 0, 0, 0, 0, 0, 0, 1576, 0, 0, 0, 1575, 0, 1574, 1573, 1573,
+    0, 0, 0, 1572, 0, 1571, 1570, 1570, 0, 1569, 1568, 1568, 1567, 1567, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1566, 0, 0, 0, 1565, 0, 1564, 1563, 1563,
+    0, 0, 0, 1562, 0, 1561, 1560, 1560, 0, 1559, 1558, 1558, 1557, 1557, 1557, 9,
+    0, 0, 0, 1556, 0, 1555, 1554, 1554, 0, 1553, 1552, 1552, 1551, 1551, 1551, 1551,
+    0, 1550, 1549, 1549, 1548, 1548, 1548, 1548, 6, 6, 6, 6, 6, 6, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1547,
+    0, 0, 0, 0, 0, 0, 0, 1546, 0, 0, 0, 1545, 0, 1544, 1543, 9,
+    0, 0, 0, 0, 0, 0, 0, 1542, 0, 0, 0, 1541, 0, 1540, 1539, 1539,
+    0, 0, 0, 1538, 0, 1537, 1536, 1536, 0, 1535, 1534, 1534, 1533, 1533, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1532, 0, 0, 0, 1531, 0, 1530, 1529, 1529,
+    0, 0, 0, 1528, 0, 1527, 1526, 1526, 0, 1525, 1524, 1524, 1523, 1523, 1523, 9,
+    0, 0, 0, 1522, 0, 1521, 1520, 1520, 0, 1519, 1518, 1518, 1517, 1517, 1517, 1517,
+    0, 1516, 1515, 1515, 1514, 1514, 1514, 1514, 1513, 1513, 1513, 1513, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1512, 0, 0, 0, 1511, 0, 1510, 1509, 1509,
+    0, 0, 0, 1508, 0, 1507, 1506, 1506, 0, 1505, 1504, 1504, 1503, 1503, 1503, 9,
+    0, 0, 0, 1502, 0, 1501, 1500, 1500, 0, 1499, 1498, 1498, 1497, 1497, 1497, 1497,
+    0, 1496, 1495, 1495, 1494, 1494, 1494, 1494, 1493, 1493, 1493, 1493, 1493, 1493, 8, 0,
+    0, 0, 0, 1492, 0, 1491, 1490, 1490, 0, 1489, 1488, 1488, 1487, 1487, 1487, 1487,
+    0, 1486, 1485, 1485, 1484, 1484, 1484, 1484, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 0,
+    0, 1482, 1481, 1481, 1480, 1480, 1480, 1480, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 0,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1478,
+    0, 0, 0, 0, 0, 0, 0, 1477, 0, 0, 0, 1476, 0, 1475, 1474, 9,
+    0, 0, 0, 0, 0, 0, 0, 1473, 0, 0, 0, 1472, 0, 1471, 1470, 1470,
+    0, 0, 0, 1469, 0, 1468, 1467, 1467, 0, 1466, 1465, 1465, 1464, 1464, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1463, 0, 0, 0, 1462, 0, 1461, 1460, 1460,
+    0, 0, 0, 1459, 0, 1458, 1457, 1457, 0, 1456, 1455, 1455, 1454, 1454, 1454, 9,
+    0, 0, 0, 1453, 0, 1452, 1451, 1451, 0, 1450, 1449, 1449, 1448, 1448, 1448, 1448,
+    0, 1447, 1446, 1446, 1445, 1445, 1445, 1445, 1444, 1444, 1444, 1444, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1443, 0, 0, 0, 1442, 0, 1441, 1440, 1440,
+    0, 0, 0, 1439, 0, 1438, 1437, 1437, 0, 1436, 1435, 1435, 1434, 1434, 1434, 9,
+    0, 0, 0, 1433, 0, 1432, 1431, 1431, 0, 1430, 1429, 1429, 1428, 1428, 1428, 1428,
+    0, 1427, 1426, 1426, 1425, 1425, 1425, 1425, 1424, 1424, 1424, 1424, 1424, 1424, 8, 0,
+    0, 0, 0, 1423, 0, 1422, 1421, 1421, 0, 1420, 1419, 1419, 1418, 1418, 1418, 1418,
+    0, 1417, 1416, 1416, 1415, 1415, 1415, 1415, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 0,
+    0, 1413, 1412, 1412, 1411, 1411, 1411, 1411, 1410, 1410, 1410, 1410, 1410, 1410, 1410, 0,
+    1409, 1409, 1409, 1409, 1409, 1409, 1409, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1408, 0, 0, 0, 1407, 0, 1406, 1405, 1405,
+    0, 0, 0, 1404, 0, 1403, 1402, 1402, 0, 1401, 1400, 1400, 1399, 1399, 1399, 9,
+    0, 0, 0, 1398, 0, 1397, 1396, 1396, 0, 1395, 1394, 1394, 1393, 1393, 1393, 1393,
+    0, 1392, 1391, 1391, 1390, 1390, 1390, 1390, 1389, 1389, 1389, 1389, 1389, 1389, 8, 0,
+    0, 0, 0, 1388, 0, 1387, 1386, 1386, 0, 1385, 1384, 1384, 1383, 1383, 1383, 1383,
+    0, 1382, 1381, 1381, 1380, 1380, 1380, 1380, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 0,
+    0, 1378, 1377, 1377, 1376, 1376, 1376, 1376, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 0,
+    1374, 1374, 1374, 1374, 1374, 1374, 1374, 0, 1374, 1374, 1374, 0, 7, 0, 0, 0,
+    0, 0, 0, 1373, 0, 1372, 1371, 1371, 0, 1370, 1369, 1369, 1368, 1368, 1368, 1368,
+    0, 1367, 1366, 1366, 1365, 1365, 1365, 1365, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 0,
+    0, 1363, 1362, 1362, 1361, 1361, 1361, 1361, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 0,
+    1359, 1359, 1359, 1359, 1359, 1359, 1359, 0, 1359, 1359, 1359, 0, 1359, 0, 0, 0,
+    0, 1358, 1357, 1357, 1356, 1356, 1356, 1356, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 0,
+    1354, 1354, 1354, 1354, 1354, 1354, 1354, 0, 1354, 1354, 1354, 0, 1354, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1353,
+    0, 0, 0, 0, 0, 0, 0, 1352, 0, 0, 0, 1351, 0, 1350, 1349, 9,
+    0, 0, 0, 0, 0, 0, 0, 1348, 0, 0, 0, 1347, 0, 1346, 1345, 1345,
+    0, 0, 0, 1344, 0, 1343, 1342, 1342, 0, 1341, 1340, 1340, 1339, 1339, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1338, 0, 0, 0, 1337, 0, 1336, 1335, 1335,
+    0, 0, 0, 1334, 0, 1333, 1332, 1332, 0, 1331, 1330, 1330, 1329, 1329, 1329, 9,
+    0, 0, 0, 1328, 0, 1327, 1326, 1326, 0, 1325, 1324, 1324, 1323, 1323, 1323, 1323,
+    0, 1322, 1321, 1321, 1320, 1320, 1320, 1320, 1319, 1319, 1319, 1319, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1318, 0, 0, 0, 1317, 0, 1316, 1315, 1315,
+    0, 0, 0, 1314, 0, 1313, 1312, 1312, 0, 1311, 1310, 1310, 1309, 1309, 1309, 9,
+    0, 0, 0, 1308, 0, 1307, 1306, 1306, 0, 1305, 1304, 1304, 1303, 1303, 1303, 1303,
+    0, 1302, 1301, 1301, 1300, 1300, 1300, 1300, 1299, 1299, 1299, 1299, 1299, 1299, 8, 0,
+    0, 0, 0, 1298, 0, 1297, 1296, 1296, 0, 1295, 1294, 1294, 1293, 1293, 1293, 1293,
+    0, 1292, 1291, 1291, 1290, 1290, 1290, 1290, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 0,
+    0, 1288, 1287, 1287, 1286, 1286, 1286, 1286, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 0,
+    1284, 1284, 1284, 1284, 1284, 1284, 1284, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1283, 0, 0, 0, 1282, 0, 1281, 1280, 1280,
+    0, 0, 0, 1279, 0, 1278, 1277, 1277, 0, 1276, 1275, 1275, 1274, 1274, 1274, 9,
+    0, 0, 0, 1273, 0, 1272, 1271, 1271, 0, 1270, 1269, 1269, 1268, 1268, 1268, 1268,
+    0, 1267, 1266, 1266, 1265, 1265, 1265, 1265, 1264, 1264, 1264, 1264, 1264, 1264, 8, 0,
+    0, 0, 0, 1263, 0, 1262, 1261, 1261, 0, 1260, 1259, 1259, 1258, 1258, 1258, 1258,
+    0, 1257, 1256, 1256, 1255, 1255, 1255, 1255, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 0,
+    0, 1253, 1252, 1252, 1251, 1251, 1251, 1251, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 0,
+    1249, 1249, 1249, 1249, 1249, 1249, 1249, 0, 1249, 1249, 1249, 0, 7, 0, 0, 0,
+    0, 0, 0, 1248, 0, 1247, 1246, 1246, 0, 1245, 1244, 1244, 1243, 1243, 1243, 1243,
+    0, 1242, 1241, 1241, 1240, 1240, 1240, 1240, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 0,
+    0, 1238, 1237, 1237, 1236, 1236, 1236, 1236, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 0,
+    1234, 1234, 1234, 1234, 1234, 1234, 1234, 0, 1234, 1234, 1234, 0, 1234, 0, 0, 0,
+    0, 1233, 1232, 1232, 1231, 1231, 1231, 1231, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 0,
+    1229, 1229, 1229, 1229, 1229, 1229, 1229, 0, 1229, 1229, 1229, 0, 1229, 0, 0, 0,
+    1228, 1228, 1228, 1228, 1228, 1228, 1228, 0, 1228, 1228, 1228, 0, 1228, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 1226, 0, 1225, 1224, 1224,
+    0, 0, 0, 1223, 0, 1222, 1221, 1221, 0, 1220, 1219, 1219, 1218, 1218, 1218, 9,
+    0, 0, 0, 1217, 0, 1216, 1215, 1215, 0, 1214, 1213, 1213, 1212, 1212, 1212, 1212,
+    0, 1211, 1210, 1210, 1209, 1209, 1209, 1209, 1208, 1208, 1208, 1208, 1208, 1208, 8, 0,
+    0, 0, 0, 1207, 0, 1206, 1205, 1205, 0, 1204, 1203, 1203, 1202, 1202, 1202, 1202,
+    0, 1201, 1200, 1200, 1199, 1199, 1199, 1199, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 0,
+    0, 1197, 1196, 1196, 1195, 1195, 1195, 1195, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 0,
+    1193, 1193, 1193, 1193, 1193, 1193, 1193, 0, 1193, 1193, 1193, 0, 7, 0, 0, 0,
+    0, 0, 0, 1192, 0, 1191, 1190, 1190, 0, 1189, 1188, 1188, 1187, 1187, 1187, 1187,
+    0, 1186, 1185, 1185, 1184, 1184, 1184, 1184, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 0,
+    0, 1182, 1181, 1181, 1180, 1180, 1180, 1180, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 0,
+    1178, 1178, 1178, 1178, 1178, 1178, 1178, 0, 1178, 1178, 1178, 0, 1178, 0, 0, 0,
+    0, 1177, 1176, 1176, 1175, 1175, 1175, 1175, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 0,
+    1173, 1173, 1173, 1173, 1173, 1173, 1173, 0, 1173, 1173, 1173, 0, 1173, 0, 0, 0,
+    1172, 1172, 1172, 1172, 1172, 1172, 1172, 0, 1172, 1172, 1172, 0, 1172, 0, 0, 0,
+    1172, 1172, 1172, 0, 1172, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1171, 0, 1170, 1169, 1169, 0, 1168, 1167, 1167, 1166, 1166, 1166, 1166,
+    0, 1165, 1164, 1164, 1163, 1163, 1163, 1163, 1162, 1162, 1162, 1162, 1162, 1162, 1162, 0,
+    0, 1161, 1160, 1160, 1159, 1159, 1159, 1159, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 0,
+    1157, 1157, 1157, 1157, 1157, 1157, 1157, 0, 1157, 1157, 1157, 0, 1157, 0, 0, 0,
+    0, 1156, 1155, 1155, 1154, 1154, 1154, 1154, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 0,
+    1152, 1152, 1152, 1152, 1152, 1152, 1152, 0, 1152, 1152, 1152, 0, 1152, 0, 0, 0,
+    1151, 1151, 1151, 1151, 1151, 1151, 1151, 0, 1151, 1151, 1151, 0, 1151, 0, 0, 0,
+    1151, 1151, 1151, 0, 1151, 0, 0, 0, 1151, 0, 0, 0, 0, 0, 0, 0,
+    0, 1150, 1149, 1149, 1148, 1148, 1148, 1148, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 0,
+    1146, 1146, 1146, 1146, 1146, 1146, 1146, 0, 1146, 1146, 1146, 0, 1146, 0, 0, 0,
+    1145, 1145, 1145, 1145, 1145, 1145, 1145, 0, 1145, 1145, 1145, 0, 1145, 0, 0, 0,
+    1145, 1145, 1145, 0, 1145, 0, 0, 0, 1145, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1144,
+    0, 0, 0, 0, 0, 0, 0, 1143, 0, 0, 0, 1142, 0, 1141, 1140, 9,
+    0, 0, 0, 0, 0, 0, 0, 1139, 0, 0, 0, 1138, 0, 1137, 1136, 1136,
+    0, 0, 0, 1135, 0, 1134, 1133, 1133, 0, 1132, 1131, 1131, 1130, 1130, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 1129, 0, 0, 0, 1128, 0, 1127, 1126, 1126,
+    0, 0, 0, 1125, 0, 1124, 1123, 1123, 0, 1122, 1121, 1121, 1120, 1120, 1120, 9,
+    0, 0, 0, 1119, 0, 1118, 1117, 1117, 0, 1116, 1115, 1115, 1114, 1114, 1114, 1114,
+    0, 1113, 1112, 1112, 1111, 1111, 1111, 1111, 1110, 1110, 1110, 1110, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1109, 0, 0, 0, 1108, 0, 1107, 1106, 1106,
+    0, 0, 0, 1105, 0, 1104, 1103, 1103, 0, 1102, 1101, 1101, 1100, 1100, 1100, 9,
+    0, 0, 0, 1099, 0, 1098, 1097, 1097, 0, 1096, 1095, 1095, 1094, 1094, 1094, 1094,
+    0, 1093, 1092, 1092, 1091, 1091, 1091, 1091, 1090, 1090, 1090, 1090, 1090, 1090, 8, 0,
+    0, 0, 0, 1089, 0, 1088, 1087, 1087, 0, 1086, 1085, 1085, 1084, 1084, 1084, 1084,
+    0, 1083, 1082, 1082, 1081, 1081, 1081, 1081, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 0,
+    0, 1079, 1078, 1078, 1077, 1077, 1077, 1077, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 0,
+    1075, 1075, 1075, 1075, 1075, 1075, 1075, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1074, 0, 0, 0, 1073, 0, 1072, 1071, 1071,
+    0, 0, 0, 1070, 0, 1069, 1068, 1068, 0, 1067, 1066, 1066, 1065, 1065, 1065, 9,
+    0, 0, 0, 1064, 0, 1063, 1062, 1062, 0, 1061, 1060, 1060, 1059, 1059, 1059, 1059,
+    0, 1058, 1057, 1057, 1056, 1056, 1056, 1056, 1055, 1055, 1055, 1055, 1055, 1055, 8, 0,
+    0, 0, 0, 1054, 0, 1053, 1052, 1052, 0, 1051, 1050, 1050, 1049, 1049, 1049, 1049,
+    0, 1048, 1047, 1047, 1046, 1046, 1046, 1046, 1045, 1045, 1045, 1045, 1045, 1045, 1045, 0,
+    0, 1044, 1043, 1043, 1042, 1042, 1042, 1042, 1041, 1041, 1041, 1041, 1041, 1041, 1041, 0,
+    1040, 1040, 1040, 1040, 1040, 1040, 1040, 0, 1040, 1040, 1040, 0, 7, 0, 0, 0,
+    0, 0, 0, 1039, 0, 1038, 1037, 1037, 0, 1036, 1035, 1035, 1034, 1034, 1034, 1034,
+    0, 1033, 1032, 1032, 1031, 1031, 1031, 1031, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 0,
+    0, 1029, 1028, 1028, 1027, 1027, 1027, 1027, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 0,
+    1025, 1025, 1025, 1025, 1025, 1025, 1025, 0, 1025, 1025, 1025, 0, 1025, 0, 0, 0,
+    0, 1024, 1023, 1023, 1022, 1022, 1022, 1022, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 0,
+    1020, 1020, 1020, 1020, 1020, 1020, 1020, 0, 1020, 1020, 1020, 0, 1020, 0, 0, 0,
+    1019, 1019, 1019, 1019, 1019, 1019, 1019, 0, 1019, 1019, 1019, 0, 1019, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1018, 0, 0, 0, 1017, 0, 1016, 1015, 1015,
+    0, 0, 0, 1014, 0, 1013, 1012, 1012, 0, 1011, 1010, 1010, 1009, 1009, 1009, 9,
+    0, 0, 0, 1008, 0, 1007, 1006, 1006, 0, 1005, 1004, 1004, 1003, 1003, 1003, 1003,
+    0, 1002, 1001, 1001, 1000, 1000, 1000, 1000, 999, 999, 999, 999, 999, 999, 8, 0,
+    0, 0, 0, 998, 0, 997, 996, 996, 0, 995, 994, 994, 993, 993, 993, 993,
+    0, 992, 991, 991, 990, 990, 990, 990, 989, 989, 989, 989, 989, 989, 989, 0,
+    0, 988, 987, 987, 986, 986, 986, 986, 985, 985, 985, 985, 985, 985, 985, 0,
+    984, 984, 984, 984, 984, 984, 984, 0, 984, 984, 984, 0, 7, 0, 0, 0,
+    0, 0, 0, 983, 0, 982, 981, 981, 0, 980, 979, 979, 978, 978, 978, 978,
+    0, 977, 976, 976, 975, 975, 975, 975, 974, 974, 974, 974, 974, 974, 974, 0,
+    0, 973, 972, 972, 971, 971, 971, 971, 970, 970, 970, 970, 970, 970, 970, 0,
+    969, 969, 969, 969, 969, 969, 969, 0, 969, 969, 969, 0, 969, 0, 0, 0,
+    0, 968, 967, 967, 966, 966, 966, 966, 965, 965, 965, 965, 965, 965, 965, 0,
+    964, 964, 964, 964, 964, 964, 964, 0, 964, 964, 964, 0, 964, 0, 0, 0,
+    963, 963, 963, 963, 963, 963, 963, 0, 963, 963, 963, 0, 963, 0, 0, 0,
+    963, 963, 963, 0, 963, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 962, 0, 961, 960, 960, 0, 959, 958, 958, 957, 957, 957, 957,
+    0, 956, 955, 955, 954, 954, 954, 954, 953, 953, 953, 953, 953, 953, 953, 0,
+    0, 952, 951, 951, 950, 950, 950, 950, 949, 949, 949, 949, 949, 949, 949, 0,
+    948, 948, 948, 948, 948, 948, 948, 0, 948, 948, 948, 0, 948, 0, 0, 0,
+    0, 947, 946, 946, 945, 945, 945, 945, 944, 944, 944, 944, 944, 944, 944, 0,
+    943, 943, 943, 943, 943, 943, 943, 0, 943, 943, 943, 0, 943, 0, 0, 0,
+    942, 942, 942, 942, 942, 942, 942, 0, 942, 942, 942, 0, 942, 0, 0, 0,
+    942, 942, 942, 0, 942, 0, 0, 0, 942, 0, 0, 0, 0, 0, 0, 0,
+    0, 941, 940, 940, 939, 939, 939, 939, 938, 938, 938, 938, 938, 938, 938, 0,
+    937, 937, 937, 937, 937, 937, 937, 0, 937, 937, 937, 0, 937, 0, 0, 0,
+    936, 936, 936, 936, 936, 936, 936, 0, 936, 936, 936, 0, 936, 0, 0, 0,
+    936, 936, 936, 0, 936, 0, 0, 0, 936, 0, 0, 0, 0, 0, 0, 0,
+    935, 935, 935, 935, 935, 935, 935, 0, 935, 935, 935, 0, 935, 0, 0, 0,
+    935, 935, 935, 0, 935, 0, 0, 0, 935, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 934, 0, 0, 0, 933, 0, 932, 931, 931,
+    0, 0, 0, 930, 0, 929, 928, 928, 0, 927, 926, 926, 925, 925, 925, 9,
+    0, 0, 0, 924, 0, 923, 922, 922, 0, 921, 920, 920, 919, 919, 919, 919,
+    0, 918, 917, 917, 916, 916, 916, 916, 915, 915, 915, 915, 915, 915, 8, 0,
+    0, 0, 0, 914, 0, 913, 912, 912, 0, 911, 910, 910, 909, 909, 909, 909,
+    0, 908, 907, 907, 906, 906, 906, 906, 905, 905, 905, 905, 905, 905, 905, 0,
+    0, 904, 903, 903, 902, 902, 902, 902, 901, 901, 901, 901, 901, 901, 901, 0,
+    900, 900, 900, 900, 900, 900, 900, 0, 900, 900, 900, 0, 7, 0, 0, 0,
+    0, 0, 0, 899, 0, 898, 897, 897, 0, 896, 895, 895, 894, 894, 894, 894,
+    0, 893, 892, 892, 891, 891, 891, 891, 890, 890, 890, 890, 890, 890, 890, 0,
+    0, 889, 888, 888, 887, 887, 887, 887, 886, 886, 886, 886, 886, 886, 886, 0,
+    885, 885, 885, 885, 885, 885, 885, 0, 885, 885, 885, 0, 885, 0, 0, 0,
+    0, 884, 883, 883, 882, 882, 882, 882, 881, 881, 881, 881, 881, 881, 881, 0,
+    880, 880, 880, 880, 880, 880, 880, 0, 880, 880, 880, 0, 880, 0, 0, 0,
+    879, 879, 879, 879, 879, 879, 879, 0, 879, 879, 879, 0, 879, 0, 0, 0,
+    879, 879, 879, 0, 879, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 878, 0, 877, 876, 876, 0, 875, 874, 874, 873, 873, 873, 873,
+    0, 872, 871, 871, 870, 870, 870, 870, 869, 869, 869, 869, 869, 869, 869, 0,
+    0, 868, 867, 867, 866, 866, 866, 866, 865, 865, 865, 865, 865, 865, 865, 0,
+    864, 864, 864, 864, 864, 864, 864, 0, 864, 864, 864, 0, 864, 0, 0, 0,
+    0, 863, 862, 862, 861, 861, 861, 861, 860, 860, 860, 860, 860, 860, 860, 0,
+    859, 859, 859, 859, 859, 859, 859, 0, 859, 859, 859, 0, 859, 0, 0, 0,
+    858, 858, 858, 858, 858, 858, 858, 0, 858, 858, 858, 0, 858, 0, 0, 0,
+    858, 858, 858, 0, 858, 0, 0, 0, 858, 0, 0, 0, 0, 0, 0, 0,
+    0, 857, 856, 856, 855, 855, 855, 855, 854, 854, 854, 854, 854, 854, 854, 0,
+    853, 853, 853, 853, 853, 853, 853, 0, 853, 853, 853, 0, 853, 0, 0, 0,
+    852, 852, 852, 852, 852, 852, 852, 0, 852, 852, 852, 0, 852, 0, 0, 0,
+    852, 852, 852, 0, 852, 0, 0, 0, 852, 0, 0, 0, 0, 0, 0, 0,
+    851, 851, 851, 851, 851, 851, 851, 0, 851, 851, 851, 0, 851, 0, 0, 0,
+    851, 851, 851, 0, 851, 0, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0,
+    851, 851, 851, 0, 851, 0, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 850, 0, 849, 848, 848, 0, 847, 846, 846, 845, 845, 845, 845,
+    0, 844, 843, 843, 842, 842, 842, 842, 841, 841, 841, 841, 841, 841, 841, 0,
+    0, 840, 839, 839, 838, 838, 838, 838, 837, 837, 837, 837, 837, 837, 837, 0,
+    836, 836, 836, 836, 836, 836, 836, 0, 836, 836, 836, 0, 836, 0, 0, 0,
+    0, 835, 834, 834, 833, 833, 833, 833, 832, 832, 832, 832, 832, 832, 832, 0,
+    831, 831, 831, 831, 831, 831, 831, 0, 831, 831, 831, 0, 831, 0, 0, 0,
+    830, 830, 830, 830, 830, 830, 830, 0, 830, 830, 830, 0, 830, 0, 0, 0,
+    830, 830, 830, 0, 830, 0, 0, 0, 830, 0, 0, 0, 0, 0, 0, 0,
+    0, 829, 828, 828, 827, 827, 827, 827, 826, 826, 826, 826, 826, 826, 826, 0,
+    825, 825, 825, 825, 825, 825, 825, 0, 825, 825, 825, 0, 825, 0, 0, 0,
+    824, 824, 824, 824, 824, 824, 824, 0, 824, 824, 824, 0, 824, 0, 0, 0,
+    824, 824, 824, 0, 824, 0, 0, 0, 824, 0, 0, 0, 0, 0, 0, 0,
+    823, 823, 823, 823, 823, 823, 823, 0, 823, 823, 823, 0, 823, 0, 0, 0,
+    823, 823, 823, 0, 823, 0, 0, 0, 823, 0, 0, 0, 0, 0, 0, 0,
+    823, 823, 823, 0, 823, 0, 0, 0, 823, 0, 0, 0, 0, 0, 0, 0,
+    823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 822, 821, 821, 820, 820, 820, 820, 819, 819, 819, 819, 819, 819, 819, 0,
+    818, 818, 818, 818, 818, 818, 818, 0, 818, 818, 818, 0, 818, 0, 0, 0,
+    817, 817, 817, 817, 817, 817, 817, 0, 817, 817, 817, 0, 817, 0, 0, 0,
+    817, 817, 817, 0, 817, 0, 0, 0, 817, 0, 0, 0, 0, 0, 0, 0,
+    816, 816, 816, 816, 816, 816, 816, 0, 816, 816, 816, 0, 816, 0, 0, 0,
+    816, 816, 816, 0, 816, 0, 0, 0, 816, 0, 0, 0, 0, 0, 0, 0,
+    816, 816, 816, 0, 816, 0, 0, 0, 816, 0, 0, 0, 0, 0, 0, 0,
+    816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 815, 0, 0, 0, 814, 0, 813, 812, 9,
+    0, 0, 0, 0, 0, 0, 0, 811, 0, 0, 0, 810, 0, 809, 808, 10,
+    0, 0, 0, 807, 0, 806, 805, 805, 0, 804, 803, 803, 802, 802, 8, 8,
+    0, 0, 0, 0, 0, 0, 0, 801, 0, 0, 0, 800, 0, 799, 798, 10,
+    0, 0, 0, 797, 0, 796, 795, 795, 0, 794, 793, 793, 792, 792, 792, 9,
+    0, 0, 0, 791, 0, 790, 789, 789, 0, 788, 787, 787, 786, 786, 786, 10,
+    0, 785, 784, 784, 783, 783, 783, 783, 782, 782, 782, 782, 7, 7, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 781, 0, 0, 0, 780, 0, 779, 778, 10,
+    0, 0, 0, 777, 0, 776, 775, 775, 0, 774, 773, 773, 772, 772, 772, 9,
+    0, 0, 0, 771, 0, 770, 769, 769, 0, 768, 767, 767, 766, 766, 766, 10,
+    0, 765, 764, 764, 763, 763, 763, 763, 762, 762, 762, 762, 762, 762, 8, 0,
+    0, 0, 0, 761, 0, 760, 759, 759, 0, 758, 757, 757, 756, 756, 756, 10,
+    0, 755, 754, 754, 753, 753, 753, 753, 752, 752, 752, 752, 752, 752, 752, 0,
+    0, 751, 750, 750, 749, 749, 749, 749, 748, 748, 748, 748, 748, 748, 748, 0,
+    747, 747, 747, 747, 747, 747, 747, 0, 6, 6, 6, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 746, 0, 0, 0, 745, 0, 744, 743, 10,
+    0, 0, 0, 742, 0, 741, 740, 740, 0, 739, 738, 738, 737, 737, 737, 9,
+    0, 0, 0, 736, 0, 735, 734, 734, 0, 733, 732, 732, 731, 731, 731, 10,
+    0, 730, 729, 729, 728, 728, 728, 728, 727, 727, 727, 727, 727, 727, 8, 0,
+    0, 0, 0, 726, 0, 725, 724, 724, 0, 723, 722, 722, 721, 721, 721, 10,
+    0, 720, 719, 719, 718, 718, 718, 718, 717, 717, 717, 717, 717, 717, 717, 0,
+    0, 716, 715, 715, 714, 714, 714, 714, 713, 713, 713, 713, 713, 713, 713, 0,
+    712, 712, 712, 712, 712, 712, 712, 0, 712, 712, 712, 0, 7, 0, 0, 0,
+    0, 0, 0, 711, 0, 710, 709, 709, 0, 708, 707, 707, 706, 706, 706, 10,
+    0, 705, 704, 704, 703, 703, 703, 703, 702, 702, 702, 702, 702, 702, 702, 0,
+    0, 701, 700, 700, 699, 699, 699, 699, 698, 698, 698, 698, 698, 698, 698, 0,
+    697, 697, 697, 697, 697, 697, 697, 0, 697, 697, 697, 0, 697, 0, 0, 0,
+    0, 696, 695, 695, 694, 694, 694, 694, 693, 693, 693, 693, 693, 693, 693, 0,
+    692, 692, 692, 692, 692, 692, 692, 0, 692, 692, 692, 0, 692, 0, 0, 0,
+    691, 691, 691, 691, 691, 691, 691, 0, 691, 691, 691, 0, 691, 0, 0, 0,
+    5, 5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 689, 0, 688, 687, 10,
+    0, 0, 0, 686, 0, 685, 684, 684, 0, 683, 682, 682, 681, 681, 681, 9,
+    0, 0, 0, 680, 0, 679, 678, 678, 0, 677, 676, 676, 675, 675, 675, 10,
+    0, 674, 673, 673, 672, 672, 672, 672, 671, 671, 671, 671, 671, 671, 8, 0,
+    0, 0, 0, 670, 0, 669, 668, 668, 0, 667, 666, 666, 665, 665, 665, 10,
+    0, 664, 663, 663, 662, 662, 662, 662, 661, 661, 661, 661, 661, 661, 661, 0,
+    0, 660, 659, 659, 658, 658, 658, 658, 657, 657, 657, 657, 657, 657, 657, 0,
+    656, 656, 656, 656, 656, 656, 656, 0, 656, 656, 656, 0, 7, 0, 0, 0,
+    0, 0, 0, 655, 0, 654, 653, 653, 0, 652, 651, 651, 650, 650, 650, 10,
+    0, 649, 648, 648, 647, 647, 647, 647, 646, 646, 646, 646, 646, 646, 646, 0,
+    0, 645, 644, 644, 643, 643, 643, 643, 642, 642, 642, 642, 642, 642, 642, 0,
+    641, 641, 641, 641, 641, 641, 641, 0, 641, 641, 641, 0, 641, 0, 0, 0,
+    0, 640, 639, 639, 638, 638, 638, 638, 637, 637, 637, 637, 637, 637, 637, 0,
+    636, 636, 636, 636, 636, 636, 636, 0, 636, 636, 636, 0, 636, 0, 0, 0,
+    635, 635, 635, 635, 635, 635, 635, 0, 635, 635, 635, 0, 635, 0, 0, 0,
+    635, 635, 635, 0, 635, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 634, 0, 633, 632, 632, 0, 631, 630, 630, 629, 629, 629, 10,
+    0, 628, 627, 627, 626, 626, 626, 626, 625, 625, 625, 625, 625, 625, 625, 0,
+    0, 624, 623, 623, 622, 622, 622, 622, 621, 621, 621, 621, 621, 621, 621, 0,
+    620, 620, 620, 620, 620, 620, 620, 0, 620, 620, 620, 0, 620, 0, 0, 0,
+    0, 619, 618, 618, 617, 617, 617, 617, 616, 616, 616, 616, 616, 616, 616, 0,
+    615, 615, 615, 615, 615, 615, 615, 0, 615, 615, 615, 0, 615, 0, 0, 0,
+    614, 614, 614, 614, 614, 614, 614, 0, 614, 614, 614, 0, 614, 0, 0, 0,
+    614, 614, 614, 0, 614, 0, 0, 0, 614, 0, 0, 0, 0, 0, 0, 0,
+    0, 613, 612, 612, 611, 611, 611, 611, 610, 610, 610, 610, 610, 610, 610, 0,
+    609, 609, 609, 609, 609, 609, 609, 0, 609, 609, 609, 0, 609, 0, 0, 0,
+    608, 608, 608, 608, 608, 608, 608, 0, 608, 608, 608, 0, 608, 0, 0, 0,
+    608, 608, 608, 0, 608, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0,
+    607, 607, 607, 607, 607, 607, 607, 0, 607, 607, 607, 0, 607, 0, 0, 0,
+    607, 607, 607, 0, 607, 0, 0, 0, 607, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 606, 0, 0, 0, 605, 0, 604, 603, 10,
+    0, 0, 0, 602, 0, 601, 600, 600, 0, 599, 598, 598, 597, 597, 597, 9,
+    0, 0, 0, 596, 0, 595, 594, 594, 0, 593, 592, 592, 591, 591, 591, 10,
+    0, 590, 589, 589, 588, 588, 588, 588, 587, 587, 587, 587, 587, 587, 8, 0,
+    0, 0, 0, 586, 0, 585, 584, 584, 0, 583, 582, 582, 581, 581, 581, 10,
+    0, 580, 579, 579, 578, 578, 578, 578, 577, 577, 577, 577, 577, 577, 577, 0,
+    0, 576, 575, 575, 574, 574, 574, 574, 573, 573, 573, 573, 573, 573, 573, 0,
+    572, 572, 572, 572, 572, 572, 572, 0, 572, 572, 572, 0, 7, 0, 0, 0,
+    0, 0, 0, 571, 0, 570, 569, 569, 0, 568, 567, 567, 566, 566, 566, 10,
+    0, 565, 564, 564, 563, 563, 563, 563, 562, 562, 562, 562, 562, 562, 562, 0,
+    0, 561, 560, 560, 559, 559, 559, 559, 558, 558, 558, 558, 558, 558, 558, 0,
+    557, 557, 557, 557, 557, 557, 557, 0, 557, 557, 557, 0, 557, 0, 0, 0,
+    0, 556, 555, 555, 554, 554, 554, 554, 553, 553, 553, 553, 553, 553, 553, 0,
+    552, 552, 552, 552, 552, 552, 552, 0, 552, 552, 552, 0, 552, 0, 0, 0,
+    551, 551, 551, 551, 551, 551, 551, 0, 551, 551, 551, 0, 551, 0, 0, 0,
+    551, 551, 551, 0, 551, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 550, 0, 549, 548, 548, 0, 547, 546, 546, 545, 545, 545, 10,
+    0, 544, 543, 543, 542, 542, 542, 542, 541, 541, 541, 541, 541, 541, 541, 0,
+    0, 540, 539, 539, 538, 538, 538, 538, 537, 537, 537, 537, 537, 537, 537, 0,
+    536, 536, 536, 536, 536, 536, 536, 0, 536, 536, 536, 0, 536, 0, 0, 0,
+    0, 535, 534, 534, 533, 533, 533, 533, 532, 532, 532, 532, 532, 532, 532, 0,
+    531, 531, 531, 531, 531, 531, 531, 0, 531, 531, 531, 0, 531, 0, 0, 0,
+    530, 530, 530, 530, 530, 530, 530, 0, 530, 530, 530, 0, 530, 0, 0, 0,
+    530, 530, 530, 0, 530, 0, 0, 0, 530, 0, 0, 0, 0, 0, 0, 0,
+    0, 529, 528, 528, 527, 527, 527, 527, 526, 526, 526, 526, 526, 526, 526, 0,
+    525, 525, 525, 525, 525, 525, 525, 0, 525, 525, 525, 0, 525, 0, 0, 0,
+    524, 524, 524, 524, 524, 524, 524, 0, 524, 524, 524, 0, 524, 0, 0, 0,
+    524, 524, 524, 0, 524, 0, 0, 0, 524, 0, 0, 0, 0, 0, 0, 0,
+    523, 523, 523, 523, 523, 523, 523, 0, 523, 523, 523, 0, 523, 0, 0, 0,
+    523, 523, 523, 0, 523, 0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0,
+    523, 523, 523, 0, 523, 0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 522, 0, 521, 520, 520, 0, 519, 518, 518, 517, 517, 517, 10,
+    0, 516, 515, 515, 514, 514, 514, 514, 513, 513, 513, 513, 513, 513, 513, 0,
+    0, 512, 511, 511, 510, 510, 510, 510, 509, 509, 509, 509, 509, 509, 509, 0,
+    508, 508, 508, 508, 508, 508, 508, 0, 508, 508, 508, 0, 508, 0, 0, 0,
+    0, 507, 506, 506, 505, 505, 505, 505, 504, 504, 504, 504, 504, 504, 504, 0,
+    503, 503, 503, 503, 503, 503, 503, 0, 503, 503, 503, 0, 503, 0, 0, 0,
+    502, 502, 502, 502, 502, 502, 502, 0, 502, 502, 502, 0, 502, 0, 0, 0,
+    502, 502, 502, 0, 502, 0, 0, 0, 502, 0, 0, 0, 0, 0, 0, 0,
+    0, 501, 500, 500, 499, 499, 499, 499, 498, 498, 498, 498, 498, 498, 498, 0,
+    497, 497, 497, 497, 497, 497, 497, 0, 497, 497, 497, 0, 497, 0, 0, 0,
+    496, 496, 496, 496, 496, 496, 496, 0, 496, 496, 496, 0, 496, 0, 0, 0,
+    496, 496, 496, 0, 496, 0, 0, 0, 496, 0, 0, 0, 0, 0, 0, 0,
+    495, 495, 495, 495, 495, 495, 495, 0, 495, 495, 495, 0, 495, 0, 0, 0,
+    495, 495, 495, 0, 495, 0, 0, 0, 495, 0, 0, 0, 0, 0, 0, 0,
+    495, 495, 495, 0, 495, 0, 0, 0, 495, 0, 0, 0, 0, 0, 0, 0,
+    495, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 494, 493, 493, 492, 492, 492, 492, 491, 491, 491, 491, 491, 491, 491, 0,
+    490, 490, 490, 490, 490, 490, 490, 0, 490, 490, 490, 0, 490, 0, 0, 0,
+    489, 489, 489, 489, 489, 489, 489, 0, 489, 489, 489, 0, 489, 0, 0, 0,
+    489, 489, 489, 0, 489, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0, 0,
+    488, 488, 488, 488, 488, 488, 488, 0, 488, 488, 488, 0, 488, 0, 0, 0,
+    488, 488, 488, 0, 488, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0,
+    488, 488, 488, 0, 488, 0, 0, 0, 488, 0, 0, 0, 0, 0, 0, 0,
+    488, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    487, 487, 487, 487, 487, 487, 487, 0, 487, 487, 487, 0, 487, 0, 0, 0,
+    487, 487, 487, 0, 487, 0, 0, 0, 487, 0, 0, 0, 0, 0, 0, 0,
+    487, 487, 487, 0, 487, 0, 0, 0, 487, 0, 0, 0, 0, 0, 0, 0,
+    487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 486, 0, 0, 0, 485, 0, 484, 483, 10,
+    0, 0, 0, 482, 0, 481, 480, 480, 0, 479, 478, 478, 477, 477, 477, 9,
+    0, 0, 0, 476, 0, 475, 474, 474, 0, 473, 472, 472, 471, 471, 471, 10,
+    0, 470, 469, 469, 468, 468, 468, 468, 467, 467, 467, 467, 467, 467, 8, 0,
+    0, 0, 0, 466, 0, 465, 464, 464, 0, 463, 462, 462, 461, 461, 461, 10,
+    0, 460, 459, 459, 458, 458, 458, 458, 457, 457, 457, 457, 457, 457, 457, 0,
+    0, 456, 455, 455, 454, 454, 454, 454, 453, 453, 453, 453, 453, 453, 453, 0,
+    452, 452, 452, 452, 452, 452, 452, 0, 452, 452, 452, 0, 7, 0, 0, 0,
+    0, 0, 0, 451, 0, 450, 449, 449, 0, 448, 447, 447, 446, 446, 446, 10,
+    0, 445, 444, 444, 443, 443, 443, 443, 442, 442, 442, 442, 442, 442, 442, 0,
+    0, 441, 440, 440, 439, 439, 439, 439, 438, 438, 438, 438, 438, 438, 438, 0,
+    437, 437, 437, 437, 437, 437, 437, 0, 437, 437, 437, 0, 437, 0, 0, 0,
+    0, 436, 435, 435, 434, 434, 434, 434, 433, 433, 433, 433, 433, 433, 433, 0,
+    432, 432, 432, 432, 432, 432, 432, 0, 432, 432, 432, 0, 432, 0, 0, 0,
+    431, 431, 431, 431, 431, 431, 431, 0, 431, 431, 431, 0, 431, 0, 0, 0,
+    431, 431, 431, 0, 431, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 430, 0, 429, 428, 428, 0, 427, 426, 426, 425, 425, 425, 10,
+    0, 424, 423, 423, 422, 422, 422, 422, 421, 421, 421, 421, 421, 421, 421, 0,
+    0, 420, 419, 419, 418, 418, 418, 418, 417, 417, 417, 417, 417, 417, 417, 0,
+    416, 416, 416, 416, 416, 416, 416, 0, 416, 416, 416, 0, 416, 0, 0, 0,
+    0, 415, 414, 414, 413, 413, 413, 413, 412, 412, 412, 412, 412, 412, 412, 0,
+    411, 411, 411, 411, 411, 411, 411, 0, 411, 411, 411, 0, 411, 0, 0, 0,
+    410, 410, 410, 410, 410, 410, 410, 0, 410, 410, 410, 0, 410, 0, 0, 0,
+    410, 410, 410, 0, 410, 0, 0, 0, 410, 0, 0, 0, 0, 0, 0, 0,
+    0, 409, 408, 408, 407, 407, 407, 407, 406, 406, 406, 406, 406, 406, 406, 0,
+    405, 405, 405, 405, 405, 405, 405, 0, 405, 405, 405, 0, 405, 0, 0, 0,
+    404, 404, 404, 404, 404, 404, 404, 0, 404, 404, 404, 0, 404, 0, 0, 0,
+    404, 404, 404, 0, 404, 0, 0, 0, 404, 0, 0, 0, 0, 0, 0, 0,
+    403, 403, 403, 403, 403, 403, 403, 0, 403, 403, 403, 0, 403, 0, 0, 0,
+    403, 403, 403, 0, 403, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0, 0,
+    403, 403, 403, 0, 403, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 402, 0, 401, 400, 400, 0, 399, 398, 398, 397, 397, 397, 10,
+    0, 396, 395, 395, 394, 394, 394, 394, 393, 393, 393, 393, 393, 393, 393, 0,
+    0, 392, 391, 391, 390, 390, 390, 390, 389, 389, 389, 389, 389, 389, 389, 0,
+    388, 388, 388, 388, 388, 388, 388, 0, 388, 388, 388, 0, 388, 0, 0, 0,
+    0, 387, 386, 386, 385, 385, 385, 385, 384, 384, 384, 384, 384, 384, 384, 0,
+    383, 383, 383, 383, 383, 383, 383, 0, 383, 383, 383, 0, 383, 0, 0, 0,
+    382, 382, 382, 382, 382, 382, 382, 0, 382, 382, 382, 0, 382, 0, 0, 0,
+    382, 382, 382, 0, 382, 0, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0,
+    0, 381, 380, 380, 379, 379, 379, 379, 378, 378, 378, 378, 378, 378, 378, 0,
+    377, 377, 377, 377, 377, 377, 377, 0, 377, 377, 377, 0, 377, 0, 0, 0,
+    376, 376, 376, 376, 376, 376, 376, 0, 376, 376, 376, 0, 376, 0, 0, 0,
+    376, 376, 376, 0, 376, 0, 0, 0, 376, 0, 0, 0, 0, 0, 0, 0,
+    375, 375, 375, 375, 375, 375, 375, 0, 375, 375, 375, 0, 375, 0, 0, 0,
+    375, 375, 375, 0, 375, 0, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0,
+    375, 375, 375, 0, 375, 0, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0,
+    375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 374, 373, 373, 372, 372, 372, 372, 371, 371, 371, 371, 371, 371, 371, 0,
+    370, 370, 370, 370, 370, 370, 370, 0, 370, 370, 370, 0, 370, 0, 0, 0,
+    369, 369, 369, 369, 369, 369, 369, 0, 369, 369, 369, 0, 369, 0, 0, 0,
+    369, 369, 369, 0, 369, 0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 0,
+    368, 368, 368, 368, 368, 368, 368, 0, 368, 368, 368, 0, 368, 0, 0, 0,
+    368, 368, 368, 0, 368, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0, 0,
+    368, 368, 368, 0, 368, 0, 0, 0, 368, 0, 0, 0, 0, 0, 0, 0,
+    368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 367, 367, 367, 367, 0, 367, 367, 367, 0, 367, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    367, 367, 367, 0, 367, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0,
+    367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 366, 0, 365, 364, 364, 0, 363, 362, 362, 361, 361, 361, 10,
+    0, 360, 359, 359, 358, 358, 358, 358, 357, 357, 357, 357, 357, 357, 357, 0,
+    0, 356, 355, 355, 354, 354, 354, 354, 353, 353, 353, 353, 353, 353, 353, 0,
+    352, 352, 352, 352, 352, 352, 352, 0, 352, 352, 352, 0, 352, 0, 0, 0,
+    0, 351, 350, 350, 349, 349, 349, 349, 348, 348, 348, 348, 348, 348, 348, 0,
+    347, 347, 347, 347, 347, 347, 347, 0, 347, 347, 347, 0, 347, 0, 0, 0,
+    346, 346, 346, 346, 346, 346, 346, 0, 346, 346, 346, 0, 346, 0, 0, 0,
+    346, 346, 346, 0, 346, 0, 0, 0, 346, 0, 0, 0, 0, 0, 0, 0,
+    0, 345, 344, 344, 343, 343, 343, 343, 342, 342, 342, 342, 342, 342, 342, 0,
+    341, 341, 341, 341, 341, 341, 341, 0, 341, 341, 341, 0, 341, 0, 0, 0,
+    340, 340, 340, 340, 340, 340, 340, 0, 340, 340, 340, 0, 340, 0, 0, 0,
+    340, 340, 340, 0, 340, 0, 0, 0, 340, 0, 0, 0, 0, 0, 0, 0,
+    339, 339, 339, 339, 339, 339, 339, 0, 339, 339, 339, 0, 339, 0, 0, 0,
+    339, 339, 339, 0, 339, 0, 0, 0, 339, 0, 0, 0, 0, 0, 0, 0,
+    339, 339, 339, 0, 339, 0, 0, 0, 339, 0, 0, 0, 0, 0, 0, 0,
+    339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 338, 337, 337, 336, 336, 336, 336, 335, 335, 335, 335, 335, 335, 335, 0,
+    334, 334, 334, 334, 334, 334, 334, 0, 334, 334, 334, 0, 334, 0, 0, 0,
+    333, 333, 333, 333, 333, 333, 333, 0, 333, 333, 333, 0, 333, 0, 0, 0,
+    333, 333, 333, 0, 333, 0, 0, 0, 333, 0, 0, 0, 0, 0, 0, 0,
+    332, 332, 332, 332, 332, 332, 332, 0, 332, 332, 332, 0, 332, 0, 0, 0,
+    332, 332, 332, 0, 332, 0, 0, 0, 332, 0, 0, 0, 0, 0, 0, 0,
+    332, 332, 332, 0, 332, 0, 0, 0, 332, 0, 0, 0, 0, 0, 0, 0,
+    332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 331, 331, 331, 331, 0, 331, 331, 331, 0, 331, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 331, 331, 0, 331, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 330, 329, 329, 328, 328, 328, 328, 327, 327, 327, 327, 327, 327, 327, 0,
+    326, 326, 326, 326, 326, 326, 326, 0, 326, 326, 326, 0, 326, 0, 0, 0,
+    325, 325, 325, 325, 325, 325, 325, 0, 325, 325, 325, 0, 325, 0, 0, 0,
+    325, 325, 325, 0, 325, 0, 0, 0, 325, 0, 0, 0, 0, 0, 0, 0,
+    324, 324, 324, 324, 324, 324, 324, 0, 324, 324, 324, 0, 324, 0, 0, 0,
+    324, 324, 324, 0, 324, 0, 0, 0, 324, 0, 0, 0, 0, 0, 0, 0,
+    324, 324, 324, 0, 324, 0, 0, 0, 324, 0, 0, 0, 0, 0, 0, 0,
+    324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 323, 323, 323, 323, 0, 323, 323, 323, 0, 323, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 323, 323, 0, 323, 0, 0, 0, 323, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned short poker_noflush5[6175] = {
+    11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192,
+    35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753,
+    37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819,
+    205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602,
+    1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613,
+    3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733,
+    194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885,
+    217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328,
+    3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777,
+    3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706,
+    3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838,
+    2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171,
+    2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842,
+    2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932,
+    2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970,
+    231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483,
+    3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494,
+    3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611,
+    3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626,
+    4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714,
+    3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846,
+    3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516,
+    4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954,
+    1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647,
+    2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710,
+    4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747,
+    2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007,
+    2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044,
+    244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550, 1691,
+    2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766,
+    2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392, 6196,
+    3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210,
+    2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354, 3574,
+    1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095,
+    1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913,
+    2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945,
+    1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441,
+    6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477,
+    6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826,
+    7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650, 2649,
+    4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789,
+    4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866, 2656,
+    2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658,
+    4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878,
+    4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033,
+    233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957,
+    4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072, 252,
+    2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103,
+    2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100, 101,
+    18, 1616, 2474, 1682, 30, 1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758, 42, 1635,
+    3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814,
+    1824, 1833, 54, 1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233, 3649,
+    6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309,
+    2837, 1880, 1890, 1899, 1907, 66, 1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782,
+    3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716, 3904,
+    6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448,
+    4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78, 1656, 3361,
+    3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021, 4066,
+    4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350,
+    1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371,
+    4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749, 2859,
+    4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046,
+    2052, 90, 1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371,
+    6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020, 4135,
+    4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560,
+    6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951,
+    6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391, 6610, 6938, 7147, 7272, 1604, 4611, 4686,
+    4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870,
+    4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036,
+    5051, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123, 102, 174, 2545, 2666, 186, 2546, 5086,
+    2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088,
+    2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670,
+    5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043,
+    3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223,
+    2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551, 5091,
+    2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166, 5202,
+    5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 5271, 3112, 3161, 3162, 3163, 3164, 3165, 3166,
+    3167, 258, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168,
+    267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269, 2144, 2154,
+    2163, 2171, 2178, 2184, 2189, 270, 107, 108, 109, 110, 111, 112, 113, 114, 19, 1617,
+    2475, 1683, 31, 1627, 3332, 3552, 1693, 2486, 3772, 2607, 1749, 1759, 43, 1636, 3341, 3561,
+    1702, 3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992, 2618, 4001, 4046, 2728, 1815, 1825, 1834,
+    55, 1644, 3349, 3569, 1710, 3394, 6198, 3614, 3789, 3834, 1776, 3430, 6234, 3650, 6354, 6682,
+    3870, 4009, 4054, 4090, 1842, 2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838, 1881,
+    1891, 1900, 1908, 67, 1651, 3356, 3576, 1717, 3401, 6205, 3621, 3796, 3841, 1783, 3437, 6241,
+    3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849, 3465, 6269, 3685, 6389, 6717, 3905, 6473, 6801,
+    7010, 4125, 4236, 4281, 4317, 4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494, 4530,
+    2849, 4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966, 1974, 1981, 79, 1657, 3362, 3582, 1723,
+    3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247, 3663, 6367, 6695, 3883, 4022, 4067, 4103, 1855,
+    3471, 6275, 3691, 6395, 6723, 3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921, 3492,
+    6296, 3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152, 6556, 6884, 7093, 7218, 4372, 4462, 4507,
+    4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661, 4706, 2761, 4669, 4714, 4750, 2860, 4676, 4721,
+    4757, 4785, 2948, 4682, 4727, 4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053, 91,
+    1662, 3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852, 1794, 3448, 6252, 3668, 6372, 6700, 3888,
+    4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400, 6728, 3916, 6484, 6812, 7021, 4136, 4247, 4292,
+    4328, 4356, 1926, 3497, 6301, 3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889, 7098,
+    7223, 4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512, 6316, 3732, 6436, 6764, 3952, 6520, 6848,
+    7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611, 6939, 7148, 7273, 7342, 4612, 4687, 4732, 4768,
+    4796, 4817, 4832, 2058, 2541, 4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896, 4941,
+    4977, 5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036, 4907, 4952, 4988, 5016, 5037, 5052, 3102,
+    2079, 2089, 2098, 2106, 2113, 2119, 2124, 103, 1666, 3371, 3591, 1732, 3416, 6220, 3636, 3811,
+    3856, 1798, 3452, 6256, 3672, 6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700, 6404,
+    6732, 3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332, 4360, 1930, 3501, 6305, 3721, 6425, 6753,
+    3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102, 7227, 4381, 4471, 4516, 4552, 4580, 4601, 1996,
+    3516, 6320, 3736, 6440, 6768, 3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396, 6615,
+    6943, 7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800, 4821, 4836, 2062, 3526, 6330, 3746, 6450,
+    6778, 3966, 6534, 6862, 7071, 4186, 6590, 6918, 7127, 7252, 4406, 6625, 6953, 7162, 7287, 7356,
+    4626, 6645, 6973, 7182, 7307, 7376, 1605, 4846, 4911, 4956, 4992, 5020, 5041, 5056, 5066, 2128,
+    2552, 5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190, 2882, 5116, 5161, 5197, 5225, 2970, 5122,
+    5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208, 5236, 5257, 5272, 3113, 5131, 5176, 5212, 5240,
+    5261, 5276, 5286, 3168, 2145, 2155, 2164, 2172, 2179, 2185, 2190, 2194, 115, 175, 2556, 2677,
+    187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
+    211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,
+    2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051,
+    3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334,
+    5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122,
+    247, 2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980,
+    5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 5491, 3123, 3172, 3173, 3174,
+    3175, 3176, 3177, 3178, 259, 2563, 5312, 2684, 5321, 5366, 2794, 5329, 5374, 5410, 2893, 5336,
+    5381, 5417, 5445, 2981, 5342, 5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477, 5492,
+    3124, 5351, 5396, 5432, 5460, 5481, 5496, 5506, 3179, 3216, 3217, 3218, 3219, 3220, 3221, 3222,
+    3223, 271, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234,
+    279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 2210, 2220,
+    2229, 2237, 2244, 2250, 2255, 282, 2211, 2221, 2230, 2238, 2245, 2251, 2256, 2260, 283, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 20, 1618, 2476, 1684, 32, 1628, 3333, 3553,
+    1694, 2487, 3773, 2608, 1750, 1760, 44, 1637, 3342, 3562, 1703, 3387, 6191, 3607, 3782, 3827,
+    1769, 2498, 3993, 2619, 4002, 4047, 2729, 1816, 1826, 1835, 56, 1645, 3350, 3570, 1711, 3395,
+    6199, 3615, 3790, 3835, 1777, 3431, 6235, 3651, 6355, 6683, 3871, 4010, 4055, 4091, 1843, 2509,
+    4213, 2630, 4222, 4267, 2740, 4230, 4275, 4311, 2839, 1882, 1892, 1901, 1909, 68, 1652, 3357,
+    3577, 1718, 3402, 6206, 3622, 3797, 3842, 1784, 3438, 6242, 3658, 6362, 6690, 3878, 4017, 4062,
+    4098, 1850, 3466, 6270, 3686, 6390, 6718, 3906, 6474, 6802, 7011, 4126, 4237, 4282, 4318, 4346,
+    1916, 2520, 4433, 2641, 4442, 4487, 2751, 4450, 4495, 4531, 2850, 4457, 4502, 4538, 4566, 2938,
+    1948, 1958, 1967, 1975, 1982, 80, 1658, 3363, 3583, 1724, 3408, 6212, 3628, 3803, 3848, 1790,
+    3444, 6248, 3664, 6368, 6696, 3884, 4023, 4068, 4104, 1856, 3472, 6276, 3692, 6396, 6724, 3912,
+    6480, 6808, 7017, 4132, 4243, 4288, 4324, 4352, 1922, 3493, 6297, 3713, 6417, 6745, 3933, 6501,
+    6829, 7038, 4153, 6557, 6885, 7094, 7219, 4373, 4463, 4508, 4544, 4572, 4593, 1988, 2531, 4653,
+    2652, 4662, 4707, 2762, 4670, 4715, 4751, 2861, 4677, 4722, 4758, 4786, 2949, 4683, 4728, 4764,
+    4792, 4813, 3026, 2014, 2024, 2033, 2041, 2048, 2054, 92, 1663, 3368, 3588, 1729, 3413, 6217,
+    3633, 3808, 3853, 1795, 3449, 6253, 3669, 6373, 6701, 3889, 4028, 4073, 4109, 1861, 3477, 6281,
+    3697, 6401, 6729, 3917, 6485, 6813, 7022, 4137, 4248, 4293, 4329, 4357, 1927, 3498, 6302, 3718,
+    6422, 6750, 3938, 6506, 6834, 7043, 4158, 6562, 6890, 7099, 7224, 4378, 4468, 4513, 4549, 4577,
+    4598, 1993, 3513, 6317, 3733, 6437, 6765, 3953, 6521, 6849, 7058, 4173, 6577, 6905, 7114, 7239,
+    4393, 6612, 6940, 7149, 7274, 7343, 4613, 4688, 4733, 4769, 4797, 4818, 4833, 2059, 2542, 4873,
+    2663, 4882, 4927, 2773, 4890, 4935, 4971, 2872, 4897, 4942, 4978, 5006, 2960, 4903, 4948, 4984,
+    5012, 5033, 3037, 4908, 4953, 4989, 5017, 5038, 5053, 3103, 2080, 2090, 2099, 2107, 2114, 2120,
+    2125, 104, 1667, 3372, 3592, 1733, 3417, 6221, 3637, 3812, 3857, 1799, 3453, 6257, 3673, 6377,
+    6705, 3893, 4032, 4077, 4113, 1865, 3481, 6285, 3701, 6405, 6733, 3921, 6489, 6817, 7026, 4141,
+    4252, 4297, 4333, 4361, 1931, 3502, 6306, 3722, 6426, 6754, 3942, 6510, 6838, 7047, 4162, 6566,
+    6894, 7103, 7228, 4382, 4472, 4517, 4553, 4581, 4602, 1997, 3517, 6321, 3737, 6441, 6769, 3957,
+    6525, 6853, 7062, 4177, 6581, 6909, 7118, 7243, 4397, 6616, 6944, 7153, 7278, 7347, 4617, 4692,
+    4737, 4773, 4801, 4822, 4837, 2063, 3527, 6331, 3747, 6451, 6779, 3967, 6535, 6863, 7072, 4187,
+    6591, 6919, 7128, 7253, 4407, 6626, 6954, 7163, 7288, 7357, 4627, 6646, 6974, 7183, 7308, 7377,
+    7411, 4847, 4912, 4957, 4993, 5021, 5042, 5057, 5067, 2129, 2553, 5093, 2674, 5102, 5147, 2784,
+    5110, 5155, 5191, 2883, 5117, 5162, 5198, 5226, 2971, 5123, 5168, 5204, 5232, 5253, 3048, 5128,
+    5173, 5209, 5237, 5258, 5273, 3114, 5132, 5177, 5213, 5241, 5262, 5277, 5287, 3169, 2146, 2156,
+    2165, 2173, 2180, 2186, 2191, 2195, 116, 1670, 3375, 3595, 1736, 3420, 6224, 3640, 3815, 3860,
+    1802, 3456, 6260, 3676, 6380, 6708, 3896, 4035, 4080, 4116, 1868, 3484, 6288, 3704, 6408, 6736,
+    3924, 6492, 6820, 7029, 4144, 4255, 4300, 4336, 4364, 1934, 3505, 6309, 3725, 6429, 6757, 3945,
+    6513, 6841, 7050, 4165, 6569, 6897, 7106, 7231, 4385, 4475, 4520, 4556, 4584, 4605, 2000, 3520,
+    6324, 3740, 6444, 6772, 3960, 6528, 6856, 7065, 4180, 6584, 6912, 7121, 7246, 4400, 6619, 6947,
+    7156, 7281, 7350, 4620, 4695, 4740, 4776, 4804, 4825, 4840, 2066, 3530, 6334, 3750, 6454, 6782,
+    3970, 6538, 6866, 7075, 4190, 6594, 6922, 7131, 7256, 4410, 6629, 6957, 7166, 7291, 7360, 4630,
+    6649, 6977, 7186, 7311, 7380, 7414, 4850, 4915, 4960, 4996, 5024, 5045, 5060, 5070, 2132, 3536,
+    6340, 3756, 6460, 6788, 3976, 6544, 6872, 7081, 4196, 6600, 6928, 7137, 7262, 4416, 6635, 6963,
+    7172, 7297, 7366, 4636, 6655, 6983, 7192, 7317, 7386, 7420, 4856, 6665, 6993, 7202, 7327, 7396,
+    7430, 1606, 5076, 5135, 5180, 5216, 5244, 5265, 5280, 5290, 5296, 2198, 2564, 5313, 2685, 5322,
+    5367, 2795, 5330, 5375, 5411, 2894, 5337, 5382, 5418, 5446, 2982, 5343, 5388, 5424, 5452, 5473,
+    3059, 5348, 5393, 5429, 5457, 5478, 5493, 3125, 5352, 5397, 5433, 5461, 5482, 5497, 5507, 3180,
+    5355, 5400, 5436, 5464, 5485, 5500, 5510, 5516, 3224, 2212, 2222, 2231, 2239, 2246, 2252, 2257,
+    2261, 2264, 128, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690,
+    5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
+    2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
+    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693, 5539, 5584,
+    2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067,
+    3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629,
+    2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675,
+    5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260, 2574, 5532, 2695, 5541, 5586,
+    2805, 5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665, 2992, 5562, 5607, 5643, 5671, 5692, 3069,
+    5567, 5612, 5648, 5676, 5697, 5712, 3135, 5571, 5616, 5652, 5680, 5701, 5716, 5726, 3190, 3227,
+    3228, 3229, 3230, 3231, 3232, 3233, 3234, 272, 2575, 5533, 2696, 5542, 5587, 2806, 5550, 5595,
+    5631, 2905, 5557, 5602, 5638, 5666, 2993, 5563, 5608, 5644, 5672, 5693, 3070, 5568, 5613, 5649,
+    5677, 5698, 5713, 3136, 5572, 5617, 5653, 5681, 5702, 5717, 5727, 3191, 5575, 5620, 5656, 5684,
+    5705, 5720, 5730, 5736, 3235, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 284, 287,
+    2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284,
+    2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 2276, 2286, 2295, 2303, 2310,
+    2316, 2321, 294, 2277, 2287, 2296, 2304, 2311, 2317, 2322, 2326, 295, 2278, 2288, 2297, 2305,
+    2312, 2318, 2323, 2327, 2330, 296, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+    21, 1619, 2477, 1685, 33, 1629, 3334, 3554, 1695, 2488, 3774, 2609, 1751, 1761, 45, 1638,
+    3343, 3563, 1704, 3388, 6192, 3608, 3783, 3828, 1770, 2499, 3994, 2620, 4003, 4048, 2730, 1817,
+    1827, 1836, 57, 1646, 3351, 3571, 1712, 3396, 6200, 3616, 3791, 3836, 1778, 3432, 6236, 3652,
+    6356, 6684, 3872, 4011, 4056, 4092, 1844, 2510, 4214, 2631, 4223, 4268, 2741, 4231, 4276, 4312,
+    2840, 1883, 1893, 1902, 1910, 69, 1653, 3358, 3578, 1719, 3403, 6207, 3623, 3798, 3843, 1785,
+    3439, 6243, 3659, 6363, 6691, 3879, 4018, 4063, 4099, 1851, 3467, 6271, 3687, 6391, 6719, 3907,
+    6475, 6803, 7012, 4127, 4238, 4283, 4319, 4347, 1917, 2521, 4434, 2642, 4443, 4488, 2752, 4451,
+    4496, 4532, 2851, 4458, 4503, 4539, 4567, 2939, 1949, 1959, 1968, 1976, 1983, 81, 1659, 3364,
+    3584, 1725, 3409, 6213, 3629, 3804, 3849, 1791, 3445, 6249, 3665, 6369, 6697, 3885, 4024, 4069,
+    4105, 1857, 3473, 6277, 3693, 6397, 6725, 3913, 6481, 6809, 7018, 4133, 4244, 4289, 4325, 4353,
+    1923, 3494, 6298, 3714, 6418, 6746, 3934, 6502, 6830, 7039, 4154, 6558, 6886, 7095, 7220, 4374,
+    4464, 4509, 4545, 4573, 4594, 1989, 2532, 4654, 2653, 4663, 4708, 2763, 4671, 4716, 4752, 2862,
+    4678, 4723, 4759, 4787, 2950, 4684, 4729, 4765, 4793, 4814, 3027, 2015, 2025, 2034, 2042, 2049,
+    2055, 93, 1664, 3369, 3589, 1730, 3414, 6218, 3634, 3809, 3854, 1796, 3450, 6254, 3670, 6374,
+    6702, 3890, 4029, 4074, 4110, 1862, 3478, 6282, 3698, 6402, 6730, 3918, 6486, 6814, 7023, 4138,
+    4249, 4294, 4330, 4358, 1928, 3499, 6303, 3719, 6423, 6751, 3939, 6507, 6835, 7044, 4159, 6563,
+    6891, 7100, 7225, 4379, 4469, 4514, 4550, 4578, 4599, 1994, 3514, 6318, 3734, 6438, 6766, 3954,
+    6522, 6850, 7059, 4174, 6578, 6906, 7115, 7240, 4394, 6613, 6941, 7150, 7275, 7344, 4614, 4689,
+    4734, 4770, 4798, 4819, 4834, 2060, 2543, 4874, 2664, 4883, 4928, 2774, 4891, 4936, 4972, 2873,
+    4898, 4943, 4979, 5007, 2961, 4904, 4949, 4985, 5013, 5034, 3038, 4909, 4954, 4990, 5018, 5039,
+    5054, 3104, 2081, 2091, 2100, 2108, 2115, 2121, 2126, 105, 1668, 3373, 3593, 1734, 3418, 6222,
+    3638, 3813, 3858, 1800, 3454, 6258, 3674, 6378, 6706, 3894, 4033, 4078, 4114, 1866, 3482, 6286,
+    3702, 6406, 6734, 3922, 6490, 6818, 7027, 4142, 4253, 4298, 4334, 4362, 1932, 3503, 6307, 3723,
+    6427, 6755, 3943, 6511, 6839, 7048, 4163, 6567, 6895, 7104, 7229, 4383, 4473, 4518, 4554, 4582,
+    4603, 1998, 3518, 6322, 3738, 6442, 6770, 3958, 6526, 6854, 7063, 4178, 6582, 6910, 7119, 7244,
+    4398, 6617, 6945, 7154, 7279, 7348, 4618, 4693, 4738, 4774, 4802, 4823, 4838, 2064, 3528, 6332,
+    3748, 6452, 6780, 3968, 6536, 6864, 7073, 4188, 6592, 6920, 7129, 7254, 4408, 6627, 6955, 7164,
+    7289, 7358, 4628, 6647, 6975, 7184, 7309, 7378, 7412, 4848, 4913, 4958, 4994, 5022, 5043, 5058,
+    5068, 2130, 2554, 5094, 2675, 5103, 5148, 2785, 5111, 5156, 5192, 2884, 5118, 5163, 5199, 5227,
+    2972, 5124, 5169, 5205, 5233, 5254, 3049, 5129, 5174, 5210, 5238, 5259, 5274, 3115, 5133, 5178,
+    5214, 5242, 5263, 5278, 5288, 3170, 2147, 2157, 2166, 2174, 2181, 2187, 2192, 2196, 117, 1671,
+    3376, 3596, 1737, 3421, 6225, 3641, 3816, 3861, 1803, 3457, 6261, 3677, 6381, 6709, 3897, 4036,
+    4081, 4117, 1869, 3485, 6289, 3705, 6409, 6737, 3925, 6493, 6821, 7030, 4145, 4256, 4301, 4337,
+    4365, 1935, 3506, 6310, 3726, 6430, 6758, 3946, 6514, 6842, 7051, 4166, 6570, 6898, 7107, 7232,
+    4386, 4476, 4521, 4557, 4585, 4606, 2001, 3521, 6325, 3741, 6445, 6773, 3961, 6529, 6857, 7066,
+    4181, 6585, 6913, 7122, 7247, 4401, 6620, 6948, 7157, 7282, 7351, 4621, 4696, 4741, 4777, 4805,
+    4826, 4841, 2067, 3531, 6335, 3751, 6455, 6783, 3971, 6539, 6867, 7076, 4191, 6595, 6923, 7132,
+    7257, 4411, 6630, 6958, 7167, 7292, 7361, 4631, 6650, 6978, 7187, 7312, 7381, 7415, 4851, 4916,
+    4961, 4997, 5025, 5046, 5061, 5071, 2133, 3537, 6341, 3757, 6461, 6789, 3977, 6545, 6873, 7082,
+    4197, 6601, 6929, 7138, 7263, 4417, 6636, 6964, 7173, 7298, 7367, 4637, 6656, 6984, 7193, 7318,
+    7387, 7421, 4857, 6666, 6994, 7203, 7328, 7397, 7431, 7445, 5077, 5136, 5181, 5217, 5245, 5266,
+    5281, 5291, 5297, 2199, 2565, 5314, 2686, 5323, 5368, 2796, 5331, 5376, 5412, 2895, 5338, 5383,
+    5419, 5447, 2983, 5344, 5389, 5425, 5453, 5474, 3060, 5349, 5394, 5430, 5458, 5479, 5494, 3126,
+    5353, 5398, 5434, 5462, 5483, 5498, 5508, 3181, 5356, 5401, 5437, 5465, 5486, 5501, 5511, 5517,
+    3225, 2213, 2223, 2232, 2240, 2247, 2253, 2258, 2262, 2265, 129, 1673, 3378, 3598, 1739, 3423,
+    6227, 3643, 3818, 3863, 1805, 3459, 6263, 3679, 6383, 6711, 3899, 4038, 4083, 4119, 1871, 3487,
+    6291, 3707, 6411, 6739, 3927, 6495, 6823, 7032, 4147, 4258, 4303, 4339, 4367, 1937, 3508, 6312,
+    3728, 6432, 6760, 3948, 6516, 6844, 7053, 4168, 6572, 6900, 7109, 7234, 4388, 4478, 4523, 4559,
+    4587, 4608, 2003, 3523, 6327, 3743, 6447, 6775, 3963, 6531, 6859, 7068, 4183, 6587, 6915, 7124,
+    7249, 4403, 6622, 6950, 7159, 7284, 7353, 4623, 4698, 4743, 4779, 4807, 4828, 4843, 2069, 3533,
+    6337, 3753, 6457, 6785, 3973, 6541, 6869, 7078, 4193, 6597, 6925, 7134, 7259, 4413, 6632, 6960,
+    7169, 7294, 7363, 4633, 6652, 6980, 7189, 7314, 7383, 7417, 4853, 4918, 4963, 4999, 5027, 5048,
+    5063, 5073, 2135, 3539, 6343, 3759, 6463, 6791, 3979, 6547, 6875, 7084, 4199, 6603, 6931, 7140,
+    7265, 4419, 6638, 6966, 7175, 7300, 7369, 4639, 6658, 6986, 7195, 7320, 7389, 7423, 4859, 6668,
+    6996, 7205, 7330, 7399, 7433, 7447, 5079, 5138, 5183, 5219, 5247, 5268, 5283, 5293, 5299, 2201,
+    3542, 6346, 3762, 6466, 6794, 3982, 6550, 6878, 7087, 4202, 6606, 6934, 7143, 7268, 4422, 6641,
+    6969, 7178, 7303, 7372, 4642, 6661, 6989, 7198, 7323, 7392, 7426, 4862, 6671, 6999, 7208, 7333,
+    7402, 7436, 7450, 5082, 6675, 7003, 7212, 7337, 7406, 7440, 7454, 1607, 5302, 5358, 5403, 5439,
+    5467, 5488, 5503, 5513, 5519, 5522, 2267, 2576, 5534, 2697, 5543, 5588, 2807, 5551, 5596, 5632,
+    2906, 5558, 5603, 5639, 5667, 2994, 5564, 5609, 5645, 5673, 5694, 3071, 5569, 5614, 5650, 5678,
+    5699, 5714, 3137, 5573, 5618, 5654, 5682, 5703, 5718, 5728, 3192, 5576, 5621, 5657, 5685, 5706,
+    5721, 5731, 5737, 3236, 5578, 5623, 5659, 5687, 5708, 5723, 5733, 5739, 5742, 3269, 2279, 2289,
+    2298, 2306, 2313, 2319, 2324, 2328, 2331, 2333, 141, 177, 2578, 2699, 189, 2579, 5746, 2700,
+    2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702,
+    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758,
+    5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
+    237, 2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001,
+    5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705,
+    5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890,
+    5911, 3079, 5786, 5831, 5867, 5895, 5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+    261, 2585, 5752, 2706, 5761, 5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003,
+    5782, 5827, 5863, 5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917, 5932, 3146, 5791, 5836, 5872,
+    5900, 5921, 5936, 5946, 3201, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 273, 2586, 5753,
+    2707, 5762, 5807, 2817, 5770, 5815, 5851, 2916, 5777, 5822, 5858, 5886, 3004, 5783, 5828, 5864,
+    5892, 5913, 3081, 5788, 5833, 5869, 5897, 5918, 5933, 3147, 5792, 5837, 5873, 5901, 5922, 5937,
+    5947, 3202, 5795, 5840, 5876, 5904, 5925, 5940, 5950, 5956, 3246, 3271, 3272, 3273, 3274, 3275,
+    3276, 3277, 3278, 3279, 285, 2587, 5754, 2708, 5763, 5808, 2818, 5771, 5816, 5852, 2917, 5778,
+    5823, 5859, 5887, 3005, 5784, 5829, 5865, 5893, 5914, 3082, 5789, 5834, 5870, 5898, 5919, 5934,
+    3148, 5793, 5838, 5874, 5902, 5923, 5938, 5948, 3203, 5796, 5841, 5877, 5905, 5926, 5941, 5951,
+    5957, 3247, 5798, 5843, 5879, 5907, 5928, 5943, 5953, 5959, 5962, 3280, 3293, 3294, 3295, 3296,
+    3297, 3298, 3299, 3300, 3301, 3302, 297, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357,
+    302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368,
+    2375, 2381, 305, 2342, 2352, 2361, 2369, 2376, 2382, 2387, 306, 2343, 2353, 2362, 2370, 2377,
+    2383, 2388, 2392, 307, 2344, 2354, 2363, 2371, 2378, 2384, 2389, 2393, 2396, 308, 2345, 2355,
+    2364, 2372, 2379, 2385, 2390, 2394, 2397, 2399, 309, 143, 144, 145, 146, 147, 148, 149,
+    150, 151, 152, 153, 22, 1620, 2478, 1686, 34, 1630, 3335, 3555, 1696, 2489, 3775, 2610,
+    1752, 1762, 46, 1639, 3344, 3564, 1705, 3389, 6193, 3609, 3784, 3829, 1771, 2500, 3995, 2621,
+    4004, 4049, 2731, 1818, 1828, 1837, 58, 1647, 3352, 3572, 1713, 3397, 6201, 3617, 3792, 3837,
+    1779, 3433, 6237, 3653, 6357, 6685, 3873, 4012, 4057, 4093, 1845, 2511, 4215, 2632, 4224, 4269,
+    2742, 4232, 4277, 4313, 2841, 1884, 1894, 1903, 1911, 70, 1654, 3359, 3579, 1720, 3404, 6208,
+    3624, 3799, 3844, 1786, 3440, 6244, 3660, 6364, 6692, 3880, 4019, 4064, 4100, 1852, 3468, 6272,
+    3688, 6392, 6720, 3908, 6476, 6804, 7013, 4128, 4239, 4284, 4320, 4348, 1918, 2522, 4435, 2643,
+    4444, 4489, 2753, 4452, 4497, 4533, 2852, 4459, 4504, 4540, 4568, 2940, 1950, 1960, 1969, 1977,
+    1984, 82, 1660, 3365, 3585, 1726, 3410, 6214, 3630, 3805, 3850, 1792, 3446, 6250, 3666, 6370,
+    6698, 3886, 4025, 4070, 4106, 1858, 3474, 6278, 3694, 6398, 6726, 3914, 6482, 6810, 7019, 4134,
+    4245, 4290, 4326, 4354, 1924, 3495, 6299, 3715, 6419, 6747, 3935, 6503, 6831, 7040, 4155, 6559,
+    6887, 7096, 7221, 4375, 4465, 4510, 4546, 4574, 4595, 1990, 2533, 4655, 2654, 4664, 4709, 2764,
+    4672, 4717, 4753, 2863, 4679, 4724, 4760, 4788, 2951, 4685, 4730, 4766, 4794, 4815, 3028, 2016,
+    2026, 2035, 2043, 2050, 2056, 94, 1665, 3370, 3590, 1731, 3415, 6219, 3635, 3810, 3855, 1797,
+    3451, 6255, 3671, 6375, 6703, 3891, 4030, 4075, 4111, 1863, 3479, 6283, 3699, 6403, 6731, 3919,
+    6487, 6815, 7024, 4139, 4250, 4295, 4331, 4359, 1929, 3500, 6304, 3720, 6424, 6752, 3940, 6508,
+    6836, 7045, 4160, 6564, 6892, 7101, 7226, 4380, 4470, 4515, 4551, 4579, 4600, 1995, 3515, 6319,
+    3735, 6439, 6767, 3955, 6523, 6851, 7060, 4175, 6579, 6907, 7116, 7241, 4395, 6614, 6942, 7151,
+    7276, 7345, 4615, 4690, 4735, 4771, 4799, 4820, 4835, 2061, 2544, 4875, 2665, 4884, 4929, 2775,
+    4892, 4937, 4973, 2874, 4899, 4944, 4980, 5008, 2962, 4905, 4950, 4986, 5014, 5035, 3039, 4910,
+    4955, 4991, 5019, 5040, 5055, 3105, 2082, 2092, 2101, 2109, 2116, 2122, 2127, 106, 1669, 3374,
+    3594, 1735, 3419, 6223, 3639, 3814, 3859, 1801, 3455, 6259, 3675, 6379, 6707, 3895, 4034, 4079,
+    4115, 1867, 3483, 6287, 3703, 6407, 6735, 3923, 6491, 6819, 7028, 4143, 4254, 4299, 4335, 4363,
+    1933, 3504, 6308, 3724, 6428, 6756, 3944, 6512, 6840, 7049, 4164, 6568, 6896, 7105, 7230, 4384,
+    4474, 4519, 4555, 4583, 4604, 1999, 3519, 6323, 3739, 6443, 6771, 3959, 6527, 6855, 7064, 4179,
+    6583, 6911, 7120, 7245, 4399, 6618, 6946, 7155, 7280, 7349, 4619, 4694, 4739, 4775, 4803, 4824,
+    4839, 2065, 3529, 6333, 3749, 6453, 6781, 3969, 6537, 6865, 7074, 4189, 6593, 6921, 7130, 7255,
+    4409, 6628, 6956, 7165, 7290, 7359, 4629, 6648, 6976, 7185, 7310, 7379, 7413, 4849, 4914, 4959,
+    4995, 5023, 5044, 5059, 5069, 2131, 2555, 5095, 2676, 5104, 5149, 2786, 5112, 5157, 5193, 2885,
+    5119, 5164, 5200, 5228, 2973, 5125, 5170, 5206, 5234, 5255, 3050, 5130, 5175, 5211, 5239, 5260,
+    5275, 3116, 5134, 5179, 5215, 5243, 5264, 5279, 5289, 3171, 2148, 2158, 2167, 2175, 2182, 2188,
+    2193, 2197, 118, 1672, 3377, 3597, 1738, 3422, 6226, 3642, 3817, 3862, 1804, 3458, 6262, 3678,
+    6382, 6710, 3898, 4037, 4082, 4118, 1870, 3486, 6290, 3706, 6410, 6738, 3926, 6494, 6822, 7031,
+    4146, 4257, 4302, 4338, 4366, 1936, 3507, 6311, 3727, 6431, 6759, 3947, 6515, 6843, 7052, 4167,
+    6571, 6899, 7108, 7233, 4387, 4477, 4522, 4558, 4586, 4607, 2002, 3522, 6326, 3742, 6446, 6774,
+    3962, 6530, 6858, 7067, 4182, 6586, 6914, 7123, 7248, 4402, 6621, 6949, 7158, 7283, 7352, 4622,
+    4697, 4742, 4778, 4806, 4827, 4842, 2068, 3532, 6336, 3752, 6456, 6784, 3972, 6540, 6868, 7077,
+    4192, 6596, 6924, 7133, 7258, 4412, 6631, 6959, 7168, 7293, 7362, 4632, 6651, 6979, 7188, 7313,
+    7382, 7416, 4852, 4917, 4962, 4998, 5026, 5047, 5062, 5072, 2134, 3538, 6342, 3758, 6462, 6790,
+    3978, 6546, 6874, 7083, 4198, 6602, 6930, 7139, 7264, 4418, 6637, 6965, 7174, 7299, 7368, 4638,
+    6657, 6985, 7194, 7319, 7388, 7422, 4858, 6667, 6995, 7204, 7329, 7398, 7432, 7446, 5078, 5137,
+    5182, 5218, 5246, 5267, 5282, 5292, 5298, 2200, 2566, 5315, 2687, 5324, 5369, 2797, 5332, 5377,
+    5413, 2896, 5339, 5384, 5420, 5448, 2984, 5345, 5390, 5426, 5454, 5475, 3061, 5350, 5395, 5431,
+    5459, 5480, 5495, 3127, 5354, 5399, 5435, 5463, 5484, 5499, 5509, 3182, 5357, 5402, 5438, 5466,
+    5487, 5502, 5512, 5518, 3226, 2214, 2224, 2233, 2241, 2248, 2254, 2259, 2263, 2266, 130, 1674,
+    3379, 3599, 1740, 3424, 6228, 3644, 3819, 3864, 1806, 3460, 6264, 3680, 6384, 6712, 3900, 4039,
+    4084, 4120, 1872, 3488, 6292, 3708, 6412, 6740, 3928, 6496, 6824, 7033, 4148, 4259, 4304, 4340,
+    4368, 1938, 3509, 6313, 3729, 6433, 6761, 3949, 6517, 6845, 7054, 4169, 6573, 6901, 7110, 7235,
+    4389, 4479, 4524, 4560, 4588, 4609, 2004, 3524, 6328, 3744, 6448, 6776, 3964, 6532, 6860, 7069,
+    4184, 6588, 6916, 7125, 7250, 4404, 6623, 6951, 7160, 7285, 7354, 4624, 4699, 4744, 4780, 4808,
+    4829, 4844, 2070, 3534, 6338, 3754, 6458, 6786, 3974, 6542, 6870, 7079, 4194, 6598, 6926, 7135,
+    7260, 4414, 6633, 6961, 7170, 7295, 7364, 4634, 6653, 6981, 7190, 7315, 7384, 7418, 4854, 4919,
+    4964, 5000, 5028, 5049, 5064, 5074, 2136, 3540, 6344, 3760, 6464, 6792, 3980, 6548, 6876, 7085,
+    4200, 6604, 6932, 7141, 7266, 4420, 6639, 6967, 7176, 7301, 7370, 4640, 6659, 6987, 7196, 7321,
+    7390, 7424, 4860, 6669, 6997, 7206, 7331, 7400, 7434, 7448, 5080, 5139, 5184, 5220, 5248, 5269,
+    5284, 5294, 5300, 2202, 3543, 6347, 3763, 6467, 6795, 3983, 6551, 6879, 7088, 4203, 6607, 6935,
+    7144, 7269, 4423, 6642, 6970, 7179, 7304, 7373, 4643, 6662, 6990, 7199, 7324, 7393, 7427, 4863,
+    6672, 7000, 7209, 7334, 7403, 7437, 7451, 5083, 6676, 7004, 7213, 7338, 7407, 7441, 7455, 7459,
+    5303, 5359, 5404, 5440, 5468, 5489, 5504, 5514, 5520, 5523, 2268, 2577, 5535, 2698, 5544, 5589,
+    2808, 5552, 5597, 5633, 2907, 5559, 5604, 5640, 5668, 2995, 5565, 5610, 5646, 5674, 5695, 3072,
+    5570, 5615, 5651, 5679, 5700, 5715, 3138, 5574, 5619, 5655, 5683, 5704, 5719, 5729, 3193, 5577,
+    5622, 5658, 5686, 5707, 5722, 5732, 5738, 3237, 5579, 5624, 5660, 5688, 5709, 5724, 5734, 5740,
+    5743, 3270, 2280, 2290, 2299, 2307, 2314, 2320, 2325, 2329, 2332, 2334, 142, 1675, 3380, 3600,
+    1741, 3425, 6229, 3645, 3820, 3865, 1807, 3461, 6265, 3681, 6385, 6713, 3901, 4040, 4085, 4121,
+    1873, 3489, 6293, 3709, 6413, 6741, 3929, 6497, 6825, 7034, 4149, 4260, 4305, 4341, 4369, 1939,
+    3510, 6314, 3730, 6434, 6762, 3950, 6518, 6846, 7055, 4170, 6574, 6902, 7111, 7236, 4390, 4480,
+    4525, 4561, 4589, 4610, 2005, 3525, 6329, 3745, 6449, 6777, 3965, 6533, 6861, 7070, 4185, 6589,
+    6917, 7126, 7251, 4405, 6624, 6952, 7161, 7286, 7355, 4625, 4700, 4745, 4781, 4809, 4830, 4845,
+    2071, 3535, 6339, 3755, 6459, 6787, 3975, 6543, 6871, 7080, 4195, 6599, 6927, 7136, 7261, 4415,
+    6634, 6962, 7171, 7296, 7365, 4635, 6654, 6982, 7191, 7316, 7385, 7419, 4855, 4920, 4965, 5001,
+    5029, 5050, 5065, 5075, 2137, 3541, 6345, 3761, 6465, 6793, 3981, 6549, 6877, 7086, 4201, 6605,
+    6933, 7142, 7267, 4421, 6640, 6968, 7177, 7302, 7371, 4641, 6660, 6988, 7197, 7322, 7391, 7425,
+    4861, 6670, 6998, 7207, 7332, 7401, 7435, 7449, 5081, 5140, 5185, 5221, 5249, 5270, 5285, 5295,
+    5301, 2203, 3544, 6348, 3764, 6468, 6796, 3984, 6552, 6880, 7089, 4204, 6608, 6936, 7145, 7270,
+    4424, 6643, 6971, 7180, 7305, 7374, 4644, 6663, 6991, 7200, 7325, 7394, 7428, 4864, 6673, 7001,
+    7210, 7335, 7404, 7438, 7452, 5084, 6677, 7005, 7214, 7339, 7408, 7442, 7456, 7460, 5304, 5360,
+    5405, 5441, 5469, 5490, 5505, 5515, 5521, 5524, 2269, 3545, 6349, 3765, 6469, 6797, 3985, 6553,
+    6881, 7090, 4205, 6609, 6937, 7146, 7271, 4425, 6644, 6972, 7181, 7306, 7375, 4645, 6664, 6992,
+    7201, 7326, 7395, 7429, 4865, 6674, 7002, 7211, 7336, 7405, 7439, 7453, 5085, 6678, 7006, 7215,
+    7340, 7409, 7443, 7457, 7461, 5305, 1609, 7007, 7216, 7341, 7410, 7444, 7458, 7462, 1608, 5525,
+    5580, 5625, 5661, 5689, 5710, 5725, 5735, 5741, 5744, 5745, 2335, 2588, 5755, 2709, 5764, 5809,
+    2819, 5772, 5817, 5853, 2918, 5779, 5824, 5860, 5888, 3006, 5785, 5830, 5866, 5894, 5915, 3083,
+    5790, 5835, 5871, 5899, 5920, 5935, 3149, 5794, 5839, 5875, 5903, 5924, 5939, 5949, 3204, 5797,
+    5842, 5878, 5906, 5927, 5942, 5952, 5958, 3248, 5799, 5844, 5880, 5908, 5929, 5944, 5954, 5960,
+    5963, 3281, 5800, 5845, 5881, 5909, 5930, 5945, 5955, 5961, 5964, 5965, 3303, 2346, 2356, 2365,
+    2373, 2380, 2386, 2391, 2395, 2398, 2400, 2401, 154, 178, 2589, 2710, 190, 2590, 5966, 2711,
+    2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713,
+    5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978,
+    6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088,
+    238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012,
+    6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2595, 5971, 2716,
+    5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110,
+    6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211,
+    262, 2596, 5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077, 6105, 3014,
+    6002, 6047, 6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116, 6137, 6152, 3157, 6011, 6056, 6092,
+    6120, 6141, 6156, 6166, 3212, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 274, 2597, 5973,
+    2718, 5982, 6027, 2828, 5990, 6035, 6071, 2927, 5997, 6042, 6078, 6106, 3015, 6003, 6048, 6084,
+    6112, 6133, 3092, 6008, 6053, 6089, 6117, 6138, 6153, 3158, 6012, 6057, 6093, 6121, 6142, 6157,
+    6167, 3213, 6015, 6060, 6096, 6124, 6145, 6160, 6170, 6176, 3257, 3282, 3283, 3284, 3285, 3286,
+    3287, 3288, 3289, 3290, 286, 2598, 5974, 2719, 5983, 6028, 2829, 5991, 6036, 6072, 2928, 5998,
+    6043, 6079, 6107, 3016, 6004, 6049, 6085, 6113, 6134, 3093, 6009, 6054, 6090, 6118, 6139, 6154,
+    3159, 6013, 6058, 6094, 6122, 6143, 6158, 6168, 3214, 6016, 6061, 6097, 6125, 6146, 6161, 6171,
+    6177, 3258, 6018, 6063, 6099, 6127, 6148, 6163, 6173, 6179, 6182, 3291, 3304, 3305, 3306, 3307,
+    3308, 3309, 3310, 3311, 3312, 3313, 298, 2599, 5975, 2720, 5984, 6029, 2830, 5992, 6037, 6073,
+    2929, 5999, 6044, 6080, 6108, 3017, 6005, 6050, 6086, 6114, 6135, 3094, 6010, 6055, 6091, 6119,
+    6140, 6155, 3160, 6014, 6059, 6095, 6123, 6144, 6159, 6169, 3215, 6017, 6062, 6098, 6126, 6147,
+    6162, 6172, 6178, 3259, 6019, 6064, 6100, 6128, 6149, 6164, 6174, 6180, 6183, 3292, 6020, 6065,
+    6101, 6129, 6150, 6165, 6175, 6181, 6184, 6185, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321,
+    3322, 3323, 3324, 3325, 310, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405,
+    2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447,
+    317, 2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 2409, 2419, 2428, 2436, 2443, 2449, 2454,
+    2458, 319, 2410, 2420, 2429, 2437, 2444, 2450, 2455, 2459, 2462, 320, 2411, 2421, 2430, 2438,
+    2445, 2451, 2456, 2460, 2463, 2465, 321, 2412, 2422, 2431, 2439, 2446, 2452, 2457, 2461, 2464,
+    2466, 2467, 322, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166
+};
+
+static const unsigned short poker_noflush7[49205] = {
+    11, 23, 11, 167, 23, 11, 167, 179, 23, 12, 168, 191, 180, 24, 35, 35,
+    35, 36, 11, 167, 23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191,
+    192, 180, 35, 35, 36, 11, 167, 179, 23, 12, 169, 2468, 181, 24, 168, 2479,
+    2600, 180, 191, 193, 192, 35, 36, 13, 169, 203, 181, 25, 169, 203, 204, 181,
+    203, 205, 204, 193, 193, 37, 47, 47, 47, 48, 47, 47, 48, 47, 48, 49,
+    11, 167, 23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191, 192, 180,
+    35, 35, 36, 11, 167, 179, 23, 12, 1600, 1600, 1600, 24, 168, 1600, 1600, 180,
+    191, 1600, 192, 35, 36, 13, 169, 2469, 181, 25, 169, 1600, 1600, 181, 2480, 1600,
+    2601, 193, 193, 37, 169, 203, 204, 181, 203, 1600, 204, 205, 205, 193, 47, 47,
+    48, 47, 48, 49, 11, 167, 179, 23, 12, 170, 2468, 182, 24, 168, 2479, 2600,
+    180, 191, 194, 192, 35, 36, 13, 170, 2469, 182, 25, 170, 1600, 1600, 182, 2480,
+    1600, 2601, 194, 194, 37, 169, 2490, 2611, 181, 2491, 1600, 2612, 2721, 2722, 193, 203,
+    206, 204, 206, 206, 205, 47, 48, 49, 14, 170, 215, 182, 26, 170, 215, 216,
+    182, 215, 217, 216, 194, 194, 38, 170, 215, 216, 182, 215, 1600, 216, 217, 217,
+    194, 215, 218, 216, 218, 218, 217, 206, 206, 206, 50, 59, 59, 59, 60, 59,
+    59, 60, 59, 60, 61, 59, 59, 60, 59, 60, 61, 59, 60, 61, 62, 11,
+    167, 23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191, 192, 180, 35,
+    35, 36, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 169, 2469, 181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601,
+    193, 193, 37, 169, 203, 204, 181, 203, 1808, 204, 205, 205, 193, 47, 47, 48,
+    47, 48, 49, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 1600, 1600, 1601, 2480, 1600,
+    1601, 1743, 1601, 37, 169, 2490, 2611, 181, 2491, 1600, 1601, 2721, 1601, 193, 203, 1808,
+    204, 1809, 1601, 205, 47, 48, 49, 14, 170, 2470, 182, 26, 170, 2501, 2622, 182,
+    2481, 2732, 2602, 194, 194, 38, 170, 2501, 2622, 182, 2502, 1600, 1601, 2732, 1601, 194,
+    2492, 2831, 2613, 2831, 1601, 2723, 206, 206, 206, 50, 170, 215, 216, 182, 215, 1874,
+    216, 217, 217, 194, 215, 1874, 216, 1875, 1601, 217, 218, 218, 218, 206, 59, 59,
+    60, 59, 60, 61, 59, 60, 61, 62, 11, 167, 179, 23, 12, 171, 2468, 183,
+    24, 168, 2479, 2600, 180, 191, 195, 192, 35, 36, 13, 171, 2469, 183, 25, 171,
+    2512, 2633, 183, 2480, 2743, 2601, 195, 195, 37, 169, 2490, 2611, 181, 2491, 2842, 2612,
+    2721, 2722, 193, 203, 207, 204, 207, 207, 205, 47, 48, 49, 14, 171, 2470, 183,
+    26, 171, 2512, 2633, 183, 2481, 2743, 2602, 195, 195, 38, 171, 2512, 2633, 183, 2513,
+    1600, 1601, 2743, 1601, 195, 2492, 2842, 2613, 2842, 1601, 2723, 207, 207, 207, 50, 170,
+    2501, 2622, 182, 2502, 2930, 2623, 2732, 2733, 194, 2503, 2930, 2624, 2930, 1601, 2734, 2831,
+    2832, 2833, 206, 215, 219, 216, 219, 219, 217, 219, 219, 219, 218, 59, 60, 61,
+    62, 15, 171, 227, 183, 27, 171, 227, 228, 183, 227, 229, 228, 195, 195, 39,
+    171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 230, 228, 230, 230, 229,
+    207, 207, 207, 51, 171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 1940,
+    228, 1941, 1601, 229, 230, 230, 230, 207, 227, 231, 228, 231, 231, 229, 231, 231,
+    231, 230, 219, 219, 219, 219, 63, 71, 71, 71, 72, 71, 71, 72, 71, 72,
+    73, 71, 71, 72, 71, 72, 73, 71, 72, 73, 74, 71, 71, 72, 71, 72,
+    73, 71, 72, 73, 74, 71, 72, 73, 74, 75, 11, 167, 23, 11, 167, 179,
+    23, 12, 168, 2468, 180, 24, 168, 191, 192, 180, 35, 35, 36, 11, 167, 179,
+    23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13,
+    169, 2469, 181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601, 193, 193, 37, 169, 203,
+    204, 181, 203, 1808, 204, 205, 205, 193, 47, 47, 48, 47, 48, 49, 11, 167,
+    179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36,
+    13, 1611, 2469, 1677, 25, 1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37, 169,
+    2490, 2611, 181, 2491, 1600, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47,
+    48, 49, 14, 170, 2470, 182, 26, 170, 2501, 2622, 182, 2481, 2732, 2602, 194, 194,
+    38, 170, 2501, 2622, 182, 2502, 1600, 2623, 2732, 2733, 194, 2492, 2831, 2613, 2831, 2832,
+    2723, 206, 206, 206, 50, 170, 215, 216, 182, 215, 1874, 216, 217, 217, 194, 215,
+    1874, 216, 1875, 1885, 217, 218, 218, 218, 206, 59, 59, 60, 59, 60, 61, 59,
+    60, 61, 62, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766,
+    2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808,
+    204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688,
+    2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 1602, 1600, 1601, 1602, 1601, 1602,
+    2492, 3987, 2613, 1602, 1601, 1602, 1810, 1820, 1602, 50, 170, 2501, 2622, 182, 2502, 4206,
+    2623, 2732, 2733, 194, 2503, 4207, 2624, 1602, 1601, 1602, 2831, 2832, 1602, 206, 215, 1874,
+    216, 1875, 1885, 217, 1876, 1886, 1602, 218, 59, 60, 61, 62, 15, 171, 2471, 183,
+    27, 171, 2512, 2633, 183, 2482, 2743, 2603, 195, 195, 39, 171, 2512, 2633, 183, 2513,
+    4426, 2634, 2743, 2744, 195, 2493, 2842, 2614, 2842, 2843, 2724, 207, 207, 207, 51, 171,
+    2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 1602, 1601, 1602, 2842,
+    2843, 1602, 207, 2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 1602, 2834, 219, 219, 219,
+    219, 63, 171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 1940, 228, 1941,
+    1951, 229, 230, 230, 230, 207, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1602, 230,
+    231, 231, 231, 231, 219, 71, 71, 72, 71, 72, 73, 71, 72, 73, 74, 71,
+    72, 73, 74, 75, 11, 167, 179, 23, 12, 172, 2468, 184, 24, 168, 2479, 2600,
+    180, 191, 196, 192, 35, 36, 13, 172, 2469, 184, 25, 172, 2523, 2644, 184, 2480,
+    2754, 2601, 196, 196, 37, 169, 2490, 2611, 181, 2491, 2853, 2612, 2721, 2722, 193, 203,
+    208, 204, 208, 208, 205, 47, 48, 49, 14, 172, 2470, 184, 26, 172, 2523, 2644,
+    184, 2481, 2754, 2602, 196, 196, 38, 172, 2523, 2644, 184, 2524, 1600, 2645, 2754, 2755,
+    196, 2492, 2853, 2613, 2853, 2854, 2723, 208, 208, 208, 50, 170, 2501, 2622, 182, 2502,
+    2941, 2623, 2732, 2733, 194, 2503, 2941, 2624, 2941, 2942, 2734, 2831, 2832, 2833, 206, 215,
+    220, 216, 220, 220, 217, 220, 220, 220, 218, 59, 60, 61, 62, 15, 172, 2471,
+    184, 27, 172, 2523, 2644, 184, 2482, 2754, 2603, 196, 196, 39, 172, 2523, 2644, 184,
+    2524, 4646, 2645, 2754, 2755, 196, 2493, 2853, 2614, 2853, 2854, 2724, 208, 208, 208, 51,
+    172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 1602, 1601, 1602,
+    2853, 2854, 1602, 208, 2504, 2941, 2625, 2941, 2942, 2735, 2941, 2942, 1602, 2834, 220, 220,
+    220, 220, 63, 171, 2512, 2633, 183, 2513, 3018, 2634, 2743, 2744, 195, 2514, 3018, 2635,
+    3018, 3019, 2745, 2842, 2843, 2844, 207, 2515, 3018, 2636, 3018, 3019, 2746, 3018, 3019, 1602,
+    2845, 2930, 2931, 2932, 2933, 219, 227, 232, 228, 232, 232, 229, 232, 232, 232, 230,
+    232, 232, 232, 232, 231, 71, 72, 73, 74, 75, 16, 172, 239, 184, 28, 172,
+    239, 240, 184, 239, 241, 240, 196, 196, 40, 172, 239, 240, 184, 239, 2006, 240,
+    241, 241, 196, 239, 242, 240, 242, 242, 241, 208, 208, 208, 52, 172, 239, 240,
+    184, 239, 2006, 240, 241, 241, 196, 239, 2006, 240, 2007, 2017, 241, 242, 242, 242,
+    208, 239, 243, 240, 243, 243, 241, 243, 243, 243, 242, 220, 220, 220, 220, 64,
+    172, 239, 240, 184, 239, 2006, 240, 241, 241, 196, 239, 2006, 240, 2007, 2017, 241,
+    242, 242, 242, 208, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 1602, 242, 243, 243,
+    243, 243, 220, 239, 244, 240, 244, 244, 241, 244, 244, 244, 242, 244, 244, 244,
+    244, 243, 232, 232, 232, 232, 232, 76, 83, 83, 83, 84, 83, 83, 84, 83,
+    84, 85, 83, 83, 84, 83, 84, 85, 83, 84, 85, 86, 83, 83, 84, 83,
+    84, 85, 83, 84, 85, 86, 83, 84, 85, 86, 87, 83, 83, 84, 83, 84,
+    85, 83, 84, 85, 86, 83, 84, 85, 86, 87, 83, 84, 85, 86, 87, 88,
+    11, 167, 23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191, 192, 180,
+    35, 35, 36, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 169, 2469, 181, 25, 169, 2490, 2611, 181, 2480, 2721,
+    2601, 193, 193, 37, 169, 203, 204, 181, 203, 1808, 204, 205, 205, 193, 47, 47,
+    48, 47, 48, 49, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600,
+    180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 1600, 1600, 1687, 2480,
+    1600, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 1600, 2612, 2721, 2722, 193, 203,
+    1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 170, 2470, 182, 26, 170, 2501, 2622,
+    182, 2481, 2732, 2602, 194, 194, 38, 170, 2501, 2622, 182, 2502, 1600, 2623, 2732, 2733,
+    194, 2492, 2831, 2613, 2831, 2832, 2723, 206, 206, 206, 50, 170, 215, 216, 182, 215,
+    1874, 216, 217, 217, 194, 215, 1874, 216, 1875, 1885, 217, 218, 218, 218, 206, 59,
+    59, 60, 59, 60, 61, 59, 60, 61, 62, 11, 167, 179, 23, 12, 1610, 2468,
+    1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25,
+    1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986,
+    2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470,
+    1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697,
+    3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820, 1829, 50,
+    170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 1601, 2734,
+    2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60,
+    61, 62, 15, 171, 2471, 183, 27, 171, 2512, 2633, 183, 2482, 2743, 2603, 195, 195,
+    39, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2493, 2842, 2614, 2842, 2843,
+    2724, 207, 207, 207, 51, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514,
+    4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844, 207, 2504, 2930, 2625, 2930, 2931, 2735, 2930,
+    2931, 2932, 2834, 219, 219, 219, 219, 63, 171, 227, 228, 183, 227, 1940, 228, 229,
+    229, 195, 227, 1940, 228, 1941, 1951, 229, 230, 230, 230, 207, 227, 1940, 228, 1941,
+    1951, 229, 1942, 1952, 1961, 230, 231, 231, 231, 231, 219, 71, 71, 72, 71, 72,
+    73, 71, 72, 73, 74, 71, 72, 73, 74, 75, 11, 167, 179, 23, 12, 1610,
+    2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677,
+    25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491,
+    3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612,
+    2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556,
+    1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829,
+    50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261,
+    2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59,
+    60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745,
+    1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997,
+    4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772,
+    1603, 1603, 1603, 1602, 1601, 1602, 1603, 1603, 1602, 1603, 2504, 4208, 2625, 4217, 4262, 2735,
+    1603, 1603, 1602, 1603, 1877, 1887, 1896, 1603, 63, 171, 2512, 2633, 183, 2513, 4426, 2634,
+    2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636,
+    4437, 4482, 2746, 1603, 1603, 1602, 1603, 2930, 2931, 2932, 1603, 219, 227, 1940, 228, 1941,
+    1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1603, 231, 71, 72, 73, 74, 75,
+    16, 172, 2472, 184, 28, 172, 2523, 2644, 184, 2483, 2754, 2604, 196, 196, 40, 172,
+    2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2494, 2853, 2615, 2853, 2854, 2725, 208,
+    208, 208, 52, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646,
+    4656, 4701, 2756, 2853, 2854, 2855, 208, 2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943,
+    2835, 220, 220, 220, 220, 64, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196,
+    2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757,
+    1603, 1603, 1602, 1603, 2941, 2942, 2943, 1603, 220, 2516, 3018, 2637, 3018, 3019, 2747, 3018,
+    3019, 3020, 2846, 3018, 3019, 3020, 1603, 2934, 232, 232, 232, 232, 232, 76, 172, 239,
+    240, 184, 239, 2006, 240, 241, 241, 196, 239, 2006, 240, 2007, 2017, 241, 242, 242,
+    242, 208, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 243, 243, 243, 243,
+    220, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 1603, 243,
+    244, 244, 244, 244, 244, 232, 83, 83, 84, 83, 84, 85, 83, 84, 85, 86,
+    83, 84, 85, 86, 87, 83, 84, 85, 86, 87, 88, 11, 167, 179, 23, 12,
+    173, 2468, 185, 24, 168, 2479, 2600, 180, 191, 197, 192, 35, 36, 13, 173, 2469,
+    185, 25, 173, 2534, 2655, 185, 2480, 2765, 2601, 197, 197, 37, 169, 2490, 2611, 181,
+    2491, 2864, 2612, 2721, 2722, 193, 203, 209, 204, 209, 209, 205, 47, 48, 49, 14,
+    173, 2470, 185, 26, 173, 2534, 2655, 185, 2481, 2765, 2602, 197, 197, 38, 173, 2534,
+    2655, 185, 2535, 1600, 2656, 2765, 2766, 197, 2492, 2864, 2613, 2864, 2865, 2723, 209, 209,
+    209, 50, 170, 2501, 2622, 182, 2502, 2952, 2623, 2732, 2733, 194, 2503, 2952, 2624, 2952,
+    2953, 2734, 2831, 2832, 2833, 206, 215, 221, 216, 221, 221, 217, 221, 221, 221, 218,
+    59, 60, 61, 62, 15, 173, 2471, 185, 27, 173, 2534, 2655, 185, 2482, 2765, 2603,
+    197, 197, 39, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2493, 2864, 2614,
+    2864, 2865, 2724, 209, 209, 209, 51, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766,
+    197, 2536, 4867, 2657, 4876, 1601, 2767, 2864, 2865, 2866, 209, 2504, 2952, 2625, 2952, 2953,
+    2735, 2952, 2953, 2954, 2834, 221, 221, 221, 221, 63, 171, 2512, 2633, 183, 2513, 3029,
+    2634, 2743, 2744, 195, 2514, 3029, 2635, 3029, 3030, 2745, 2842, 2843, 2844, 207, 2515, 3029,
+    2636, 3029, 3030, 2746, 3029, 3030, 3031, 2845, 2930, 2931, 2932, 2933, 219, 227, 233, 228,
+    233, 233, 229, 233, 233, 233, 230, 233, 233, 233, 233, 231, 71, 72, 73, 74,
+    75, 16, 173, 2472, 185, 28, 173, 2534, 2655, 185, 2483, 2765, 2604, 197, 197, 40,
+    173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2494, 2864, 2615, 2864, 2865, 2725,
+    209, 209, 209, 52, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867,
+    2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2505, 2952, 2626, 2952, 2953, 2736, 2952, 2953,
+    2954, 2835, 221, 221, 221, 221, 64, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766,
+    197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922,
+    2768, 1603, 1603, 1602, 1603, 2952, 2953, 2954, 1603, 221, 2516, 3029, 2637, 3029, 3030, 2747,
+    3029, 3030, 3031, 2846, 3029, 3030, 3031, 1603, 2934, 233, 233, 233, 233, 233, 76, 172,
+    2523, 2644, 184, 2524, 3095, 2645, 2754, 2755, 196, 2525, 3095, 2646, 3095, 3096, 2756, 2853,
+    2854, 2855, 208, 2526, 3095, 2647, 3095, 3096, 2757, 3095, 3096, 3097, 2856, 2941, 2942, 2943,
+    2944, 220, 2527, 3095, 2648, 3095, 3096, 2758, 3095, 3096, 3097, 2857, 3095, 3096, 3097, 1603,
+    2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 245, 240, 245, 245, 241, 245, 245, 245,
+    242, 245, 245, 245, 245, 243, 245, 245, 245, 245, 245, 244, 83, 84, 85, 86,
+    87, 88, 17, 173, 251, 185, 29, 173, 251, 252, 185, 251, 253, 252, 197, 197,
+    41, 173, 251, 252, 185, 251, 2072, 252, 253, 253, 197, 251, 254, 252, 254, 254,
+    253, 209, 209, 209, 53, 173, 251, 252, 185, 251, 2072, 252, 253, 253, 197, 251,
+    2072, 252, 2073, 2083, 253, 254, 254, 254, 209, 251, 255, 252, 255, 255, 253, 255,
+    255, 255, 254, 221, 221, 221, 221, 65, 173, 251, 252, 185, 251, 2072, 252, 253,
+    253, 197, 251, 2072, 252, 2073, 2083, 253, 254, 254, 254, 209, 251, 2072, 252, 2073,
+    2083, 253, 2074, 2084, 2093, 254, 255, 255, 255, 255, 221, 251, 256, 252, 256, 256,
+    253, 256, 256, 256, 254, 256, 256, 256, 256, 255, 233, 233, 233, 233, 233, 77,
+    173, 251, 252, 185, 251, 2072, 252, 253, 253, 197, 251, 2072, 252, 2073, 2083, 253,
+    254, 254, 254, 209, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 255, 255,
+    255, 255, 221, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094,
+    1603, 255, 256, 256, 256, 256, 256, 233, 251, 257, 252, 257, 257, 253, 257, 257,
+    257, 254, 257, 257, 257, 257, 255, 257, 257, 257, 257, 257, 256, 245, 245, 245,
+    245, 245, 245, 89, 95, 95, 95, 96, 95, 95, 96, 95, 96, 97, 95, 95,
+    96, 95, 96, 97, 95, 96, 97, 98, 95, 95, 96, 95, 96, 97, 95, 96,
+    97, 98, 95, 96, 97, 98, 99, 95, 95, 96, 95, 96, 97, 95, 96, 97,
+    98, 95, 96, 97, 98, 99, 95, 96, 97, 98, 99, 100, 95, 95, 96, 95,
+    96, 97, 95, 96, 97, 98, 95, 96, 97, 98, 99, 95, 96, 97, 98, 99,
+    100, 95, 96, 97, 98, 99, 100, 101, 11, 167, 23, 11, 167, 179, 23, 12,
+    168, 2468, 180, 24, 168, 191, 192, 180, 35, 35, 36, 11, 167, 179, 23, 12,
+    1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 169, 2469,
+    181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601, 193, 193, 37, 169, 203, 204, 181,
+    203, 1808, 204, 205, 205, 193, 47, 47, 48, 47, 48, 49, 11, 167, 179, 23,
+    12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611,
+    2469, 1677, 25, 1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37, 169, 2490, 2611,
+    181, 2491, 1600, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49,
+    14, 170, 2470, 182, 26, 170, 2501, 2622, 182, 2481, 2732, 2602, 194, 194, 38, 170,
+    2501, 2622, 182, 2502, 1600, 2623, 2732, 2733, 194, 2492, 2831, 2613, 2831, 2832, 2723, 206,
+    206, 206, 50, 170, 215, 216, 182, 215, 1874, 216, 217, 217, 194, 215, 1874, 216,
+    1875, 1885, 217, 218, 218, 218, 206, 59, 59, 60, 59, 60, 61, 59, 60, 61,
+    62, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742,
+    192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
+    1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809,
+    1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767,
+    2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987,
+    2613, 3996, 1601, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732,
+    2733, 194, 2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875,
+    1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 171, 2471, 183, 27, 171,
+    2512, 2633, 183, 2482, 2743, 2603, 195, 195, 39, 171, 2512, 2633, 183, 2513, 4426, 2634,
+    2743, 2744, 195, 2493, 2842, 2614, 2842, 2843, 2724, 207, 207, 207, 51, 171, 2512, 2633,
+    183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844,
+    207, 2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932, 2834, 219, 219, 219, 219, 63,
+    171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 1940, 228, 1941, 1951, 229,
+    230, 230, 230, 207, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 231, 231,
+    231, 231, 219, 71, 71, 72, 71, 72, 73, 71, 72, 73, 74, 71, 72, 73,
+    74, 75, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601,
+    1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204,
+    1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481,
+    3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
+    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623,
+    2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216,
+    1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27,
+    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186,
+    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345,
+    3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602, 4005, 4050,
+    1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887, 1896, 1904,
+    63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481,
+    2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602, 2845, 2930,
+    2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953,
+    1962, 1970, 231, 71, 72, 73, 74, 75, 16, 172, 2472, 184, 28, 172, 2523, 2644,
+    184, 2483, 2754, 2604, 196, 196, 40, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755,
+    196, 2494, 2853, 2615, 2853, 2854, 2725, 208, 208, 208, 52, 172, 2523, 2644, 184, 2524,
+    4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2505,
+    2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220, 220, 220, 220, 64, 172, 2523,
+    2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854,
+    2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944,
+    220, 2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020, 3021, 2934,
+    232, 232, 232, 232, 232, 76, 172, 239, 240, 184, 239, 2006, 240, 241, 241, 196,
+    239, 2006, 240, 2007, 2017, 241, 242, 242, 242, 208, 239, 2006, 240, 2007, 2017, 241,
+    2008, 2018, 2027, 242, 243, 243, 243, 243, 220, 239, 2006, 240, 2007, 2017, 241, 2008,
+    2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 244, 244, 244, 244, 244, 232, 83, 83,
+    84, 83, 84, 85, 83, 84, 85, 86, 83, 84, 85, 86, 87, 83, 84, 85,
+    86, 87, 88, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766,
+    2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808,
+    204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688,
+    2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763,
+    2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206,
+    2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874,
+    216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679,
+    27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382,
+    6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640,
+    3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005,
+    4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896,
+    1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436,
+    4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845,
+    2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943,
+    1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329,
+    3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778,
+    3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707,
+    3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839,
+    2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648,
+    3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013,
+    4058, 4094, 1846, 1604, 1604, 1604, 1604, 1604, 1604, 1603, 1603, 1602, 1603, 1604, 1604, 1604,
+    1603, 1604, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 1604, 1604, 1604, 1603,
+    1604, 1944, 1954, 1963, 1971, 1604, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755,
+    196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702,
+    2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758,
+    4666, 4711, 4747, 2857, 1604, 1604, 1604, 1603, 1604, 3018, 3019, 3020, 3021, 1604, 232, 239,
+    2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020,
+    2029, 2037, 1604, 244, 83, 84, 85, 86, 87, 88, 17, 173, 2473, 185, 29, 173,
+    2534, 2655, 185, 2484, 2765, 2605, 197, 197, 41, 173, 2534, 2655, 185, 2535, 4866, 2656,
+    2765, 2766, 197, 2495, 2864, 2616, 2864, 2865, 2726, 209, 209, 209, 53, 173, 2534, 2655,
+    185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866,
+    209, 2506, 2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954, 2836, 221, 221, 221, 221, 65,
+    173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767,
+    2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
+    2954, 2955, 221, 2517, 3029, 2638, 3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031,
+    3032, 2935, 233, 233, 233, 233, 233, 77, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765,
+    2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877,
+    4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923,
+    2769, 4886, 4931, 4967, 2868, 1604, 1604, 1604, 1603, 1604, 3029, 3030, 3031, 3032, 1604, 233,
+    2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098, 2946, 3095,
+    3096, 3097, 3098, 1604, 3023, 245, 245, 245, 245, 245, 245, 89, 173, 251, 252, 185,
+    251, 2072, 252, 253, 253, 197, 251, 2072, 252, 2073, 2083, 253, 254, 254, 254, 209,
+    251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 255, 255, 255, 255, 221, 251,
+    2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 256, 256,
+    256, 256, 256, 233, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085,
+    2094, 2102, 255, 2076, 2086, 2095, 2103, 1604, 256, 257, 257, 257, 257, 257, 257, 245,
+    95, 95, 96, 95, 96, 97, 95, 96, 97, 98, 95, 96, 97, 98, 99, 95,
+    96, 97, 98, 99, 100, 95, 96, 97, 98, 99, 100, 101, 11, 167, 179, 23,
+    12, 174, 2468, 186, 24, 168, 2479, 2600, 180, 191, 198, 192, 35, 36, 13, 174,
+    2469, 186, 25, 174, 2545, 2666, 186, 2480, 2776, 2601, 198, 198, 37, 169, 2490, 2611,
+    181, 2491, 2875, 2612, 2721, 2722, 193, 203, 210, 204, 210, 210, 205, 47, 48, 49,
+    14, 174, 2470, 186, 26, 174, 2545, 2666, 186, 2481, 2776, 2602, 198, 198, 38, 174,
+    2545, 2666, 186, 2546, 1600, 2667, 2776, 2777, 198, 2492, 2875, 2613, 2875, 2876, 2723, 210,
+    210, 210, 50, 170, 2501, 2622, 182, 2502, 2963, 2623, 2732, 2733, 194, 2503, 2963, 2624,
+    2963, 2964, 2734, 2831, 2832, 2833, 206, 215, 222, 216, 222, 222, 217, 222, 222, 222,
+    218, 59, 60, 61, 62, 15, 174, 2471, 186, 27, 174, 2545, 2666, 186, 2482, 2776,
+    2603, 198, 198, 39, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2493, 2875,
+    2614, 2875, 2876, 2724, 210, 210, 210, 51, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776,
+    2777, 198, 2547, 5087, 2668, 5096, 1601, 2778, 2875, 2876, 2877, 210, 2504, 2963, 2625, 2963,
+    2964, 2735, 2963, 2964, 2965, 2834, 222, 222, 222, 222, 63, 171, 2512, 2633, 183, 2513,
+    3040, 2634, 2743, 2744, 195, 2514, 3040, 2635, 3040, 3041, 2745, 2842, 2843, 2844, 207, 2515,
+    3040, 2636, 3040, 3041, 2746, 3040, 3041, 3042, 2845, 2930, 2931, 2932, 2933, 219, 227, 234,
+    228, 234, 234, 229, 234, 234, 234, 230, 234, 234, 234, 234, 231, 71, 72, 73,
+    74, 75, 16, 174, 2472, 186, 28, 174, 2545, 2666, 186, 2483, 2776, 2604, 198, 198,
+    40, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2494, 2875, 2615, 2875, 2876,
+    2725, 210, 210, 210, 52, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547,
+    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2505, 2963, 2626, 2963, 2964, 2736, 2963,
+    2964, 2965, 2835, 222, 222, 222, 222, 64, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776,
+    2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097,
+    5142, 2779, 5105, 5150, 1602, 2878, 2963, 2964, 2965, 2966, 222, 2516, 3040, 2637, 3040, 3041,
+    2747, 3040, 3041, 3042, 2846, 3040, 3041, 3042, 3043, 2934, 234, 234, 234, 234, 234, 76,
+    172, 2523, 2644, 184, 2524, 3106, 2645, 2754, 2755, 196, 2525, 3106, 2646, 3106, 3107, 2756,
+    2853, 2854, 2855, 208, 2526, 3106, 2647, 3106, 3107, 2757, 3106, 3107, 3108, 2856, 2941, 2942,
+    2943, 2944, 220, 2527, 3106, 2648, 3106, 3107, 2758, 3106, 3107, 3108, 2857, 3106, 3107, 3108,
+    3109, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 246, 240, 246, 246, 241, 246, 246,
+    246, 242, 246, 246, 246, 246, 243, 246, 246, 246, 246, 246, 244, 83, 84, 85,
+    86, 87, 88, 17, 174, 2473, 186, 29, 174, 2545, 2666, 186, 2484, 2776, 2605, 198,
+    198, 41, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2495, 2875, 2616, 2875,
+    2876, 2726, 210, 210, 210, 53, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198,
+    2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2506, 2963, 2627, 2963, 2964, 2737,
+    2963, 2964, 2965, 2836, 222, 222, 222, 222, 65, 174, 2545, 2666, 186, 2546, 5086, 2667,
+    2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669,
+    5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2517, 3040, 2638, 3040,
+    3041, 2748, 3040, 3041, 3042, 2847, 3040, 3041, 3042, 3043, 2935, 234, 234, 234, 234, 234,
+    77, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141,
+    2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963,
+    2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 1604, 1604,
+    1604, 1603, 1604, 3040, 3041, 3042, 3043, 1604, 234, 2528, 3106, 2649, 3106, 3107, 2759, 3106,
+    3107, 3108, 2858, 3106, 3107, 3108, 3109, 2946, 3106, 3107, 3108, 3109, 1604, 3023, 246, 246,
+    246, 246, 246, 246, 89, 173, 2534, 2655, 185, 2535, 3161, 2656, 2765, 2766, 197, 2536,
+    3161, 2657, 3161, 3162, 2767, 2864, 2865, 2866, 209, 2537, 3161, 2658, 3161, 3162, 2768, 3161,
+    3162, 3163, 2867, 2952, 2953, 2954, 2955, 221, 2538, 3161, 2659, 3161, 3162, 2769, 3161, 3162,
+    3163, 2868, 3161, 3162, 3163, 3164, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 3161, 2660,
+    3161, 3162, 2770, 3161, 3162, 3163, 2869, 3161, 3162, 3163, 3164, 2957, 3161, 3162, 3163, 3164,
+    1604, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 258, 252, 258, 258, 253, 258,
+    258, 258, 254, 258, 258, 258, 258, 255, 258, 258, 258, 258, 258, 256, 258, 258,
+    258, 258, 258, 258, 257, 95, 96, 97, 98, 99, 100, 101, 18, 174, 263, 186,
+    30, 174, 263, 264, 186, 263, 265, 264, 198, 198, 42, 174, 263, 264, 186, 263,
+    2138, 264, 265, 265, 198, 263, 266, 264, 266, 266, 265, 210, 210, 210, 54, 174,
+    263, 264, 186, 263, 2138, 264, 265, 265, 198, 263, 2138, 264, 2139, 2149, 265, 266,
+    266, 266, 210, 263, 267, 264, 267, 267, 265, 267, 267, 267, 266, 222, 222, 222,
+    222, 66, 174, 263, 264, 186, 263, 2138, 264, 265, 265, 198, 263, 2138, 264, 2139,
+    2149, 265, 266, 266, 266, 210, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266,
+    267, 267, 267, 267, 222, 263, 268, 264, 268, 268, 265, 268, 268, 268, 266, 268,
+    268, 268, 268, 267, 234, 234, 234, 234, 234, 78, 174, 263, 264, 186, 263, 2138,
+    264, 265, 265, 198, 263, 2138, 264, 2139, 2149, 265, 266, 266, 266, 210, 263, 2138,
+    264, 2139, 2149, 265, 2140, 2150, 2159, 266, 267, 267, 267, 267, 222, 263, 2138, 264,
+    2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 268, 268, 268, 268,
+    268, 234, 263, 269, 264, 269, 269, 265, 269, 269, 269, 266, 269, 269, 269, 269,
+    267, 269, 269, 269, 269, 269, 268, 246, 246, 246, 246, 246, 246, 90, 174, 263,
+    264, 186, 263, 2138, 264, 265, 265, 198, 263, 2138, 264, 2139, 2149, 265, 266, 266,
+    266, 210, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 267, 267, 267, 267,
+    222, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267,
+    268, 268, 268, 268, 268, 234, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266,
+    2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 1604, 268, 269, 269, 269, 269, 269,
+    269, 246, 263, 270, 264, 270, 270, 265, 270, 270, 270, 266, 270, 270, 270, 270,
+    267, 270, 270, 270, 270, 270, 268, 270, 270, 270, 270, 270, 270, 269, 258, 258,
+    258, 258, 258, 258, 258, 102, 107, 107, 107, 108, 107, 107, 108, 107, 108, 109,
+    107, 107, 108, 107, 108, 109, 107, 108, 109, 110, 107, 107, 108, 107, 108, 109,
+    107, 108, 109, 110, 107, 108, 109, 110, 111, 107, 107, 108, 107, 108, 109, 107,
+    108, 109, 110, 107, 108, 109, 110, 111, 107, 108, 109, 110, 111, 112, 107, 107,
+    108, 107, 108, 109, 107, 108, 109, 110, 107, 108, 109, 110, 111, 107, 108, 109,
+    110, 111, 112, 107, 108, 109, 110, 111, 112, 113, 107, 107, 108, 107, 108, 109,
+    107, 108, 109, 110, 107, 108, 109, 110, 111, 107, 108, 109, 110, 111, 112, 107,
+    108, 109, 110, 111, 112, 113, 107, 108, 109, 110, 111, 112, 113, 114, 11, 167,
+    23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191, 192, 180, 35, 35,
+    36, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742,
+    192, 35, 36, 13, 169, 2469, 181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601, 193,
+    193, 37, 169, 203, 204, 181, 203, 1808, 204, 205, 205, 193, 47, 47, 48, 47,
+    48, 49, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 1600, 1600, 1687, 2480, 1600, 2601,
+    1743, 1753, 37, 169, 2490, 2611, 181, 2491, 1600, 2612, 2721, 2722, 193, 203, 1808, 204,
+    1809, 1819, 205, 47, 48, 49, 14, 170, 2470, 182, 26, 170, 2501, 2622, 182, 2481,
+    2732, 2602, 194, 194, 38, 170, 2501, 2622, 182, 2502, 1600, 2623, 2732, 2733, 194, 2492,
+    2831, 2613, 2831, 2832, 2723, 206, 206, 206, 50, 170, 215, 216, 182, 215, 1874, 216,
+    217, 217, 194, 215, 1874, 216, 1875, 1885, 217, 218, 218, 218, 206, 59, 59, 60,
+    59, 60, 61, 59, 60, 61, 62, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24,
+    168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326,
+    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721,
+    2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26,
+    1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600,
+    1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820, 1829, 50, 170, 2501,
+    2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832,
+    2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62,
+    15, 171, 2471, 183, 27, 171, 2512, 2633, 183, 2482, 2743, 2603, 195, 195, 39, 171,
+    2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2493, 2842, 2614, 2842, 2843, 2724, 207,
+    207, 207, 51, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635,
+    4436, 1601, 2745, 2842, 2843, 2844, 207, 2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932,
+    2834, 219, 219, 219, 219, 63, 171, 227, 228, 183, 227, 1940, 228, 229, 229, 195,
+    227, 1940, 228, 1941, 1951, 229, 230, 230, 230, 207, 227, 1940, 228, 1941, 1951, 229,
+    1942, 1952, 1961, 230, 231, 231, 231, 231, 219, 71, 71, 72, 71, 72, 73, 71,
+    72, 73, 74, 71, 72, 73, 74, 75, 11, 167, 179, 23, 12, 1610, 2468, 1676,
+    24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621,
+    3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612,
+    2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678,
+    26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381,
+    1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170,
+    2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831,
+    2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61,
+    62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39,
+    1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724,
+    1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230,
+    3646, 1602, 1601, 1602, 4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270,
+    1602, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744,
+    195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482,
+    2746, 4445, 4490, 1602, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229,
+    1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 172,
+    2472, 184, 28, 172, 2523, 2644, 184, 2483, 2754, 2604, 196, 196, 40, 172, 2523, 2644,
+    184, 2524, 4646, 2645, 2754, 2755, 196, 2494, 2853, 2615, 2853, 2854, 2725, 208, 208, 208,
+    52, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701,
+    2756, 2853, 2854, 2855, 208, 2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220,
+    220, 220, 220, 64, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647,
+    2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710,
+    1602, 2856, 2941, 2942, 2943, 2944, 220, 2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020,
+    2846, 3018, 3019, 3020, 3021, 2934, 232, 232, 232, 232, 232, 76, 172, 239, 240, 184,
+    239, 2006, 240, 241, 241, 196, 239, 2006, 240, 2007, 2017, 241, 242, 242, 242, 208,
+    239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 243, 243, 243, 243, 220, 239,
+    2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 244, 244,
+    244, 244, 244, 232, 83, 83, 84, 83, 84, 85, 83, 84, 85, 86, 83, 84,
+    85, 86, 87, 83, 84, 85, 86, 87, 88, 11, 167, 179, 23, 12, 1610, 2468,
+    1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25,
+    1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986,
+    2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470,
+    1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697,
+    3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50,
+    170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734,
+    2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60,
+    61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755,
+    39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042,
+    2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426,
+    6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225,
+    4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743,
+    2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437,
+    4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951,
+    229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16,
+    1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338,
+    3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822,
+    1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351,
+    6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835,
+    1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434,
+    6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603,
+    1603, 1602, 1603, 4233, 4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491,
+    4527, 2846, 4453, 4498, 4534, 1603, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644,
+    184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
+    208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220,
+    2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 1603, 2945, 3018,
+    3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009,
+    2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88,
+    17, 173, 2473, 185, 29, 173, 2534, 2655, 185, 2484, 2765, 2605, 197, 197, 41, 173,
+    2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2495, 2864, 2616, 2864, 2865, 2726, 209,
+    209, 209, 53, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657,
+    4876, 4921, 2767, 2864, 2865, 2866, 209, 2506, 2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954,
+    2836, 221, 221, 221, 221, 65, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197,
+    2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768,
+    4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2517, 3029, 2638, 3029, 3030, 2748, 3029,
+    3030, 3031, 2847, 3029, 3030, 3031, 3032, 2935, 233, 233, 233, 233, 233, 77, 173, 2534,
+    2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865,
+    2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955,
+    221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956,
+    3029, 3030, 3031, 3032, 3033, 233, 2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858,
+    3095, 3096, 3097, 3098, 2946, 3095, 3096, 3097, 3098, 3099, 3023, 245, 245, 245, 245, 245,
+    245, 89, 173, 251, 252, 185, 251, 2072, 252, 253, 253, 197, 251, 2072, 252, 2073,
+    2083, 253, 254, 254, 254, 209, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254,
+    255, 255, 255, 255, 221, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075,
+    2085, 2094, 2102, 255, 256, 256, 256, 256, 256, 233, 251, 2072, 252, 2073, 2083, 253,
+    2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 257,
+    257, 257, 257, 257, 257, 245, 95, 95, 96, 95, 96, 97, 95, 96, 97, 98,
+    95, 96, 97, 98, 99, 95, 96, 97, 98, 99, 100, 95, 96, 97, 98, 99,
+    100, 101, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601,
+    1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204,
+    1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481,
+    3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
+    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623,
+    2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216,
+    1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27,
+    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186,
+    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345,
+    3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050,
+    4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904,
+    63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481,
+    2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930,
+    2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953,
+    1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549,
+    1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823,
+    1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391,
+    6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505,
+    4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353,
+    3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058,
+    4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342,
+    1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934,
+    1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196,
+    2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757,
+    4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666,
+    4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006,
+    240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029,
+    2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330,
+    3550, 1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779,
+    3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708,
+    3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840,
+    2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649,
+    3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014,
+    4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315,
+    4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563,
+    2935, 1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845,
+    1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721,
+    3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 1605, 1605, 1605, 1605, 1605, 1605,
+    1605, 1605, 1605, 1605, 1604, 1604, 1604, 1603, 1604, 1605, 1605, 1605, 1605, 1604, 1605, 2528,
+    4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 1605, 1605,
+    1605, 1605, 1604, 1605, 2011, 2021, 2030, 2038, 2045, 1605, 89, 173, 2534, 2655, 185, 2535,
+    4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537,
+    4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869,
+    2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031,
+    3032, 3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975,
+    5003, 2957, 1605, 1605, 1605, 1605, 1604, 1605, 3095, 3096, 3097, 3098, 3099, 1605, 245, 251,
+    2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086,
+    2095, 2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 1605, 257, 95, 96, 97, 98, 99,
+    100, 101, 18, 174, 2474, 186, 30, 174, 2545, 2666, 186, 2485, 2776, 2606, 198, 198,
+    42, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2496, 2875, 2617, 2875, 2876,
+    2727, 210, 210, 210, 54, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547,
+    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2507, 2963, 2628, 2963, 2964, 2738, 2963,
+    2964, 2965, 2837, 222, 222, 222, 222, 66, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776,
+    2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097,
+    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2518, 3040, 2639, 3040, 3041,
+    2749, 3040, 3041, 3042, 2848, 3040, 3041, 3042, 3043, 2936, 234, 234, 234, 234, 234, 78,
+    174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778,
+    2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964,
+    2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
+    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2529, 3106, 2650, 3106, 3107, 2760, 3106, 3107,
+    3108, 2859, 3106, 3107, 3108, 3109, 2947, 3106, 3107, 3108, 3109, 3110, 3024, 246, 246, 246,
+    246, 246, 246, 90, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087,
+    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150,
+    5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187,
+    2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671, 5099,
+    5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 1605, 1605, 1605, 1605, 1604,
+    1605, 3106, 3107, 3108, 3109, 3110, 1605, 246, 2540, 3161, 2661, 3161, 3162, 2771, 3161, 3162,
+    3163, 2870, 3161, 3162, 3163, 3164, 2958, 3161, 3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163,
+    3164, 3165, 1605, 3101, 258, 258, 258, 258, 258, 258, 258, 102, 174, 263, 264, 186,
+    263, 2138, 264, 265, 265, 198, 263, 2138, 264, 2139, 2149, 265, 266, 266, 266, 210,
+    263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 267, 267, 267, 267, 222, 263,
+    2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 268, 268,
+    268, 268, 268, 234, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151,
+    2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 269, 269, 269, 269, 269, 269, 246,
+    263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142,
+    2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 1605, 269, 270, 270, 270, 270,
+    270, 270, 270, 258, 107, 107, 108, 107, 108, 109, 107, 108, 109, 110, 107, 108,
+    109, 110, 111, 107, 108, 109, 110, 111, 112, 107, 108, 109, 110, 111, 112, 113,
+    107, 108, 109, 110, 111, 112, 113, 114, 11, 167, 179, 23, 12, 175, 2468, 187,
+    24, 168, 2479, 2600, 180, 191, 199, 192, 35, 36, 13, 175, 2469, 187, 25, 175,
+    2556, 2677, 187, 2480, 2787, 2601, 199, 199, 37, 169, 2490, 2611, 181, 2491, 2886, 2612,
+    2721, 2722, 193, 203, 211, 204, 211, 211, 205, 47, 48, 49, 14, 175, 2470, 187,
+    26, 175, 2556, 2677, 187, 2481, 2787, 2602, 199, 199, 38, 175, 2556, 2677, 187, 2557,
+    1600, 2678, 2787, 2788, 199, 2492, 2886, 2613, 2886, 2887, 2723, 211, 211, 211, 50, 170,
+    2501, 2622, 182, 2502, 2974, 2623, 2732, 2733, 194, 2503, 2974, 2624, 2974, 2975, 2734, 2831,
+    2832, 2833, 206, 215, 223, 216, 223, 223, 217, 223, 223, 223, 218, 59, 60, 61,
+    62, 15, 175, 2471, 187, 27, 175, 2556, 2677, 187, 2482, 2787, 2603, 199, 199, 39,
+    175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2493, 2886, 2614, 2886, 2887, 2724,
+    211, 211, 211, 51, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307,
+    2679, 5316, 1601, 2789, 2886, 2887, 2888, 211, 2504, 2974, 2625, 2974, 2975, 2735, 2974, 2975,
+    2976, 2834, 223, 223, 223, 223, 63, 171, 2512, 2633, 183, 2513, 3051, 2634, 2743, 2744,
+    195, 2514, 3051, 2635, 3051, 3052, 2745, 2842, 2843, 2844, 207, 2515, 3051, 2636, 3051, 3052,
+    2746, 3051, 3052, 3053, 2845, 2930, 2931, 2932, 2933, 219, 227, 235, 228, 235, 235, 229,
+    235, 235, 235, 230, 235, 235, 235, 235, 231, 71, 72, 73, 74, 75, 16, 175,
+    2472, 187, 28, 175, 2556, 2677, 187, 2483, 2787, 2604, 199, 199, 40, 175, 2556, 2677,
+    187, 2557, 5306, 2678, 2787, 2788, 199, 2494, 2886, 2615, 2886, 2887, 2725, 211, 211, 211,
+    52, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361,
+    2789, 2886, 2887, 2888, 211, 2505, 2974, 2626, 2974, 2975, 2736, 2974, 2975, 2976, 2835, 223,
+    223, 223, 223, 64, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307,
+    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
+    1602, 2889, 2974, 2975, 2976, 2977, 223, 2516, 3051, 2637, 3051, 3052, 2747, 3051, 3052, 3053,
+    2846, 3051, 3052, 3053, 3054, 2934, 235, 235, 235, 235, 235, 76, 172, 2523, 2644, 184,
+    2524, 3117, 2645, 2754, 2755, 196, 2525, 3117, 2646, 3117, 3118, 2756, 2853, 2854, 2855, 208,
+    2526, 3117, 2647, 3117, 3118, 2757, 3117, 3118, 3119, 2856, 2941, 2942, 2943, 2944, 220, 2527,
+    3117, 2648, 3117, 3118, 2758, 3117, 3118, 3119, 2857, 3117, 3118, 3119, 3120, 2945, 3018, 3019,
+    3020, 3021, 3022, 232, 239, 247, 240, 247, 247, 241, 247, 247, 247, 242, 247, 247,
+    247, 247, 243, 247, 247, 247, 247, 247, 244, 83, 84, 85, 86, 87, 88, 17,
+    175, 2473, 187, 29, 175, 2556, 2677, 187, 2484, 2787, 2605, 199, 199, 41, 175, 2556,
+    2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2495, 2886, 2616, 2886, 2887, 2726, 211, 211,
+    211, 53, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316,
+    5361, 2789, 2886, 2887, 2888, 211, 2506, 2974, 2627, 2974, 2975, 2737, 2974, 2975, 2976, 2836,
+    223, 223, 223, 223, 65, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558,
+    5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325,
+    5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2517, 3051, 2638, 3051, 3052, 2748, 3051, 3052,
+    3053, 2847, 3051, 3052, 3053, 3054, 2935, 235, 235, 235, 235, 235, 77, 175, 2556, 2677,
+    187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
+    211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223,
+    2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 1603, 2978, 3051,
+    3052, 3053, 3054, 3055, 235, 2528, 3117, 2649, 3117, 3118, 2759, 3117, 3118, 3119, 2858, 3117,
+    3118, 3119, 3120, 2946, 3117, 3118, 3119, 3120, 3121, 3023, 247, 247, 247, 247, 247, 247,
+    89, 173, 2534, 2655, 185, 2535, 3172, 2656, 2765, 2766, 197, 2536, 3172, 2657, 3172, 3173,
+    2767, 2864, 2865, 2866, 209, 2537, 3172, 2658, 3172, 3173, 2768, 3172, 3173, 3174, 2867, 2952,
+    2953, 2954, 2955, 221, 2538, 3172, 2659, 3172, 3173, 2769, 3172, 3173, 3174, 2868, 3172, 3173,
+    3174, 3175, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 3172, 2660, 3172, 3173, 2770, 3172,
+    3173, 3174, 2869, 3172, 3173, 3174, 3175, 2957, 3172, 3173, 3174, 3175, 3176, 3034, 3095, 3096,
+    3097, 3098, 3099, 3100, 245, 251, 259, 252, 259, 259, 253, 259, 259, 259, 254, 259,
+    259, 259, 259, 255, 259, 259, 259, 259, 259, 256, 259, 259, 259, 259, 259, 259,
+    257, 95, 96, 97, 98, 99, 100, 101, 18, 175, 2474, 187, 30, 175, 2556, 2677,
+    187, 2485, 2787, 2606, 199, 199, 42, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788,
+    199, 2496, 2886, 2617, 2886, 2887, 2727, 211, 211, 211, 54, 175, 2556, 2677, 187, 2557,
+    5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2507,
+    2974, 2628, 2974, 2975, 2738, 2974, 2975, 2976, 2837, 223, 223, 223, 223, 66, 175, 2556,
+    2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
+    2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977,
+    223, 2518, 3051, 2639, 3051, 3052, 2749, 3051, 3052, 3053, 2848, 3051, 3052, 3053, 3054, 2936,
+    235, 235, 235, 235, 235, 78, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199,
+    2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790,
+    5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326,
+    5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2529, 3117,
+    2650, 3117, 3118, 2760, 3117, 3118, 3119, 2859, 3117, 3118, 3119, 3120, 2947, 3117, 3118, 3119,
+    3120, 3121, 3024, 247, 247, 247, 247, 247, 247, 90, 175, 2556, 2677, 187, 2557, 5306,
+    2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308,
+    2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681,
+    5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
+    3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443,
+    2979, 1605, 1605, 1605, 1605, 1604, 1605, 3117, 3118, 3119, 3120, 3121, 1605, 247, 2540, 3172,
+    2661, 3172, 3173, 2771, 3172, 3173, 3174, 2870, 3172, 3173, 3174, 3175, 2958, 3172, 3173, 3174,
+    3175, 3176, 3035, 3172, 3173, 3174, 3175, 3176, 1605, 3101, 259, 259, 259, 259, 259, 259,
+    259, 102, 174, 2545, 2666, 186, 2546, 3216, 2667, 2776, 2777, 198, 2547, 3216, 2668, 3216,
+    3217, 2778, 2875, 2876, 2877, 210, 2548, 3216, 2669, 3216, 3217, 2779, 3216, 3217, 3218, 2878,
+    2963, 2964, 2965, 2966, 222, 2549, 3216, 2670, 3216, 3217, 2780, 3216, 3217, 3218, 2879, 3216,
+    3217, 3218, 3219, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 3216, 2671, 3216, 3217, 2781,
+    3216, 3217, 3218, 2880, 3216, 3217, 3218, 3219, 2968, 3216, 3217, 3218, 3219, 3220, 3045, 3106,
+    3107, 3108, 3109, 3110, 3111, 246, 2551, 3216, 2672, 3216, 3217, 2782, 3216, 3217, 3218, 2881,
+    3216, 3217, 3218, 3219, 2969, 3216, 3217, 3218, 3219, 3220, 3046, 3216, 3217, 3218, 3219, 3220,
+    1605, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258, 263, 271, 264, 271, 271, 265,
+    271, 271, 271, 266, 271, 271, 271, 271, 267, 271, 271, 271, 271, 271, 268, 271,
+    271, 271, 271, 271, 271, 269, 271, 271, 271, 271, 271, 271, 271, 270, 107, 108,
+    109, 110, 111, 112, 113, 114, 19, 175, 275, 187, 31, 175, 275, 276, 187, 275,
+    277, 276, 199, 199, 43, 175, 275, 276, 187, 275, 2204, 276, 277, 277, 199, 275,
+    278, 276, 278, 278, 277, 211, 211, 211, 55, 175, 275, 276, 187, 275, 2204, 276,
+    277, 277, 199, 275, 2204, 276, 2205, 2215, 277, 278, 278, 278, 211, 275, 279, 276,
+    279, 279, 277, 279, 279, 279, 278, 223, 223, 223, 223, 67, 175, 275, 276, 187,
+    275, 2204, 276, 277, 277, 199, 275, 2204, 276, 2205, 2215, 277, 278, 278, 278, 211,
+    275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 279, 279, 279, 279, 223, 275,
+    280, 276, 280, 280, 277, 280, 280, 280, 278, 280, 280, 280, 280, 279, 235, 235,
+    235, 235, 235, 79, 175, 275, 276, 187, 275, 2204, 276, 277, 277, 199, 275, 2204,
+    276, 2205, 2215, 277, 278, 278, 278, 211, 275, 2204, 276, 2205, 2215, 277, 2206, 2216,
+    2225, 278, 279, 279, 279, 279, 223, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225,
+    278, 2207, 2217, 2226, 2234, 279, 280, 280, 280, 280, 280, 235, 275, 281, 276, 281,
+    281, 277, 281, 281, 281, 278, 281, 281, 281, 281, 279, 281, 281, 281, 281, 281,
+    280, 247, 247, 247, 247, 247, 247, 91, 175, 275, 276, 187, 275, 2204, 276, 277,
+    277, 199, 275, 2204, 276, 2205, 2215, 277, 278, 278, 278, 211, 275, 2204, 276, 2205,
+    2215, 277, 2206, 2216, 2225, 278, 279, 279, 279, 279, 223, 275, 2204, 276, 2205, 2215,
+    277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 280, 280, 280, 280, 280, 235,
+    275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208,
+    2218, 2227, 2235, 2242, 280, 281, 281, 281, 281, 281, 281, 247, 275, 282, 276, 282,
+    282, 277, 282, 282, 282, 278, 282, 282, 282, 282, 279, 282, 282, 282, 282, 282,
+    280, 282, 282, 282, 282, 282, 282, 281, 259, 259, 259, 259, 259, 259, 259, 103,
+    175, 275, 276, 187, 275, 2204, 276, 277, 277, 199, 275, 2204, 276, 2205, 2215, 277,
+    278, 278, 278, 211, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 279, 279,
+    279, 279, 223, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226,
+    2234, 279, 280, 280, 280, 280, 280, 235, 275, 2204, 276, 2205, 2215, 277, 2206, 2216,
+    2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 281, 281, 281,
+    281, 281, 281, 247, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217,
+    2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 1605, 281,
+    282, 282, 282, 282, 282, 282, 282, 259, 275, 283, 276, 283, 283, 277, 283, 283,
+    283, 278, 283, 283, 283, 283, 279, 283, 283, 283, 283, 283, 280, 283, 283, 283,
+    283, 283, 283, 281, 283, 283, 283, 283, 283, 283, 283, 282, 271, 271, 271, 271,
+    271, 271, 271, 271, 115, 119, 119, 119, 120, 119, 119, 120, 119, 120, 121, 119,
+    119, 120, 119, 120, 121, 119, 120, 121, 122, 119, 119, 120, 119, 120, 121, 119,
+    120, 121, 122, 119, 120, 121, 122, 123, 119, 119, 120, 119, 120, 121, 119, 120,
+    121, 122, 119, 120, 121, 122, 123, 119, 120, 121, 122, 123, 124, 119, 119, 120,
+    119, 120, 121, 119, 120, 121, 122, 119, 120, 121, 122, 123, 119, 120, 121, 122,
+    123, 124, 119, 120, 121, 122, 123, 124, 125, 119, 119, 120, 119, 120, 121, 119,
+    120, 121, 122, 119, 120, 121, 122, 123, 119, 120, 121, 122, 123, 124, 119, 120,
+    121, 122, 123, 124, 125, 119, 120, 121, 122, 123, 124, 125, 126, 119, 119, 120,
+    119, 120, 121, 119, 120, 121, 122, 119, 120, 121, 122, 123, 119, 120, 121, 122,
+    123, 124, 119, 120, 121, 122, 123, 124, 125, 119, 120, 121, 122, 123, 124, 125,
+    126, 119, 120, 121, 122, 123, 124, 125, 126, 127, 11, 167, 23, 11, 167, 179,
+    23, 12, 168, 2468, 180, 24, 168, 191, 192, 180, 35, 35, 36, 11, 167, 179,
+    23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13,
+    169, 2469, 181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601, 193, 193, 37, 169, 203,
+    204, 181, 203, 1808, 204, 205, 205, 193, 47, 47, 48, 47, 48, 49, 11, 167,
+    179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36,
+    13, 1611, 2469, 1677, 25, 1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37, 169,
+    2490, 2611, 181, 2491, 1600, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47,
+    48, 49, 14, 170, 2470, 182, 26, 170, 2501, 2622, 182, 2481, 2732, 2602, 194, 194,
+    38, 170, 2501, 2622, 182, 2502, 1600, 2623, 2732, 2733, 194, 2492, 2831, 2613, 2831, 2832,
+    2723, 206, 206, 206, 50, 170, 215, 216, 182, 215, 1874, 216, 217, 217, 194, 215,
+    1874, 216, 1875, 1885, 217, 218, 218, 218, 206, 59, 59, 60, 59, 60, 61, 59,
+    60, 61, 62, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766,
+    2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808,
+    204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688,
+    2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763,
+    2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206,
+    2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206, 215, 1874,
+    216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 171, 2471, 183,
+    27, 171, 2512, 2633, 183, 2482, 2743, 2603, 195, 195, 39, 171, 2512, 2633, 183, 2513,
+    4426, 2634, 2743, 2744, 195, 2493, 2842, 2614, 2842, 2843, 2724, 207, 207, 207, 51, 171,
+    2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 1601, 2745, 2842,
+    2843, 2844, 207, 2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932, 2834, 219, 219, 219,
+    219, 63, 171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 1940, 228, 1941,
+    1951, 229, 230, 230, 230, 207, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230,
+    231, 231, 231, 231, 219, 71, 71, 72, 71, 72, 73, 71, 72, 73, 74, 71,
+    72, 73, 74, 75, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600,
+    180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480,
+    3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203,
+    1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547,
+    1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821,
+    1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502,
+    4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215,
+    1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471,
+    1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698,
+    3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
+    1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602,
+    4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887,
+    1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635,
+    4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602,
+    2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230,
+    1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 172, 2472, 184, 28, 172,
+    2523, 2644, 184, 2483, 2754, 2604, 196, 196, 40, 172, 2523, 2644, 184, 2524, 4646, 2645,
+    2754, 2755, 196, 2494, 2853, 2615, 2853, 2854, 2725, 208, 208, 208, 52, 172, 2523, 2644,
+    184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855,
+    208, 2505, 2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220, 220, 220, 220, 64,
+    172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756,
+    2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942,
+    2943, 2944, 220, 2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020,
+    3021, 2934, 232, 232, 232, 232, 232, 76, 172, 239, 240, 184, 239, 2006, 240, 241,
+    241, 196, 239, 2006, 240, 2007, 2017, 241, 242, 242, 242, 208, 239, 2006, 240, 2007,
+    2017, 241, 2008, 2018, 2027, 242, 243, 243, 243, 243, 220, 239, 2006, 240, 2007, 2017,
+    241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 244, 244, 244, 244, 244, 232,
+    83, 83, 84, 83, 84, 85, 83, 84, 85, 86, 83, 84, 85, 86, 87, 83,
+    84, 85, 86, 87, 88, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479,
+    2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687,
+    2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193,
+    203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327,
+    3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776,
+    3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182,
+    2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206,
+    215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613,
+    2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557,
+    1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830,
+    51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601,
+    3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877,
+    1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427,
+    2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490,
+    4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961,
+    230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28,
+    1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187,
+    3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346,
+    3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051,
+    4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905,
+    64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686,
+    3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603, 1603, 1602, 1603, 4233,
+    4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498,
+    4534, 1603, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645,
+    2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647,
+    4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658,
+    4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022,
+    232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243,
+    2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 173, 2473, 185,
+    29, 173, 2534, 2655, 185, 2484, 2765, 2605, 197, 197, 41, 173, 2534, 2655, 185, 2535,
+    4866, 2656, 2765, 2766, 197, 2495, 2864, 2616, 2864, 2865, 2726, 209, 209, 209, 53, 173,
+    2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864,
+    2865, 2866, 209, 2506, 2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954, 2836, 221, 221, 221,
+    221, 65, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876,
+    4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867,
+    2952, 2953, 2954, 2955, 221, 2517, 3029, 2638, 3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029,
+    3030, 3031, 3032, 2935, 233, 233, 233, 233, 233, 77, 173, 2534, 2655, 185, 2535, 4866,
+    2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868,
+    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659,
+    4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956, 3029, 3030, 3031, 3032,
+    3033, 233, 2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098,
+    2946, 3095, 3096, 3097, 3098, 3099, 3023, 245, 245, 245, 245, 245, 245, 89, 173, 251,
+    252, 185, 251, 2072, 252, 253, 253, 197, 251, 2072, 252, 2073, 2083, 253, 254, 254,
+    254, 209, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 255, 255, 255, 255,
+    221, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255,
+    256, 256, 256, 256, 256, 233, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254,
+    2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 257, 257, 257, 257, 257,
+    257, 245, 95, 95, 96, 95, 96, 97, 95, 96, 97, 98, 95, 96, 97, 98,
+    99, 95, 96, 97, 98, 99, 100, 95, 96, 97, 98, 99, 100, 101, 11, 167,
+    179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36,
+    13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169,
+    2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47,
+    48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754,
+    38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041,
+    2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503,
+    4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876,
+    1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689,
+    2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764,
+    2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194,
+    3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208,
+    2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633,
+    183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844,
+    207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219,
+    227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71,
+    72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604,
+    1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615,
+    3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831,
+    1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263,
+    2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202,
+    3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266,
+    3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637,
+    4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971,
+    1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656,
+    4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856,
+    2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673,
+    4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241,
+    2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83,
+    84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550, 1691, 2484, 3770,
+    2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990,
+    2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787,
+    3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219,
+    4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354, 3574, 1715, 3399,
+    6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463,
+    6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430,
+    2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964,
+    1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661,
+    6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014,
+    4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150,
+    1604, 1604, 1604, 1603, 1604, 4460, 4505, 4541, 4569, 1604, 1985, 2528, 4650, 2649, 4659, 4704,
+    2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 1604, 3023,
+    2011, 2021, 2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766,
+    197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922,
+    2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769,
+    4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539,
+    4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945,
+    4981, 5009, 1604, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072, 252, 2073, 2083,
+    253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256,
+    2077, 2087, 2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100, 101, 18, 174,
+    2474, 186, 30, 174, 2545, 2666, 186, 2485, 2776, 2606, 198, 198, 42, 174, 2545, 2666,
+    186, 2546, 5086, 2667, 2776, 2777, 198, 2496, 2875, 2617, 2875, 2876, 2727, 210, 210, 210,
+    54, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141,
+    2778, 2875, 2876, 2877, 210, 2507, 2963, 2628, 2963, 2964, 2738, 2963, 2964, 2965, 2837, 222,
+    222, 222, 222, 66, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087,
+    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150,
+    5186, 2878, 2963, 2964, 2965, 2966, 222, 2518, 3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042,
+    2848, 3040, 3041, 3042, 3043, 2936, 234, 234, 234, 234, 234, 78, 174, 2545, 2666, 186,
+    2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
+    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549,
+    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041,
+    3042, 3043, 3044, 234, 2529, 3106, 2650, 3106, 3107, 2760, 3106, 3107, 3108, 2859, 3106, 3107,
+    3108, 3109, 2947, 3106, 3107, 3108, 3109, 3110, 3024, 246, 246, 246, 246, 246, 246, 90,
+    174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778,
+    2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964,
+    2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194,
+    5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152,
+    5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 1604, 3045, 3106, 3107, 3108,
+    3109, 3110, 3111, 246, 2540, 3161, 2661, 3161, 3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162,
+    3163, 3164, 2958, 3161, 3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163, 3164, 3165, 3166, 3101,
+    258, 258, 258, 258, 258, 258, 258, 102, 174, 263, 264, 186, 263, 2138, 264, 265,
+    265, 198, 263, 2138, 264, 2139, 2149, 265, 266, 266, 266, 210, 263, 2138, 264, 2139,
+    2149, 265, 2140, 2150, 2159, 266, 267, 267, 267, 267, 222, 263, 2138, 264, 2139, 2149,
+    265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 268, 268, 268, 268, 268, 234,
+    263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142,
+    2152, 2161, 2169, 2176, 268, 269, 269, 269, 269, 269, 269, 246, 263, 2138, 264, 2139,
+    2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 2176,
+    268, 2143, 2153, 2162, 2170, 2177, 2183, 269, 270, 270, 270, 270, 270, 270, 270, 258,
+    107, 107, 108, 107, 108, 109, 107, 108, 109, 110, 107, 108, 109, 110, 111, 107,
+    108, 109, 110, 111, 112, 107, 108, 109, 110, 111, 112, 113, 107, 108, 109, 110,
+    111, 112, 113, 114, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600,
+    180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480,
+    3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203,
+    1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547,
+    1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821,
+    1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502,
+    4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215,
+    1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471,
+    1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698,
+    3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51,
+    1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866,
+    4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887,
+    1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635,
+    4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526,
+    2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230,
+    1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624,
+    3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603,
+    3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566,
+    1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087,
+    1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64,
+    1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874,
+    4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278,
+    4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534,
+    4562, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754,
+    2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657,
+    4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703,
+    2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232,
+    239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010,
+    2020, 2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29,
+    1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188,
+    3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347,
+    3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052,
+    4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906,
+    65, 1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687,
+    3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234,
+    4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499,
+    4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625,
+    3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689,
+    6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414,
+    6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590,
+    1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946,
+    4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89, 173, 2534, 2655,
+    185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866,
+    209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221,
+    2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029,
+    3030, 3031, 3032, 3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894,
+    4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100,
+    245, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255,
+    2076, 2086, 2095, 2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257, 95, 96, 97,
+    98, 99, 100, 101, 18, 1616, 2474, 1682, 30, 1626, 3331, 3551, 1692, 2485, 3771, 2606,
+    1748, 1758, 42, 1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617,
+    4000, 4045, 2727, 1814, 1824, 1833, 54, 1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833,
+    1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265,
+    2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907, 66, 1650, 3355, 3575, 1716, 3400, 6204,
+    3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268,
+    3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639,
+    4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973,
+    1980, 78, 1656, 3361, 3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366,
+    6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130,
+    4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555,
+    6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760,
+    4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012,
+    2022, 2031, 2039, 2046, 2052, 90, 1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793,
+    3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915,
+    6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504,
+    6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991, 1606, 1606,
+    1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1605, 1605, 1605,
+    1605, 1604, 1605, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 2540, 4871, 2661, 4880, 4925, 2771,
+    4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031, 3035, 1606,
+    1606, 1606, 1606, 1606, 1605, 1606, 2078, 2088, 2097, 2105, 2112, 2118, 1606, 102, 174, 2545,
+    2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
+    2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966,
+    222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967,
+    3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880,
+    5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110,
+    3111, 246, 2551, 5091, 2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224,
+    2969, 5121, 5166, 5202, 5230, 5251, 3046, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 3161, 3162,
+    3163, 3164, 3165, 3166, 1606, 258, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266,
+    2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177,
+    2183, 269, 2144, 2154, 2163, 2171, 2178, 2184, 1606, 270, 107, 108, 109, 110, 111, 112,
+    113, 114, 19, 175, 2475, 187, 31, 175, 2556, 2677, 187, 2486, 2787, 2607, 199, 199,
+    43, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2497, 2886, 2618, 2886, 2887,
+    2728, 211, 211, 211, 55, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558,
+    5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2508, 2974, 2629, 2974, 2975, 2739, 2974,
+    2975, 2976, 2838, 223, 223, 223, 223, 67, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787,
+    2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317,
+    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2519, 3051, 2640, 3051, 3052,
+    2750, 3051, 3052, 3053, 2849, 3051, 3052, 3053, 3054, 2937, 235, 235, 235, 235, 235, 79,
+    175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789,
+    2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975,
+    2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414,
+    5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2530, 3117, 2651, 3117, 3118, 2761, 3117, 3118,
+    3119, 2860, 3117, 3118, 3119, 3120, 2948, 3117, 3118, 3119, 3120, 3121, 3025, 247, 247, 247,
+    247, 247, 247, 91, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307,
+    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
+    5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407,
+    2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319,
+    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
+    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247, 2541, 3172, 2662, 3172, 3173, 2772, 3172, 3173,
+    3174, 2871, 3172, 3173, 3174, 3175, 2959, 3172, 3173, 3174, 3175, 3176, 3036, 3172, 3173, 3174,
+    3175, 3176, 3177, 3102, 259, 259, 259, 259, 259, 259, 259, 103, 175, 2556, 2677, 187,
+    2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,
+    2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560,
+    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
+    3053, 3054, 3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379,
+    5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
+    2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341,
+    5386, 5422, 5450, 5471, 3057, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 3172, 3173, 3174, 3175,
+    3176, 3177, 1606, 259, 2552, 3216, 2673, 3216, 3217, 2783, 3216, 3217, 3218, 2882, 3216, 3217,
+    3218, 3219, 2970, 3216, 3217, 3218, 3219, 3220, 3047, 3216, 3217, 3218, 3219, 3220, 3221, 3113,
+    3216, 3217, 3218, 3219, 3220, 3221, 1606, 3168, 271, 271, 271, 271, 271, 271, 271, 271,
+    115, 175, 275, 276, 187, 275, 2204, 276, 277, 277, 199, 275, 2204, 276, 2205, 2215,
+    277, 278, 278, 278, 211, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 279,
+    279, 279, 279, 223, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217,
+    2226, 2234, 279, 280, 280, 280, 280, 280, 235, 275, 2204, 276, 2205, 2215, 277, 2206,
+    2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 281, 281,
+    281, 281, 281, 281, 247, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207,
+    2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 2249,
+    281, 282, 282, 282, 282, 282, 282, 282, 259, 275, 2204, 276, 2205, 2215, 277, 2206,
+    2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219,
+    2228, 2236, 2243, 2249, 281, 2210, 2220, 2229, 2237, 2244, 2250, 1606, 282, 283, 283, 283,
+    283, 283, 283, 283, 283, 271, 119, 119, 120, 119, 120, 121, 119, 120, 121, 122,
+    119, 120, 121, 122, 123, 119, 120, 121, 122, 123, 124, 119, 120, 121, 122, 123,
+    124, 125, 119, 120, 121, 122, 123, 124, 125, 126, 119, 120, 121, 122, 123, 124,
+    125, 126, 127, 11, 167, 179, 23, 12, 176, 2468, 188, 24, 168, 2479, 2600, 180,
+    191, 200, 192, 35, 36, 13, 176, 2469, 188, 25, 176, 2567, 2688, 188, 2480, 2798,
+    2601, 200, 200, 37, 169, 2490, 2611, 181, 2491, 2897, 2612, 2721, 2722, 193, 203, 212,
+    204, 212, 212, 205, 47, 48, 49, 14, 176, 2470, 188, 26, 176, 2567, 2688, 188,
+    2481, 2798, 2602, 200, 200, 38, 176, 2567, 2688, 188, 2568, 1600, 2689, 2798, 2799, 200,
+    2492, 2897, 2613, 2897, 2898, 2723, 212, 212, 212, 50, 170, 2501, 2622, 182, 2502, 2985,
+    2623, 2732, 2733, 194, 2503, 2985, 2624, 2985, 2986, 2734, 2831, 2832, 2833, 206, 215, 224,
+    216, 224, 224, 217, 224, 224, 224, 218, 59, 60, 61, 62, 15, 176, 2471, 188,
+    27, 176, 2567, 2688, 188, 2482, 2798, 2603, 200, 200, 39, 176, 2567, 2688, 188, 2568,
+    5526, 2689, 2798, 2799, 200, 2493, 2897, 2614, 2897, 2898, 2724, 212, 212, 212, 51, 176,
+    2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 1601, 2800, 2897,
+    2898, 2899, 212, 2504, 2985, 2625, 2985, 2986, 2735, 2985, 2986, 2987, 2834, 224, 224, 224,
+    224, 63, 171, 2512, 2633, 183, 2513, 3062, 2634, 2743, 2744, 195, 2514, 3062, 2635, 3062,
+    3063, 2745, 2842, 2843, 2844, 207, 2515, 3062, 2636, 3062, 3063, 2746, 3062, 3063, 3064, 2845,
+    2930, 2931, 2932, 2933, 219, 227, 236, 228, 236, 236, 229, 236, 236, 236, 230, 236,
+    236, 236, 236, 231, 71, 72, 73, 74, 75, 16, 176, 2472, 188, 28, 176, 2567,
+    2688, 188, 2483, 2798, 2604, 200, 200, 40, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798,
+    2799, 200, 2494, 2897, 2615, 2897, 2898, 2725, 212, 212, 212, 52, 176, 2567, 2688, 188,
+    2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,
+    2505, 2985, 2626, 2985, 2986, 2736, 2985, 2986, 2987, 2835, 224, 224, 224, 224, 64, 176,
+    2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897,
+    2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 1602, 2900, 2985, 2986, 2987,
+    2988, 224, 2516, 3062, 2637, 3062, 3063, 2747, 3062, 3063, 3064, 2846, 3062, 3063, 3064, 3065,
+    2934, 236, 236, 236, 236, 236, 76, 172, 2523, 2644, 184, 2524, 3128, 2645, 2754, 2755,
+    196, 2525, 3128, 2646, 3128, 3129, 2756, 2853, 2854, 2855, 208, 2526, 3128, 2647, 3128, 3129,
+    2757, 3128, 3129, 3130, 2856, 2941, 2942, 2943, 2944, 220, 2527, 3128, 2648, 3128, 3129, 2758,
+    3128, 3129, 3130, 2857, 3128, 3129, 3130, 3131, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239,
+    248, 240, 248, 248, 241, 248, 248, 248, 242, 248, 248, 248, 248, 243, 248, 248,
+    248, 248, 248, 244, 83, 84, 85, 86, 87, 88, 17, 176, 2473, 188, 29, 176,
+    2567, 2688, 188, 2484, 2798, 2605, 200, 200, 41, 176, 2567, 2688, 188, 2568, 5526, 2689,
+    2798, 2799, 200, 2495, 2897, 2616, 2897, 2898, 2726, 212, 212, 212, 53, 176, 2567, 2688,
+    188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
+    212, 2506, 2985, 2627, 2985, 2986, 2737, 2985, 2986, 2987, 2836, 224, 224, 224, 224, 65,
+    176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800,
+    2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986,
+    2987, 2988, 224, 2517, 3062, 2638, 3062, 3063, 2748, 3062, 3063, 3064, 2847, 3062, 3063, 3064,
+    3065, 2935, 236, 236, 236, 236, 236, 77, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798,
+    2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537,
+    5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583,
+    2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 1603, 2989, 3062, 3063, 3064, 3065, 3066, 236,
+    2528, 3128, 2649, 3128, 3129, 2759, 3128, 3129, 3130, 2858, 3128, 3129, 3130, 3131, 2946, 3128,
+    3129, 3130, 3131, 3132, 3023, 248, 248, 248, 248, 248, 248, 89, 173, 2534, 2655, 185,
+    2535, 3183, 2656, 2765, 2766, 197, 2536, 3183, 2657, 3183, 3184, 2767, 2864, 2865, 2866, 209,
+    2537, 3183, 2658, 3183, 3184, 2768, 3183, 3184, 3185, 2867, 2952, 2953, 2954, 2955, 221, 2538,
+    3183, 2659, 3183, 3184, 2769, 3183, 3184, 3185, 2868, 3183, 3184, 3185, 3186, 2956, 3029, 3030,
+    3031, 3032, 3033, 233, 2539, 3183, 2660, 3183, 3184, 2770, 3183, 3184, 3185, 2869, 3183, 3184,
+    3185, 3186, 2957, 3183, 3184, 3185, 3186, 3187, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245,
+    251, 260, 252, 260, 260, 253, 260, 260, 260, 254, 260, 260, 260, 260, 255, 260,
+    260, 260, 260, 260, 256, 260, 260, 260, 260, 260, 260, 257, 95, 96, 97, 98,
+    99, 100, 101, 18, 176, 2474, 188, 30, 176, 2567, 2688, 188, 2485, 2798, 2606, 200,
+    200, 42, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2496, 2897, 2617, 2897,
+    2898, 2727, 212, 212, 212, 54, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200,
+    2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2507, 2985, 2628, 2985, 2986, 2738,
+    2985, 2986, 2987, 2837, 224, 224, 224, 224, 66, 176, 2567, 2688, 188, 2568, 5526, 2689,
+    2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691,
+    5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2518, 3062, 2639, 3062,
+    3063, 2749, 3062, 3063, 3064, 2848, 3062, 3063, 3064, 3065, 2936, 236, 236, 236, 236, 236,
+    78, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581,
+    2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
+    2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598,
+    5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2529, 3128, 2650, 3128, 3129, 2760, 3128,
+    3129, 3130, 2859, 3128, 3129, 3130, 3131, 2947, 3128, 3129, 3130, 3131, 3132, 3024, 248, 248,
+    248, 248, 248, 248, 90, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569,
+    5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545,
+    5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591,
+    5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693,
+    5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669,
+    1604, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2540, 3183, 2661, 3183, 3184, 2771, 3183,
+    3184, 3185, 2870, 3183, 3184, 3185, 3186, 2958, 3183, 3184, 3185, 3186, 3187, 3035, 3183, 3184,
+    3185, 3186, 3187, 3188, 3101, 260, 260, 260, 260, 260, 260, 260, 102, 174, 2545, 2666,
+    186, 2546, 3227, 2667, 2776, 2777, 198, 2547, 3227, 2668, 3227, 3228, 2778, 2875, 2876, 2877,
+    210, 2548, 3227, 2669, 3227, 3228, 2779, 3227, 3228, 3229, 2878, 2963, 2964, 2965, 2966, 222,
+    2549, 3227, 2670, 3227, 3228, 2780, 3227, 3228, 3229, 2879, 3227, 3228, 3229, 3230, 2967, 3040,
+    3041, 3042, 3043, 3044, 234, 2550, 3227, 2671, 3227, 3228, 2781, 3227, 3228, 3229, 2880, 3227,
+    3228, 3229, 3230, 2968, 3227, 3228, 3229, 3230, 3231, 3045, 3106, 3107, 3108, 3109, 3110, 3111,
+    246, 2551, 3227, 2672, 3227, 3228, 2782, 3227, 3228, 3229, 2881, 3227, 3228, 3229, 3230, 2969,
+    3227, 3228, 3229, 3230, 3231, 3046, 3227, 3228, 3229, 3230, 3231, 3232, 3112, 3161, 3162, 3163,
+    3164, 3165, 3166, 3167, 258, 263, 272, 264, 272, 272, 265, 272, 272, 272, 266, 272,
+    272, 272, 272, 267, 272, 272, 272, 272, 272, 268, 272, 272, 272, 272, 272, 272,
+    269, 272, 272, 272, 272, 272, 272, 272, 270, 107, 108, 109, 110, 111, 112, 113,
+    114, 19, 176, 2475, 188, 31, 176, 2567, 2688, 188, 2486, 2798, 2607, 200, 200, 43,
+    176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2497, 2897, 2618, 2897, 2898, 2728,
+    212, 212, 212, 55, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527,
+    2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2508, 2985, 2629, 2985, 2986, 2739, 2985, 2986,
+    2987, 2838, 224, 224, 224, 224, 67, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799,
+    200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582,
+    2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2519, 3062, 2640, 3062, 3063, 2750,
+    3062, 3063, 3064, 2849, 3062, 3063, 3064, 3065, 2937, 236, 236, 236, 236, 236, 79, 176,
+    2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897,
+    2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
+    2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662,
+    2989, 3062, 3063, 3064, 3065, 3066, 236, 2530, 3128, 2651, 3128, 3129, 2761, 3128, 3129, 3130,
+    2860, 3128, 3129, 3130, 3131, 2948, 3128, 3129, 3130, 3131, 3132, 3025, 248, 248, 248, 248,
+    248, 248, 91, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690,
+    5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
+    2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
+    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693, 5539, 5584,
+    2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067,
+    3128, 3129, 3130, 3131, 3132, 3133, 248, 2541, 3183, 2662, 3183, 3184, 2772, 3183, 3184, 3185,
+    2871, 3183, 3184, 3185, 3186, 2959, 3183, 3184, 3185, 3186, 3187, 3036, 3183, 3184, 3185, 3186,
+    3187, 3188, 3102, 260, 260, 260, 260, 260, 260, 260, 103, 176, 2567, 2688, 188, 2568,
+    5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570,
+    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529,
+    2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064,
+    3065, 3066, 236, 2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
+    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2573,
+    5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606,
+    5642, 5670, 5691, 3068, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 3183, 3184, 3185, 3186, 3187,
+    3188, 1606, 260, 2552, 3227, 2673, 3227, 3228, 2783, 3227, 3228, 3229, 2882, 3227, 3228, 3229,
+    3230, 2970, 3227, 3228, 3229, 3230, 3231, 3047, 3227, 3228, 3229, 3230, 3231, 3232, 3113, 3227,
+    3228, 3229, 3230, 3231, 3232, 1606, 3168, 272, 272, 272, 272, 272, 272, 272, 272, 115,
+    175, 2556, 2677, 187, 2557, 3260, 2678, 2787, 2788, 199, 2558, 3260, 2679, 3260, 3261, 2789,
+    2886, 2887, 2888, 211, 2559, 3260, 2680, 3260, 3261, 2790, 3260, 3261, 3262, 2889, 2974, 2975,
+    2976, 2977, 223, 2560, 3260, 2681, 3260, 3261, 2791, 3260, 3261, 3262, 2890, 3260, 3261, 3262,
+    3263, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2561, 3260, 2682, 3260, 3261, 2792, 3260, 3261,
+    3262, 2891, 3260, 3261, 3262, 3263, 2979, 3260, 3261, 3262, 3263, 3264, 3056, 3117, 3118, 3119,
+    3120, 3121, 3122, 247, 2562, 3260, 2683, 3260, 3261, 2793, 3260, 3261, 3262, 2892, 3260, 3261,
+    3262, 3263, 2980, 3260, 3261, 3262, 3263, 3264, 3057, 3260, 3261, 3262, 3263, 3264, 3265, 3123,
+    3172, 3173, 3174, 3175, 3176, 3177, 3178, 259, 2563, 3260, 2684, 3260, 3261, 2794, 3260, 3261,
+    3262, 2893, 3260, 3261, 3262, 3263, 2981, 3260, 3261, 3262, 3263, 3264, 3058, 3260, 3261, 3262,
+    3263, 3264, 3265, 3124, 3260, 3261, 3262, 3263, 3264, 3265, 1606, 3179, 3216, 3217, 3218, 3219,
+    3220, 3221, 3222, 3223, 271, 275, 284, 276, 284, 284, 277, 284, 284, 284, 278, 284,
+    284, 284, 284, 279, 284, 284, 284, 284, 284, 280, 284, 284, 284, 284, 284, 284,
+    281, 284, 284, 284, 284, 284, 284, 284, 282, 284, 284, 284, 284, 284, 284, 284,
+    284, 283, 119, 120, 121, 122, 123, 124, 125, 126, 127, 20, 176, 287, 188, 32,
+    176, 287, 288, 188, 287, 289, 288, 200, 200, 44, 176, 287, 288, 188, 287, 2270,
+    288, 289, 289, 200, 287, 290, 288, 290, 290, 289, 212, 212, 212, 56, 176, 287,
+    288, 188, 287, 2270, 288, 289, 289, 200, 287, 2270, 288, 2271, 2281, 289, 290, 290,
+    290, 212, 287, 291, 288, 291, 291, 289, 291, 291, 291, 290, 224, 224, 224, 224,
+    68, 176, 287, 288, 188, 287, 2270, 288, 289, 289, 200, 287, 2270, 288, 2271, 2281,
+    289, 290, 290, 290, 212, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 291,
+    291, 291, 291, 224, 287, 292, 288, 292, 292, 289, 292, 292, 292, 290, 292, 292,
+    292, 292, 291, 236, 236, 236, 236, 236, 80, 176, 287, 288, 188, 287, 2270, 288,
+    289, 289, 200, 287, 2270, 288, 2271, 2281, 289, 290, 290, 290, 212, 287, 2270, 288,
+    2271, 2281, 289, 2272, 2282, 2291, 290, 291, 291, 291, 291, 224, 287, 2270, 288, 2271,
+    2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 292, 292, 292, 292, 292,
+    236, 287, 293, 288, 293, 293, 289, 293, 293, 293, 290, 293, 293, 293, 293, 291,
+    293, 293, 293, 293, 293, 292, 248, 248, 248, 248, 248, 248, 92, 176, 287, 288,
+    188, 287, 2270, 288, 289, 289, 200, 287, 2270, 288, 2271, 2281, 289, 290, 290, 290,
+    212, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 291, 291, 291, 291, 224,
+    287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 292,
+    292, 292, 292, 292, 236, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273,
+    2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 293, 293, 293, 293, 293, 293,
+    248, 287, 294, 288, 294, 294, 289, 294, 294, 294, 290, 294, 294, 294, 294, 291,
+    294, 294, 294, 294, 294, 292, 294, 294, 294, 294, 294, 294, 293, 260, 260, 260,
+    260, 260, 260, 260, 104, 176, 287, 288, 188, 287, 2270, 288, 289, 289, 200, 287,
+    2270, 288, 2271, 2281, 289, 290, 290, 290, 212, 287, 2270, 288, 2271, 2281, 289, 2272,
+    2282, 2291, 290, 291, 291, 291, 291, 224, 287, 2270, 288, 2271, 2281, 289, 2272, 2282,
+    2291, 290, 2273, 2283, 2292, 2300, 291, 292, 292, 292, 292, 292, 236, 287, 2270, 288,
+    2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301,
+    2308, 292, 293, 293, 293, 293, 293, 293, 248, 287, 2270, 288, 2271, 2281, 289, 2272,
+    2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285,
+    2294, 2302, 2309, 2315, 293, 294, 294, 294, 294, 294, 294, 294, 260, 287, 295, 288,
+    295, 295, 289, 295, 295, 295, 290, 295, 295, 295, 295, 291, 295, 295, 295, 295,
+    295, 292, 295, 295, 295, 295, 295, 295, 293, 295, 295, 295, 295, 295, 295, 295,
+    294, 272, 272, 272, 272, 272, 272, 272, 272, 116, 176, 287, 288, 188, 287, 2270,
+    288, 289, 289, 200, 287, 2270, 288, 2271, 2281, 289, 290, 290, 290, 212, 287, 2270,
+    288, 2271, 2281, 289, 2272, 2282, 2291, 290, 291, 291, 291, 291, 224, 287, 2270, 288,
+    2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 292, 292, 292, 292,
+    292, 236, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300,
+    291, 2274, 2284, 2293, 2301, 2308, 292, 293, 293, 293, 293, 293, 293, 248, 287, 2270,
+    288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293,
+    2301, 2308, 292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 294, 294, 294, 294, 294, 294,
+    294, 260, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300,
+    291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 2276, 2286,
+    2295, 2303, 2310, 2316, 1606, 294, 295, 295, 295, 295, 295, 295, 295, 295, 272, 287,
+    296, 288, 296, 296, 289, 296, 296, 296, 290, 296, 296, 296, 296, 291, 296, 296,
+    296, 296, 296, 292, 296, 296, 296, 296, 296, 296, 293, 296, 296, 296, 296, 296,
+    296, 296, 294, 296, 296, 296, 296, 296, 296, 296, 296, 295, 284, 284, 284, 284,
+    284, 284, 284, 284, 284, 128, 131, 131, 131, 132, 131, 131, 132, 131, 132, 133,
+    131, 131, 132, 131, 132, 133, 131, 132, 133, 134, 131, 131, 132, 131, 132, 133,
+    131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 131, 132, 131, 132, 133, 131,
+    132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133, 134, 135, 136, 131, 131,
+    132, 131, 132, 133, 131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133,
+    134, 135, 136, 131, 132, 133, 134, 135, 136, 137, 131, 131, 132, 131, 132, 133,
+    131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133, 134, 135, 136, 131,
+    132, 133, 134, 135, 136, 137, 131, 132, 133, 134, 135, 136, 137, 138, 131, 131,
+    132, 131, 132, 133, 131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133,
+    134, 135, 136, 131, 132, 133, 134, 135, 136, 137, 131, 132, 133, 134, 135, 136,
+    137, 138, 131, 132, 133, 134, 135, 136, 137, 138, 139, 131, 131, 132, 131, 132,
+    133, 131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133, 134, 135, 136,
+    131, 132, 133, 134, 135, 136, 137, 131, 132, 133, 134, 135, 136, 137, 138, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 131, 132, 133, 134, 135, 136, 137, 138,
+    139, 140, 11, 167, 23, 11, 167, 179, 23, 12, 168, 2468, 180, 24, 168, 191,
+    192, 180, 35, 35, 36, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479,
+    2600, 180, 191, 1742, 192, 35, 36, 13, 169, 2469, 181, 25, 169, 2490, 2611, 181,
+    2480, 2721, 2601, 193, 193, 37, 169, 203, 204, 181, 203, 1808, 204, 205, 205, 193,
+    47, 47, 48, 47, 48, 49, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168,
+    2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 1600, 1600,
+    1687, 2480, 1600, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 1600, 2612, 2721, 2722,
+    193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 170, 2470, 182, 26, 170,
+    2501, 2622, 182, 2481, 2732, 2602, 194, 194, 38, 170, 2501, 2622, 182, 2502, 1600, 2623,
+    2732, 2733, 194, 2492, 2831, 2613, 2831, 2832, 2723, 206, 206, 206, 50, 170, 215, 216,
+    182, 215, 1874, 216, 217, 217, 194, 215, 1874, 216, 1875, 1885, 217, 218, 218, 218,
+    206, 59, 59, 60, 59, 60, 61, 59, 60, 61, 62, 11, 167, 179, 23, 12,
+    1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469,
+    1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181,
+    2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14,
+    1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336,
+    3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987, 2613, 3996, 1601, 2723, 1810, 1820,
+    1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216,
+    1601, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218,
+    59, 60, 61, 62, 15, 171, 2471, 183, 27, 171, 2512, 2633, 183, 2482, 2743, 2603,
+    195, 195, 39, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2493, 2842, 2614,
+    2842, 2843, 2724, 207, 207, 207, 51, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744,
+    195, 2514, 4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844, 207, 2504, 2930, 2625, 2930, 2931,
+    2735, 2930, 2931, 2932, 2834, 219, 219, 219, 219, 63, 171, 227, 228, 183, 227, 1940,
+    228, 229, 229, 195, 227, 1940, 228, 1941, 1951, 229, 230, 230, 230, 207, 227, 1940,
+    228, 1941, 1951, 229, 1942, 1952, 1961, 230, 231, 231, 231, 231, 219, 71, 71, 72,
+    71, 72, 73, 71, 72, 73, 74, 71, 72, 73, 74, 75, 11, 167, 179, 23,
+    12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611,
+    2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611,
+    181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49,
+    14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631,
+    3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
+    1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624,
+    4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895,
+    218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768,
+    2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
+    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785,
+    3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602, 4005, 4050, 1602, 1838, 2504, 4208, 2625, 4217,
+    4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513,
+    4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515,
+    4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940,
+    228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73,
+    74, 75, 16, 172, 2472, 184, 28, 172, 2523, 2644, 184, 2483, 2754, 2604, 196, 196,
+    40, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2494, 2853, 2615, 2853, 2854,
+    2725, 208, 208, 208, 52, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525,
+    4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2505, 2941, 2626, 2941, 2942, 2736, 2941,
+    2942, 2943, 2835, 220, 220, 220, 220, 64, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754,
+    2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657,
+    4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944, 220, 2516, 3018, 2637, 3018, 3019,
+    2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020, 3021, 2934, 232, 232, 232, 232, 232, 76,
+    172, 239, 240, 184, 239, 2006, 240, 241, 241, 196, 239, 2006, 240, 2007, 2017, 241,
+    242, 242, 242, 208, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 243, 243,
+    243, 243, 220, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028,
+    2036, 243, 244, 244, 244, 244, 244, 232, 83, 83, 84, 83, 84, 85, 83, 84,
+    85, 86, 83, 84, 85, 86, 87, 83, 84, 85, 86, 87, 88, 11, 167, 179,
+    23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13,
+    1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490,
+    2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48,
+    49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38,
+    1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723,
+    1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207,
+    2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886,
+    1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482,
+    3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493,
+    3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610,
+    3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625,
+    4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183,
+    2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207,
+    2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227,
+    1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72,
+    73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746,
+    1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998,
+    4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773,
+    3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736,
+    4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618,
+    3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682,
+    6386, 6714, 3902, 1603, 1603, 1602, 1603, 4233, 4278, 4314, 1603, 1912, 2516, 4429, 2637, 4438,
+    4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 1603, 2934, 1944, 1954, 1963, 1971, 1978,
+    76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701,
+    2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941,
+    2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718,
+    4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008,
+    2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84,
+    85, 86, 87, 88, 17, 173, 2473, 185, 29, 173, 2534, 2655, 185, 2484, 2765, 2605,
+    197, 197, 41, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2495, 2864, 2616,
+    2864, 2865, 2726, 209, 209, 209, 53, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766,
+    197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2506, 2952, 2627, 2952, 2953,
+    2737, 2952, 2953, 2954, 2836, 221, 221, 221, 221, 65, 173, 2534, 2655, 185, 2535, 4866,
+    2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868,
+    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2517, 3029, 2638,
+    3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031, 3032, 2935, 233, 233, 233, 233,
+    233, 77, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876,
+    4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867,
+    2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893,
+    4938, 4974, 1603, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2528, 3095, 2649, 3095, 3096, 2759,
+    3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098, 2946, 3095, 3096, 3097, 3098, 3099, 3023, 245,
+    245, 245, 245, 245, 245, 89, 173, 251, 252, 185, 251, 2072, 252, 253, 253, 197,
+    251, 2072, 252, 2073, 2083, 253, 254, 254, 254, 209, 251, 2072, 252, 2073, 2083, 253,
+    2074, 2084, 2093, 254, 255, 255, 255, 255, 221, 251, 2072, 252, 2073, 2083, 253, 2074,
+    2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 256, 256, 256, 256, 256, 233, 251, 2072,
+    252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095,
+    2103, 2110, 256, 257, 257, 257, 257, 257, 257, 245, 95, 95, 96, 95, 96, 97,
+    95, 96, 97, 98, 95, 96, 97, 98, 99, 95, 96, 97, 98, 99, 100, 95,
+    96, 97, 98, 99, 100, 101, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168,
+    2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546,
+    1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722,
+    193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622,
+    3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601,
+    3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622,
+    182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833,
+    206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15,
+    1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337,
+    3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821,
+    1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350,
+    1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834,
+    1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514,
+    4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445,
+    4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952,
+    1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680,
+    28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383,
+    6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641,
+    3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006,
+    4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897,
+    1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358,
+    6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122,
+    4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453,
+    4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646,
+    2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648,
+    2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648,
+    4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021,
+    3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036,
+    243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473,
+    1681, 29, 1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700,
+    3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53,
+    1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868,
+    4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889,
+    1898, 1906, 65, 1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655,
+    6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008,
+    4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847,
+    4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405,
+    6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469,
+    6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294,
+    3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 1604, 1604, 1604, 1603, 1604, 4460, 4505, 4541,
+    4569, 1604, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755,
+    4783, 2946, 4680, 4725, 4761, 4789, 1604, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89, 173,
+    2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864,
+    2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954,
+    2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002,
+    2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968,
+    2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 1604, 3034, 3095, 3096, 3097, 3098,
+    3099, 3100, 245, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094,
+    2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257, 95,
+    96, 97, 98, 99, 100, 101, 18, 174, 2474, 186, 30, 174, 2545, 2666, 186, 2485,
+    2776, 2606, 198, 198, 42, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2496,
+    2875, 2617, 2875, 2876, 2727, 210, 210, 210, 54, 174, 2545, 2666, 186, 2546, 5086, 2667,
+    2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2507, 2963, 2628,
+    2963, 2964, 2738, 2963, 2964, 2965, 2837, 222, 222, 222, 222, 66, 174, 2545, 2666, 186,
+    2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
+    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2518,
+    3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042, 2848, 3040, 3041, 3042, 3043, 2936, 234, 234,
+    234, 234, 234, 78, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087,
+    2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150,
+    5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187,
+    2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2529, 3106, 2650, 3106,
+    3107, 2760, 3106, 3107, 3108, 2859, 3106, 3107, 3108, 3109, 2947, 3106, 3107, 3108, 3109, 3110,
+    3024, 246, 246, 246, 246, 246, 246, 90, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776,
+    2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097,
+    5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143,
+    2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234,
+    2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120,
+    5165, 5201, 5229, 1604, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2540, 3161, 2661, 3161,
+    3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162, 3163, 3164, 2958, 3161, 3162, 3163, 3164, 3165,
+    3035, 3161, 3162, 3163, 3164, 3165, 3166, 3101, 258, 258, 258, 258, 258, 258, 258, 102,
+    174, 263, 264, 186, 263, 2138, 264, 265, 265, 198, 263, 2138, 264, 2139, 2149, 265,
+    266, 266, 266, 210, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 267, 267,
+    267, 267, 222, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160,
+    2168, 267, 268, 268, 268, 268, 268, 234, 263, 2138, 264, 2139, 2149, 265, 2140, 2150,
+    2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 269, 269, 269,
+    269, 269, 269, 246, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151,
+    2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269,
+    270, 270, 270, 270, 270, 270, 270, 258, 107, 107, 108, 107, 108, 109, 107, 108,
+    109, 110, 107, 108, 109, 110, 111, 107, 108, 109, 110, 111, 112, 107, 108, 109,
+    110, 111, 112, 113, 107, 108, 109, 110, 111, 112, 113, 114, 11, 167, 179, 23,
+    12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611,
+    2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611,
+    181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49,
+    14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631,
+    3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
+    1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624,
+    4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895,
+    218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768,
+    2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
+    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785,
+    3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217,
+    4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513,
+    4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515,
+    4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940,
+    228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73,
+    74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756,
+    40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043,
+    2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427,
+    6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226,
+    4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793,
+    3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386,
+    6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483,
+    2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,
+    172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756,
+    2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942,
+    2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754,
+    4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018,
+    2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85,
+    86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747,
+    1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999,
+    4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774,
+    3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737,
+    4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354, 3574, 1715, 3399, 6203, 3619,
+    3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683,
+    6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439,
+    4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979,
+    77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693,
+    3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240,
+    4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882,
+    7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667,
+    4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021,
+    2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536,
+    4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885,
+    4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931,
+    4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 4870, 2660,
+    4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009,
+    5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072, 252, 2073, 2083, 253, 2074,
+    2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 2077, 2087,
+    2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100, 101, 18, 1616, 2474, 1682,
+    30, 1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758, 42, 1635, 3340, 3560, 1701, 3385,
+    6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54, 1643,
+    3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008,
+    4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899,
+    1907, 66, 1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360,
+    6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124,
+    4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455,
+    4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78, 1656, 3361, 3581, 1722, 3406, 6210,
+    3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274,
+    3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711,
+    6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570,
+    4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784,
+    2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90, 1661, 3366,
+    3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071,
+    4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355,
+    1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376,
+    4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056, 4171,
+    6575, 6903, 7112, 7237, 4391, 1605, 1605, 1605, 1605, 1604, 1605, 4686, 4731, 4767, 4795, 4816,
+    1605, 2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004,
+    2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036, 1605, 3101, 2078, 2088,
+    2097, 2105, 2112, 2118, 2123, 102, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198,
+    2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779,
+    5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106,
+    5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 5090,
+    2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201,
+    5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551, 5091, 2672, 5100, 5145, 2782,
+    5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166, 5202, 5230, 5251, 3046, 5126,
+    5171, 5207, 5235, 5256, 1605, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258, 263, 2138,
+    264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161,
+    2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269, 2144, 2154, 2163, 2171, 2178, 2184,
+    2189, 270, 107, 108, 109, 110, 111, 112, 113, 114, 19, 175, 2475, 187, 31, 175,
+    2556, 2677, 187, 2486, 2787, 2607, 199, 199, 43, 175, 2556, 2677, 187, 2557, 5306, 2678,
+    2787, 2788, 199, 2497, 2886, 2618, 2886, 2887, 2728, 211, 211, 211, 55, 175, 2556, 2677,
+    187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888,
+    211, 2508, 2974, 2629, 2974, 2975, 2739, 2974, 2975, 2976, 2838, 223, 223, 223, 223, 67,
+    175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789,
+    2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975,
+    2976, 2977, 223, 2519, 3051, 2640, 3051, 3052, 2750, 3051, 3052, 3053, 2849, 3051, 3052, 3053,
+    3054, 2937, 235, 235, 235, 235, 235, 79, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787,
+    2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317,
+    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363,
+    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,
+    2530, 3117, 2651, 3117, 3118, 2761, 3117, 3118, 3119, 2860, 3117, 3118, 3119, 3120, 2948, 3117,
+    3118, 3119, 3120, 3121, 3025, 247, 247, 247, 247, 247, 247, 91, 175, 2556, 2677, 187,
+    2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211,
+    2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560,
+    5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052,
+    3053, 3054, 3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379,
+    5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247,
+    2541, 3172, 2662, 3172, 3173, 2772, 3172, 3173, 3174, 2871, 3172, 3173, 3174, 3175, 2959, 3172,
+    3173, 3174, 3175, 3176, 3036, 3172, 3173, 3174, 3175, 3176, 3177, 3102, 259, 259, 259, 259,
+    259, 259, 259, 103, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307,
+    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
+    5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407,
+    2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319,
+    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
+    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247, 2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373,
+    5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427,
+    5455, 5476, 1605, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259, 2552, 3216, 2673, 3216,
+    3217, 2783, 3216, 3217, 3218, 2882, 3216, 3217, 3218, 3219, 2970, 3216, 3217, 3218, 3219, 3220,
+    3047, 3216, 3217, 3218, 3219, 3220, 3221, 3113, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3168,
+    271, 271, 271, 271, 271, 271, 271, 271, 115, 175, 275, 276, 187, 275, 2204, 276,
+    277, 277, 199, 275, 2204, 276, 2205, 2215, 277, 278, 278, 278, 211, 275, 2204, 276,
+    2205, 2215, 277, 2206, 2216, 2225, 278, 279, 279, 279, 279, 223, 275, 2204, 276, 2205,
+    2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 280, 280, 280, 280, 280,
+    235, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279,
+    2208, 2218, 2227, 2235, 2242, 280, 281, 281, 281, 281, 281, 281, 247, 275, 2204, 276,
+    2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235,
+    2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 282, 282, 282, 282, 282, 282, 282,
+    259, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279,
+    2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 2210, 2220, 2229,
+    2237, 2244, 2250, 2255, 282, 283, 283, 283, 283, 283, 283, 283, 283, 271, 119, 119,
+    120, 119, 120, 121, 119, 120, 121, 122, 119, 120, 121, 122, 123, 119, 120, 121,
+    122, 123, 124, 119, 120, 121, 122, 123, 124, 125, 119, 120, 121, 122, 123, 124,
+    125, 126, 119, 120, 121, 122, 123, 124, 125, 126, 127, 11, 167, 179, 23, 12,
+    1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469,
+    1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181,
+    2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14,
+    1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336,
+    3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820,
+    1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216,
+    4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218,
+    59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603,
+    1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614,
+    3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830,
+    1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262,
+    2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426,
+    2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428,
+    2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228,
+    1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74,
+    75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40,
+    1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725,
+    1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231,
+    3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271,
+    4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838,
+    1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714,
+    3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747,
+    4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172,
+    2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853,
+    2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943,
+    2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782,
+    2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027,
+    242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85, 86,
+    87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757,
+    41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044,
+    2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428,
+    6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227,
+    4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794,
+    3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387,
+    6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484,
+    2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979, 77,
+    1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881,
+    4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285,
+    4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882, 7091,
+    1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712,
+    4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030,
+    2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867,
+    2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930,
+    4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967,
+    2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 4870, 2660, 4879,
+    4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030,
+    3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072, 252, 2073, 2083, 253, 2074, 2084,
+    2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 2077, 2087, 2096,
+    2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100, 101, 18, 1616, 2474, 1682, 30,
+    1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758, 42, 1635, 3340, 3560, 1701, 3385, 6189,
+    3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54, 1643, 3348,
+    3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053,
+    4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907,
+    66, 1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360, 6688,
+    3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235,
+    4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500,
+    4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78, 1656, 3361, 3581, 1722, 3406, 6210, 3626,
+    3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690,
+    6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415,
+    6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570, 4591,
+    1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947,
+    4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90, 1661, 3366, 3586,
+    1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071, 4107,
+    1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925,
+    3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466,
+    4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056, 4171, 6575,
+    6903, 7112, 7237, 4391, 6610, 6938, 7147, 7272, 1604, 4611, 4686, 4731, 4767, 4795, 4816, 4831,
+    2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958,
+    4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015, 5036, 5051, 3101, 2078, 2088, 2097,
+    2105, 2112, 2118, 2123, 102, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547,
+    5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105,
+    5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151,
+    5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671,
+    5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229,
+    5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551, 5091, 2672, 5100, 5145, 2782, 5108,
+    5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166, 5202, 5230, 5251, 3046, 5126, 5171,
+    5207, 5235, 5256, 5271, 3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258, 263, 2138, 264,
+    2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169,
+    2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269, 2144, 2154, 2163, 2171, 2178, 2184, 2189,
+    270, 107, 108, 109, 110, 111, 112, 113, 114, 19, 1617, 2475, 1683, 31, 1627, 3332,
+    3552, 1693, 2486, 3772, 2607, 1749, 1759, 43, 1636, 3341, 3561, 1702, 3386, 6190, 3606, 3781,
+    3826, 1768, 2497, 3992, 2618, 4001, 4046, 2728, 1815, 1825, 1834, 55, 1644, 3349, 3569, 1710,
+    3394, 6198, 3614, 3789, 3834, 1776, 3430, 6234, 3650, 6354, 6682, 3870, 4009, 4054, 4090, 1842,
+    2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838, 1881, 1891, 1900, 1908, 67, 1651,
+    3356, 3576, 1717, 3401, 6205, 3621, 3796, 3841, 1783, 3437, 6241, 3657, 6361, 6689, 3877, 4016,
+    4061, 4097, 1849, 3465, 6269, 3685, 6389, 6717, 3905, 6473, 6801, 7010, 4125, 4236, 4281, 4317,
+    4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494, 4530, 2849, 4456, 4501, 4537, 4565,
+    2937, 1947, 1957, 1966, 1974, 1981, 79, 1657, 3362, 3582, 1723, 3407, 6211, 3627, 3802, 3847,
+    1789, 3443, 6247, 3663, 6367, 6695, 3883, 4022, 4067, 4103, 1855, 3471, 6275, 3691, 6395, 6723,
+    3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921, 3492, 6296, 3712, 6416, 6744, 3932,
+    6500, 6828, 7037, 4152, 6556, 6884, 7093, 7218, 4372, 4462, 4507, 4543, 4571, 4592, 1987, 2530,
+    4652, 2651, 4661, 4706, 2761, 4669, 4714, 4750, 2860, 4676, 4721, 4757, 4785, 2948, 4682, 4727,
+    4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053, 91, 1662, 3367, 3587, 1728, 3412,
+    6216, 3632, 3807, 3852, 1794, 3448, 6252, 3668, 6372, 6700, 3888, 4027, 4072, 4108, 1860, 3476,
+    6280, 3696, 6400, 6728, 3916, 6484, 6812, 7021, 4136, 4247, 4292, 4328, 4356, 1926, 3497, 6301,
+    3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889, 7098, 7223, 4377, 4467, 4512, 4548,
+    4576, 4597, 1992, 3512, 6316, 3732, 6436, 6764, 3952, 6520, 6848, 7057, 4172, 6576, 6904, 7113,
+    7238, 4392, 6611, 6939, 7148, 7273, 7342, 4612, 4687, 4732, 4768, 4796, 4817, 4832, 2058, 2541,
+    4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896, 4941, 4977, 5005, 2959, 4902, 4947,
+    4983, 5011, 5032, 3036, 4907, 4952, 4988, 5016, 5037, 5052, 3102, 2079, 2089, 2098, 2106, 2113,
+    2119, 2124, 103, 1666, 3371, 3591, 1732, 3416, 6220, 3636, 3811, 3856, 1798, 3452, 6256, 3672,
+    6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700, 6404, 6732, 3920, 6488, 6816, 7025,
+    4140, 4251, 4296, 4332, 4360, 1930, 3501, 6305, 3721, 6425, 6753, 3941, 6509, 6837, 7046, 4161,
+    6565, 6893, 7102, 7227, 4381, 4471, 4516, 4552, 4580, 4601, 1996, 3516, 6320, 3736, 6440, 6768,
+    3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396, 6615, 6943, 7152, 7277, 7346, 4616,
+    4691, 4736, 4772, 4800, 4821, 4836, 2062, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607,
+    1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1606, 1606, 1606,
+    1606, 1605, 1606, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 2552, 5092, 2673, 5101, 5146,
+    2783, 5109, 5154, 5190, 2882, 5116, 5161, 5197, 5225, 2970, 5122, 5167, 5203, 5231, 5252, 3047,
+    5127, 5172, 5208, 5236, 5257, 5272, 3113, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 2145,
+    2155, 2164, 2172, 2179, 2185, 2190, 1607, 115, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787,
+    2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317,
+    5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363,
+    2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235,
+    2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340,
+    5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247, 2562, 5311, 2683, 5320,
+    5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422, 5450, 5471,
+    3057, 5346, 5391, 5427, 5455, 5476, 5491, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259,
+    2563, 5312, 2684, 5321, 5366, 2794, 5329, 5374, 5410, 2893, 5336, 5381, 5417, 5445, 2981, 5342,
+    5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477, 5492, 3124, 1607, 1607, 1607, 1607,
+    1607, 1607, 1606, 1607, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 1607, 271, 275, 2204, 276,
+    2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235,
+    2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 2210, 2220, 2229, 2237, 2244, 2250, 2255,
+    282, 2211, 2221, 2230, 2238, 2245, 2251, 2256, 1607, 283, 119, 120, 121, 122, 123, 124,
+    125, 126, 127, 20, 176, 2476, 188, 32, 176, 2567, 2688, 188, 2487, 2798, 2608, 200,
+    200, 44, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2498, 2897, 2619, 2897,
+    2898, 2729, 212, 212, 212, 56, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200,
+    2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2509, 2985, 2630, 2985, 2986, 2740,
+    2985, 2986, 2987, 2839, 224, 224, 224, 224, 68, 176, 2567, 2688, 188, 2568, 5526, 2689,
+    2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691,
+    5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2520, 3062, 2641, 3062,
+    3063, 2751, 3062, 3063, 3064, 2850, 3062, 3063, 3064, 3065, 2938, 236, 236, 236, 236, 236,
+    80, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581,
+    2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985,
+    2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598,
+    5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2531, 3128, 2652, 3128, 3129, 2762, 3128,
+    3129, 3130, 2861, 3128, 3129, 3130, 3131, 2949, 3128, 3129, 3130, 3131, 3132, 3026, 248, 248,
+    248, 248, 248, 248, 92, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569,
+    5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545,
+    5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591,
+    5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693,
+    5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669,
+    5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2542, 3183, 2663, 3183, 3184, 2773, 3183,
+    3184, 3185, 2872, 3183, 3184, 3185, 3186, 2960, 3183, 3184, 3185, 3186, 3187, 3037, 3183, 3184,
+    3185, 3186, 3187, 3188, 3103, 260, 260, 260, 260, 260, 260, 260, 104, 176, 2567, 2688,
+    188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899,
+    212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224,
+    2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062,
+    3063, 3064, 3065, 3066, 236, 2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554,
+    5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133,
+    248, 2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991,
+    5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185,
+    3186, 3187, 3188, 3189, 260, 2553, 3227, 2674, 3227, 3228, 2784, 3227, 3228, 3229, 2883, 3227,
+    3228, 3229, 3230, 2971, 3227, 3228, 3229, 3230, 3231, 3048, 3227, 3228, 3229, 3230, 3231, 3232,
+    3114, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3169, 272, 272, 272, 272, 272, 272, 272,
+    272, 116, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536,
+    5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900,
+    2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553,
+    5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693, 5539, 5584, 2803,
+    5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128,
+    3129, 3130, 3131, 3132, 3133, 248, 2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903,
+    5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675, 5696,
+    5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260, 2574, 5532, 2695, 5541, 5586, 2805,
+    5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665, 2992, 5562, 5607, 5643, 5671, 5692, 3069, 5567,
+    5612, 5648, 5676, 5697, 5712, 3135, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 3227, 3228,
+    3229, 3230, 3231, 3232, 3233, 1607, 272, 2564, 3260, 2685, 3260, 3261, 2795, 3260, 3261, 3262,
+    2894, 3260, 3261, 3262, 3263, 2982, 3260, 3261, 3262, 3263, 3264, 3059, 3260, 3261, 3262, 3263,
+    3264, 3265, 3125, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3180, 3260, 3261, 3262, 3263, 3264,
+    3265, 3266, 1607, 3224, 284, 284, 284, 284, 284, 284, 284, 284, 284, 128, 176, 287,
+    288, 188, 287, 2270, 288, 289, 289, 200, 287, 2270, 288, 2271, 2281, 289, 290, 290,
+    290, 212, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 291, 291, 291, 291,
+    224, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291,
+    292, 292, 292, 292, 292, 236, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290,
+    2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 293, 293, 293, 293, 293,
+    293, 248, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300,
+    291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 294, 294,
+    294, 294, 294, 294, 294, 260, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290,
+    2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309,
+    2315, 293, 2276, 2286, 2295, 2303, 2310, 2316, 2321, 294, 295, 295, 295, 295, 295, 295,
+    295, 295, 272, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292,
+    2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 2276,
+    2286, 2295, 2303, 2310, 2316, 2321, 294, 2277, 2287, 2296, 2304, 2311, 2317, 2322, 1607, 295,
+    296, 296, 296, 296, 296, 296, 296, 296, 296, 284, 131, 131, 132, 131, 132, 133,
+    131, 132, 133, 134, 131, 132, 133, 134, 135, 131, 132, 133, 134, 135, 136, 131,
+    132, 133, 134, 135, 136, 137, 131, 132, 133, 134, 135, 136, 137, 138, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 11, 167, 179, 23, 12, 177, 2468, 189, 24, 168, 2479, 2600, 180, 191, 201,
+    192, 35, 36, 13, 177, 2469, 189, 25, 177, 2578, 2699, 189, 2480, 2809, 2601, 201,
+    201, 37, 169, 2490, 2611, 181, 2491, 2908, 2612, 2721, 2722, 193, 203, 213, 204, 213,
+    213, 205, 47, 48, 49, 14, 177, 2470, 189, 26, 177, 2578, 2699, 189, 2481, 2809,
+    2602, 201, 201, 38, 177, 2578, 2699, 189, 2579, 1600, 2700, 2809, 2810, 201, 2492, 2908,
+    2613, 2908, 2909, 2723, 213, 213, 213, 50, 170, 2501, 2622, 182, 2502, 2996, 2623, 2732,
+    2733, 194, 2503, 2996, 2624, 2996, 2997, 2734, 2831, 2832, 2833, 206, 215, 225, 216, 225,
+    225, 217, 225, 225, 225, 218, 59, 60, 61, 62, 15, 177, 2471, 189, 27, 177,
+    2578, 2699, 189, 2482, 2809, 2603, 201, 201, 39, 177, 2578, 2699, 189, 2579, 5746, 2700,
+    2809, 2810, 201, 2493, 2908, 2614, 2908, 2909, 2724, 213, 213, 213, 51, 177, 2578, 2699,
+    189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 1601, 2811, 2908, 2909, 2910,
+    213, 2504, 2996, 2625, 2996, 2997, 2735, 2996, 2997, 2998, 2834, 225, 225, 225, 225, 63,
+    171, 2512, 2633, 183, 2513, 3073, 2634, 2743, 2744, 195, 2514, 3073, 2635, 3073, 3074, 2745,
+    2842, 2843, 2844, 207, 2515, 3073, 2636, 3073, 3074, 2746, 3073, 3074, 3075, 2845, 2930, 2931,
+    2932, 2933, 219, 227, 237, 228, 237, 237, 229, 237, 237, 237, 230, 237, 237, 237,
+    237, 231, 71, 72, 73, 74, 75, 16, 177, 2472, 189, 28, 177, 2578, 2699, 189,
+    2483, 2809, 2604, 201, 201, 40, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201,
+    2494, 2908, 2615, 2908, 2909, 2725, 213, 213, 213, 52, 177, 2578, 2699, 189, 2579, 5746,
+    2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2505, 2996,
+    2626, 2996, 2997, 2736, 2996, 2997, 2998, 2835, 225, 225, 225, 225, 64, 177, 2578, 2699,
+    189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
+    213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 1602, 2911, 2996, 2997, 2998, 2999, 225,
+    2516, 3073, 2637, 3073, 3074, 2747, 3073, 3074, 3075, 2846, 3073, 3074, 3075, 3076, 2934, 237,
+    237, 237, 237, 237, 76, 172, 2523, 2644, 184, 2524, 3139, 2645, 2754, 2755, 196, 2525,
+    3139, 2646, 3139, 3140, 2756, 2853, 2854, 2855, 208, 2526, 3139, 2647, 3139, 3140, 2757, 3139,
+    3140, 3141, 2856, 2941, 2942, 2943, 2944, 220, 2527, 3139, 2648, 3139, 3140, 2758, 3139, 3140,
+    3141, 2857, 3139, 3140, 3141, 3142, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 249, 240,
+    249, 249, 241, 249, 249, 249, 242, 249, 249, 249, 249, 243, 249, 249, 249, 249,
+    249, 244, 83, 84, 85, 86, 87, 88, 17, 177, 2473, 189, 29, 177, 2578, 2699,
+    189, 2484, 2809, 2605, 201, 201, 41, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810,
+    201, 2495, 2908, 2616, 2908, 2909, 2726, 213, 213, 213, 53, 177, 2578, 2699, 189, 2579,
+    5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2506,
+    2996, 2627, 2996, 2997, 2737, 2996, 2997, 2998, 2836, 225, 225, 225, 225, 65, 177, 2578,
+    2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909,
+    2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999,
+    225, 2517, 3073, 2638, 3073, 3074, 2748, 3073, 3074, 3075, 2847, 3073, 3074, 3075, 3076, 2935,
+    237, 237, 237, 237, 237, 77, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201,
+    2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812,
+    5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766,
+    5811, 5847, 2912, 5773, 5818, 5854, 1603, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2528, 3139,
+    2649, 3139, 3140, 2759, 3139, 3140, 3141, 2858, 3139, 3140, 3141, 3142, 2946, 3139, 3140, 3141,
+    3142, 3143, 3023, 249, 249, 249, 249, 249, 249, 89, 173, 2534, 2655, 185, 2535, 3194,
+    2656, 2765, 2766, 197, 2536, 3194, 2657, 3194, 3195, 2767, 2864, 2865, 2866, 209, 2537, 3194,
+    2658, 3194, 3195, 2768, 3194, 3195, 3196, 2867, 2952, 2953, 2954, 2955, 221, 2538, 3194, 2659,
+    3194, 3195, 2769, 3194, 3195, 3196, 2868, 3194, 3195, 3196, 3197, 2956, 3029, 3030, 3031, 3032,
+    3033, 233, 2539, 3194, 2660, 3194, 3195, 2770, 3194, 3195, 3196, 2869, 3194, 3195, 3196, 3197,
+    2957, 3194, 3195, 3196, 3197, 3198, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 261,
+    252, 261, 261, 253, 261, 261, 261, 254, 261, 261, 261, 261, 255, 261, 261, 261,
+    261, 261, 256, 261, 261, 261, 261, 261, 261, 257, 95, 96, 97, 98, 99, 100,
+    101, 18, 177, 2474, 189, 30, 177, 2578, 2699, 189, 2485, 2809, 2606, 201, 201, 42,
+    177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2496, 2908, 2617, 2908, 2909, 2727,
+    213, 213, 213, 54, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747,
+    2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2507, 2996, 2628, 2996, 2997, 2738, 2996, 2997,
+    2998, 2837, 225, 225, 225, 225, 66, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810,
+    201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802,
+    2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2518, 3073, 2639, 3073, 3074, 2749,
+    3073, 3074, 3075, 2848, 3073, 3074, 3075, 3076, 2936, 237, 237, 237, 237, 237, 78, 177,
+    2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908,
+    2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998,
+    2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882,
+    3000, 3073, 3074, 3075, 3076, 3077, 237, 2529, 3139, 2650, 3139, 3140, 2760, 3139, 3140, 3141,
+    2859, 3139, 3140, 3141, 3142, 2947, 3139, 3140, 3141, 3142, 3143, 3024, 249, 249, 249, 249,
+    249, 249, 90, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701,
+    5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846,
+    2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912,
+    5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750, 2704, 5759, 5804,
+    2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 1604, 3078,
+    3139, 3140, 3141, 3142, 3143, 3144, 249, 2540, 3194, 2661, 3194, 3195, 2771, 3194, 3195, 3196,
+    2870, 3194, 3195, 3196, 3197, 2958, 3194, 3195, 3196, 3197, 3198, 3035, 3194, 3195, 3196, 3197,
+    3198, 3199, 3101, 261, 261, 261, 261, 261, 261, 261, 102, 174, 2545, 2666, 186, 2546,
+    3238, 2667, 2776, 2777, 198, 2547, 3238, 2668, 3238, 3239, 2778, 2875, 2876, 2877, 210, 2548,
+    3238, 2669, 3238, 3239, 2779, 3238, 3239, 3240, 2878, 2963, 2964, 2965, 2966, 222, 2549, 3238,
+    2670, 3238, 3239, 2780, 3238, 3239, 3240, 2879, 3238, 3239, 3240, 3241, 2967, 3040, 3041, 3042,
+    3043, 3044, 234, 2550, 3238, 2671, 3238, 3239, 2781, 3238, 3239, 3240, 2880, 3238, 3239, 3240,
+    3241, 2968, 3238, 3239, 3240, 3241, 3242, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551,
+    3238, 2672, 3238, 3239, 2782, 3238, 3239, 3240, 2881, 3238, 3239, 3240, 3241, 2969, 3238, 3239,
+    3240, 3241, 3242, 3046, 3238, 3239, 3240, 3241, 3242, 3243, 3112, 3161, 3162, 3163, 3164, 3165,
+    3166, 3167, 258, 263, 273, 264, 273, 273, 265, 273, 273, 273, 266, 273, 273, 273,
+    273, 267, 273, 273, 273, 273, 273, 268, 273, 273, 273, 273, 273, 273, 269, 273,
+    273, 273, 273, 273, 273, 273, 270, 107, 108, 109, 110, 111, 112, 113, 114, 19,
+    177, 2475, 189, 31, 177, 2578, 2699, 189, 2486, 2809, 2607, 201, 201, 43, 177, 2578,
+    2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2497, 2908, 2618, 2908, 2909, 2728, 213, 213,
+    213, 55, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756,
+    5801, 2811, 2908, 2909, 2910, 213, 2508, 2996, 2629, 2996, 2997, 2739, 2996, 2997, 2998, 2838,
+    225, 225, 225, 225, 67, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580,
+    5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765,
+    5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2519, 3073, 2640, 3073, 3074, 2750, 3073, 3074,
+    3075, 2849, 3073, 3074, 3075, 3076, 2937, 237, 237, 237, 237, 237, 79, 177, 2578, 2699,
+    189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
+    213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,
+    2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073,
+    3074, 3075, 3076, 3077, 237, 2530, 3139, 2651, 3139, 3140, 2761, 3139, 3140, 3141, 2860, 3139,
+    3140, 3141, 3142, 2948, 3139, 3140, 3141, 3142, 3143, 3025, 249, 249, 249, 249, 249, 249,
+    91, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801,
+    2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
+    2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818,
+    5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750, 2704, 5759, 5804, 2814, 5767,
+    5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140,
+    3141, 3142, 3143, 3144, 249, 2541, 3194, 2662, 3194, 3195, 2772, 3194, 3195, 3196, 2871, 3194,
+    3195, 3196, 3197, 2959, 3194, 3195, 3196, 3197, 3198, 3036, 3194, 3195, 3196, 3197, 3198, 3199,
+    3102, 261, 261, 261, 261, 261, 261, 261, 103, 177, 2578, 2699, 189, 2579, 5746, 2700,
+    2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702,
+    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758,
+    5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
+    237, 2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001,
+    5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705,
+    5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890,
+    5911, 3079, 5786, 5831, 5867, 5895, 5916, 1605, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+    261, 2552, 3238, 2673, 3238, 3239, 2783, 3238, 3239, 3240, 2882, 3238, 3239, 3240, 3241, 2970,
+    3238, 3239, 3240, 3241, 3242, 3047, 3238, 3239, 3240, 3241, 3242, 3243, 3113, 3238, 3239, 3240,
+    3241, 3242, 3243, 3244, 3168, 273, 273, 273, 273, 273, 273, 273, 273, 115, 175, 2556,
+    2677, 187, 2557, 3271, 2678, 2787, 2788, 199, 2558, 3271, 2679, 3271, 3272, 2789, 2886, 2887,
+    2888, 211, 2559, 3271, 2680, 3271, 3272, 2790, 3271, 3272, 3273, 2889, 2974, 2975, 2976, 2977,
+    223, 2560, 3271, 2681, 3271, 3272, 2791, 3271, 3272, 3273, 2890, 3271, 3272, 3273, 3274, 2978,
+    3051, 3052, 3053, 3054, 3055, 235, 2561, 3271, 2682, 3271, 3272, 2792, 3271, 3272, 3273, 2891,
+    3271, 3272, 3273, 3274, 2979, 3271, 3272, 3273, 3274, 3275, 3056, 3117, 3118, 3119, 3120, 3121,
+    3122, 247, 2562, 3271, 2683, 3271, 3272, 2793, 3271, 3272, 3273, 2892, 3271, 3272, 3273, 3274,
+    2980, 3271, 3272, 3273, 3274, 3275, 3057, 3271, 3272, 3273, 3274, 3275, 3276, 3123, 3172, 3173,
+    3174, 3175, 3176, 3177, 3178, 259, 2563, 3271, 2684, 3271, 3272, 2794, 3271, 3272, 3273, 2893,
+    3271, 3272, 3273, 3274, 2981, 3271, 3272, 3273, 3274, 3275, 3058, 3271, 3272, 3273, 3274, 3275,
+    3276, 3124, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3179, 3216, 3217, 3218, 3219, 3220, 3221,
+    3222, 3223, 271, 275, 285, 276, 285, 285, 277, 285, 285, 285, 278, 285, 285, 285,
+    285, 279, 285, 285, 285, 285, 285, 280, 285, 285, 285, 285, 285, 285, 281, 285,
+    285, 285, 285, 285, 285, 285, 282, 285, 285, 285, 285, 285, 285, 285, 285, 283,
+    119, 120, 121, 122, 123, 124, 125, 126, 127, 20, 177, 2476, 189, 32, 177, 2578,
+    2699, 189, 2487, 2809, 2608, 201, 201, 44, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809,
+    2810, 201, 2498, 2908, 2619, 2908, 2909, 2729, 213, 213, 213, 56, 177, 2578, 2699, 189,
+    2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213,
+    2509, 2996, 2630, 2996, 2997, 2740, 2996, 2997, 2998, 2839, 225, 225, 225, 225, 68, 177,
+    2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908,
+    2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998,
+    2999, 225, 2520, 3073, 2641, 3073, 3074, 2751, 3073, 3074, 3075, 2850, 3073, 3074, 3075, 3076,
+    2938, 237, 237, 237, 237, 237, 80, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810,
+    201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802,
+    2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813,
+    5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2531,
+    3139, 2652, 3139, 3140, 2762, 3139, 3140, 3141, 2861, 3139, 3140, 3141, 3142, 2949, 3139, 3140,
+    3141, 3142, 3143, 3026, 249, 249, 249, 249, 249, 249, 92, 177, 2578, 2699, 189, 2579,
+    5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581,
+    5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749,
+    2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075,
+    3076, 3077, 237, 2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855,
+    5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2542,
+    3194, 2663, 3194, 3195, 2773, 3194, 3195, 3196, 2872, 3194, 3195, 3196, 3197, 2960, 3194, 3195,
+    3196, 3197, 3198, 3037, 3194, 3195, 3196, 3197, 3198, 3199, 3103, 261, 261, 261, 261, 261,
+    261, 261, 104, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701,
+    5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846,
+    2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912,
+    5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750, 2704, 5759, 5804,
+    2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078,
+    3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849,
+    2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895,
+    5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261, 2553, 3238, 2674, 3238, 3239,
+    2784, 3238, 3239, 3240, 2883, 3238, 3239, 3240, 3241, 2971, 3238, 3239, 3240, 3241, 3242, 3048,
+    3238, 3239, 3240, 3241, 3242, 3243, 3114, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3169, 273,
+    273, 273, 273, 273, 273, 273, 273, 116, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809,
+    2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757,
+    5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803,
+    2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237,
+    2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780,
+    5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705, 5760,
+    5805, 2815, 5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911,
+    3079, 5786, 5831, 5867, 5895, 5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261,
+    2585, 5752, 2706, 5761, 5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003, 5782,
+    5827, 5863, 5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917, 5932, 3146, 1607, 1607, 1607, 1607,
+    1607, 1607, 1606, 1607, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 1607, 273, 2564, 3271, 2685,
+    3271, 3272, 2795, 3271, 3272, 3273, 2894, 3271, 3272, 3273, 3274, 2982, 3271, 3272, 3273, 3274,
+    3275, 3059, 3271, 3272, 3273, 3274, 3275, 3276, 3125, 3271, 3272, 3273, 3274, 3275, 3276, 3277,
+    3180, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 1607, 3224, 285, 285, 285, 285, 285, 285,
+    285, 285, 285, 128, 176, 2567, 2688, 188, 2568, 3293, 2689, 2798, 2799, 200, 2569, 3293,
+    2690, 3293, 3294, 2800, 2897, 2898, 2899, 212, 2570, 3293, 2691, 3293, 3294, 2801, 3293, 3294,
+    3295, 2900, 2985, 2986, 2987, 2988, 224, 2571, 3293, 2692, 3293, 3294, 2802, 3293, 3294, 3295,
+    2901, 3293, 3294, 3295, 3296, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 3293, 2693, 3293,
+    3294, 2803, 3293, 3294, 3295, 2902, 3293, 3294, 3295, 3296, 2990, 3293, 3294, 3295, 3296, 3297,
+    3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 3293, 2694, 3293, 3294, 2804, 3293, 3294,
+    3295, 2903, 3293, 3294, 3295, 3296, 2991, 3293, 3294, 3295, 3296, 3297, 3068, 3293, 3294, 3295,
+    3296, 3297, 3298, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260, 2574, 3293, 2695, 3293,
+    3294, 2805, 3293, 3294, 3295, 2904, 3293, 3294, 3295, 3296, 2992, 3293, 3294, 3295, 3296, 3297,
+    3069, 3293, 3294, 3295, 3296, 3297, 3298, 3135, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3190,
+    3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 272, 2575, 3293, 2696, 3293, 3294, 2806, 3293,
+    3294, 3295, 2905, 3293, 3294, 3295, 3296, 2993, 3293, 3294, 3295, 3296, 3297, 3070, 3293, 3294,
+    3295, 3296, 3297, 3298, 3136, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3191, 3293, 3294, 3295,
+    3296, 3297, 3298, 3299, 1607, 3235, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 284,
+    287, 297, 288, 297, 297, 289, 297, 297, 297, 290, 297, 297, 297, 297, 291, 297,
+    297, 297, 297, 297, 292, 297, 297, 297, 297, 297, 297, 293, 297, 297, 297, 297,
+    297, 297, 297, 294, 297, 297, 297, 297, 297, 297, 297, 297, 295, 297, 297, 297,
+    297, 297, 297, 297, 297, 297, 296, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 21, 177, 299, 189, 33, 177, 299, 300, 189, 299, 301, 300, 201, 201, 45,
+    177, 299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 302, 300, 302, 302, 301,
+    213, 213, 213, 57, 177, 299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 2336,
+    300, 2337, 2347, 301, 302, 302, 302, 213, 299, 303, 300, 303, 303, 301, 303, 303,
+    303, 302, 225, 225, 225, 225, 69, 177, 299, 300, 189, 299, 2336, 300, 301, 301,
+    201, 299, 2336, 300, 2337, 2347, 301, 302, 302, 302, 213, 299, 2336, 300, 2337, 2347,
+    301, 2338, 2348, 2357, 302, 303, 303, 303, 303, 225, 299, 304, 300, 304, 304, 301,
+    304, 304, 304, 302, 304, 304, 304, 304, 303, 237, 237, 237, 237, 237, 81, 177,
+    299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 2336, 300, 2337, 2347, 301, 302,
+    302, 302, 213, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 303, 303, 303,
+    303, 225, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366,
+    303, 304, 304, 304, 304, 304, 237, 299, 305, 300, 305, 305, 301, 305, 305, 305,
+    302, 305, 305, 305, 305, 303, 305, 305, 305, 305, 305, 304, 249, 249, 249, 249,
+    249, 249, 93, 177, 299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 2336, 300,
+    2337, 2347, 301, 302, 302, 302, 213, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357,
+    302, 303, 303, 303, 303, 225, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302,
+    2339, 2349, 2358, 2366, 303, 304, 304, 304, 304, 304, 237, 299, 2336, 300, 2337, 2347,
+    301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304,
+    305, 305, 305, 305, 305, 305, 249, 299, 306, 300, 306, 306, 301, 306, 306, 306,
+    302, 306, 306, 306, 306, 303, 306, 306, 306, 306, 306, 304, 306, 306, 306, 306,
+    306, 306, 305, 261, 261, 261, 261, 261, 261, 261, 105, 177, 299, 300, 189, 299,
+    2336, 300, 301, 301, 201, 299, 2336, 300, 2337, 2347, 301, 302, 302, 302, 213, 299,
+    2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 303, 303, 303, 303, 225, 299, 2336,
+    300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 304, 304, 304,
+    304, 304, 237, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358,
+    2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 305, 305, 305, 305, 305, 305, 249, 299,
+    2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350,
+    2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305, 306, 306, 306, 306, 306,
+    306, 306, 261, 299, 307, 300, 307, 307, 301, 307, 307, 307, 302, 307, 307, 307,
+    307, 303, 307, 307, 307, 307, 307, 304, 307, 307, 307, 307, 307, 307, 305, 307,
+    307, 307, 307, 307, 307, 307, 306, 273, 273, 273, 273, 273, 273, 273, 273, 117,
+    177, 299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 2336, 300, 2337, 2347, 301,
+    302, 302, 302, 213, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 303, 303,
+    303, 303, 225, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358,
+    2366, 303, 304, 304, 304, 304, 304, 237, 299, 2336, 300, 2337, 2347, 301, 2338, 2348,
+    2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 305, 305, 305,
+    305, 305, 305, 249, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349,
+    2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305,
+    306, 306, 306, 306, 306, 306, 306, 261, 299, 2336, 300, 2337, 2347, 301, 2338, 2348,
+    2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360,
+    2368, 2375, 2381, 305, 2342, 2352, 2361, 2369, 2376, 2382, 2387, 306, 307, 307, 307, 307,
+    307, 307, 307, 307, 273, 299, 308, 300, 308, 308, 301, 308, 308, 308, 302, 308,
+    308, 308, 308, 303, 308, 308, 308, 308, 308, 304, 308, 308, 308, 308, 308, 308,
+    305, 308, 308, 308, 308, 308, 308, 308, 306, 308, 308, 308, 308, 308, 308, 308,
+    308, 307, 285, 285, 285, 285, 285, 285, 285, 285, 285, 129, 177, 299, 300, 189,
+    299, 2336, 300, 301, 301, 201, 299, 2336, 300, 2337, 2347, 301, 302, 302, 302, 213,
+    299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 303, 303, 303, 303, 225, 299,
+    2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 304, 304,
+    304, 304, 304, 237, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349,
+    2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 305, 305, 305, 305, 305, 305, 249,
+    299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 2340,
+    2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305, 306, 306, 306, 306,
+    306, 306, 306, 261, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349,
+    2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305,
+    2342, 2352, 2361, 2369, 2376, 2382, 2387, 306, 307, 307, 307, 307, 307, 307, 307, 307,
+    273, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303,
+    2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305, 2342, 2352, 2361,
+    2369, 2376, 2382, 2387, 306, 2343, 2353, 2362, 2370, 2377, 2383, 2388, 1607, 307, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 285, 299, 309, 300, 309, 309, 301, 309, 309,
+    309, 302, 309, 309, 309, 309, 303, 309, 309, 309, 309, 309, 304, 309, 309, 309,
+    309, 309, 309, 305, 309, 309, 309, 309, 309, 309, 309, 306, 309, 309, 309, 309,
+    309, 309, 309, 309, 307, 309, 309, 309, 309, 309, 309, 309, 309, 309, 308, 297,
+    297, 297, 297, 297, 297, 297, 297, 297, 297, 141, 143, 143, 143, 144, 143, 143,
+    144, 143, 144, 145, 143, 143, 144, 143, 144, 145, 143, 144, 145, 146, 143, 143,
+    144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146, 147, 143, 143, 144,
+    143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146, 147, 143, 144, 145, 146,
+    147, 148, 143, 143, 144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146,
+    147, 143, 144, 145, 146, 147, 148, 143, 144, 145, 146, 147, 148, 149, 143, 143,
+    144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146, 147, 143, 144, 145,
+    146, 147, 148, 143, 144, 145, 146, 147, 148, 149, 143, 144, 145, 146, 147, 148,
+    149, 150, 143, 143, 144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146,
+    147, 143, 144, 145, 146, 147, 148, 143, 144, 145, 146, 147, 148, 149, 143, 144,
+    145, 146, 147, 148, 149, 150, 143, 144, 145, 146, 147, 148, 149, 150, 151, 143,
+    143, 144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146, 147, 143, 144,
+    145, 146, 147, 148, 143, 144, 145, 146, 147, 148, 149, 143, 144, 145, 146, 147,
+    148, 149, 150, 143, 144, 145, 146, 147, 148, 149, 150, 151, 143, 144, 145, 146,
+    147, 148, 149, 150, 151, 152, 143, 143, 144, 143, 144, 145, 143, 144, 145, 146,
+    143, 144, 145, 146, 147, 143, 144, 145, 146, 147, 148, 143, 144, 145, 146, 147,
+    148, 149, 143, 144, 145, 146, 147, 148, 149, 150, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 11, 167, 23, 11, 167, 179, 23, 12,
+    168, 2468, 180, 24, 168, 191, 192, 180, 35, 35, 36, 11, 167, 179, 23, 12,
+    1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 169, 2469,
+    181, 25, 169, 2490, 2611, 181, 2480, 2721, 2601, 193, 193, 37, 169, 203, 204, 181,
+    203, 1808, 204, 205, 205, 193, 47, 47, 48, 47, 48, 49, 11, 167, 179, 23,
+    12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611,
+    2469, 1677, 25, 1621, 1600, 1600, 1687, 2480, 1600, 2601, 1743, 1753, 37, 169, 2490, 2611,
+    181, 2491, 1600, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49,
+    14, 170, 2470, 182, 26, 170, 2501, 2622, 182, 2481, 2732, 2602, 194, 194, 38, 170,
+    2501, 2622, 182, 2502, 1600, 2623, 2732, 2733, 194, 2492, 2831, 2613, 2831, 2832, 2723, 206,
+    206, 206, 50, 170, 215, 216, 182, 215, 1874, 216, 217, 217, 194, 215, 1874, 216,
+    1875, 1885, 217, 218, 218, 218, 206, 59, 59, 60, 59, 60, 61, 59, 60, 61,
+    62, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742,
+    192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
+    1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809,
+    1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767,
+    2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 1601, 3776, 1601, 1763, 2492, 3987,
+    2613, 3996, 1601, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732,
+    2733, 194, 2503, 4207, 2624, 4216, 1601, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875,
+    1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 171, 2471, 183, 27, 171,
+    2512, 2633, 183, 2482, 2743, 2603, 195, 195, 39, 171, 2512, 2633, 183, 2513, 4426, 2634,
+    2743, 2744, 195, 2493, 2842, 2614, 2842, 2843, 2724, 207, 207, 207, 51, 171, 2512, 2633,
+    183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 1601, 2745, 2842, 2843, 2844,
+    207, 2504, 2930, 2625, 2930, 2931, 2735, 2930, 2931, 2932, 2834, 219, 219, 219, 219, 63,
+    171, 227, 228, 183, 227, 1940, 228, 229, 229, 195, 227, 1940, 228, 1941, 1951, 229,
+    230, 230, 230, 207, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 231, 231,
+    231, 231, 219, 71, 71, 72, 71, 72, 73, 71, 72, 73, 74, 71, 72, 73,
+    74, 75, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601,
+    1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204,
+    1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481,
+    3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
+    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623,
+    2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216,
+    1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27,
+    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186,
+    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345,
+    3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 1602, 1601, 1602, 4005, 4050,
+    1602, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 1602, 2834, 1877, 1887, 1896, 1904,
+    63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481,
+    2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 1602, 2845, 2930,
+    2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953,
+    1962, 1970, 231, 71, 72, 73, 74, 75, 16, 172, 2472, 184, 28, 172, 2523, 2644,
+    184, 2483, 2754, 2604, 196, 196, 40, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755,
+    196, 2494, 2853, 2615, 2853, 2854, 2725, 208, 208, 208, 52, 172, 2523, 2644, 184, 2524,
+    4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2505,
+    2941, 2626, 2941, 2942, 2736, 2941, 2942, 2943, 2835, 220, 220, 220, 220, 64, 172, 2523,
+    2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854,
+    2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 1602, 2856, 2941, 2942, 2943, 2944,
+    220, 2516, 3018, 2637, 3018, 3019, 2747, 3018, 3019, 3020, 2846, 3018, 3019, 3020, 3021, 2934,
+    232, 232, 232, 232, 232, 76, 172, 239, 240, 184, 239, 2006, 240, 241, 241, 196,
+    239, 2006, 240, 2007, 2017, 241, 242, 242, 242, 208, 239, 2006, 240, 2007, 2017, 241,
+    2008, 2018, 2027, 242, 243, 243, 243, 243, 220, 239, 2006, 240, 2007, 2017, 241, 2008,
+    2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 244, 244, 244, 244, 244, 232, 83, 83,
+    84, 83, 84, 85, 83, 84, 85, 86, 83, 84, 85, 86, 87, 83, 84, 85,
+    86, 87, 88, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180,
+    191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766,
+    2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808,
+    204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688,
+    2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763,
+    2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206,
+    2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874,
+    216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679,
+    27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382,
+    6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640,
+    3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005,
+    4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896,
+    1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436,
+    4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845,
+    2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943,
+    1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329,
+    3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778,
+    3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707,
+    3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839,
+    2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648,
+    3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013,
+    4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 1603, 1603, 1602, 1603, 4233, 4278, 4314,
+    1603, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 1603,
+    2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755,
+    196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702,
+    2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758,
+    4666, 4711, 4747, 2857, 4673, 4718, 4754, 1603, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239,
+    2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020,
+    2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 173, 2473, 185, 29, 173,
+    2534, 2655, 185, 2484, 2765, 2605, 197, 197, 41, 173, 2534, 2655, 185, 2535, 4866, 2656,
+    2765, 2766, 197, 2495, 2864, 2616, 2864, 2865, 2726, 209, 209, 209, 53, 173, 2534, 2655,
+    185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866,
+    209, 2506, 2952, 2627, 2952, 2953, 2737, 2952, 2953, 2954, 2836, 221, 221, 221, 221, 65,
+    173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767,
+    2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
+    2954, 2955, 221, 2517, 3029, 2638, 3029, 3030, 2748, 3029, 3030, 3031, 2847, 3029, 3030, 3031,
+    3032, 2935, 233, 233, 233, 233, 233, 77, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765,
+    2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877,
+    4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923,
+    2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 1603, 2956, 3029, 3030, 3031, 3032, 3033, 233,
+    2528, 3095, 2649, 3095, 3096, 2759, 3095, 3096, 3097, 2858, 3095, 3096, 3097, 3098, 2946, 3095,
+    3096, 3097, 3098, 3099, 3023, 245, 245, 245, 245, 245, 245, 89, 173, 251, 252, 185,
+    251, 2072, 252, 253, 253, 197, 251, 2072, 252, 2073, 2083, 253, 254, 254, 254, 209,
+    251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 255, 255, 255, 255, 221, 251,
+    2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 256, 256,
+    256, 256, 256, 233, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085,
+    2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 257, 257, 257, 257, 257, 257, 245,
+    95, 95, 96, 95, 96, 97, 95, 96, 97, 98, 95, 96, 97, 98, 99, 95,
+    96, 97, 98, 99, 100, 95, 96, 97, 98, 99, 100, 101, 11, 167, 179, 23,
+    12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611,
+    2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611,
+    181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49,
+    14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631,
+    3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810,
+    1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624,
+    4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895,
+    218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768,
+    2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988,
+    2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785,
+    3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217,
+    4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513,
+    4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515,
+    4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940,
+    228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73,
+    74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756,
+    40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043,
+    2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427,
+    6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226,
+    4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793,
+    3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386,
+    6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483,
+    2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76,
+    172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756,
+    2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942,
+    2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754,
+    4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018,
+    2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85,
+    86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747,
+    1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999,
+    4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774,
+    3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737,
+    4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354, 3574, 1715, 3399, 6203, 3619,
+    3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683,
+    6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439,
+    4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979,
+    77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693,
+    3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240,
+    4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 1604, 1604,
+    1604, 1603, 1604, 4460, 4505, 4541, 4569, 1604, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667,
+    4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761, 4789, 1604, 3023, 2011, 2021,
+    2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536,
+    4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885,
+    4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931,
+    4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 4870, 2660,
+    4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009,
+    1604, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072, 252, 2073, 2083, 253, 2074,
+    2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 2077, 2087,
+    2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100, 101, 18, 174, 2474, 186,
+    30, 174, 2545, 2666, 186, 2485, 2776, 2606, 198, 198, 42, 174, 2545, 2666, 186, 2546,
+    5086, 2667, 2776, 2777, 198, 2496, 2875, 2617, 2875, 2876, 2727, 210, 210, 210, 54, 174,
+    2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875,
+    2876, 2877, 210, 2507, 2963, 2628, 2963, 2964, 2738, 2963, 2964, 2965, 2837, 222, 222, 222,
+    222, 66, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096,
+    5141, 2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878,
+    2963, 2964, 2965, 2966, 222, 2518, 3040, 2639, 3040, 3041, 2749, 3040, 3041, 3042, 2848, 3040,
+    3041, 3042, 3043, 2936, 234, 234, 234, 234, 234, 78, 174, 2545, 2666, 186, 2546, 5086,
+    2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548, 5088,
+    2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089, 2670,
+    5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042, 3043,
+    3044, 234, 2529, 3106, 2650, 3106, 3107, 2760, 3106, 3107, 3108, 2859, 3106, 3107, 3108, 3109,
+    2947, 3106, 3107, 3108, 3109, 3110, 3024, 246, 246, 246, 246, 246, 246, 90, 174, 2545,
+    2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876,
+    2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966,
+    222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967,
+    3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880,
+    5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 1604, 3045, 3106, 3107, 3108, 3109, 3110,
+    3111, 246, 2540, 3161, 2661, 3161, 3162, 2771, 3161, 3162, 3163, 2870, 3161, 3162, 3163, 3164,
+    2958, 3161, 3162, 3163, 3164, 3165, 3035, 3161, 3162, 3163, 3164, 3165, 3166, 3101, 258, 258,
+    258, 258, 258, 258, 258, 102, 174, 263, 264, 186, 263, 2138, 264, 265, 265, 198,
+    263, 2138, 264, 2139, 2149, 265, 266, 266, 266, 210, 263, 2138, 264, 2139, 2149, 265,
+    2140, 2150, 2159, 266, 267, 267, 267, 267, 222, 263, 2138, 264, 2139, 2149, 265, 2140,
+    2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 268, 268, 268, 268, 268, 234, 263, 2138,
+    264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161,
+    2169, 2176, 268, 269, 269, 269, 269, 269, 269, 246, 263, 2138, 264, 2139, 2149, 265,
+    2140, 2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143,
+    2153, 2162, 2170, 2177, 2183, 269, 270, 270, 270, 270, 270, 270, 270, 258, 107, 107,
+    108, 107, 108, 109, 107, 108, 109, 110, 107, 108, 109, 110, 111, 107, 108, 109,
+    110, 111, 112, 107, 108, 109, 110, 111, 112, 113, 107, 108, 109, 110, 111, 112,
+    113, 114, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191,
+    1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601,
+    1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204,
+    1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481,
+    3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492,
+    3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623,
+    2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216,
+    1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27,
+    1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186,
+    3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345,
+    3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050,
+    4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904,
+    63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481,
+    2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930,
+    2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953,
+    1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549,
+    1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823,
+    1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391,
+    6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505,
+    4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353,
+    3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058,
+    4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342,
+    1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934,
+    1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196,
+    2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757,
+    4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666,
+    4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006,
+    240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029,
+    2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330,
+    3550, 1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779,
+    3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708,
+    3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840,
+    2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649,
+    3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014,
+    4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315,
+    4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563,
+    2935, 1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845,
+    1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721,
+    3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930,
+    6498, 6826, 7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528,
+    4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725,
+    4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535,
+    4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537,
+    4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869,
+    2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031,
+    3032, 3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975,
+    5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251,
+    2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086,
+    2095, 2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99,
+    100, 101, 18, 1616, 2474, 1682, 30, 1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758,
+    42, 1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045,
+    2727, 1814, 1824, 1833, 54, 1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429,
+    6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228,
+    4273, 4309, 2837, 1880, 1890, 1899, 1907, 66, 1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795,
+    3840, 1782, 3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388,
+    6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485,
+    2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78,
+    1656, 3361, 3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882,
+    4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286,
+    4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092,
+    7217, 4371, 4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713,
+    4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031,
+    2039, 2046, 2052, 90, 1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251,
+    3667, 6371, 6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811,
+    7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041,
+    4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435,
+    6763, 3951, 6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391, 1605, 1605, 1605, 1605, 1604,
+    1605, 4686, 4731, 4767, 4795, 4816, 1605, 2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933,
+    4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987,
+    5015, 5036, 1605, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123, 102, 174, 2545, 2666, 186,
+    2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210,
+    2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549,
+    5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041,
+    3042, 3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159,
+    5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246,
+    2551, 5091, 2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121,
+    5166, 5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 1605, 3112, 3161, 3162, 3163, 3164,
+    3165, 3166, 3167, 258, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151,
+    2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269,
+    2144, 2154, 2163, 2171, 2178, 2184, 2189, 270, 107, 108, 109, 110, 111, 112, 113, 114,
+    19, 175, 2475, 187, 31, 175, 2556, 2677, 187, 2486, 2787, 2607, 199, 199, 43, 175,
+    2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2497, 2886, 2618, 2886, 2887, 2728, 211,
+    211, 211, 55, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679,
+    5316, 5361, 2789, 2886, 2887, 2888, 211, 2508, 2974, 2629, 2974, 2975, 2739, 2974, 2975, 2976,
+    2838, 223, 223, 223, 223, 67, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199,
+    2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790,
+    5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2519, 3051, 2640, 3051, 3052, 2750, 3051,
+    3052, 3053, 2849, 3051, 3052, 3053, 3054, 2937, 235, 235, 235, 235, 235, 79, 175, 2556,
+    2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
+    2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977,
+    223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978,
+    3051, 3052, 3053, 3054, 3055, 235, 2530, 3117, 2651, 3117, 3118, 2761, 3117, 3118, 3119, 2860,
+    3117, 3118, 3119, 3120, 2948, 3117, 3118, 3119, 3120, 3121, 3025, 247, 247, 247, 247, 247,
+    247, 91, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316,
+    5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889,
+    2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333,
+    5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319, 5364, 2792,
+    5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117,
+    3118, 3119, 3120, 3121, 3122, 247, 2541, 3172, 2662, 3172, 3173, 2772, 3172, 3173, 3174, 2871,
+    3172, 3173, 3174, 3175, 2959, 3172, 3173, 3174, 3175, 3176, 3036, 3172, 3173, 3174, 3175, 3176,
+    3177, 3102, 259, 259, 259, 259, 259, 259, 259, 103, 175, 2556, 2677, 187, 2557, 5306,
+    2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308,
+    2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681,
+    5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054,
+    3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443,
+    2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121, 3122, 247, 2562, 5311,
+    2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422,
+    5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 1605, 3123, 3172, 3173, 3174, 3175, 3176, 3177,
+    3178, 259, 2552, 3216, 2673, 3216, 3217, 2783, 3216, 3217, 3218, 2882, 3216, 3217, 3218, 3219,
+    2970, 3216, 3217, 3218, 3219, 3220, 3047, 3216, 3217, 3218, 3219, 3220, 3221, 3113, 3216, 3217,
+    3218, 3219, 3220, 3221, 3222, 3168, 271, 271, 271, 271, 271, 271, 271, 271, 115, 175,
+    275, 276, 187, 275, 2204, 276, 277, 277, 199, 275, 2204, 276, 2205, 2215, 277, 278,
+    278, 278, 211, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 279, 279, 279,
+    279, 223, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226, 2234,
+    279, 280, 280, 280, 280, 280, 235, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225,
+    278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 281, 281, 281, 281,
+    281, 281, 247, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226,
+    2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 282,
+    282, 282, 282, 282, 282, 282, 259, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225,
+    278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236,
+    2243, 2249, 281, 2210, 2220, 2229, 2237, 2244, 2250, 2255, 282, 283, 283, 283, 283, 283,
+    283, 283, 283, 271, 119, 119, 120, 119, 120, 121, 119, 120, 121, 122, 119, 120,
+    121, 122, 123, 119, 120, 121, 122, 123, 124, 119, 120, 121, 122, 123, 124, 125,
+    119, 120, 121, 122, 123, 124, 125, 126, 119, 120, 121, 122, 123, 124, 125, 126,
+    127, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24, 168, 2479, 2600, 180, 191, 1742,
+    192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326, 3546, 1687, 2480, 3766, 2601, 1743,
+    1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721, 2722, 193, 203, 1808, 204, 1809,
+    1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26, 1622, 3327, 3547, 1688, 2481, 3767,
+    2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600, 3601, 3776, 3821, 1763, 2492, 3987,
+    2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501, 2622, 182, 2502, 4206, 2623, 2732,
+    2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832, 2833, 206, 215, 1874, 216, 1875,
+    1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62, 15, 1613, 2471, 1679, 27, 1623,
+    3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632, 3337, 3557, 1698, 3382, 6186, 3602,
+    3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811, 1821, 1830, 51, 1640, 3345, 3565,
+    1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646, 6350, 1601, 3866, 4005, 4050, 4086,
+    1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306, 2834, 1877, 1887, 1896, 1904, 63,
+    171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195, 2514, 4427, 2635, 4436, 4481, 2745,
+    2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746, 4445, 4490, 4526, 2845, 2930, 2931,
+    2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942, 1952, 1961, 230, 1943, 1953, 1962,
+    1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472, 1680, 28, 1624, 3329, 3549, 1690,
+    2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699, 3383, 6187, 3603, 3778, 3823, 1765,
+    2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52, 1641, 3346, 3566, 1707, 3391, 6195,
+    3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867, 4006, 4051, 4087, 1839, 2505, 4209,
+    2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888, 1897, 1905, 64, 1648, 3353, 3573,
+    1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654, 6358, 6686, 3874, 4013, 4058, 4094,
+    1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602, 4122, 4233, 4278, 4314, 4342, 1912,
+    2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846, 4453, 4498, 4534, 4562, 2934, 1944,
+    1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524, 4646, 2645, 2754, 2755, 196, 2525,
+    4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526, 4648, 2647, 4657, 4702, 2757, 4665,
+    4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649, 2648, 4658, 4703, 2758, 4666, 4711,
+    4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 2006, 240,
+    2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028, 2036, 243, 2010, 2020, 2029, 2037,
+    2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615, 2473, 1681, 29, 1625, 3330, 3550,
+    1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559, 1700, 3384, 6188, 3604, 3779, 3824,
+    1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832, 53, 1642, 3347, 3567, 1708, 3392,
+    6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680, 3868, 4007, 4052, 4088, 1840, 2506,
+    4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879, 1889, 1898, 1906, 65, 1649, 3354,
+    3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239, 3655, 6359, 6687, 3875, 4014, 4059,
+    4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799, 7008, 4123, 4234, 4279, 4315, 4343,
+    1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528, 2847, 4454, 4499, 4535, 4563, 2935,
+    1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721, 3405, 6209, 3625, 3800, 3845, 1787,
+    3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853, 3469, 6273, 3689, 6393, 6721, 3909,
+    6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490, 6294, 3710, 6414, 6742, 3930, 6498,
+    6826, 7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505, 4541, 4569, 4590, 1985, 2528, 4650,
+    2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719, 4755, 4783, 2946, 4680, 4725, 4761,
+    4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89, 173, 2534, 2655, 185, 2535, 4866,
+    2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767, 2864, 2865, 2866, 209, 2537, 4868,
+    2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953, 2954, 2955, 221, 2538, 4869, 2659,
+    4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974, 5002, 2956, 3029, 3030, 3031, 3032,
+    3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932, 4968, 2869, 4894, 4939, 4975, 5003,
+    2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 2072,
+    252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085, 2094, 2102, 255, 2076, 2086, 2095,
+    2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257, 95, 96, 97, 98, 99, 100,
+    101, 18, 1616, 2474, 1682, 30, 1626, 3331, 3551, 1692, 2485, 3771, 2606, 1748, 1758, 42,
+    1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767, 2496, 3991, 2617, 4000, 4045, 2727,
+    1814, 1824, 1833, 54, 1643, 3348, 3568, 1709, 3393, 6197, 3613, 3788, 3833, 1775, 3429, 6233,
+    3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211, 2628, 4220, 4265, 2738, 4228, 4273,
+    4309, 2837, 1880, 1890, 1899, 1907, 66, 1650, 3355, 3575, 1716, 3400, 6204, 3620, 3795, 3840,
+    1782, 3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096, 1848, 3464, 6268, 3684, 6388, 6716,
+    3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914, 2518, 4431, 2639, 4440, 4485, 2749,
+    4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946, 1956, 1965, 1973, 1980, 78, 1656,
+    3361, 3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442, 6246, 3662, 6366, 6694, 3882, 4021,
+    4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478, 6806, 7015, 4130, 4241, 4286, 4322,
+    4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827, 7036, 4151, 6555, 6883, 7092, 7217,
+    4371, 4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650, 4660, 4705, 2760, 4668, 4713, 4749,
+    2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790, 4811, 3024, 2012, 2022, 2031, 2039,
+    2046, 2052, 90, 1661, 3366, 3586, 1727, 3411, 6215, 3631, 3806, 3851, 1793, 3447, 6251, 3667,
+    6371, 6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695, 6399, 6727, 3915, 6483, 6811, 7020,
+    4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420, 6748, 3936, 6504, 6832, 7041, 4156,
+    6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596, 1991, 3511, 6315, 3731, 6435, 6763,
+    3951, 6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391, 6610, 6938, 7147, 7272, 1604, 4611,
+    4686, 4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871, 2661, 4880, 4925, 2771, 4888, 4933, 4969,
+    2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010, 5031, 3035, 4906, 4951, 4987, 5015,
+    5036, 5051, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123, 102, 174, 2545, 2666, 186, 2546,
+    5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141, 2778, 2875, 2876, 2877, 210, 2548,
+    5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963, 2964, 2965, 2966, 222, 2549, 5089,
+    2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158, 5194, 5222, 2967, 3040, 3041, 3042,
+    3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107, 5152, 5188, 2880, 5114, 5159, 5195,
+    5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551,
+    5091, 2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115, 5160, 5196, 5224, 2969, 5121, 5166,
+    5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 5271, 3112, 3161, 3162, 3163, 3164, 3165,
+    3166, 3167, 258, 263, 2138, 264, 2139, 2149, 265, 2140, 2150, 2159, 266, 2141, 2151, 2160,
+    2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153, 2162, 2170, 2177, 2183, 269, 2144,
+    2154, 2163, 2171, 2178, 2184, 2189, 270, 107, 108, 109, 110, 111, 112, 113, 114, 19,
+    1617, 2475, 1683, 31, 1627, 3332, 3552, 1693, 2486, 3772, 2607, 1749, 1759, 43, 1636, 3341,
+    3561, 1702, 3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992, 2618, 4001, 4046, 2728, 1815, 1825,
+    1834, 55, 1644, 3349, 3569, 1710, 3394, 6198, 3614, 3789, 3834, 1776, 3430, 6234, 3650, 6354,
+    6682, 3870, 4009, 4054, 4090, 1842, 2508, 4212, 2629, 4221, 4266, 2739, 4229, 4274, 4310, 2838,
+    1881, 1891, 1900, 1908, 67, 1651, 3356, 3576, 1717, 3401, 6205, 3621, 3796, 3841, 1783, 3437,
+    6241, 3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849, 3465, 6269, 3685, 6389, 6717, 3905, 6473,
+    6801, 7010, 4125, 4236, 4281, 4317, 4345, 1915, 2519, 4432, 2640, 4441, 4486, 2750, 4449, 4494,
+    4530, 2849, 4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966, 1974, 1981, 79, 1657, 3362, 3582,
+    1723, 3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247, 3663, 6367, 6695, 3883, 4022, 4067, 4103,
+    1855, 3471, 6275, 3691, 6395, 6723, 3911, 6479, 6807, 7016, 4131, 4242, 4287, 4323, 4351, 1921,
+    3492, 6296, 3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152, 6556, 6884, 7093, 7218, 4372, 4462,
+    4507, 4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661, 4706, 2761, 4669, 4714, 4750, 2860, 4676,
+    4721, 4757, 4785, 2948, 4682, 4727, 4763, 4791, 4812, 3025, 2013, 2023, 2032, 2040, 2047, 2053,
+    91, 1662, 3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852, 1794, 3448, 6252, 3668, 6372, 6700,
+    3888, 4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400, 6728, 3916, 6484, 6812, 7021, 4136, 4247,
+    4292, 4328, 4356, 1926, 3497, 6301, 3717, 6421, 6749, 3937, 6505, 6833, 7042, 4157, 6561, 6889,
+    7098, 7223, 4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512, 6316, 3732, 6436, 6764, 3952, 6520,
+    6848, 7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611, 6939, 7148, 7273, 7342, 4612, 4687, 4732,
+    4768, 4796, 4817, 4832, 2058, 2541, 4872, 2662, 4881, 4926, 2772, 4889, 4934, 4970, 2871, 4896,
+    4941, 4977, 5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036, 4907, 4952, 4988, 5016, 5037, 5052,
+    3102, 2079, 2089, 2098, 2106, 2113, 2119, 2124, 103, 1666, 3371, 3591, 1732, 3416, 6220, 3636,
+    3811, 3856, 1798, 3452, 6256, 3672, 6376, 6704, 3892, 4031, 4076, 4112, 1864, 3480, 6284, 3700,
+    6404, 6732, 3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332, 4360, 1930, 3501, 6305, 3721, 6425,
+    6753, 3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102, 7227, 4381, 4471, 4516, 4552, 4580, 4601,
+    1996, 3516, 6320, 3736, 6440, 6768, 3956, 6524, 6852, 7061, 4176, 6580, 6908, 7117, 7242, 4396,
+    6615, 6943, 7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800, 4821, 4836, 2062, 3526, 6330, 3746,
+    6450, 6778, 3966, 6534, 6862, 7071, 4186, 6590, 6918, 7127, 7252, 4406, 6625, 6953, 7162, 7287,
+    7356, 4626, 1606, 1606, 1606, 1606, 1606, 1605, 1606, 4911, 4956, 4992, 5020, 5041, 5056, 1606,
+    2128, 2552, 5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190, 2882, 5116, 5161, 5197, 5225, 2970,
+    5122, 5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208, 5236, 5257, 5272, 3113, 5131, 5176, 5212,
+    5240, 5261, 5276, 1606, 3168, 2145, 2155, 2164, 2172, 2179, 2185, 2190, 2194, 115, 175, 2556,
+    2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307, 2679, 5316, 5361, 2789, 2886, 2887,
+    2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370, 5406, 2889, 2974, 2975, 2976, 2977,
+    223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407, 2890, 5333, 5378, 5414, 5442, 2978,
+    3051, 3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319, 5364, 2792, 5327, 5372, 5408, 2891,
+    5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470, 3056, 3117, 3118, 3119, 3120, 3121,
+    3122, 247, 2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373, 5409, 2892, 5335, 5380, 5416, 5444,
+    2980, 5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427, 5455, 5476, 5491, 3123, 3172, 3173,
+    3174, 3175, 3176, 3177, 3178, 259, 2563, 5312, 2684, 5321, 5366, 2794, 5329, 5374, 5410, 2893,
+    5336, 5381, 5417, 5445, 2981, 5342, 5387, 5423, 5451, 5472, 3058, 5347, 5392, 5428, 5456, 5477,
+    5492, 3124, 5351, 5396, 5432, 5460, 5481, 5496, 1606, 3179, 3216, 3217, 3218, 3219, 3220, 3221,
+    3222, 3223, 271, 275, 2204, 276, 2205, 2215, 277, 2206, 2216, 2225, 278, 2207, 2217, 2226,
+    2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219, 2228, 2236, 2243, 2249, 281, 2210,
+    2220, 2229, 2237, 2244, 2250, 2255, 282, 2211, 2221, 2230, 2238, 2245, 2251, 2256, 2260, 283,
+    119, 120, 121, 122, 123, 124, 125, 126, 127, 20, 176, 2476, 188, 32, 176, 2567,
+    2688, 188, 2487, 2798, 2608, 200, 200, 44, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798,
+    2799, 200, 2498, 2897, 2619, 2897, 2898, 2729, 212, 212, 212, 56, 176, 2567, 2688, 188,
+    2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212,
+    2509, 2985, 2630, 2985, 2986, 2740, 2985, 2986, 2987, 2839, 224, 224, 224, 224, 68, 176,
+    2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897,
+    2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987,
+    2988, 224, 2520, 3062, 2641, 3062, 3063, 2751, 3062, 3063, 3064, 2850, 3062, 3063, 3064, 3065,
+    2938, 236, 236, 236, 236, 236, 80, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799,
+    200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582,
+    2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802,
+    5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2531,
+    3128, 2652, 3128, 3129, 2762, 3128, 3129, 3130, 2861, 3128, 3129, 3130, 3131, 2949, 3128, 3129,
+    3130, 3131, 3132, 3026, 248, 248, 248, 248, 248, 248, 92, 176, 2567, 2688, 188, 2568,
+    5526, 2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570,
+    5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529,
+    2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064,
+    3065, 3066, 236, 2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635,
+    5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2542,
+    3183, 2663, 3183, 3184, 2773, 3183, 3184, 3185, 2872, 3183, 3184, 3185, 3186, 2960, 3183, 3184,
+    3185, 3186, 3187, 3037, 3183, 3184, 3185, 3186, 3187, 3188, 3103, 260, 260, 260, 260, 260,
+    260, 260, 104, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798, 2799, 200, 2569, 5527, 2690,
+    5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537, 5582, 2801, 5545, 5590, 5626,
+    2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583, 2802, 5546, 5591, 5627, 2901,
+    5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 5530, 2693, 5539, 5584,
+    2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560, 5605, 5641, 5669, 5690, 3067,
+    3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 5531, 2694, 5540, 5585, 2804, 5548, 5593, 5629,
+    2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691, 3068, 5566, 5611, 5647, 5675,
+    5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260, 2553, 3227, 2674, 3227, 3228,
+    2784, 3227, 3228, 3229, 2883, 3227, 3228, 3229, 3230, 2971, 3227, 3228, 3229, 3230, 3231, 3048,
+    3227, 3228, 3229, 3230, 3231, 3232, 3114, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3169, 272,
+    272, 272, 272, 272, 272, 272, 272, 116, 176, 2567, 2688, 188, 2568, 5526, 2689, 2798,
+    2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528, 2691, 5537,
+    5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692, 5538, 5583,
+    2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065, 3066, 236,
+    2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663, 2990, 5560,
+    5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 5531, 2694, 5540,
+    5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642, 5670, 5691,
+    3068, 5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260,
+    2574, 5532, 2695, 5541, 5586, 2805, 5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665, 2992, 5562,
+    5607, 5643, 5671, 5692, 3069, 5567, 5612, 5648, 5676, 5697, 5712, 3135, 5571, 5616, 5652, 5680,
+    5701, 5716, 1606, 3190, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 272, 2564, 3260, 2685,
+    3260, 3261, 2795, 3260, 3261, 3262, 2894, 3260, 3261, 3262, 3263, 2982, 3260, 3261, 3262, 3263,
+    3264, 3059, 3260, 3261, 3262, 3263, 3264, 3265, 3125, 3260, 3261, 3262, 3263, 3264, 3265, 3266,
+    3180, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3224, 284, 284, 284, 284, 284, 284,
+    284, 284, 284, 128, 176, 287, 288, 188, 287, 2270, 288, 289, 289, 200, 287, 2270,
+    288, 2271, 2281, 289, 290, 290, 290, 212, 287, 2270, 288, 2271, 2281, 289, 2272, 2282,
+    2291, 290, 291, 291, 291, 291, 224, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291,
+    290, 2273, 2283, 2292, 2300, 291, 292, 292, 292, 292, 292, 236, 287, 2270, 288, 2271,
+    2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308,
+    292, 293, 293, 293, 293, 293, 293, 248, 287, 2270, 288, 2271, 2281, 289, 2272, 2282,
+    2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294,
+    2302, 2309, 2315, 293, 294, 294, 294, 294, 294, 294, 294, 260, 287, 2270, 288, 2271,
+    2281, 289, 2272, 2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308,
+    292, 2275, 2285, 2294, 2302, 2309, 2315, 293, 2276, 2286, 2295, 2303, 2310, 2316, 2321, 294,
+    295, 295, 295, 295, 295, 295, 295, 295, 272, 287, 2270, 288, 2271, 2281, 289, 2272,
+    2282, 2291, 290, 2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285,
+    2294, 2302, 2309, 2315, 293, 2276, 2286, 2295, 2303, 2310, 2316, 2321, 294, 2277, 2287, 2296,
+    2304, 2311, 2317, 2322, 2326, 295, 296, 296, 296, 296, 296, 296, 296, 296, 296, 284,
+    131, 131, 132, 131, 132, 133, 131, 132, 133, 134, 131, 132, 133, 134, 135, 131,
+    132, 133, 134, 135, 136, 131, 132, 133, 134, 135, 136, 137, 131, 132, 133, 134,
+    135, 136, 137, 138, 131, 132, 133, 134, 135, 136, 137, 138, 139, 131, 132, 133,
+    134, 135, 136, 137, 138, 139, 140, 11, 167, 179, 23, 12, 1610, 2468, 1676, 24,
+    168, 2479, 2600, 180, 191, 1742, 192, 35, 36, 13, 1611, 2469, 1677, 25, 1621, 3326,
+    3546, 1687, 2480, 3766, 2601, 1743, 1753, 37, 169, 2490, 2611, 181, 2491, 3986, 2612, 2721,
+    2722, 193, 203, 1808, 204, 1809, 1819, 205, 47, 48, 49, 14, 1612, 2470, 1678, 26,
+    1622, 3327, 3547, 1688, 2481, 3767, 2602, 1744, 1754, 38, 1631, 3336, 3556, 1697, 3381, 1600,
+    3601, 3776, 3821, 1763, 2492, 3987, 2613, 3996, 4041, 2723, 1810, 1820, 1829, 50, 170, 2501,
+    2622, 182, 2502, 4206, 2623, 2732, 2733, 194, 2503, 4207, 2624, 4216, 4261, 2734, 2831, 2832,
+    2833, 206, 215, 1874, 216, 1875, 1885, 217, 1876, 1886, 1895, 218, 59, 60, 61, 62,
+    15, 1613, 2471, 1679, 27, 1623, 3328, 3548, 1689, 2482, 3768, 2603, 1745, 1755, 39, 1632,
+    3337, 3557, 1698, 3382, 6186, 3602, 3777, 3822, 1764, 2493, 3988, 2614, 3997, 4042, 2724, 1811,
+    1821, 1830, 51, 1640, 3345, 3565, 1706, 3390, 6194, 3610, 3785, 3830, 1772, 3426, 6230, 3646,
+    6350, 1601, 3866, 4005, 4050, 4086, 1838, 2504, 4208, 2625, 4217, 4262, 2735, 4225, 4270, 4306,
+    2834, 1877, 1887, 1896, 1904, 63, 171, 2512, 2633, 183, 2513, 4426, 2634, 2743, 2744, 195,
+    2514, 4427, 2635, 4436, 4481, 2745, 2842, 2843, 2844, 207, 2515, 4428, 2636, 4437, 4482, 2746,
+    4445, 4490, 4526, 2845, 2930, 2931, 2932, 2933, 219, 227, 1940, 228, 1941, 1951, 229, 1942,
+    1952, 1961, 230, 1943, 1953, 1962, 1970, 231, 71, 72, 73, 74, 75, 16, 1614, 2472,
+    1680, 28, 1624, 3329, 3549, 1690, 2483, 3769, 2604, 1746, 1756, 40, 1633, 3338, 3558, 1699,
+    3383, 6187, 3603, 3778, 3823, 1765, 2494, 3989, 2615, 3998, 4043, 2725, 1812, 1822, 1831, 52,
+    1641, 3346, 3566, 1707, 3391, 6195, 3611, 3786, 3831, 1773, 3427, 6231, 3647, 6351, 6679, 3867,
+    4006, 4051, 4087, 1839, 2505, 4209, 2626, 4218, 4263, 2736, 4226, 4271, 4307, 2835, 1878, 1888,
+    1897, 1905, 64, 1648, 3353, 3573, 1714, 3398, 6202, 3618, 3793, 3838, 1780, 3434, 6238, 3654,
+    6358, 6686, 3874, 4013, 4058, 4094, 1846, 3462, 6266, 3682, 6386, 6714, 3902, 6470, 6798, 1602,
+    4122, 4233, 4278, 4314, 4342, 1912, 2516, 4429, 2637, 4438, 4483, 2747, 4446, 4491, 4527, 2846,
+    4453, 4498, 4534, 4562, 2934, 1944, 1954, 1963, 1971, 1978, 76, 172, 2523, 2644, 184, 2524,
+    4646, 2645, 2754, 2755, 196, 2525, 4647, 2646, 4656, 4701, 2756, 2853, 2854, 2855, 208, 2526,
+    4648, 2647, 4657, 4702, 2757, 4665, 4710, 4746, 2856, 2941, 2942, 2943, 2944, 220, 2527, 4649,
+    2648, 4658, 4703, 2758, 4666, 4711, 4747, 2857, 4673, 4718, 4754, 4782, 2945, 3018, 3019, 3020,
+    3021, 3022, 232, 239, 2006, 240, 2007, 2017, 241, 2008, 2018, 2027, 242, 2009, 2019, 2028,
+    2036, 243, 2010, 2020, 2029, 2037, 2044, 244, 83, 84, 85, 86, 87, 88, 17, 1615,
+    2473, 1681, 29, 1625, 3330, 3550, 1691, 2484, 3770, 2605, 1747, 1757, 41, 1634, 3339, 3559,
+    1700, 3384, 6188, 3604, 3779, 3824, 1766, 2495, 3990, 2616, 3999, 4044, 2726, 1813, 1823, 1832,
+    53, 1642, 3347, 3567, 1708, 3392, 6196, 3612, 3787, 3832, 1774, 3428, 6232, 3648, 6352, 6680,
+    3868, 4007, 4052, 4088, 1840, 2506, 4210, 2627, 4219, 4264, 2737, 4227, 4272, 4308, 2836, 1879,
+    1889, 1898, 1906, 65, 1649, 3354, 3574, 1715, 3399, 6203, 3619, 3794, 3839, 1781, 3435, 6239,
+    3655, 6359, 6687, 3875, 4014, 4059, 4095, 1847, 3463, 6267, 3683, 6387, 6715, 3903, 6471, 6799,
+    7008, 4123, 4234, 4279, 4315, 4343, 1913, 2517, 4430, 2638, 4439, 4484, 2748, 4447, 4492, 4528,
+    2847, 4454, 4499, 4535, 4563, 2935, 1945, 1955, 1964, 1972, 1979, 77, 1655, 3360, 3580, 1721,
+    3405, 6209, 3625, 3800, 3845, 1787, 3441, 6245, 3661, 6365, 6693, 3881, 4020, 4065, 4101, 1853,
+    3469, 6273, 3689, 6393, 6721, 3909, 6477, 6805, 7014, 4129, 4240, 4285, 4321, 4349, 1919, 3490,
+    6294, 3710, 6414, 6742, 3930, 6498, 6826, 7035, 4150, 6554, 6882, 7091, 1603, 4370, 4460, 4505,
+    4541, 4569, 4590, 1985, 2528, 4650, 2649, 4659, 4704, 2759, 4667, 4712, 4748, 2858, 4674, 4719,
+    4755, 4783, 2946, 4680, 4725, 4761, 4789, 4810, 3023, 2011, 2021, 2030, 2038, 2045, 2051, 89,
+    173, 2534, 2655, 185, 2535, 4866, 2656, 2765, 2766, 197, 2536, 4867, 2657, 4876, 4921, 2767,
+    2864, 2865, 2866, 209, 2537, 4868, 2658, 4877, 4922, 2768, 4885, 4930, 4966, 2867, 2952, 2953,
+    2954, 2955, 221, 2538, 4869, 2659, 4878, 4923, 2769, 4886, 4931, 4967, 2868, 4893, 4938, 4974,
+    5002, 2956, 3029, 3030, 3031, 3032, 3033, 233, 2539, 4870, 2660, 4879, 4924, 2770, 4887, 4932,
+    4968, 2869, 4894, 4939, 4975, 5003, 2957, 4900, 4945, 4981, 5009, 5030, 3034, 3095, 3096, 3097,
+    3098, 3099, 3100, 245, 251, 2072, 252, 2073, 2083, 253, 2074, 2084, 2093, 254, 2075, 2085,
+    2094, 2102, 255, 2076, 2086, 2095, 2103, 2110, 256, 2077, 2087, 2096, 2104, 2111, 2117, 257,
+    95, 96, 97, 98, 99, 100, 101, 18, 1616, 2474, 1682, 30, 1626, 3331, 3551, 1692,
+    2485, 3771, 2606, 1748, 1758, 42, 1635, 3340, 3560, 1701, 3385, 6189, 3605, 3780, 3825, 1767,
+    2496, 3991, 2617, 4000, 4045, 2727, 1814, 1824, 1833, 54, 1643, 3348, 3568, 1709, 3393, 6197,
+    3613, 3788, 3833, 1775, 3429, 6233, 3649, 6353, 6681, 3869, 4008, 4053, 4089, 1841, 2507, 4211,
+    2628, 4220, 4265, 2738, 4228, 4273, 4309, 2837, 1880, 1890, 1899, 1907, 66, 1650, 3355, 3575,
+    1716, 3400, 6204, 3620, 3795, 3840, 1782, 3436, 6240, 3656, 6360, 6688, 3876, 4015, 4060, 4096,
+    1848, 3464, 6268, 3684, 6388, 6716, 3904, 6472, 6800, 7009, 4124, 4235, 4280, 4316, 4344, 1914,
+    2518, 4431, 2639, 4440, 4485, 2749, 4448, 4493, 4529, 2848, 4455, 4500, 4536, 4564, 2936, 1946,
+    1956, 1965, 1973, 1980, 78, 1656, 3361, 3581, 1722, 3406, 6210, 3626, 3801, 3846, 1788, 3442,
+    6246, 3662, 6366, 6694, 3882, 4021, 4066, 4102, 1854, 3470, 6274, 3690, 6394, 6722, 3910, 6478,
+    6806, 7015, 4130, 4241, 4286, 4322, 4350, 1920, 3491, 6295, 3711, 6415, 6743, 3931, 6499, 6827,
+    7036, 4151, 6555, 6883, 7092, 7217, 4371, 4461, 4506, 4542, 4570, 4591, 1986, 2529, 4651, 2650,
+    4660, 4705, 2760, 4668, 4713, 4749, 2859, 4675, 4720, 4756, 4784, 2947, 4681, 4726, 4762, 4790,
+    4811, 3024, 2012, 2022, 2031, 2039, 2046, 2052, 90, 1661, 3366, 3586, 1727, 3411, 6215, 3631,
+    3806, 3851, 1793, 3447, 6251, 3667, 6371, 6699, 3887, 4026, 4071, 4107, 1859, 3475, 6279, 3695,
+    6399, 6727, 3915, 6483, 6811, 7020, 4135, 4246, 4291, 4327, 4355, 1925, 3496, 6300, 3716, 6420,
+    6748, 3936, 6504, 6832, 7041, 4156, 6560, 6888, 7097, 7222, 4376, 4466, 4511, 4547, 4575, 4596,
+    1991, 3511, 6315, 3731, 6435, 6763, 3951, 6519, 6847, 7056, 4171, 6575, 6903, 7112, 7237, 4391,
+    6610, 6938, 7147, 7272, 1604, 4611, 4686, 4731, 4767, 4795, 4816, 4831, 2057, 2540, 4871, 2661,
+    4880, 4925, 2771, 4888, 4933, 4969, 2870, 4895, 4940, 4976, 5004, 2958, 4901, 4946, 4982, 5010,
+    5031, 3035, 4906, 4951, 4987, 5015, 5036, 5051, 3101, 2078, 2088, 2097, 2105, 2112, 2118, 2123,
+    102, 174, 2545, 2666, 186, 2546, 5086, 2667, 2776, 2777, 198, 2547, 5087, 2668, 5096, 5141,
+    2778, 2875, 2876, 2877, 210, 2548, 5088, 2669, 5097, 5142, 2779, 5105, 5150, 5186, 2878, 2963,
+    2964, 2965, 2966, 222, 2549, 5089, 2670, 5098, 5143, 2780, 5106, 5151, 5187, 2879, 5113, 5158,
+    5194, 5222, 2967, 3040, 3041, 3042, 3043, 3044, 234, 2550, 5090, 2671, 5099, 5144, 2781, 5107,
+    5152, 5188, 2880, 5114, 5159, 5195, 5223, 2968, 5120, 5165, 5201, 5229, 5250, 3045, 3106, 3107,
+    3108, 3109, 3110, 3111, 246, 2551, 5091, 2672, 5100, 5145, 2782, 5108, 5153, 5189, 2881, 5115,
+    5160, 5196, 5224, 2969, 5121, 5166, 5202, 5230, 5251, 3046, 5126, 5171, 5207, 5235, 5256, 5271,
+    3112, 3161, 3162, 3163, 3164, 3165, 3166, 3167, 258, 263, 2138, 264, 2139, 2149, 265, 2140,
+    2150, 2159, 266, 2141, 2151, 2160, 2168, 267, 2142, 2152, 2161, 2169, 2176, 268, 2143, 2153,
+    2162, 2170, 2177, 2183, 269, 2144, 2154, 2163, 2171, 2178, 2184, 2189, 270, 107, 108, 109,
+    110, 111, 112, 113, 114, 19, 1617, 2475, 1683, 31, 1627, 3332, 3552, 1693, 2486, 3772,
+    2607, 1749, 1759, 43, 1636, 3341, 3561, 1702, 3386, 6190, 3606, 3781, 3826, 1768, 2497, 3992,
+    2618, 4001, 4046, 2728, 1815, 1825, 1834, 55, 1644, 3349, 3569, 1710, 3394, 6198, 3614, 3789,
+    3834, 1776, 3430, 6234, 3650, 6354, 6682, 3870, 4009, 4054, 4090, 1842, 2508, 4212, 2629, 4221,
+    4266, 2739, 4229, 4274, 4310, 2838, 1881, 1891, 1900, 1908, 67, 1651, 3356, 3576, 1717, 3401,
+    6205, 3621, 3796, 3841, 1783, 3437, 6241, 3657, 6361, 6689, 3877, 4016, 4061, 4097, 1849, 3465,
+    6269, 3685, 6389, 6717, 3905, 6473, 6801, 7010, 4125, 4236, 4281, 4317, 4345, 1915, 2519, 4432,
+    2640, 4441, 4486, 2750, 4449, 4494, 4530, 2849, 4456, 4501, 4537, 4565, 2937, 1947, 1957, 1966,
+    1974, 1981, 79, 1657, 3362, 3582, 1723, 3407, 6211, 3627, 3802, 3847, 1789, 3443, 6247, 3663,
+    6367, 6695, 3883, 4022, 4067, 4103, 1855, 3471, 6275, 3691, 6395, 6723, 3911, 6479, 6807, 7016,
+    4131, 4242, 4287, 4323, 4351, 1921, 3492, 6296, 3712, 6416, 6744, 3932, 6500, 6828, 7037, 4152,
+    6556, 6884, 7093, 7218, 4372, 4462, 4507, 4543, 4571, 4592, 1987, 2530, 4652, 2651, 4661, 4706,
+    2761, 4669, 4714, 4750, 2860, 4676, 4721, 4757, 4785, 2948, 4682, 4727, 4763, 4791, 4812, 3025,
+    2013, 2023, 2032, 2040, 2047, 2053, 91, 1662, 3367, 3587, 1728, 3412, 6216, 3632, 3807, 3852,
+    1794, 3448, 6252, 3668, 6372, 6700, 3888, 4027, 4072, 4108, 1860, 3476, 6280, 3696, 6400, 6728,
+    3916, 6484, 6812, 7021, 4136, 4247, 4292, 4328, 4356, 1926, 3497, 6301, 3717, 6421, 6749, 3937,
+    6505, 6833, 7042, 4157, 6561, 6889, 7098, 7223, 4377, 4467, 4512, 4548, 4576, 4597, 1992, 3512,
+    6316, 3732, 6436, 6764, 3952, 6520, 6848, 7057, 4172, 6576, 6904, 7113, 7238, 4392, 6611, 6939,
+    7148, 7273, 7342, 4612, 4687, 4732, 4768, 4796, 4817, 4832, 2058, 2541, 4872, 2662, 4881, 4926,
+    2772, 4889, 4934, 4970, 2871, 4896, 4941, 4977, 5005, 2959, 4902, 4947, 4983, 5011, 5032, 3036,
+    4907, 4952, 4988, 5016, 5037, 5052, 3102, 2079, 2089, 2098, 2106, 2113, 2119, 2124, 103, 1666,
+    3371, 3591, 1732, 3416, 6220, 3636, 3811, 3856, 1798, 3452, 6256, 3672, 6376, 6704, 3892, 4031,
+    4076, 4112, 1864, 3480, 6284, 3700, 6404, 6732, 3920, 6488, 6816, 7025, 4140, 4251, 4296, 4332,
+    4360, 1930, 3501, 6305, 3721, 6425, 6753, 3941, 6509, 6837, 7046, 4161, 6565, 6893, 7102, 7227,
+    4381, 4471, 4516, 4552, 4580, 4601, 1996, 3516, 6320, 3736, 6440, 6768, 3956, 6524, 6852, 7061,
+    4176, 6580, 6908, 7117, 7242, 4396, 6615, 6943, 7152, 7277, 7346, 4616, 4691, 4736, 4772, 4800,
+    4821, 4836, 2062, 3526, 6330, 3746, 6450, 6778, 3966, 6534, 6862, 7071, 4186, 6590, 6918, 7127,
+    7252, 4406, 6625, 6953, 7162, 7287, 7356, 4626, 6645, 6973, 7182, 7307, 7376, 1605, 4846, 4911,
+    4956, 4992, 5020, 5041, 5056, 5066, 2128, 2552, 5092, 2673, 5101, 5146, 2783, 5109, 5154, 5190,
+    2882, 5116, 5161, 5197, 5225, 2970, 5122, 5167, 5203, 5231, 5252, 3047, 5127, 5172, 5208, 5236,
+    5257, 5272, 3113, 5131, 5176, 5212, 5240, 5261, 5276, 5286, 3168, 2145, 2155, 2164, 2172, 2179,
+    2185, 2190, 2194, 115, 175, 2556, 2677, 187, 2557, 5306, 2678, 2787, 2788, 199, 2558, 5307,
+    2679, 5316, 5361, 2789, 2886, 2887, 2888, 211, 2559, 5308, 2680, 5317, 5362, 2790, 5325, 5370,
+    5406, 2889, 2974, 2975, 2976, 2977, 223, 2560, 5309, 2681, 5318, 5363, 2791, 5326, 5371, 5407,
+    2890, 5333, 5378, 5414, 5442, 2978, 3051, 3052, 3053, 3054, 3055, 235, 2561, 5310, 2682, 5319,
+    5364, 2792, 5327, 5372, 5408, 2891, 5334, 5379, 5415, 5443, 2979, 5340, 5385, 5421, 5449, 5470,
+    3056, 3117, 3118, 3119, 3120, 3121, 3122, 247, 2562, 5311, 2683, 5320, 5365, 2793, 5328, 5373,
+    5409, 2892, 5335, 5380, 5416, 5444, 2980, 5341, 5386, 5422, 5450, 5471, 3057, 5346, 5391, 5427,
+    5455, 5476, 5491, 3123, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 259, 2563, 5312, 2684, 5321,
+    5366, 2794, 5329, 5374, 5410, 2893, 5336, 5381, 5417, 5445, 2981, 5342, 5387, 5423, 5451, 5472,
+    3058, 5347, 5392, 5428, 5456, 5477, 5492, 3124, 5351, 5396, 5432, 5460, 5481, 5496, 5506, 3179,
+    3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 271, 275, 2204, 276, 2205, 2215, 277, 2206,
+    2216, 2225, 278, 2207, 2217, 2226, 2234, 279, 2208, 2218, 2227, 2235, 2242, 280, 2209, 2219,
+    2228, 2236, 2243, 2249, 281, 2210, 2220, 2229, 2237, 2244, 2250, 2255, 282, 2211, 2221, 2230,
+    2238, 2245, 2251, 2256, 2260, 283, 119, 120, 121, 122, 123, 124, 125, 126, 127, 20,
+    1618, 2476, 1684, 32, 1628, 3333, 3553, 1694, 2487, 3773, 2608, 1750, 1760, 44, 1637, 3342,
+    3562, 1703, 3387, 6191, 3607, 3782, 3827, 1769, 2498, 3993, 2619, 4002, 4047, 2729, 1816, 1826,
+    1835, 56, 1645, 3350, 3570, 1711, 3395, 6199, 3615, 3790, 3835, 1777, 3431, 6235, 3651, 6355,
+    6683, 3871, 4010, 4055, 4091, 1843, 2509, 4213, 2630, 4222, 4267, 2740, 4230, 4275, 4311, 2839,
+    1882, 1892, 1901, 1909, 68, 1652, 3357, 3577, 1718, 3402, 6206, 3622, 3797, 3842, 1784, 3438,
+    6242, 3658, 6362, 6690, 3878, 4017, 4062, 4098, 1850, 3466, 6270, 3686, 6390, 6718, 3906, 6474,
+    6802, 7011, 4126, 4237, 4282, 4318, 4346, 1916, 2520, 4433, 2641, 4442, 4487, 2751, 4450, 4495,
+    4531, 2850, 4457, 4502, 4538, 4566, 2938, 1948, 1958, 1967, 1975, 1982, 80, 1658, 3363, 3583,
+    1724, 3408, 6212, 3628, 3803, 3848, 1790, 3444, 6248, 3664, 6368, 6696, 3884, 4023, 4068, 4104,
+    1856, 3472, 6276, 3692, 6396, 6724, 3912, 6480, 6808, 7017, 4132, 4243, 4288, 4324, 4352, 1922,
+    3493, 6297, 3713, 6417, 6745, 3933, 6501, 6829, 7038, 4153, 6557, 6885, 7094, 7219, 4373, 4463,
+    4508, 4544, 4572, 4593, 1988, 2531, 4653, 2652, 4662, 4707, 2762, 4670, 4715, 4751, 2861, 4677,
+    4722, 4758, 4786, 2949, 4683, 4728, 4764, 4792, 4813, 3026, 2014, 2024, 2033, 2041, 2048, 2054,
+    92, 1663, 3368, 3588, 1729, 3413, 6217, 3633, 3808, 3853, 1795, 3449, 6253, 3669, 6373, 6701,
+    3889, 4028, 4073, 4109, 1861, 3477, 6281, 3697, 6401, 6729, 3917, 6485, 6813, 7022, 4137, 4248,
+    4293, 4329, 4357, 1927, 3498, 6302, 3718, 6422, 6750, 3938, 6506, 6834, 7043, 4158, 6562, 6890,
+    7099, 7224, 4378, 4468, 4513, 4549, 4577, 4598, 1993, 3513, 6317, 3733, 6437, 6765, 3953, 6521,
+    6849, 7058, 4173, 6577, 6905, 7114, 7239, 4393, 6612, 6940, 7149, 7274, 7343, 4613, 4688, 4733,
+    4769, 4797, 4818, 4833, 2059, 2542, 4873, 2663, 4882, 4927, 2773, 4890, 4935, 4971, 2872, 4897,
+    4942, 4978, 5006, 2960, 4903, 4948, 4984, 5012, 5033, 3037, 4908, 4953, 4989, 5017, 5038, 5053,
+    3103, 2080, 2090, 2099, 2107, 2114, 2120, 2125, 104, 1667, 3372, 3592, 1733, 3417, 6221, 3637,
+    3812, 3857, 1799, 3453, 6257, 3673, 6377, 6705, 3893, 4032, 4077, 4113, 1865, 3481, 6285, 3701,
+    6405, 6733, 3921, 6489, 6817, 7026, 4141, 4252, 4297, 4333, 4361, 1931, 3502, 6306, 3722, 6426,
+    6754, 3942, 6510, 6838, 7047, 4162, 6566, 6894, 7103, 7228, 4382, 4472, 4517, 4553, 4581, 4602,
+    1997, 3517, 6321, 3737, 6441, 6769, 3957, 6525, 6853, 7062, 4177, 6581, 6909, 7118, 7243, 4397,
+    6616, 6944, 7153, 7278, 7347, 4617, 4692, 4737, 4773, 4801, 4822, 4837, 2063, 3527, 6331, 3747,
+    6451, 6779, 3967, 6535, 6863, 7072, 4187, 6591, 6919, 7128, 7253, 4407, 6626, 6954, 7163, 7288,
+    7357, 4627, 6646, 6974, 7183, 7308, 7377, 7411, 4847, 4912, 4957, 4993, 5021, 5042, 5057, 5067,
+    2129, 2553, 5093, 2674, 5102, 5147, 2784, 5110, 5155, 5191, 2883, 5117, 5162, 5198, 5226, 2971,
+    5123, 5168, 5204, 5232, 5253, 3048, 5128, 5173, 5209, 5237, 5258, 5273, 3114, 5132, 5177, 5213,
+    5241, 5262, 5277, 5287, 3169, 2146, 2156, 2165, 2173, 2180, 2186, 2191, 2195, 116, 1609, 1609,
+    1609, 1736, 1609, 1609, 3640, 1609, 3860, 1802, 1609, 1609, 3676, 1609, 6708, 3896, 1609, 4080,
+    4116, 1868, 1609, 1609, 3704, 1609, 6736, 3924, 1609, 6820, 7029, 4144, 1609, 4300, 4336, 4364,
+    1934, 1609, 1609, 3725, 1609, 6757, 3945, 1609, 6841, 7050, 4165, 1609, 6897, 7106, 7231, 4385,
+    1609, 4520, 4556, 4584, 4605, 2000, 1609, 1609, 3740, 1609, 6772, 3960, 1609, 6856, 7065, 4180,
+    1609, 6912, 7121, 7246, 4400, 1609, 6947, 7156, 7281, 7350, 4620, 1609, 4740, 4776, 4804, 4825,
+    4840, 2066, 1609, 1609, 3750, 1609, 6782, 3970, 1609, 6866, 7075, 4190, 1609, 6922, 7131, 7256,
+    4410, 1609, 6957, 7166, 7291, 7360, 4630, 1609, 6977, 7186, 7311, 7380, 7414, 4850, 1609, 4960,
+    4996, 5024, 5045, 5060, 5070, 2132, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608,
+    1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608,
+    1608, 1608, 1607, 1607, 1607, 1607, 1607, 1607, 1606, 1607, 1608, 1608, 1608, 1608, 1608, 1608,
+    1608, 1607, 1608, 1609, 1609, 2685, 1609, 5367, 2795, 1609, 5375, 5411, 2894, 1609, 5382, 5418,
+    5446, 2982, 1609, 5388, 5424, 5452, 5473, 3059, 1609, 5393, 5429, 5457, 5478, 5493, 3125, 1609,
+    5397, 5433, 5461, 5482, 5497, 5507, 3180, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608,
+    1609, 2222, 2231, 2239, 2246, 2252, 2257, 2261, 1608, 128, 176, 2567, 2688, 188, 2568, 5526,
+    2689, 2798, 2799, 200, 2569, 5527, 2690, 5536, 5581, 2800, 2897, 2898, 2899, 212, 2570, 5528,
+    2691, 5537, 5582, 2801, 5545, 5590, 5626, 2900, 2985, 2986, 2987, 2988, 224, 2571, 5529, 2692,
+    5538, 5583, 2802, 5546, 5591, 5627, 2901, 5553, 5598, 5634, 5662, 2989, 3062, 3063, 3064, 3065,
+    3066, 236, 2572, 5530, 2693, 5539, 5584, 2803, 5547, 5592, 5628, 2902, 5554, 5599, 5635, 5663,
+    2990, 5560, 5605, 5641, 5669, 5690, 3067, 3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 5531,
+    2694, 5540, 5585, 2804, 5548, 5593, 5629, 2903, 5555, 5600, 5636, 5664, 2991, 5561, 5606, 5642,
+    5670, 5691, 3068, 5566, 5611, 5647, 5675, 5696, 5711, 3134, 3183, 3184, 3185, 3186, 3187, 3188,
+    3189, 260, 2574, 5532, 2695, 5541, 5586, 2805, 5549, 5594, 5630, 2904, 5556, 5601, 5637, 5665,
+    2992, 5562, 5607, 5643, 5671, 5692, 3069, 5567, 5612, 5648, 5676, 5697, 5712, 3135, 5571, 5616,
+    5652, 5680, 5701, 5716, 5726, 3190, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 272, 1609,
+    1609, 2696, 1609, 5587, 2806, 1609, 5595, 5631, 2905, 1609, 5602, 5638, 5666, 2993, 1609, 5608,
+    5644, 5672, 5693, 3070, 1609, 5613, 5649, 5677, 5698, 5713, 3136, 1609, 5617, 5653, 5681, 5702,
+    5717, 5727, 3191, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608, 1609, 3261, 3262, 3263,
+    3264, 3265, 3266, 3267, 1608, 284, 287, 2270, 288, 2271, 2281, 289, 2272, 2282, 2291, 290,
+    2273, 2283, 2292, 2300, 291, 2274, 2284, 2293, 2301, 2308, 292, 2275, 2285, 2294, 2302, 2309,
+    2315, 293, 2276, 2286, 2295, 2303, 2310, 2316, 2321, 294, 2277, 2287, 2296, 2304, 2311, 2317,
+    2322, 2326, 295, 1609, 2288, 2297, 2305, 2312, 2318, 2323, 2327, 1608, 296, 131, 132, 133,
+    134, 135, 136, 137, 138, 139, 140, 21, 177, 2477, 189, 33, 177, 2578, 2699, 189,
+    2488, 2809, 2609, 201, 201, 45, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201,
+    2499, 2908, 2620, 2908, 2909, 2730, 213, 213, 213, 57, 177, 2578, 2699, 189, 2579, 5746,
+    2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2510, 2996,
+    2631, 2996, 2997, 2741, 2996, 2997, 2998, 2840, 225, 225, 225, 225, 69, 177, 2578, 2699,
+    189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910,
+    213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225,
+    2521, 3073, 2642, 3073, 3074, 2752, 3073, 3074, 3075, 2851, 3073, 3074, 3075, 3076, 2939, 237,
+    237, 237, 237, 237, 81, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580,
+    5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765,
+    5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811,
+    5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2532, 3139, 2653,
+    3139, 3140, 2763, 3139, 3140, 3141, 2862, 3139, 3140, 3141, 3142, 2950, 3139, 3140, 3141, 3142,
+    3143, 3027, 249, 249, 249, 249, 249, 249, 93, 177, 2578, 2699, 189, 2579, 5746, 2700,
+    2809, 2810, 201, 2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702,
+    5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758,
+    5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077,
+    237, 2583, 5750, 2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001,
+    5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2543, 3194, 2664,
+    3194, 3195, 2774, 3194, 3195, 3196, 2873, 3194, 3195, 3196, 3197, 2961, 3194, 3195, 3196, 3197,
+    3198, 3038, 3194, 3195, 3196, 3197, 3198, 3199, 3104, 261, 261, 261, 261, 261, 261, 261,
+    105, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756, 5801,
+    2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911, 2996,
+    2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773, 5818,
+    5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750, 2704, 5759, 5804, 2814, 5767,
+    5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139, 3140,
+    3141, 3142, 3143, 3144, 249, 2584, 5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914, 5775,
+    5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895, 5916, 5931,
+    3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261, 2554, 3238, 2675, 3238, 3239, 2785, 3238,
+    3239, 3240, 2884, 3238, 3239, 3240, 3241, 2972, 3238, 3239, 3240, 3241, 3242, 3049, 3238, 3239,
+    3240, 3241, 3242, 3243, 3115, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3170, 273, 273, 273,
+    273, 273, 273, 273, 273, 117, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201,
+    2580, 5747, 2701, 5756, 5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812,
+    5765, 5810, 5846, 2911, 2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766,
+    5811, 5847, 2912, 5773, 5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750,
+    2704, 5759, 5804, 2814, 5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861,
+    5889, 5910, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705, 5760, 5805, 2815,
+    5768, 5813, 5849, 2914, 5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786,
+    5831, 5867, 5895, 5916, 5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261, 2585, 5752,
+    2706, 5761, 5806, 2816, 5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003, 5782, 5827, 5863,
+    5891, 5912, 3080, 5787, 5832, 5868, 5896, 5917, 5932, 3146, 5791, 5836, 5872, 5900, 5921, 5936,
+    5946, 3201, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 273, 2565, 3271, 2686, 3271, 3272,
+    2796, 3271, 3272, 3273, 2895, 3271, 3272, 3273, 3274, 2983, 3271, 3272, 3273, 3274, 3275, 3060,
+    3271, 3272, 3273, 3274, 3275, 3276, 3126, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3181, 3271,
+    3272, 3273, 3274, 3275, 3276, 3277, 3278, 3225, 285, 285, 285, 285, 285, 285, 285, 285,
+    285, 129, 177, 2578, 2699, 189, 2579, 5746, 2700, 2809, 2810, 201, 2580, 5747, 2701, 5756,
+    5801, 2811, 2908, 2909, 2910, 213, 2581, 5748, 2702, 5757, 5802, 2812, 5765, 5810, 5846, 2911,
+    2996, 2997, 2998, 2999, 225, 2582, 5749, 2703, 5758, 5803, 2813, 5766, 5811, 5847, 2912, 5773,
+    5818, 5854, 5882, 3000, 3073, 3074, 3075, 3076, 3077, 237, 2583, 5750, 2704, 5759, 5804, 2814,
+    5767, 5812, 5848, 2913, 5774, 5819, 5855, 5883, 3001, 5780, 5825, 5861, 5889, 5910, 3078, 3139,
+    3140, 3141, 3142, 3143, 3144, 249, 2584, 5751, 2705, 5760, 5805, 2815, 5768, 5813, 5849, 2914,
+    5775, 5820, 5856, 5884, 3002, 5781, 5826, 5862, 5890, 5911, 3079, 5786, 5831, 5867, 5895, 5916,
+    5931, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 261, 2585, 5752, 2706, 5761, 5806, 2816,
+    5769, 5814, 5850, 2915, 5776, 5821, 5857, 5885, 3003, 5782, 5827, 5863, 5891, 5912, 3080, 5787,
+    5832, 5868, 5896, 5917, 5932, 3146, 5791, 5836, 5872, 5900, 5921, 5936, 5946, 3201, 3238, 3239,
+    3240, 3241, 3242, 3243, 3244, 3245, 273, 1609, 1609, 2707, 1609, 5807, 2817, 1609, 5815, 5851,
+    2916, 1609, 5822, 5858, 5886, 3004, 1609, 5828, 5864, 5892, 5913, 3081, 1609, 5833, 5869, 5897,
+    5918, 5933, 3147, 1609, 5837, 5873, 5901, 5922, 5937, 5947, 3202, 1608, 1608, 1608, 1608, 1608,
+    1608, 1608, 1607, 1608, 1609, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 1608, 285, 2576, 3293,
+    2697, 3293, 3294, 2807, 3293, 3294, 3295, 2906, 3293, 3294, 3295, 3296, 2994, 3293, 3294, 3295,
+    3296, 3297, 3071, 3293, 3294, 3295, 3296, 3297, 3298, 3137, 3293, 3294, 3295, 3296, 3297, 3298,
+    3299, 3192, 3293, 3294, 3295, 3296, 3297, 3298, 3299, 3300, 3236, 1609, 3294, 3295, 3296, 3297,
+    3298, 3299, 3300, 1608, 3269, 297, 297, 297, 297, 297, 297, 297, 297, 297, 297, 141,
+    177, 299, 300, 189, 299, 2336, 300, 301, 301, 201, 299, 2336, 300, 2337, 2347, 301,
+    302, 302, 302, 213, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 303, 303,
+    303, 303, 225, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358,
+    2366, 303, 304, 304, 304, 304, 304, 237, 299, 2336, 300, 2337, 2347, 301, 2338, 2348,
+    2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 305, 305, 305,
+    305, 305, 305, 249, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339, 2349,
+    2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381, 305,
+    306, 306, 306, 306, 306, 306, 306, 261, 299, 2336, 300, 2337, 2347, 301, 2338, 2348,
+    2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360,
+    2368, 2375, 2381, 305, 2342, 2352, 2361, 2369, 2376, 2382, 2387, 306, 307, 307, 307, 307,
+    307, 307, 307, 307, 273, 299, 2336, 300, 2337, 2347, 301, 2338, 2348, 2357, 302, 2339,
+    2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374, 304, 2341, 2351, 2360, 2368, 2375, 2381,
+    305, 2342, 2352, 2361, 2369, 2376, 2382, 2387, 306, 2343, 2353, 2362, 2370, 2377, 2383, 2388,
+    2392, 307, 308, 308, 308, 308, 308, 308, 308, 308, 308, 285, 299, 2336, 300, 2337,
+    2347, 301, 2338, 2348, 2357, 302, 2339, 2349, 2358, 2366, 303, 2340, 2350, 2359, 2367, 2374,
+    304, 2341, 2351, 2360, 2368, 2375, 2381, 305, 2342, 2352, 2361, 2369, 2376, 2382, 2387, 306,
+    2343, 2353, 2362, 2370, 2377, 2383, 2388, 2392, 307, 1609, 2354, 2363, 2371, 2378, 2384, 2389,
+    2393, 1608, 308, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 297, 143, 143,
+    144, 143, 144, 145, 143, 144, 145, 146, 143, 144, 145, 146, 147, 143, 144, 145,
+    146, 147, 148, 143, 144, 145, 146, 147, 148, 149, 143, 144, 145, 146, 147, 148,
+    149, 150, 143, 144, 145, 146, 147, 148, 149, 150, 151, 143, 144, 145, 146, 147,
+    148, 149, 150, 151, 152, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+    11, 167, 179, 23, 12, 178, 2468, 190, 24, 168, 2479, 2600, 180, 191, 202, 192,
+    35, 36, 13, 178, 2469, 190, 25, 178, 2589, 2710, 190, 2480, 2820, 2601, 202, 202,
+    37, 169, 2490, 2611, 181, 2491, 2919, 2612, 2721, 2722, 193, 203, 214, 204, 214, 214,
+    205, 47, 48, 49, 14, 178, 2470, 190, 26, 178, 2589, 2710, 190, 2481, 2820, 2602,
+    202, 202, 38, 178, 2589, 2710, 190, 2590, 1600, 2711, 2820, 2821, 202, 2492, 2919, 2613,
+    2919, 2920, 2723, 214, 214, 214, 50, 170, 2501, 2622, 182, 2502, 3007, 2623, 2732, 2733,
+    194, 2503, 3007, 2624, 3007, 3008, 2734, 2831, 2832, 2833, 206, 215, 226, 216, 226, 226,
+    217, 226, 226, 226, 218, 59, 60, 61, 62, 15, 178, 2471, 190, 27, 178, 2589,
+    2710, 190, 2482, 2820, 2603, 202, 202, 39, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820,
+    2821, 202, 2493, 2919, 2614, 2919, 2920, 2724, 214, 214, 214, 51, 178, 2589, 2710, 190,
+    2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 1601, 2822, 2919, 2920, 2921, 214,
+    2504, 3007, 2625, 3007, 3008, 2735, 3007, 3008, 3009, 2834, 226, 226, 226, 226, 63, 171,
+    2512, 2633, 183, 2513, 3084, 2634, 2743, 2744, 195, 2514, 3084, 2635, 3084, 3085, 2745, 2842,
+    2843, 2844, 207, 2515, 3084, 2636, 3084, 3085, 2746, 3084, 3085, 3086, 2845, 2930, 2931, 2932,
+    2933, 219, 227, 238, 228, 238, 238, 229, 238, 238, 238, 230, 238, 238, 238, 238,
+    231, 71, 72, 73, 74, 75, 16, 178, 2472, 190, 28, 178, 2589, 2710, 190, 2483,
+    2820, 2604, 202, 202, 40, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2494,
+    2919, 2615, 2919, 2920, 2725, 214, 214, 214, 52, 178, 2589, 2710, 190, 2590, 5966, 2711,
+    2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2505, 3007, 2626,
+    3007, 3008, 2736, 3007, 3008, 3009, 2835, 226, 226, 226, 226, 64, 178, 2589, 2710, 190,
+    2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,
+    2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 1602, 2922, 3007, 3008, 3009, 3010, 226, 2516,
+    3084, 2637, 3084, 3085, 2747, 3084, 3085, 3086, 2846, 3084, 3085, 3086, 3087, 2934, 238, 238,
+    238, 238, 238, 76, 172, 2523, 2644, 184, 2524, 3150, 2645, 2754, 2755, 196, 2525, 3150,
+    2646, 3150, 3151, 2756, 2853, 2854, 2855, 208, 2526, 3150, 2647, 3150, 3151, 2757, 3150, 3151,
+    3152, 2856, 2941, 2942, 2943, 2944, 220, 2527, 3150, 2648, 3150, 3151, 2758, 3150, 3151, 3152,
+    2857, 3150, 3151, 3152, 3153, 2945, 3018, 3019, 3020, 3021, 3022, 232, 239, 250, 240, 250,
+    250, 241, 250, 250, 250, 242, 250, 250, 250, 250, 243, 250, 250, 250, 250, 250,
+    244, 83, 84, 85, 86, 87, 88, 17, 178, 2473, 190, 29, 178, 2589, 2710, 190,
+    2484, 2820, 2605, 202, 202, 41, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202,
+    2495, 2919, 2616, 2919, 2920, 2726, 214, 214, 214, 53, 178, 2589, 2710, 190, 2590, 5966,
+    2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2506, 3007,
+    2627, 3007, 3008, 2737, 3007, 3008, 3009, 2836, 226, 226, 226, 226, 65, 178, 2589, 2710,
+    190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921,
+    214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226,
+    2517, 3084, 2638, 3084, 3085, 2748, 3084, 3085, 3086, 2847, 3084, 3085, 3086, 3087, 2935, 238,
+    238, 238, 238, 238, 77, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591,
+    5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985,
+    6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031,
+    6067, 2923, 5993, 6038, 6074, 1603, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2528, 3150, 2649,
+    3150, 3151, 2759, 3150, 3151, 3152, 2858, 3150, 3151, 3152, 3153, 2946, 3150, 3151, 3152, 3153,
+    3154, 3023, 250, 250, 250, 250, 250, 250, 89, 173, 2534, 2655, 185, 2535, 3205, 2656,
+    2765, 2766, 197, 2536, 3205, 2657, 3205, 3206, 2767, 2864, 2865, 2866, 209, 2537, 3205, 2658,
+    3205, 3206, 2768, 3205, 3206, 3207, 2867, 2952, 2953, 2954, 2955, 221, 2538, 3205, 2659, 3205,
+    3206, 2769, 3205, 3206, 3207, 2868, 3205, 3206, 3207, 3208, 2956, 3029, 3030, 3031, 3032, 3033,
+    233, 2539, 3205, 2660, 3205, 3206, 2770, 3205, 3206, 3207, 2869, 3205, 3206, 3207, 3208, 2957,
+    3205, 3206, 3207, 3208, 3209, 3034, 3095, 3096, 3097, 3098, 3099, 3100, 245, 251, 262, 252,
+    262, 262, 253, 262, 262, 262, 254, 262, 262, 262, 262, 255, 262, 262, 262, 262,
+    262, 256, 262, 262, 262, 262, 262, 262, 257, 95, 96, 97, 98, 99, 100, 101,
+    18, 178, 2474, 190, 30, 178, 2589, 2710, 190, 2485, 2820, 2606, 202, 202, 42, 178,
+    2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2496, 2919, 2617, 2919, 2920, 2727, 214,
+    214, 214, 54, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712,
+    5976, 6021, 2822, 2919, 2920, 2921, 214, 2507, 3007, 2628, 3007, 3008, 2738, 3007, 3008, 3009,
+    2837, 226, 226, 226, 226, 66, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202,
+    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823,
+    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2518, 3084, 2639, 3084, 3085, 2749, 3084,
+    3085, 3086, 2848, 3084, 3085, 3086, 3087, 2936, 238, 238, 238, 238, 238, 78, 178, 2589,
+    2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920,
+    2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
+    226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011,
+    3084, 3085, 3086, 3087, 3088, 238, 2529, 3150, 2650, 3150, 3151, 2760, 3150, 3151, 3152, 2859,
+    3150, 3151, 3152, 3153, 2947, 3150, 3151, 3152, 3153, 3154, 3024, 250, 250, 250, 250, 250,
+    250, 90, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976,
+    6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922,
+    3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
+    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825,
+    5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 1604, 3089, 3150,
+    3151, 3152, 3153, 3154, 3155, 250, 2540, 3205, 2661, 3205, 3206, 2771, 3205, 3206, 3207, 2870,
+    3205, 3206, 3207, 3208, 2958, 3205, 3206, 3207, 3208, 3209, 3035, 3205, 3206, 3207, 3208, 3209,
+    3210, 3101, 262, 262, 262, 262, 262, 262, 262, 102, 174, 2545, 2666, 186, 2546, 3249,
+    2667, 2776, 2777, 198, 2547, 3249, 2668, 3249, 3250, 2778, 2875, 2876, 2877, 210, 2548, 3249,
+    2669, 3249, 3250, 2779, 3249, 3250, 3251, 2878, 2963, 2964, 2965, 2966, 222, 2549, 3249, 2670,
+    3249, 3250, 2780, 3249, 3250, 3251, 2879, 3249, 3250, 3251, 3252, 2967, 3040, 3041, 3042, 3043,
+    3044, 234, 2550, 3249, 2671, 3249, 3250, 2781, 3249, 3250, 3251, 2880, 3249, 3250, 3251, 3252,
+    2968, 3249, 3250, 3251, 3252, 3253, 3045, 3106, 3107, 3108, 3109, 3110, 3111, 246, 2551, 3249,
+    2672, 3249, 3250, 2782, 3249, 3250, 3251, 2881, 3249, 3250, 3251, 3252, 2969, 3249, 3250, 3251,
+    3252, 3253, 3046, 3249, 3250, 3251, 3252, 3253, 3254, 3112, 3161, 3162, 3163, 3164, 3165, 3166,
+    3167, 258, 263, 274, 264, 274, 274, 265, 274, 274, 274, 266, 274, 274, 274, 274,
+    267, 274, 274, 274, 274, 274, 268, 274, 274, 274, 274, 274, 274, 269, 274, 274,
+    274, 274, 274, 274, 274, 270, 107, 108, 109, 110, 111, 112, 113, 114, 19, 178,
+    2475, 190, 31, 178, 2589, 2710, 190, 2486, 2820, 2607, 202, 202, 43, 178, 2589, 2710,
+    190, 2590, 5966, 2711, 2820, 2821, 202, 2497, 2919, 2618, 2919, 2920, 2728, 214, 214, 214,
+    55, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021,
+    2822, 2919, 2920, 2921, 214, 2508, 3007, 2629, 3007, 3008, 2739, 3007, 3008, 3009, 2838, 226,
+    226, 226, 226, 67, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967,
+    2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030,
+    6066, 2922, 3007, 3008, 3009, 3010, 226, 2519, 3084, 2640, 3084, 3085, 2750, 3084, 3085, 3086,
+    2849, 3084, 3085, 3086, 3087, 2937, 238, 238, 238, 238, 238, 79, 178, 2589, 2710, 190,
+    2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214,
+    2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593,
+    5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085,
+    3086, 3087, 3088, 238, 2530, 3150, 2651, 3150, 3151, 2761, 3150, 3151, 3152, 2860, 3150, 3151,
+    3152, 3153, 2948, 3150, 3151, 3152, 3153, 3154, 3025, 250, 250, 250, 250, 250, 250, 91,
+    178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822,
+    2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008,
+    3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074,
+    6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032,
+    6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152,
+    3153, 3154, 3155, 250, 2541, 3205, 2662, 3205, 3206, 2772, 3205, 3206, 3207, 2871, 3205, 3206,
+    3207, 3208, 2959, 3205, 3206, 3207, 3208, 3209, 3036, 3205, 3206, 3207, 3208, 3209, 3210, 3102,
+    262, 262, 262, 262, 262, 262, 262, 103, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820,
+    2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977,
+    6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023,
+    2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238,
+    2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000,
+    6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2595, 5971, 2716, 5980,
+    6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131,
+    3090, 6006, 6051, 6087, 6115, 6136, 1605, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262,
+    2552, 3249, 2673, 3249, 3250, 2783, 3249, 3250, 3251, 2882, 3249, 3250, 3251, 3252, 2970, 3249,
+    3250, 3251, 3252, 3253, 3047, 3249, 3250, 3251, 3252, 3253, 3254, 3113, 3249, 3250, 3251, 3252,
+    3253, 3254, 3255, 3168, 274, 274, 274, 274, 274, 274, 274, 274, 115, 175, 2556, 2677,
+    187, 2557, 3282, 2678, 2787, 2788, 199, 2558, 3282, 2679, 3282, 3283, 2789, 2886, 2887, 2888,
+    211, 2559, 3282, 2680, 3282, 3283, 2790, 3282, 3283, 3284, 2889, 2974, 2975, 2976, 2977, 223,
+    2560, 3282, 2681, 3282, 3283, 2791, 3282, 3283, 3284, 2890, 3282, 3283, 3284, 3285, 2978, 3051,
+    3052, 3053, 3054, 3055, 235, 2561, 3282, 2682, 3282, 3283, 2792, 3282, 3283, 3284, 2891, 3282,
+    3283, 3284, 3285, 2979, 3282, 3283, 3284, 3285, 3286, 3056, 3117, 3118, 3119, 3120, 3121, 3122,
+    247, 2562, 3282, 2683, 3282, 3283, 2793, 3282, 3283, 3284, 2892, 3282, 3283, 3284, 3285, 2980,
+    3282, 3283, 3284, 3285, 3286, 3057, 3282, 3283, 3284, 3285, 3286, 3287, 3123, 3172, 3173, 3174,
+    3175, 3176, 3177, 3178, 259, 2563, 3282, 2684, 3282, 3283, 2794, 3282, 3283, 3284, 2893, 3282,
+    3283, 3284, 3285, 2981, 3282, 3283, 3284, 3285, 3286, 3058, 3282, 3283, 3284, 3285, 3286, 3287,
+    3124, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3179, 3216, 3217, 3218, 3219, 3220, 3221, 3222,
+    3223, 271, 275, 286, 276, 286, 286, 277, 286, 286, 286, 278, 286, 286, 286, 286,
+    279, 286, 286, 286, 286, 286, 280, 286, 286, 286, 286, 286, 286, 281, 286, 286,
+    286, 286, 286, 286, 286, 282, 286, 286, 286, 286, 286, 286, 286, 286, 283, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 20, 178, 2476, 190, 32, 178, 2589, 2710,
+    190, 2487, 2820, 2608, 202, 202, 44, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821,
+    202, 2498, 2919, 2619, 2919, 2920, 2729, 214, 214, 214, 56, 178, 2589, 2710, 190, 2590,
+    5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2509,
+    3007, 2630, 3007, 3008, 2740, 3007, 3008, 3009, 2839, 226, 226, 226, 226, 68, 178, 2589,
+    2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920,
+    2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
+    226, 2520, 3084, 2641, 3084, 3085, 2751, 3084, 3085, 3086, 2850, 3084, 3085, 3086, 3087, 2938,
+    238, 238, 238, 238, 238, 80, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202,
+    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823,
+    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986,
+    6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2531, 3150,
+    2652, 3150, 3151, 2762, 3150, 3151, 3152, 2861, 3150, 3151, 3152, 3153, 2949, 3150, 3151, 3152,
+    3153, 3154, 3026, 250, 250, 250, 250, 250, 250, 92, 178, 2589, 2710, 190, 2590, 5966,
+    2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968,
+    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714,
+    5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087,
+    3088, 238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103,
+    3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2542, 3205,
+    2663, 3205, 3206, 2773, 3205, 3206, 3207, 2872, 3205, 3206, 3207, 3208, 2960, 3205, 3206, 3207,
+    3208, 3209, 3037, 3205, 3206, 3207, 3208, 3209, 3210, 3103, 262, 262, 262, 262, 262, 262,
+    262, 104, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976,
+    6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922,
+    3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
+    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825,
+    5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150,
+    3151, 3152, 3153, 3154, 3155, 250, 2595, 5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925,
+    5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136,
+    6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262, 2553, 3249, 2674, 3249, 3250, 2784,
+    3249, 3250, 3251, 2883, 3249, 3250, 3251, 3252, 2971, 3249, 3250, 3251, 3252, 3253, 3048, 3249,
+    3250, 3251, 3252, 3253, 3254, 3114, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3169, 274, 274,
+    274, 274, 274, 274, 274, 274, 116, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821,
+    202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022,
+    2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824,
+    5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2594,
+    5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045,
+    6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2595, 5971, 2716, 5980, 6025,
+    2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090,
+    6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 262, 2596,
+    5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077, 6105, 3014, 6002, 6047,
+    6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116, 6137, 6152, 3157, 6011, 6056, 6092, 6120, 6141,
+    6156, 1606, 3212, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 274, 2564, 3282, 2685, 3282,
+    3283, 2795, 3282, 3283, 3284, 2894, 3282, 3283, 3284, 3285, 2982, 3282, 3283, 3284, 3285, 3286,
+    3059, 3282, 3283, 3284, 3285, 3286, 3287, 3125, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3180,
+    3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3224, 286, 286, 286, 286, 286, 286, 286,
+    286, 286, 128, 176, 2567, 2688, 188, 2568, 3304, 2689, 2798, 2799, 200, 2569, 3304, 2690,
+    3304, 3305, 2800, 2897, 2898, 2899, 212, 2570, 3304, 2691, 3304, 3305, 2801, 3304, 3305, 3306,
+    2900, 2985, 2986, 2987, 2988, 224, 2571, 3304, 2692, 3304, 3305, 2802, 3304, 3305, 3306, 2901,
+    3304, 3305, 3306, 3307, 2989, 3062, 3063, 3064, 3065, 3066, 236, 2572, 3304, 2693, 3304, 3305,
+    2803, 3304, 3305, 3306, 2902, 3304, 3305, 3306, 3307, 2990, 3304, 3305, 3306, 3307, 3308, 3067,
+    3128, 3129, 3130, 3131, 3132, 3133, 248, 2573, 3304, 2694, 3304, 3305, 2804, 3304, 3305, 3306,
+    2903, 3304, 3305, 3306, 3307, 2991, 3304, 3305, 3306, 3307, 3308, 3068, 3304, 3305, 3306, 3307,
+    3308, 3309, 3134, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 260, 2574, 3304, 2695, 3304, 3305,
+    2805, 3304, 3305, 3306, 2904, 3304, 3305, 3306, 3307, 2992, 3304, 3305, 3306, 3307, 3308, 3069,
+    3304, 3305, 3306, 3307, 3308, 3309, 3135, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3190, 3227,
+    3228, 3229, 3230, 3231, 3232, 3233, 3234, 272, 2575, 3304, 2696, 3304, 3305, 2806, 3304, 3305,
+    3306, 2905, 3304, 3305, 3306, 3307, 2993, 3304, 3305, 3306, 3307, 3308, 3070, 3304, 3305, 3306,
+    3307, 3308, 3309, 3136, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3191, 3304, 3305, 3306, 3307,
+    3308, 3309, 3310, 3311, 3235, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 3268, 284, 287,
+    298, 288, 298, 298, 289, 298, 298, 298, 290, 298, 298, 298, 298, 291, 298, 298,
+    298, 298, 298, 292, 298, 298, 298, 298, 298, 298, 293, 298, 298, 298, 298, 298,
+    298, 298, 294, 298, 298, 298, 298, 298, 298, 298, 298, 295, 298, 298, 298, 298,
+    298, 298, 298, 298, 298, 296, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+    21, 178, 2477, 190, 33, 178, 2589, 2710, 190, 2488, 2820, 2609, 202, 202, 45, 178,
+    2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2499, 2919, 2620, 2919, 2920, 2730, 214,
+    214, 214, 57, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712,
+    5976, 6021, 2822, 2919, 2920, 2921, 214, 2510, 3007, 2631, 3007, 3008, 2741, 3007, 3008, 3009,
+    2840, 226, 226, 226, 226, 69, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202,
+    2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823,
+    5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2521, 3084, 2642, 3084, 3085, 2752, 3084,
+    3085, 3086, 2851, 3084, 3085, 3086, 3087, 2939, 238, 238, 238, 238, 238, 81, 178, 2589,
+    2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920,
+    2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010,
+    226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011,
+    3084, 3085, 3086, 3087, 3088, 238, 2532, 3150, 2653, 3150, 3151, 2763, 3150, 3151, 3152, 2862,
+    3150, 3151, 3152, 3153, 2950, 3150, 3151, 3152, 3153, 3154, 3027, 250, 250, 250, 250, 250,
+    250, 93, 178, 2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976,
+    6021, 2822, 2919, 2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922,
+    3007, 3008, 3009, 3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993,
+    6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825,
+    5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150,
+    3151, 3152, 3153, 3154, 3155, 250, 2543, 3205, 2664, 3205, 3206, 2774, 3205, 3206, 3207, 2873,
+    3205, 3206, 3207, 3208, 2961, 3205, 3206, 3207, 3208, 3209, 3038, 3205, 3206, 3207, 3208, 3209,
+    3210, 3104, 262, 262, 262, 262, 262, 262, 262, 105, 178, 2589, 2710, 190, 2590, 5966,
+    2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592, 5968,
+    2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969, 2714,
+    5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086, 3087,
+    3088, 238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075, 6103,
+    3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2595, 5971,
+    2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046, 6082,
+    6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209, 3210,
+    3211, 262, 2554, 3249, 2675, 3249, 3250, 2785, 3249, 3250, 3251, 2884, 3249, 3250, 3251, 3252,
+    2972, 3249, 3250, 3251, 3252, 3253, 3049, 3249, 3250, 3251, 3252, 3253, 3254, 3115, 3249, 3250,
+    3251, 3252, 3253, 3254, 3255, 3170, 274, 274, 274, 274, 274, 274, 274, 274, 117, 178,
+    2589, 2710, 190, 2590, 5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919,
+    2920, 2921, 214, 2592, 5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009,
+    3010, 226, 2593, 5969, 2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102,
+    3011, 3084, 3085, 3086, 3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068,
+    2924, 5994, 6039, 6075, 6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153,
+    3154, 3155, 250, 2595, 5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076,
+    6104, 3013, 6001, 6046, 6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205,
+    3206, 3207, 3208, 3209, 3210, 3211, 262, 2596, 5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070,
+    2926, 5996, 6041, 6077, 6105, 3014, 6002, 6047, 6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116,
+    6137, 6152, 3157, 6011, 6056, 6092, 6120, 6141, 6156, 6166, 3212, 3249, 3250, 3251, 3252, 3253,
+    3254, 3255, 3256, 274, 2565, 3282, 2686, 3282, 3283, 2796, 3282, 3283, 3284, 2895, 3282, 3283,
+    3284, 3285, 2983, 3282, 3283, 3284, 3285, 3286, 3060, 3282, 3283, 3284, 3285, 3286, 3287, 3126,
+    3282, 3283, 3284, 3285, 3286, 3287, 3288, 3181, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289,
+    3225, 286, 286, 286, 286, 286, 286, 286, 286, 286, 129, 178, 2589, 2710, 190, 2590,
+    5966, 2711, 2820, 2821, 202, 2591, 5967, 2712, 5976, 6021, 2822, 2919, 2920, 2921, 214, 2592,
+    5968, 2713, 5977, 6022, 2823, 5985, 6030, 6066, 2922, 3007, 3008, 3009, 3010, 226, 2593, 5969,
+    2714, 5978, 6023, 2824, 5986, 6031, 6067, 2923, 5993, 6038, 6074, 6102, 3011, 3084, 3085, 3086,
+    3087, 3088, 238, 2594, 5970, 2715, 5979, 6024, 2825, 5987, 6032, 6068, 2924, 5994, 6039, 6075,
+    6103, 3012, 6000, 6045, 6081, 6109, 6130, 3089, 3150, 3151, 3152, 3153, 3154, 3155, 250, 2595,
+    5971, 2716, 5980, 6025, 2826, 5988, 6033, 6069, 2925, 5995, 6040, 6076, 6104, 3013, 6001, 6046,
+    6082, 6110, 6131, 3090, 6006, 6051, 6087, 6115, 6136, 6151, 3156, 3205, 3206, 3207, 3208, 3209,
+    3210, 3211, 262, 2596, 5972, 2717, 5981, 6026, 2827, 5989, 6034, 6070, 2926, 5996, 6041, 6077,
+    6105, 3014, 6002, 6047, 6083, 6111, 6132, 3091, 6007, 6052, 6088, 6116, 6137, 6152, 3157, 6011,
+    6056, 6092, 6120, 6141, 6156, 6166, 3212, 3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 274,
+    1609, 1609, 2718, 1609, 6027, 2828, 1609, 6035, 6071, 2927, 1609, 6042, 6078, 6106, 3015, 1609,
+    6048, 6084, 6112, 6133, 3092, 1609, 6053, 6089, 6117, 6138, 6153, 3158, 1609, 6057, 6093, 6121,
+    6142, 6157, 6167, 3213, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1607, 1608, 1609, 3283, 3284,
+    3285, 3286, 3287, 3288, 3289, 1608, 286, 2576, 3304, 2697, 3304, 3305, 2807, 3304, 3305, 3306,
+    2906, 3304, 3305, 3306, 3307, 2994, 3304, 3305, 3306, 3307, 3308, 3071, 3304, 3305, 3306, 3307,
+    3308, 3309, 3137, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3192, 3304, 3305, 3306, 3307, 3308,
+    3309, 3310, 3311, 3236, 1609, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 1608, 3269, 298, 298,
+    298, 298, 298, 298, 298, 298, 298, 298, 141, 177, 2578, 2699, 189, 2579, 3315, 2700,
+    2809, 2810, 201, 2580, 3315, 2701, 3315, 3316, 2811, 2908, 2909, 2910, 213, 2581, 3315, 2702,
+    3315, 3316, 2812, 3315, 3316, 3317, 2911, 2996, 2997, 2998, 2999, 225, 2582, 3315, 2703, 3315,
+    3316, 2813, 3315, 3316, 3317, 2912, 3315, 3316, 3317, 3318, 3000, 3073, 3074, 3075, 3076, 3077,
+    237, 2583, 3315, 2704, 3315, 3316, 2814, 3315, 3316, 3317, 2913, 3315, 3316, 3317, 3318, 3001,
+    3315, 3316, 3317, 3318, 3319, 3078, 3139, 3140, 3141, 3142, 3143, 3144, 249, 2584, 3315, 2705,
+    3315, 3316, 2815, 3315, 3316, 3317, 2914, 3315, 3316, 3317, 3318, 3002, 3315, 3316, 3317, 3318,
+    3319, 3079, 3315, 3316, 3317, 3318, 3319, 3320, 3145, 3194, 3195, 3196, 3197, 3198, 3199, 3200,
+    261, 2585, 3315, 2706, 3315, 3316, 2816, 3315, 3316, 3317, 2915, 3315, 3316, 3317, 3318, 3003,
+    3315, 3316, 3317, 3318, 3319, 3080, 3315, 3316, 3317, 3318, 3319, 3320, 3146, 3315, 3316, 3317,
+    3318, 3319, 3320, 3321, 3201, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 273, 2586, 3315,
+    2707, 3315, 3316, 2817, 3315, 3316, 3317, 2916, 3315, 3316, 3317, 3318, 3004, 3315, 3316, 3317,
+    3318, 3319, 3081, 3315, 3316, 3317, 3318, 3319, 3320, 3147, 3315, 3316, 3317, 3318, 3319, 3320,
+    3321, 3202, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3246, 3271, 3272, 3273, 3274, 3275,
+    3276, 3277, 3278, 3279, 285, 2587, 3315, 2708, 3315, 3316, 2818, 3315, 3316, 3317, 2917, 3315,
+    3316, 3317, 3318, 3005, 3315, 3316, 3317, 3318, 3319, 3082, 3315, 3316, 3317, 3318, 3319, 3320,
+    3148, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3203, 3315, 3316, 3317, 3318, 3319, 3320, 3321,
+    3322, 3247, 1609, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 1608, 3280, 3293, 3294, 3295, 3296,
+    3297, 3298, 3299, 3300, 3301, 3302, 297, 299, 310, 300, 310, 310, 301, 310, 310, 310,
+    302, 310, 310, 310, 310, 303, 310, 310, 310, 310, 310, 304, 310, 310, 310, 310,
+    310, 310, 305, 310, 310, 310, 310, 310, 310, 310, 306, 310, 310, 310, 310, 310,
+    310, 310, 310, 307, 310, 310, 310, 310, 310, 310, 310, 310, 310, 308, 310, 310,
+    310, 310, 310, 310, 310, 310, 310, 310, 309, 143, 144, 145, 146, 147, 148, 149,
+    150, 151, 152, 153, 22, 178, 311, 190, 34, 178, 311, 312, 190, 311, 313, 312,
+    202, 202, 46, 178, 311, 312, 190, 311, 2402, 312, 313, 313, 202, 311, 314, 312,
+    314, 314, 313, 214, 214, 214, 58, 178, 311, 312, 190, 311, 2402, 312, 313, 313,
+    202, 311, 2402, 312, 2403, 2413, 313, 314, 314, 314, 214, 311, 315, 312, 315, 315,
+    313, 315, 315, 315, 314, 226, 226, 226, 226, 70, 178, 311, 312, 190, 311, 2402,
+    312, 313, 313, 202, 311, 2402, 312, 2403, 2413, 313, 314, 314, 314, 214, 311, 2402,
+    312, 2403, 2413, 313, 2404, 2414, 2423, 314, 315, 315, 315, 315, 226, 311, 316, 312,
+    316, 316, 313, 316, 316, 316, 314, 316, 316, 316, 316, 315, 238, 238, 238, 238,
+    238, 82, 178, 311, 312, 190, 311, 2402, 312, 313, 313, 202, 311, 2402, 312, 2403,
+    2413, 313, 314, 314, 314, 214, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314,
+    315, 315, 315, 315, 226, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405,
+    2415, 2424, 2432, 315, 316, 316, 316, 316, 316, 238, 311, 317, 312, 317, 317, 313,
+    317, 317, 317, 314, 317, 317, 317, 317, 315, 317, 317, 317, 317, 317, 316, 250,
+    250, 250, 250, 250, 250, 94, 178, 311, 312, 190, 311, 2402, 312, 313, 313, 202,
+    311, 2402, 312, 2403, 2413, 313, 314, 314, 314, 214, 311, 2402, 312, 2403, 2413, 313,
+    2404, 2414, 2423, 314, 315, 315, 315, 315, 226, 311, 2402, 312, 2403, 2413, 313, 2404,
+    2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 316, 316, 316, 316, 316, 238, 311, 2402,
+    312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425,
+    2433, 2440, 316, 317, 317, 317, 317, 317, 317, 250, 311, 318, 312, 318, 318, 313,
+    318, 318, 318, 314, 318, 318, 318, 318, 315, 318, 318, 318, 318, 318, 316, 318,
+    318, 318, 318, 318, 318, 317, 262, 262, 262, 262, 262, 262, 262, 106, 178, 311,
+    312, 190, 311, 2402, 312, 313, 313, 202, 311, 2402, 312, 2403, 2413, 313, 314, 314,
+    314, 214, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 315, 315, 315, 315,
+    226, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315,
+    316, 316, 316, 316, 316, 238, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314,
+    2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 317, 317, 317, 317, 317,
+    317, 250, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432,
+    315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447, 317, 318, 318,
+    318, 318, 318, 318, 318, 262, 311, 319, 312, 319, 319, 313, 319, 319, 319, 314,
+    319, 319, 319, 319, 315, 319, 319, 319, 319, 319, 316, 319, 319, 319, 319, 319,
+    319, 317, 319, 319, 319, 319, 319, 319, 319, 318, 274, 274, 274, 274, 274, 274,
+    274, 274, 118, 178, 311, 312, 190, 311, 2402, 312, 313, 313, 202, 311, 2402, 312,
+    2403, 2413, 313, 314, 314, 314, 214, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423,
+    314, 315, 315, 315, 315, 226, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314,
+    2405, 2415, 2424, 2432, 315, 316, 316, 316, 316, 316, 238, 311, 2402, 312, 2403, 2413,
+    313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316,
+    317, 317, 317, 317, 317, 317, 250, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423,
+    314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434,
+    2441, 2447, 317, 318, 318, 318, 318, 318, 318, 318, 262, 311, 2402, 312, 2403, 2413,
+    313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316,
+    2407, 2417, 2426, 2434, 2441, 2447, 317, 2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 319,
+    319, 319, 319, 319, 319, 319, 319, 274, 311, 320, 312, 320, 320, 313, 320, 320,
+    320, 314, 320, 320, 320, 320, 315, 320, 320, 320, 320, 320, 316, 320, 320, 320,
+    320, 320, 320, 317, 320, 320, 320, 320, 320, 320, 320, 318, 320, 320, 320, 320,
+    320, 320, 320, 320, 319, 286, 286, 286, 286, 286, 286, 286, 286, 286, 130, 178,
+    311, 312, 190, 311, 2402, 312, 313, 313, 202, 311, 2402, 312, 2403, 2413, 313, 314,
+    314, 314, 214, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 315, 315, 315,
+    315, 226, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432,
+    315, 316, 316, 316, 316, 316, 238, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423,
+    314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 317, 317, 317, 317,
+    317, 317, 250, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424,
+    2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447, 317, 318,
+    318, 318, 318, 318, 318, 318, 262, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423,
+    314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434,
+    2441, 2447, 317, 2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 319, 319, 319, 319, 319,
+    319, 319, 319, 274, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415,
+    2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447, 317,
+    2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 2409, 2419, 2428, 2436, 2443, 2449, 2454, 2458,
+    319, 320, 320, 320, 320, 320, 320, 320, 320, 320, 286, 311, 321, 312, 321, 321,
+    313, 321, 321, 321, 314, 321, 321, 321, 321, 315, 321, 321, 321, 321, 321, 316,
+    321, 321, 321, 321, 321, 321, 317, 321, 321, 321, 321, 321, 321, 321, 318, 321,
+    321, 321, 321, 321, 321, 321, 321, 319, 321, 321, 321, 321, 321, 321, 321, 321,
+    321, 320, 298, 298, 298, 298, 298, 298, 298, 298, 298, 298, 142, 178, 311, 312,
+    190, 311, 2402, 312, 313, 313, 202, 311, 2402, 312, 2403, 2413, 313, 314, 314, 314,
+    214, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 315, 315, 315, 315, 226,
+    311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 316,
+    316, 316, 316, 316, 238, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405,
+    2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 317, 317, 317, 317, 317, 317,
+    250, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432, 315,
+    2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447, 317, 318, 318, 318,
+    318, 318, 318, 318, 262, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405,
+    2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447,
+    317, 2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 319, 319, 319, 319, 319, 319, 319,
+    319, 274, 311, 2402, 312, 2403, 2413, 313, 2404, 2414, 2423, 314, 2405, 2415, 2424, 2432,
+    315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417, 2426, 2434, 2441, 2447, 317, 2408, 2418,
+    2427, 2435, 2442, 2448, 2453, 318, 2409, 2419, 2428, 2436, 2443, 2449, 2454, 2458, 319, 320,
+    320, 320, 320, 320, 320, 320, 320, 320, 286, 311, 2402, 312, 2403, 2413, 313, 2404,
+    2414, 2423, 314, 2405, 2415, 2424, 2432, 315, 2406, 2416, 2425, 2433, 2440, 316, 2407, 2417,
+    2426, 2434, 2441, 2447, 317, 2408, 2418, 2427, 2435, 2442, 2448, 2453, 318, 2409, 2419, 2428,
+    2436, 2443, 2449, 2454, 2458, 319, 1609, 2420, 2429, 2437, 2444, 2450, 2455, 2459, 1608, 320,
+    321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 298, 311, 322, 312, 322, 322,
+    313, 322, 322, 322, 314, 322, 322, 322, 322, 315, 322, 322, 322, 322, 322, 316,
+    322, 322, 322, 322, 322, 322, 317, 322, 322, 322, 322, 322, 322, 322, 318, 322,
+    322, 322, 322, 322, 322, 322, 322, 319, 322, 322, 322, 322, 322, 322, 322, 322,
+    322, 320, 322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 321, 310, 310, 310,
+    310, 310, 310, 310, 310, 310, 310, 310, 154, 155, 155, 155, 156, 155, 155, 156,
+    155, 156, 157, 155, 155, 156, 155, 156, 157, 155, 156, 157, 158, 155, 155, 156,
+    155, 156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159, 155, 155, 156, 155,
+    156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159, 155, 156, 157, 158, 159,
+    160, 155, 155, 156, 155, 156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159,
+    155, 156, 157, 158, 159, 160, 155, 156, 157, 158, 159, 160, 161, 155, 155, 156,
+    155, 156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159, 155, 156, 157, 158,
+    159, 160, 155, 156, 157, 158, 159, 160, 161, 155, 156, 157, 158, 159, 160, 161,
+    162, 155, 155, 156, 155, 156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159,
+    155, 156, 157, 158, 159, 160, 155, 156, 157, 158, 159, 160, 161, 155, 156, 157,
+    158, 159, 160, 161, 162, 155, 156, 157, 158, 159, 160, 161, 162, 163, 155, 155,
+    156, 155, 156, 157, 155, 156, 157, 158, 155, 156, 157, 158, 159, 155, 156, 157,
+    158, 159, 160, 155, 156, 157, 158, 159, 160, 161, 155, 156, 157, 158, 159, 160,
+    161, 162, 155, 156, 157, 158, 159, 160, 161, 162, 163, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 155, 155, 156, 155, 156, 157, 155, 156, 157, 158, 155,
+    156, 157, 158, 159, 155, 156, 157, 158, 159, 160, 155, 156, 157, 158, 159, 160,
+    161, 155, 156, 157, 158, 159, 160, 161, 162, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 155, 156, 157, 158,
+    159, 160, 161, 162, 163, 164, 165, 155, 155, 156, 155, 156, 157, 155, 156, 157,
+    158, 155, 156, 157, 158, 159, 155, 156, 157, 158, 159, 160, 155, 156, 157, 158,
+    159, 160, 161, 155, 156, 157, 158, 159, 160, 161, 162, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 155, 156,
+    157, 158, 159, 160, 161, 162, 163, 164, 165, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166
+};
+
+#endif
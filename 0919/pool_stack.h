@@ -0,0 +1,215 @@
+// 풀 기반 연속 스택 (C++11)
+//
+// Stack.c 는 push 마다 malloc, pop 마다 free 를 부르고 원소가 힙 여기저기 흩어진다.
+// PoolStack 은 원소를 다음 순서로 연속된 메모리에 쌓는다.
+//   1) 객체 안의 작은 인라인 버퍼 (Inline 개) - 원소가 적으면 힙을 쓰지 않는다
+//   2) ChunkSize 개짜리 청크 - 청크는 ChunkPool 의 슬랩(arena)에서 잘라 쓰고
+//      반납된 청크는 자유 리스트에 보관했다가 다시 준다
+// pop 으로 청크가 비어도 하나는 여분으로 남겨 두어 경계에서 push/pop 이 반복될 때
+// 청크를 계속 주고받지 않는다.
+
+#ifndef POOL_STACK_H
+#define POOL_STACK_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+// 같은 크기의 청크를 나눠 주는 풀 (스레드 하나에서만 사용)
+template <size_t Bytes, size_t SlabChunks = 16>
+class ChunkPool
+{
+public:
+    // 일부러 해제하지 않는다: 함수 안 static 이면 종료할 때 먼저 소멸해서
+    // 전역/static PoolStack 의 소멸자가 지워진 풀에 청크를 돌려주게 된다
+    static ChunkPool &instance()
+    {
+        static ChunkPool *pool = new ChunkPool;
+        return *pool;
+    }
+
+    void *acquire()
+    {
+        if (free_ == NULL)
+            grow();
+        FreeChunk *c = free_;
+        free_ = c->next;
+        return c;
+    }
+
+    void release(void *p)
+    {
+        FreeChunk *c = static_cast<FreeChunk *>(p);
+        c->next = free_;
+        free_ = c;
+    }
+
+    ~ChunkPool()
+    {
+        for (size_t i = 0; i < slabs_.size(); i++)
+            std::free(slabs_[i]);
+    }
+
+private:
+    struct FreeChunk
+    {
+        FreeChunk *next;
+    };
+
+    // 청크 간격은 16바이트 배수로 맞춰 자유 리스트 포인터와 원소 정렬을 지킨다
+    static const size_t Stride = (Bytes + 15) / 16 * 16;
+
+    // 슬랩 하나를 할당해서 청크 SlabChunks 개를 자유 리스트에 넣는다
+    void grow()
+    {
+        char *slab = static_cast<char *>(std::malloc(Stride * SlabChunks));
+        if (slab == NULL)
+            throw std::bad_alloc();
+        slabs_.push_back(slab);
+        for (size_t i = SlabChunks; i > 0; i--)
+            release(slab + (i - 1) * Stride);
+    }
+
+    ChunkPool() : free_(NULL) {}
+    ChunkPool(const ChunkPool &);
+    ChunkPool &operator=(const ChunkPool &);
+
+    FreeChunk *free_;
+    std::vector<char *> slabs_;
+};
+
+template <typename T, size_t Inline = 16, size_t ChunkSize = 4096>
+class PoolStack
+{
+    static_assert(Inline > 0 && ChunkSize > 0, "Inline, ChunkSize 는 1 이상");
+    static_assert(sizeof(T) * ChunkSize >= sizeof(void *), "청크가 포인터보다 작음");
+
+    typedef ChunkPool<sizeof(T) * ChunkSize> Pool;
+
+public:
+    PoolStack()
+        : seg_(0), size_(0)
+    {
+        begin_ = top_ = inline_data();
+        end_ = begin_ + Inline;
+    }
+
+    ~PoolStack()
+    {
+        clear();
+        for (size_t i = 0; i < chunks_.size(); i++)
+            Pool::instance().release(chunks_[i]);
+    }
+
+    // 원소는 복사하지 않고 이동으로만 넣는다
+    void push(T &&value)
+    {
+        if (top_ == end_)
+            next_segment();
+        new (top_) T(std::move(value));
+        ++top_;
+        ++size_;
+    }
+
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        if (top_ == end_)
+            next_segment();
+        T *p = new (top_) T(std::forward<Args>(args)...);
+        ++top_;
+        ++size_;
+        return *p;
+    }
+
+    // 비어 있을 때 호출하면 안 된다
+    void pop()
+    {
+        --top_;
+        top_->~T();
+        --size_;
+        if (top_ == begin_ && seg_ > 0)
+            prev_segment();
+    }
+
+    T &top() { return top_[-1]; }
+    const T &top() const { return top_[-1]; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // n 개까지는 push 중에 풀에서 청크를 받지 않도록 미리 확보
+    void reserve(size_t n)
+    {
+        if (n <= Inline)
+            return;
+        size_t need = (n - Inline + ChunkSize - 1) / ChunkSize;
+        chunks_.reserve(need);
+        while (chunks_.size() < need)
+            chunks_.push_back(static_cast<T *>(Pool::instance().acquire()));
+    }
+
+    void clear()
+    {
+        while (size_ > 0)
+            pop();
+    }
+
+    // 위(top)에서 아래 방향으로 원소마다 f(원소) 호출
+    template <typename F>
+    void for_each(F f) const
+    {
+        size_t seg = seg_;
+        const T *p = top_;
+        const T *begin = begin_;
+        for (;;)
+        {
+            while (p != begin)
+                f(*--p);
+            if (seg == 0)
+                break;
+            seg--;
+            begin = seg == 0 ? inline_data() : chunks_[seg - 1];
+            p = begin + (seg == 0 ? Inline : ChunkSize);
+        }
+    }
+
+private:
+    PoolStack(const PoolStack &);
+    PoolStack &operator=(const PoolStack &);
+
+    T *inline_data() { return reinterpret_cast<T *>(inline_); }
+    const T *inline_data() const { return reinterpret_cast<const T *>(inline_); }
+
+    // 현재 구간이 가득 찼을 때 다음 청크로 이동 (없으면 풀에서 받는다)
+    void next_segment()
+    {
+        if (seg_ == chunks_.size())
+            chunks_.push_back(static_cast<T *>(Pool::instance().acquire()));
+        begin_ = top_ = chunks_[seg_];
+        end_ = begin_ + ChunkSize;
+        seg_++;
+    }
+
+    // 현재 청크가 비었을 때 이전 구간으로 돌아간다 (빈 청크 하나만 여분으로 남김)
+    void prev_segment()
+    {
+        while (chunks_.size() > seg_)
+        {
+            Pool::instance().release(chunks_.back());
+            chunks_.pop_back();
+        }
+        seg_--;
+        begin_ = seg_ == 0 ? inline_data() : chunks_[seg_ - 1];
+        end_ = top_ = begin_ + (seg_ == 0 ? Inline : ChunkSize);
+    }
+
+    alignas(T) unsigned char inline_[sizeof(T) * Inline];
+    std::vector<T *> chunks_; // chunks_[k] 가 구간 k+1
+    T *begin_, *top_, *end_;  // 현재 구간의 시작, 다음 원소 위치, 끝
+    size_t seg_;              // 현재 구간 (0: 인라인 버퍼)
+    size_t size_;
+};
+
+#endif
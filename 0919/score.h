@@ -0,0 +1,249 @@
+// 악보 파일(.song) 형식과 스트리밍 읽기
+//
+// 파일 구조 (숫자는 리틀엔디언)
+//   0  "SONG"           매직
+//   4  u8  버전 (1)
+//   5  u8  트랙 수 (1 ~ SCORE_MAX_TRACKS)
+//   6  u16 기본 템포 (BPM)
+//   8  u16 한 박자의 틱 수
+//  10  u16 예약 (0)
+//  12  트랙 표: 트랙마다 u32 시작 위치, u32 바이트 길이
+//  ..  이벤트: 2바이트 [코드, 길이(틱)]
+//      코드 0~127 : 음 번호 (note_table.h 의 MIDI 번호, 옥타브 포함)
+//      코드 0x80  : 쉼표
+//      코드 0x81  : 템포 변경 (두 번째 바이트가 새 BPM, 1 ~ 255. 기본 템포는 u16 이라 더 클 수 있다)
+//
+// 파일은 통째로 읽지 않고 메모리 매핑해서 커서로 이벤트를 하나씩 꺼낸다.
+// 해석할 것이 헤더뿐이라 시작 비용이 없고, 실제로 읽는 페이지만 디스크에서 올라온다.
+
+#ifndef SCORE_H
+#define SCORE_H
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define SCORE_VERSION 1
+#define SCORE_MAX_TRACKS 16
+#define SCORE_HEADER 12
+#define SCORE_REST 0x80
+#define SCORE_TEMPO 0x81
+
+struct score
+{
+    const unsigned char *data;
+    size_t size;
+    int tracks;
+    int tempo;
+    int ticks;
+    int mapped; // 1이면 score_close 에서 매핑 해제
+#ifdef _WIN32
+    HANDLE file, map;
+#endif
+};
+
+struct score_cursor
+{
+    const unsigned char *p, *end;
+    int tempo;
+    int ticks;
+};
+
+struct score_event
+{
+    int note; // 음 번호, 쉼표는 -1
+    int ms;   // 길이 (밀리초)
+};
+
+static inline unsigned int score_u16(const unsigned char *p)
+{
+    return p[0] | p[1] << 8;
+}
+
+static inline unsigned int score_u32(const unsigned char *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24;
+}
+
+// 메모리에 있는 악보의 헤더와 트랙 표 검사 (0: 성공, -1: 잘못된 형식)
+static inline int score_from_memory(struct score *s, const unsigned char *data, size_t size)
+{
+    int i;
+    s->data = data;
+    s->size = size;
+    s->mapped = 0;
+    if (size < SCORE_HEADER || memcmp(data, "SONG", 4) != 0 || data[4] != SCORE_VERSION)
+        return -1;
+    s->tracks = data[5];
+    s->tempo = score_u16(data + 6);
+    s->ticks = score_u16(data + 8);
+    if (s->tracks < 1 || s->tracks > SCORE_MAX_TRACKS || s->tempo == 0 || s->ticks == 0)
+        return -1;
+    if (size < SCORE_HEADER + 8 * (size_t)s->tracks)
+        return -1;
+    for (i = 0; i < s->tracks; i++)
+    {
+        size_t offset = score_u32(data + SCORE_HEADER + 8 * i);
+        size_t length = score_u32(data + SCORE_HEADER + 8 * i + 4);
+        if (offset > size || length > size - offset)
+            return -1;
+    }
+    return 0;
+}
+
+static inline void score_close(struct score *s)
+{
+    if (!s->mapped)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(s->data);
+    CloseHandle(s->map);
+    CloseHandle(s->file);
+#else
+    munmap((void *)s->data, s->size);
+#endif
+    s->mapped = 0;
+}
+
+// 악보 파일을 메모리 매핑으로 연다 (0: 성공, -1: 실패)
+static inline int score_open(struct score *s, const char *path)
+{
+    const unsigned char *data;
+    size_t size;
+#ifdef _WIN32
+    LARGE_INTEGER length;
+    s->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                          FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (s->file == INVALID_HANDLE_VALUE)
+        return -1;
+    if (!GetFileSizeEx(s->file, &length) || length.QuadPart == 0)
+    {
+        CloseHandle(s->file);
+        return -1;
+    }
+    s->map = CreateFileMappingA(s->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (s->map == NULL)
+    {
+        CloseHandle(s->file);
+        return -1;
+    }
+    data = (const unsigned char *)MapViewOfFile(s->map, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL)
+    {
+        CloseHandle(s->map);
+        CloseHandle(s->file);
+        return -1;
+    }
+    size = (size_t)length.QuadPart;
+#else
+    struct stat st;
+    void *p;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return -1;
+    }
+    size = (size_t)st.st_size;
+    p = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // 매핑은 파일을 닫아도 유지된다
+    if (p == MAP_FAILED)
+        return -1;
+    madvise(p, size, MADV_SEQUENTIAL);
+    data = (const unsigned char *)p;
+#endif
+    if (score_from_memory(s, data, size) != 0)
+    {
+        s->mapped = 1;
+        score_close(s);
+        return -1;
+    }
+    s->mapped = 1;
+    return 0;
+}
+
+// track 번째 트랙의 처음을 가리키는 커서 준비 (0: 성공, -1: 없는 트랙)
+static inline int score_track(const struct score *s, int track, struct score_cursor *c)
+{
+    const unsigned char *entry;
+    if (track < 0 || track >= s->tracks)
+        return -1;
+    entry = s->data + SCORE_HEADER + 8 * track;
+    c->p = s->data + score_u32(entry);
+    c->end = c->p + score_u32(entry + 4);
+    c->tempo = s->tempo;
+    c->ticks = s->ticks;
+    return 0;
+}
+
+// 다음 음/쉼표를 꺼낸다 (1: 이벤트 있음, 0: 트랙 끝)
+static inline int score_next(struct score_cursor *c, struct score_event *ev)
+{
+    while (c->end - c->p >= 2)
+    {
+        int code = c->p[0], length = c->p[1];
+        c->p += 2;
+        if (code == SCORE_TEMPO)
+        {
+            if (length > 0)
+                c->tempo = length;
+            continue;
+        }
+        if (code > SCORE_REST) // 모르는 코드는 건너뛴다
+            continue;
+        ev->note = code == SCORE_REST ? -1 : code;
+        ev->ms = (int)(length * 60000LL / ((long long)c->tempo * c->ticks)); // 템포 x 틱은 int 를 넘을 수 있다
+        return 1;
+    }
+    return 0;
+}
+
+// 트랙별 이벤트 바이트열을 악보 파일로 저장 (0: 성공, -1: 실패)
+static inline int score_save(const char *path, int tempo, int ticks,
+                             const unsigned char *track[], const int length[], int count)
+{
+    unsigned char head[SCORE_HEADER + 8 * SCORE_MAX_TRACKS];
+    unsigned int offset = SCORE_HEADER + 8 * count;
+    FILE *fp;
+    int i, j;
+
+    if (count < 1 || count > SCORE_MAX_TRACKS)
+        return -1;
+    memcpy(head, "SONG", 4);
+    head[4] = SCORE_VERSION;
+    head[5] = (unsigned char)count;
+    head[6] = tempo & 0xff;
+    head[7] = tempo >> 8 & 0xff;
+    head[8] = ticks & 0xff;
+    head[9] = ticks >> 8 & 0xff;
+    head[10] = head[11] = 0;
+    for (i = 0; i < count; i++)
+    {
+        unsigned int v[2];
+        v[0] = offset;
+        v[1] = length[i];
+        for (j = 0; j < 8; j++)
+            head[SCORE_HEADER + 8 * i + j] = v[j / 4] >> (j % 4 * 8) & 0xff;
+        offset += length[i];
+    }
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+        return -1;
+    fwrite(head, 1, SCORE_HEADER + 8 * count, fp);
+    for (i = 0; i < count; i++)
+        fwrite(track[i], 1, length[i], fp);
+    return fclose(fp) == 0 ? 0 : -1;
+}
+
+#endif
@@ -1,128 +1,44 @@
 #include <stdio.h>
-void number_check(int k, int i);
-void digit_print(int dim[], int line);
-int zero[20] =
-    {1, 1, 1, 1,
-     1, 0, 0, 1,
-     1, 0, 0, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1};
-int one[20] =
-    {0, 0, 1, 0,
-     0, 0, 1, 0,
-     0, 0, 1, 0,
-     0, 0, 1, 0,
-     0, 0, 1, 0};
-int two[20] =
-    {1, 1, 1, 1,
-     0, 0, 0, 1,
-     1, 1, 1, 1,
-     1, 0, 0, 0,
-     1, 1, 1, 1};
-int three[20] =
-    {1, 1, 1, 1,
-     0, 0, 0, 1,
-     1, 1, 1, 1,
-     0, 0, 0, 1,
-     1, 1, 1, 1};
-int four[20] =
-    {1, 0, 0, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1,
-     0, 0, 0, 1,
-     0, 0, 0, 1};
-int five[20] =
-    {1, 1, 1, 1,
-     1, 0, 0, 0,
-     1, 1, 1, 1,
-     0, 0, 0, 1,
-     1, 1, 1, 1};
-int six[20] =
-    {1, 0, 0, 0,
-     1, 0, 0, 0,
-     1, 1, 1, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1};
-int seven[20] =
-    {1, 1, 1, 1,
-     0, 0, 0, 1,
-     0, 0, 0, 1,
-     0, 0, 0, 1,
-     0, 0, 0, 1};
-int eight[20] =
-    {1, 1, 1, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1};
-int nine[20] =
-    {1, 1, 1, 1,
-     1, 0, 0, 1,
-     1, 1, 1, 1,
-     0, 0, 0, 1,
-     0, 0, 0, 1};
+#include <stdlib.h>
+#include "digit_render.h"
+
+// 숫자 모양은 digit_render.h 의 20비트 마스크(digit_mask)에 들어 있다.
+// 입력은 문자열로 받으므로 int 범위를 넘는 긴 숫자와 0 도 출력할 수 있다.
+
+#define INPUT_MAX 1024
+
 int main(void)
 {
-    int num, line;
+    static struct digit_font font;
+    char input[INPUT_MAX + 1];
+    unsigned char digit[INPUT_MAX];
+    size_t count, cap;
+    long len;
+    char *buf;
+
+    digit_font_init(&font, "■", "  ");
+
     printf("디지털 숫자 출력 프로그램\n");
-    printf("1 이상의 정수만 입력합니다. \n\n");
+    printf("0 이상의 정수를 입력합니다. (최대 %d 자리)\n\n", INPUT_MAX);
     printf("\n정수 숫자입력 후 Enter> ");
-    scanf("%d", &num);
-    printf("\n\n");
-    for (line = 0; line <= 4; line++)
+    if (scanf("%1024s", input) != 1)
+        return 1;
+    count = digit_split(input, digit);
+    if (count == 0)
     {
-        number_check(num, line);
-        printf("\n");
+        printf("숫자가 없습니다.\n");
+        return 1;
     }
+    printf("\n\n");
+
+    // 5행 전체를 버퍼 하나에 그린 뒤 한 번에 출력
+    cap = digit_render_size(&font, count, 0);
+    buf = (char *)malloc(cap);
+    if (buf == NULL)
+        return 1;
+    len = digit_render(&font, digit, count, 0, 0, buf, cap);
+    if (len > 0)
+        fwrite(buf, 1, (size_t)len, stdout);
+    free(buf);
     return 0;
 }
-void digit_print(int dim[], int line)
-{
-    int i;
-    for (i = line * 4; i <= line * 4 + 3; i++)
-        if (dim[i] == 1)
-            printf("■");
-        else
-            printf(" ");
-    printf(" ");
-}
-void number_check(int k, int i)
-{
-    if (k >= 1)
-    {
-        number_check(k / 10, i);
-        switch (k % 10)
-        {
-        case 0:
-            digit_print(zero, i);
-            break;
-        case 1:
-            digit_print(one, i);
-            break;
-        case 2:
-            digit_print(two, i);
-            break;
-        case 3:
-            digit_print(three, i);
-            break;
-        case 4:
-            digit_print(four, i);
-            break;
-        case 5:
-            digit_print(five, i);
-            break;
-        case 6:
-            digit_print(six, i);
-            break;
-        case 7:
-            digit_print(seven, i);
-            break;
-        case 8:
-            digit_print(eight, i);
-            break;
-        case 9:
-            digit_print(nine, i);
-            break;
-        }
-    }
-}
\ No newline at end of file
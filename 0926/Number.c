@@ -1,18 +1,21 @@
 #include <stdio.h>
 #include <string.h>
 #include <conio.h>
-#include <math.h>
+#include "num_format.h"
+void char_serial_number(char *number);
+void char_reverse_number(char *number);
 void serial_number(long number);
 void reverse_number(long number);
 void rec_serial_number(long number);
 void rec_reverse_number(long number);
+void print_digit(int digit, int index, void *ctx);
 
 int main(void)
 {
     char str[20];
     long number;
     printf("문자열을 입력하세요: ");
-    scanf("%s", str);
+    scanf("%19s", str);
     char_serial_number(str);
     char_reverse_number(str);
     printf("정수를 입력하세요: ");
@@ -43,46 +46,47 @@ void char_reverse_number(char *number)
     printf("\n");
 }
 
-// 정수형 정순으로
+// 정수형 정순으로 (log10/pow 대신 num_format.h 로 한 번에 변환, 0 과 음수도 처리)
 void serial_number(long number)
 {
-    int num;
-    int i, length = 0;
-    length = (int)(log10(number) + 1); // 최대 자리수 계산
-    for (i = length; i >= 1; i--)
-    {
-        num = number / (long)pow(10, i - 1);
-        printf("%ld\n", num);
-        number = number - num * (long)pow(10, i - 1);
-    }
+    char text[NUM_FORMAT_MAX];
+    int i, length;
+    length = num_format_i64(text, number);
+    for (i = 0; i < length; i++)
+        printf("%c\n", text[i]);
     printf("\n");
 }
 // 정수형 역순으로
 void reverse_number(long number)
 {
-    while (number > 0)
-    {
-        printf("%ld\n", number % 10);
-        number /= 10;
-    }
+    char text[NUM_FORMAT_MAX];
+    int i, length;
+    length = num_reverse_i64(text, number);
+    for (i = 0; i < length; i++)
+        printf("%c\n", text[i]);
+    printf("\n");
 }
-// 재귀함수 정순으로
+
+// 자리마다 불리는 콜백
+void print_digit(int digit, int index, void *ctx)
+{
+    (void)index;
+    (void)ctx;
+    printf("%c\n", '0' + digit);
+}
+// 재귀 대신 자리별 콜백으로 정순
 void rec_serial_number(long number)
 {
-    if (number > 0)
-    {
-        serial_number(number / 10);
-        printf("%ld\n", number % 10);
-    }
-    else
-        return;
+    if (number < 0)
+        printf("-\n");
+    num_each_digit(number < 0 ? 0 - (unsigned long)number : (unsigned long)number, 0, print_digit, NULL);
+    printf("\n");
 }
-// 재귀함수 역순으로
+// 재귀 대신 자리별 콜백으로 역순
 void rec_reverse_number(long number)
 {
-    printf("%ld\n", number % 10);
-    if ((number / 10) > 0)
-        reverse_number(number / 10);
-    else
-        return;
-}
\ No newline at end of file
+    if (number < 0)
+        printf("-\n");
+    num_each_digit(number < 0 ? 0 - (unsigned long)number : (unsigned long)number, 1, print_digit, NULL);
+    printf("\n");
+}
@@ -0,0 +1,212 @@
+// 정수 -> 문자열 변환 속도 비교
+//
+//   printf("%ld")    : 실제 출력 (널 장치로)
+//   sprintf("%ld")   : 같은 형식을 버퍼로
+//   log10/pow        : Number.c 의 예전 serial_number 방식 (버퍼로)
+//   recursive        : 예전 rec_serial_number 방식 (버퍼로)
+//   num_format       : num_format.h
+//
+// 컴파일 예: gcc -O2 NumberBench.c -o NumberBench -lm
+// 실행 예:   NumberBench 10000000   (값 개수, 기본 5000000)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include "num_format.h"
+
+#ifdef _WIN32
+#define NULL_DEVICE "NUL"
+#else
+#define NULL_DEVICE "/dev/null"
+#endif
+
+double now_sec(void);
+int old_serial(char *out, long number);
+int old_recursive_step(char *out, long number);
+int old_recursive(char *out, long number);
+void collect_digit(int digit, int index, void *ctx);
+int self_check(void);
+void bench(const char *name, int (*fn)(char *, long), const long *values, long n);
+int by_sprintf(char *out, long number);
+int by_num_format(char *out, long number);
+
+unsigned long long checksum;
+
+int main(int argc, char *argv[])
+{
+    long n = argc > 1 ? atol(argv[1]) : 5000000, i;
+    long *values;
+    uint64_t s = 88172645463325252ULL;
+    FILE *sink;
+    double t;
+
+    if (!self_check())
+        return 1;
+
+    values = (long *)malloc(sizeof(long) * n);
+    if (values == NULL)
+        return 1;
+    // 자리 수가 고르게 섞이도록 1~10자리(양수) 값
+    for (i = 0; i < n; i++)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        values[i] = 1 + (long)((s >> 8) % (num_pow10[1 + s % 10] - 1));
+    }
+
+    printf("값 %ld 개\n", n);
+    sink = fopen(NULL_DEVICE, "w");
+    if (sink != NULL)
+    {
+        t = now_sec();
+        for (i = 0; i < n; i++)
+            fprintf(sink, "%ld", values[i]);
+        t = now_sec() - t;
+        printf("%-14s %8.2f ns/값\n", "printf(%ld)", t * 1e9 / n);
+        fclose(sink);
+    }
+    bench("sprintf(%ld)", by_sprintf, values, n);
+    bench("log10/pow", old_serial, values, n);
+    bench("recursive", old_recursive, values, n);
+    bench("num_format", by_num_format, values, n);
+    printf("(checksum %llu)\n", checksum);
+    free(values);
+    return 0;
+}
+
+double now_sec(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+void bench(const char *name, int (*fn)(char *, long), const long *values, long n)
+{
+    char text[64];
+    long i;
+    double t = now_sec();
+    for (i = 0; i < n; i++)
+        checksum += fn(text, values[i]) + text[0];
+    t = now_sec() - t;
+    printf("%-14s %8.2f ns/값\n", name, t * 1e9 / n);
+}
+
+int by_sprintf(char *out, long number)
+{
+    return sprintf(out, "%ld", number);
+}
+
+int by_num_format(char *out, long number)
+{
+    return num_format_i64(out, number);
+}
+
+// 예전 serial_number 를 버퍼에 쓰도록 옮긴 것 (0, 음수는 원래처럼 틀린다)
+int old_serial(char *out, long number)
+{
+    int num, i, length, n = 0;
+    length = (int)(log10(number) + 1);
+    for (i = length; i >= 1; i--)
+    {
+        num = number / (long)pow(10, i - 1);
+        out[n++] = (char)('0' + num);
+        number = number - num * (long)pow(10, i - 1);
+    }
+    out[n] = '\0';
+    return n;
+}
+
+int old_recursive_step(char *out, long number)
+{
+    int n = 0;
+    if (number > 0)
+    {
+        n = old_recursive_step(out, number / 10);
+        out[n++] = (char)('0' + number % 10);
+    }
+    return n;
+}
+
+int old_recursive(char *out, long number)
+{
+    int n = old_recursive_step(out, number);
+    out[n] = '\0';
+    return n;
+}
+
+void collect_digit(int digit, int index, void *ctx)
+{
+    ((char *)ctx)[index] = (char)('0' + digit);
+}
+
+// num_format 결과를 sprintf 와 비교
+int self_check(void)
+{
+    char a[64], b[64], c[64];
+    int k, n, i, fail = 0;
+    long long j;
+    uint64_t s = 12345;
+
+    for (k = 0; k < 2000000 && !fail; k++)
+    {
+        uint64_t u;
+        int64_t v;
+        if (k < 20)
+            u = num_pow10[k];
+        else if (k < 40)
+            u = num_pow10[k - 20] - 1;
+        else if (k < 60)
+            u = num_pow10[k - 40] + 1;
+        else
+        {
+            s ^= s << 13;
+            s ^= s >> 7;
+            s ^= s << 17;
+            u = s >> (s & 63);
+        }
+        v = (int64_t)u;
+
+        n = num_format_u64(a, u);
+        sprintf(b, "%llu", (unsigned long long)u);
+        fail |= strcmp(a, b) != 0 || n != (int)strlen(b) || num_count_u64(u) != n;
+
+        n = num_format_i64(a, v);
+        sprintf(b, "%lld", (long long)v);
+        fail |= strcmp(a, b) != 0 || n != (int)strlen(b);
+
+        n = num_format_i32(a, (int32_t)u);
+        sprintf(b, "%d", (int)(int32_t)u);
+        fail |= strcmp(a, b) != 0 || n != (int)strlen(b);
+
+        n = num_format_u32(a, (uint32_t)u);
+        sprintf(b, "%u", (unsigned)(uint32_t)u);
+        fail |= strcmp(a, b) != 0 || n != (int)strlen(b);
+
+        // 역순, 콜백
+        n = num_reverse_u64(a, u);
+        num_format_u64(b, u);
+        for (i = 0; i < n; i++)
+            fail |= a[i] != b[n - 1 - i];
+        memset(c, 0, sizeof(c));
+        fail |= num_each_digit(u, 0, collect_digit, c) != n || strcmp(b, c) != 0;
+        if (fail)
+            printf("틀림: %llu -> %s / %s\n", (unsigned long long)u, a, b);
+    }
+    // 끝 값들
+    for (j = 0; j < 4 && !fail; j++)
+    {
+        static const long long edge[4] = {0, -1, LLONG_MIN, LLONG_MAX};
+        num_format_i64(a, edge[j]);
+        sprintf(b, "%lld", edge[j]);
+        fail |= strcmp(a, b) != 0;
+    }
+    num_format_i32(a, INT_MIN);
+    sprintf(b, "%d", INT_MIN);
+    fail |= strcmp(a, b) != 0;
+    printf("자체 검사: %s\n", fail ? "실패" : "통과");
+    return !fail;
+}
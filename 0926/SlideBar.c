@@ -1,16 +1,16 @@
 #include <stdio.h>
-#include <stdlib.h>
-#include <conio.h>
-#include <windows.h>
-void draw_horizontal_slide(int x, int y, int length, char *s);
-void draw_vertical_slide(int x, int y, int length, char *s);
-void draw_rectangle(int c, int r);
-void move_arrow_key(char key, int *x1, int *y1, int x_b, int y_b);
-void gotoxy(int x, int y);
+#include "console_ui.h"
+#include "../0912/move.h"
 int main(void)
 {
-    char *slide = "■", key;
-    int x = 1, y = 1;
+    // 화면 위젯: 한 번 만들어 두고 값이 바뀐 것만 다시 그린다
+    static struct ui_widget screen, v_slide, v_value, h_slide, h_value;
+    char *slide = "■";
+    struct key_input input;
+    struct key_event ev[64];
+    struct mover knob; // 손잡이 위치: x = 수평, y = 수직
+    struct move_result r;
+    int i, n, done = 0;
     int h_slide_length, v_slide_length;
     printf("슬라이드바 표시\n\n");
     printf("수평 슬라이드바의 길이(최대 70)를 \n");
@@ -19,96 +19,40 @@ int main(void)
     printf("수직 슬라이드바의 길이(최대 19)를 \n");
     printf("입력하고 Enter>");
     scanf("%d", &v_slide_length);
-    system("cls");
-    do
-    {
-        draw_vertical_slide(1, y, v_slide_length, slide);
-        draw_horizontal_slide(x, v_slide_length + 3, h_slide_length, slide);
-        key = getch();
-        move_arrow_key(key, &x, &y, h_slide_length, v_slide_length);
-    } while (key != 27);
-    return 0;
-}
-
-void draw_rectangle(int c, int r)
-{
-    int i, j;
-    unsigned char a = 0xa6;
-    unsigned char b[7];
-    for (i = 1; i < 7; i++)
-        b[i] = 0xa0 + i;
-    printf("%c%c", a, b[3]);
-    for (i = 0; i < c; i++)
-        printf("%c%c", a, b[1]);
-    printf("%c%c", a, b[4]);
-    printf("\n");
-    for (i = 0; i < r; i++)
-    {
-        printf("%c%c", a, b[2]);
-        for (j = 0; j < c; j++)
-            printf(" ");
-        printf("%c%c", a, b[2]);
-        printf("\n");
-    }
-    printf("%c%c", a, b[6]);
-    for (i = 0; i < c; i++)
-        printf("%c%c", a, b[1]);
-    printf("%c%c", a, b[5]);
-    printf("\n");
-}
-
-void draw_horizontal_slide(int x, int y, int length, char *s)
-{
-    int real_length = length / 2;
-    gotoxy(1, y);
-    draw_rectangle(real_length + 1, 1);
-    gotoxy(x + 2, y + 1);
-    printf("%s", s);
-    gotoxy(real_length * 2 + 2, y - 1);
-    printf("%2d", x);
-}
-
-void draw_vertical_slide(int x, int y, int length, char *s)
-{
-    gotoxy(x, 1);
-    draw_rectangle(1, length);
-    gotoxy(x + 2, y + 1);
-    printf("%s", s);
-    gotoxy(x + 6, length + 1);
-    printf("%2d", y);
-}
+    term_clear();
 
-void move_arrow_key(char key, int *x1, int *y1, int x_b, int y_b)
-{
-    switch (key)
+    ui_init();
+    ui_panel_init(&screen, 1, 1);
+    ui_slider_init(&v_slide, 0, 0, 1, 1, v_slide_length, slide);
+    ui_label_init(&v_value, 6, v_slide_length, 2, "");
+    ui_slider_init(&h_slide, 0, v_slide_length + 2, 0, 1, h_slide_length, slide);
+    ui_label_init(&h_value, h_slide_length / 2 * 2 + 1, v_slide_length + 1, 2, "");
+    ui_add(&screen, &v_slide);
+    ui_add(&screen, &v_value);
+    ui_add(&screen, &h_slide);
+    ui_add(&screen, &h_value);
+    ui_slider_bind(&v_slide, &v_value);
+    ui_slider_bind(&h_slide, &h_value);
+    key_open(&input);
+    mover_init(&knob, 1, 1, 1, 1, h_slide_length, v_slide_length);
+    while (!done)
     {
-    case 72: // 위쪽(상) 방향의 화살표 키 입력
-        *y1 = *y1 - 1;
-        if (*y1 < 1)
-            *y1 = 1; // y좌표의 최소값
-        break;
-    case 75: // 왼쪽(좌) 방향의 화살표 키 입력
-        *x1 = *x1 - 1;
-        if (*x1 < 1)
-            *x1 = 1; // x좌표의 최소값
-        break;
-    case 77: // 오른쪽(우) 방향의 화살표 키 입력
-        *x1 = *x1 + 1;
-        if (*x1 > x_b)
-            *x1 = x_b; // x좌표의 최대값
-        break;
-    case 80: // 아래쪽(하) 방향의 화살표 키 입력
-        *y1 = *y1 + 1;
-        if (*y1 > y_b)
-            *y1 = y_b; // y좌표의 최대값
-        break;
-    default:
-        return;
+        ui_set_value(&v_slide, knob.y);
+        ui_set_value(&h_slide, knob.x);
+        ui_paint(&screen); // 처음에는 전부, 그 다음부터는 움직인 손잡이와 숫자만
+        // 방향키를 누르고 있으면 다음 자동 이동 시각까지만 기다린다 (0912/move.h)
+        n = key_wait(&input, ev, 64, mover_wait_ms(&knob, key_now_us()));
+        if (n < 0)
+            break;
+        for (i = 0; i < n; i++)
+        {
+            if (ev[i].key == KEY_ESC)
+                done = 1;
+            else
+                mover_key(&knob, &ev[i], &r);
+        }
+        mover_update(&knob, key_now_us(), &r);
     }
+    key_close(&input);
+    return 0;
 }
-
-void gotoxy(int x, int y)
-{
-    COORD Pos = {x - 1, y - 1};
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), Pos);
-}
\ No newline at end of file
@@ -1,12 +1,14 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include <conio.h>
 #include <windows.h>
 #include <time.h>
+#include "num_format.h"
+#include "../0912/move.h"
 
 #define BOARD_WIDTH 12
 #define BOARD_HEIGHT 22
 #define SHAPE_SIZE 4
+#define FALL_US 1000000 // 자동 낙하 간격 (마이크로초)
 
 // 게임 보드
 int board[BOARD_HEIGHT][BOARD_WIDTH];
@@ -35,6 +37,10 @@ int current_x = 4, current_y = 0;
 int score = 0, prev_score = -1;
 int lines_cleared = 0, prev_lines = -1;
 
+// 키보드
+struct key_input input;
+struct mover shift; // 좌우 이동: 누르고 있으면 DAS/ARR 로 빨라진다 (0912/move.h)
+
 // 함수 선언
 void gotoxy(int x, int y);
 void hide_cursor();
@@ -48,7 +54,7 @@ void place_block();
 int clear_lines();
 void new_block();
 void game_over();
-int kbhit_timeout();
+int shift_to(int x);
 
 int main(void)
 {
@@ -61,15 +67,20 @@ int main(void)
     print_board();
     print_info();
 
-    int fall_time = 0;
-    char key;
+    struct key_event ev[64];
+    uint64_t next_fall = key_now_us() + FALL_US, now;
+    struct move_result r;
+    int i, n, wait, shift_wait;
 
+    key_open(&input);
+    mover_init(&shift, current_x, 0, -SHAPE_SIZE, 0, BOARD_WIDTH, 0);
     while (1)
     {
         int need_refresh = 0;
 
         // 자동 낙하
-        if (fall_time++ > 10) // 약 1초마다 낙하
+        now = key_now_us();
+        if (now >= next_fall) // 약 1초마다 낙하
         {
             if (!check_collision(0, 1, current_shape))
             {
@@ -84,50 +95,46 @@ int main(void)
                     lines_cleared++;
                 }
                 new_block();
+                mover_set(&shift, current_x, 0);
                 if (check_collision(0, 0, current_shape))
                 {
                     game_over();
                     break;
                 }
             }
-            fall_time = 0;
+            next_fall = now + FALL_US;
             need_refresh = 1;
         }
 
-        // 키 입력 처리
-        if (kbhit())
+        // 키 입력 처리: 다음 낙하 시각까지 잠들어 있다가 키가 들어오면 바로 깨어난다
+        wait = (int)((next_fall - now + 999) / 1000);
+        shift_wait = mover_wait_ms(&shift, now);
+        if (shift_wait >= 0 && shift_wait < wait)
+            wait = shift_wait; // 좌우 자동 이동이 먼저
+        n = key_wait(&input, ev, 64, wait);
+        for (i = 0; i < n; i++)
         {
-            key = getch();
-            switch (key)
+            switch (ev[i].key)
             {
-            case 27: // ESC
+            case KEY_ESC:
                 goto game_end;
-            case 72: // 위쪽 화살표 (회전)
+            case KEY_UP: // 위쪽 화살표 (회전)
                 rotation_right();
                 need_refresh = 1;
                 break;
-            case 75: // 왼쪽 화살표
-                if (!check_collision(-1, 0, current_shape))
-                {
-                    current_x--;
-                    need_refresh = 1;
-                }
-                break;
-            case 77: // 오른쪽 화살표
-                if (!check_collision(1, 0, current_shape))
-                {
-                    current_x++;
-                    need_refresh = 1;
-                }
+            case KEY_LEFT: // 왼쪽 화살표
+            case KEY_RIGHT: // 오른쪽 화살표
+                mover_key(&shift, &ev[i], &r);
+                need_refresh |= shift_to(r.x);
                 break;
-            case 80: // 아래쪽 화살표 (빠른 낙하)
+            case KEY_DOWN: // 아래쪽 화살표 (빠른 낙하)
                 if (!check_collision(0, 1, current_shape))
                 {
                     current_y++;
                     need_refresh = 1;
                 }
                 break;
-            case 32: // 스페이스바 (한번에 떨어뜨리기)
+            case KEY_SPACE: // 스페이스바 (한번에 떨어뜨리기)
                 while (!check_collision(0, 1, current_shape))
                     current_y++;
                 need_refresh = 1;
@@ -135,17 +142,20 @@ int main(void)
             }
         }
 
+        // 좌우 키를 누르고 있는 동안의 자동 이동
+        if (mover_update(&shift, key_now_us(), &r))
+            need_refresh |= shift_to(r.x);
+
         // 화면 갱신이 필요할 때만 다시 그리기
         if (need_refresh)
         {
             print_board();
             print_info();
         }
-
-        Sleep(100);
     }
 
 game_end:
+    key_close(&input);
     gotoxy(1, BOARD_HEIGHT + 5);
     printf("게임을 종료합니다.\n");
     return 0;
@@ -243,19 +253,23 @@ void print_board()
 
 void print_info()
 {
+    char text[NUM_FORMAT_MAX];
+
     // 점수가 변경되었을 때만 다시 그리기
     if (score != prev_score)
     {
+        num_format_i32(text, score);
         gotoxy(30, 4);
-        printf("점수: %d    ", score); // 공백으로 이전 텍스트 지우기
+        printf("점수: %s    ", text); // 공백으로 이전 텍스트 지우기
         prev_score = score;
     }
 
     // 라인 수가 변경되었을 때만 다시 그리기
     if (lines_cleared != prev_lines)
     {
+        num_format_i32(text, lines_cleared);
         gotoxy(30, 5);
-        printf("라인: %d    ", lines_cleared); // 공백으로 이전 텍스트 지우기
+        printf("라인: %s    ", text); // 공백으로 이전 텍스트 지우기
         prev_lines = lines_cleared;
     }
 
@@ -401,16 +415,28 @@ void new_block()
 
 void game_over()
 {
+    char text[NUM_FORMAT_MAX];
+    struct key_event ev[16];
+
     gotoxy(5, BOARD_HEIGHT / 2);
     printf("게임 오버!");
     gotoxy(5, BOARD_HEIGHT / 2 + 1);
-    printf("최종 점수: %d", score);
+    num_format_i32(text, score);
+    printf("최종 점수: %s", text);
     gotoxy(5, BOARD_HEIGHT / 2 + 2);
     printf("아무 키나 누르세요...");
-    getch();
+    key_wait(&input, ev, 16, -1);
 }
 
-int kbhit_timeout()
+// 좌우 이동: x 까지 한 칸씩 옮기다가 막히면 멈춘다. 움직였으면 1
+int shift_to(int x)
 {
-    return kbhit();
+    int moved = 0, step = x < current_x ? -1 : 1;
+    while (current_x != x && !check_collision(step, 0, current_shape))
+    {
+        current_x += step;
+        moved = 1;
+    }
+    mover_set(&shift, current_x, 0);
+    return moved;
 }
\ No newline at end of file
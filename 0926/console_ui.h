@@ -0,0 +1,371 @@
+// 콘솔 UI 위젯 (상자, 슬라이더, 라벨)
+//
+// SlideBar.c 는 키를 누를 때마다 테두리와 슬라이더 전체를 다시 그리고, 테두리 문자도
+// b[] 에 매번 새로 만든다. 여기서는 위젯을 한 번 만들어 두고(retained) 바뀐 것만 그린다.
+//
+// - 위젯은 트리로 묶는다. 맨 위 위젯의 x, y 는 화면 좌표(1부터), 자식은 부모 왼쪽 위 기준 오프셋(0부터).
+// - 값이나 글자가 실제로 바뀔 때만 더럽힘(dirty) 표시가 붙는다.
+//     UI_DIRTY_VALUE : 슬라이더 손잡이, 라벨 글자만 다시 그림 (슬라이더는 이전 칸만 지우고 새 칸에 그림)
+//     UI_DIRTY_ALL   : 위젯 전체와 자식까지 다시 그림
+// - 테두리 모양 문자는 ui_init 에서 한 번, 상자 한 줄 문자열은 위젯을 만들 때 한 번 만든다.
+// - ui_paint 는 그릴 내용을 버퍼 하나에 모아 한 번에 출력한다. (커서 이동은 ANSI ESC[y;xH)
+// - 위젯을 만들기 전에 ui_init 을 한 번 부른다.
+//
+// 테두리는 SlideBar.c 처럼 완성형(CP949) 선 문자 0xA6A1 ~ 0xA6A6 을 쓴다.
+// UTF-8 터미널에서는 UI_UTF8 을 정의하고 컴파일한다.
+
+#ifndef CONSOLE_UI_H
+#define CONSOLE_UI_H
+
+#include <stdio.h>
+#include <string.h>
+#include "num_format.h"
+#include "../0912/term.h"
+
+#define UI_MAX_COLS 80    // 상자 안쪽 최대 칸 수 (한 칸 = 2글자 폭)
+#define UI_MAX_TEXT 64    // 라벨 최대 바이트 수
+#define UI_BUFFER 65536   // 한 번에 출력할 버퍼 크기
+
+enum ui_kind
+{
+    UI_PANEL, // 아무것도 그리지 않는 묶음 (HUD 패널 등)
+    UI_BOX,
+    UI_SLIDER,
+    UI_LABEL
+};
+
+enum ui_dirty
+{
+    UI_CLEAN,
+    UI_DIRTY_VALUE,
+    UI_DIRTY_ALL
+};
+
+// 테두리 문자 번호 (SlideBar.c 의 b[1] ~ b[6] 순서)
+enum ui_glyph
+{
+    UI_H = 1,  // ─
+    UI_V,      // │
+    UI_TL,     // ┌
+    UI_TR,     // ┐
+    UI_BR,     // ┘
+    UI_BL      // └
+};
+
+struct ui_widget
+{
+    enum ui_kind kind;
+    int x, y;       // 위치 (맨 위는 화면 좌표, 자식은 부모 기준 오프셋)
+    int cols, rows; // 상자 안쪽 칸 수, 줄 수
+    enum ui_dirty dirty;
+
+    // 상자 테두리 (위, 가운데, 아래 한 줄씩 미리 만들어 둔 문자열)
+    char frame[3][UI_MAX_COLS * 2 + 8];
+    int frame_len[3];
+
+    // 슬라이더
+    int vertical, value, min, max, drawn; // drawn: 화면에 그려져 있는 손잡이 값
+    const char *knob;
+    struct ui_widget *value_label; // 값을 숫자로 보여 줄 라벨 (없으면 NULL)
+
+    // 라벨 (width 칸에 오른쪽 정렬, 0 이면 왼쪽 정렬 그대로)
+    char text[UI_MAX_TEXT];
+    int width, drawn_len;
+
+    struct ui_widget *parent, *child, *next;
+};
+
+static char ui_glyph_text[7][4];
+static char ui_out[UI_BUFFER];
+static size_t ui_out_len;
+
+// 테두리 문자를 한 번만 만든다. Windows 콘솔이면 ANSI 커서 이동을 켠다.
+static inline void ui_init(void)
+{
+    int i;
+#ifdef UI_UTF8
+    static const char *utf8[7] = {"", "─", "│", "┌", "┐", "┘", "└"};
+    for (i = 1; i < 7; i++)
+        strcpy(ui_glyph_text[i], utf8[i]);
+#else
+    for (i = 1; i < 7; i++)
+    {
+        ui_glyph_text[i][0] = (char)0xa6;
+        ui_glyph_text[i][1] = (char)(0xa0 + i);
+        ui_glyph_text[i][2] = '\0';
+    }
+#endif
+    term_init();
+}
+
+// ---- 출력 버퍼 ----
+
+static inline void ui_flush(void)
+{
+    if (ui_out_len > 0)
+    {
+        fwrite(ui_out, 1, ui_out_len, stdout);
+        fflush(stdout);
+        ui_out_len = 0;
+    }
+}
+
+static inline void ui_put(const char *s, size_t n)
+{
+    if (ui_out_len + n > sizeof(ui_out))
+        ui_flush();
+    memcpy(ui_out + ui_out_len, s, n);
+    ui_out_len += n;
+}
+
+static inline void ui_goto(int x, int y)
+{
+    char seq[32];
+    int n = 0;
+    seq[n++] = '\x1b';
+    seq[n++] = '[';
+    n += num_format_i32(seq + n, y);
+    seq[n++] = ';';
+    n += num_format_i32(seq + n, x);
+    seq[n++] = 'H';
+    ui_put(seq, n);
+}
+
+// ---- 위젯 만들기 ----
+
+static inline void ui_widget_init(struct ui_widget *w, enum ui_kind kind, int x, int y)
+{
+    memset(w, 0, sizeof(*w));
+    w->kind = kind;
+    w->x = x;
+    w->y = y;
+    w->dirty = UI_DIRTY_ALL;
+}
+
+// 테두리 세 줄을 미리 만든다 (cols 칸 폭, 가운데 줄은 공백 cols*2 개)
+static inline void ui_build_frame(struct ui_widget *w)
+{
+    int row, i;
+    static const enum ui_glyph left[3] = {UI_TL, UI_V, UI_BL}, right[3] = {UI_TR, UI_V, UI_BR};
+
+    if (w->cols > UI_MAX_COLS)
+        w->cols = UI_MAX_COLS;
+    for (row = 0; row < 3; row++)
+    {
+        char *p = w->frame[row];
+        const char *g;
+        strcpy(p, ui_glyph_text[left[row]]);
+        p += strlen(p);
+        for (i = 0; i < w->cols; i++)
+        {
+            if (row == 1)
+            {
+                *p++ = ' ';
+                *p++ = ' ';
+            }
+            else
+            {
+                for (g = ui_glyph_text[UI_H]; *g; g++)
+                    *p++ = *g;
+            }
+        }
+        strcpy(p, ui_glyph_text[right[row]]);
+        p += strlen(p);
+        w->frame_len[row] = (int)(p - w->frame[row]);
+    }
+}
+
+static inline void ui_panel_init(struct ui_widget *w, int x, int y)
+{
+    ui_widget_init(w, UI_PANEL, x, y);
+}
+
+static inline void ui_box_init(struct ui_widget *w, int x, int y, int cols, int rows)
+{
+    ui_widget_init(w, UI_BOX, x, y);
+    w->cols = cols;
+    w->rows = rows;
+    ui_build_frame(w);
+}
+
+// 슬라이더: 테두리 안에서 손잡이가 min ~ max 사이를 움직인다
+//   수평: 손잡이가 한 글자씩 움직이므로 안쪽 폭 (max-min+3)/2 칸, 1줄    수직: 안쪽 1칸, max-min+1 줄
+static inline void ui_slider_init(struct ui_widget *w, int x, int y, int vertical,
+                                  int min, int max, const char *knob)
+{
+    ui_widget_init(w, UI_SLIDER, x, y);
+    w->vertical = vertical;
+    w->min = min;
+    w->max = max;
+    w->value = w->drawn = min;
+    w->knob = knob;
+    if (vertical)
+    {
+        w->cols = 1;
+        w->rows = max - min + 1;
+    }
+    else
+    {
+        w->cols = (max - min + 3) / 2;
+        w->rows = 1;
+    }
+    ui_build_frame(w);
+}
+
+static inline void ui_label_init(struct ui_widget *w, int x, int y, int width, const char *text)
+{
+    ui_widget_init(w, UI_LABEL, x, y);
+    w->width = width;
+    strncpy(w->text, text, UI_MAX_TEXT - 1);
+}
+
+// parent 의 마지막 자식으로 붙인다
+static inline void ui_add(struct ui_widget *parent, struct ui_widget *child)
+{
+    struct ui_widget **p = &parent->child;
+    while (*p)
+        p = &(*p)->next;
+    *p = child;
+    child->parent = parent;
+    child->next = NULL;
+}
+
+// ---- 값 바꾸기 (바뀔 때만 더럽힘) ----
+
+static inline void ui_mark(struct ui_widget *w, enum ui_dirty d)
+{
+    if (w->dirty < d)
+        w->dirty = d;
+}
+
+static inline void ui_invalidate(struct ui_widget *w)
+{
+    ui_mark(w, UI_DIRTY_ALL);
+}
+
+static inline void ui_set_text(struct ui_widget *w, const char *text)
+{
+    if (strncmp(w->text, text, UI_MAX_TEXT - 1) == 0)
+        return;
+    strncpy(w->text, text, UI_MAX_TEXT - 1);
+    ui_mark(w, UI_DIRTY_VALUE);
+}
+
+static inline void ui_set_number(struct ui_widget *w, int value)
+{
+    char text[NUM_FORMAT_MAX];
+    num_format_i32(text, value);
+    ui_set_text(w, text);
+}
+
+static inline void ui_set_value(struct ui_widget *w, int value)
+{
+    if (value < w->min)
+        value = w->min;
+    if (value > w->max)
+        value = w->max;
+    if (value == w->value)
+        return;
+    w->value = value;
+    ui_mark(w, UI_DIRTY_VALUE);
+    if (w->value_label)
+        ui_set_number(w->value_label, value);
+}
+
+// 슬라이더 값을 라벨에 연결한다
+static inline void ui_slider_bind(struct ui_widget *slider, struct ui_widget *label)
+{
+    slider->value_label = label;
+    ui_set_number(label, slider->value);
+}
+
+// ---- 그리기 ----
+
+static inline void ui_paint_frame(const struct ui_widget *w, int ax, int ay)
+{
+    int r;
+    ui_goto(ax, ay);
+    ui_put(w->frame[0], w->frame_len[0]);
+    for (r = 1; r <= w->rows; r++)
+    {
+        ui_goto(ax, ay + r);
+        ui_put(w->frame[1], w->frame_len[1]);
+    }
+    ui_goto(ax, ay + w->rows + 1);
+    ui_put(w->frame[2], w->frame_len[2]);
+}
+
+// 손잡이 위치 (값 v 일 때 화면 좌표)
+static inline void ui_knob_pos(const struct ui_widget *w, int ax, int ay, int v, int *kx, int *ky)
+{
+    *kx = ax + 2 + (w->vertical ? 0 : v - w->min);
+    *ky = ay + 1 + (w->vertical ? v - w->min : 0);
+}
+
+static inline void ui_paint_knob(struct ui_widget *w, int ax, int ay, int erase)
+{
+    int kx, ky;
+    if (erase)
+    {
+        ui_knob_pos(w, ax, ay, w->drawn, &kx, &ky);
+        ui_goto(kx, ky);
+        ui_put("  ", 2);
+    }
+    ui_knob_pos(w, ax, ay, w->value, &kx, &ky);
+    ui_goto(kx, ky);
+    ui_put(w->knob, strlen(w->knob));
+    w->drawn = w->value;
+}
+
+static inline void ui_paint_label(struct ui_widget *w, int ax, int ay)
+{
+    int len = (int)strlen(w->text), pad = w->width - len, clear;
+    ui_goto(ax, ay);
+    while (pad-- > 0)
+        ui_put(" ", 1);
+    ui_put(w->text, len);
+    // 이전 글자가 더 길었으면 남은 부분을 지운다
+    for (clear = (w->width > len ? w->width : len); clear < w->drawn_len; clear++)
+        ui_put(" ", 1);
+    w->drawn_len = w->width > len ? w->width : len;
+}
+
+static inline void ui_paint_node(struct ui_widget *w, int ox, int oy, int force)
+{
+    int ax = ox + w->x, ay = oy + w->y, all = force || w->dirty == UI_DIRTY_ALL;
+    struct ui_widget *c;
+
+    if (all || w->dirty == UI_DIRTY_VALUE)
+    {
+        switch (w->kind)
+        {
+        case UI_PANEL:
+            break;
+        case UI_BOX:
+            if (all)
+                ui_paint_frame(w, ax, ay);
+            break;
+        case UI_SLIDER:
+            if (all)
+                ui_paint_frame(w, ax, ay);
+            // 값만 바뀌었으면 이전 손잡이 칸만 지운다 (테두리를 새로 그렸으면 지울 필요 없음)
+            ui_paint_knob(w, ax, ay, !all);
+            break;
+        case UI_LABEL:
+            ui_paint_label(w, ax, ay);
+            break;
+        }
+    }
+    w->dirty = UI_CLEAN;
+    for (c = w->child; c; c = c->next)
+        ui_paint_node(c, ax, ay, all);
+}
+
+// 더럽혀진 위젯만 그리고 한 번에 출력한다
+static inline void ui_paint(struct ui_widget *root)
+{
+    ui_paint_node(root, 0, 0, 0);
+    ui_flush();
+}
+
+#endif
@@ -0,0 +1,134 @@
+// 디지털 숫자 렌더러
+//
+// 숫자 0~9 의 5행 4열 모양을 20비트 마스크 하나로 저장한다.
+//   16진수 한 자리가 한 행이고, 가장 낮은 자리가 첫 번째 행이다.
+//   각 행에서 비트 0 이 왼쪽 열이다.   예) 0 = 0xF999F -> 1111 / 1001 / 1001 / 1001 / 1111
+// digit_font_init() 에서 숫자별, 행별 출력 문자열을 미리 만들어 두고
+// digit_split() 으로 숫자 문자열을 0~9 값으로 한 번만 나눈 뒤, digit_render() 가 5행 전체를
+// 버퍼 하나에 이어 붙인다. 출력은 fwrite 한 번이면 되고, 자리 수 제한(int 범위)이 없다.
+// 테트리스 점수처럼 계속 바뀌는 숫자는 좌표를 주면 행마다 커서 이동이 붙어 제자리에 다시 그려진다.
+
+#ifndef DIGIT_RENDER_H
+#define DIGIT_RENDER_H
+
+#include <stdio.h>
+#include <string.h>
+
+#define DIGIT_ROWS 5
+#define DIGIT_COLS 4
+#define DIGIT_CELL_MAX 8 // 한 칸 문자열의 최대 바이트 수
+
+static const unsigned long digit_mask[10] = {
+    0xF999F, // 0
+    0x44444, // 1
+    0xF1F8F, // 2
+    0xF8F8F, // 3
+    0x88F99, // 4
+    0xF8F1F, // 5
+    0xF9F11, // 6
+    0x8888F, // 7
+    0xF9F9F, // 8
+    0x88F9F  // 9
+};
+
+struct digit_font
+{
+    // seg[d][r]: 숫자 d 의 r 행 (4칸 + 숫자 사이 간격)
+    char seg[10][DIGIT_ROWS][DIGIT_CELL_MAX * (DIGIT_COLS + 1)];
+    int len[10][DIGIT_ROWS];
+};
+
+// on: 켜진 칸 문자열(예: "■"), off: 꺼진 칸 문자열(예: "  "), 숫자 사이 간격은 off 한 칸
+static inline void digit_font_init(struct digit_font *f, const char *on, const char *off)
+{
+    int on_len = (int)strlen(on), off_len = (int)strlen(off);
+    int d, r, c;
+
+    if (on_len > DIGIT_CELL_MAX)
+        on_len = DIGIT_CELL_MAX;
+    if (off_len > DIGIT_CELL_MAX)
+        off_len = DIGIT_CELL_MAX;
+    for (d = 0; d < 10; d++)
+    {
+        for (r = 0; r < DIGIT_ROWS; r++)
+        {
+            char *p = f->seg[d][r];
+            for (c = 0; c < DIGIT_COLS; c++)
+            {
+                if (digit_mask[d] >> (r * DIGIT_COLS + c) & 1)
+                {
+                    memcpy(p, on, on_len);
+                    p += on_len;
+                }
+                else
+                {
+                    memcpy(p, off, off_len);
+                    p += off_len;
+                }
+            }
+            memcpy(p, off, off_len);
+            p += off_len;
+            f->len[d][r] = (int)(p - f->seg[d][r]);
+        }
+    }
+}
+
+// 렌더링에 필요한 버퍼 크기 (digits 자리, 행마다 앞에 붙는 prefix 최대 바이트 수)
+static inline size_t digit_render_size(const struct digit_font *f, size_t digits, size_t prefix)
+{
+    int d, r, widest = 0;
+    for (d = 0; d < 10; d++)
+        for (r = 0; r < DIGIT_ROWS; r++)
+            if (f->len[d][r] > widest)
+                widest = f->len[d][r];
+    return DIGIT_ROWS * (digits * widest + prefix + 1) + 1;
+}
+
+// 숫자 문자열을 0~9 값 배열로 한 번만 분리한다. 숫자가 아닌 문자는 건너뛴다.
+// 돌려주는 값은 자리 수
+static inline size_t digit_split(const char *s, unsigned char digit[])
+{
+    size_t count = 0;
+    for (; *s; s++)
+        if (*s >= '0' && *s <= '9')
+            digit[count++] = (unsigned char)(*s - '0');
+    return count;
+}
+
+// digit[0..count) 를 5행으로 buf 에 그린다.
+// x, y 가 1 이상이면 행마다 ANSI 커서 이동(ESC[y;xH)을 앞에 붙이고, 0 이면 행 끝에 줄바꿈.
+// 돌려주는 값은 쓴 바이트 수 (버퍼가 모자라면 -1)
+static inline long digit_render(const struct digit_font *f, const unsigned char digit[], size_t count,
+                                int x, int y, char *buf, size_t cap)
+{
+    size_t i, pos = 0;
+    int r;
+
+    for (r = 0; r < DIGIT_ROWS; r++)
+    {
+        if (x > 0 && y > 0)
+        {
+            int w = snprintf(buf + pos, cap - pos, "\x1b[%d;%dH", y + r, x);
+            if (w < 0 || (size_t)w >= cap - pos)
+                return -1;
+            pos += w;
+        }
+        for (i = 0; i < count; i++)
+        {
+            int len = f->len[digit[i]][r];
+            if (pos + len > cap)
+                return -1;
+            memcpy(buf + pos, f->seg[digit[i]][r], len);
+            pos += len;
+        }
+        if (x <= 0 || y <= 0)
+        {
+            if (pos + 1 > cap)
+                return -1;
+            buf[pos++] = '\n';
+        }
+    }
+    return (long)pos;
+}
+
+#endif
@@ -0,0 +1,196 @@
+// 정수 -> 10진수 문자열 (32/64비트)
+//
+// Number.c 의 serial_number 는 log10 으로 자리 수를, pow(10, i-1) 로 각 자리를 구해서
+// 자리마다 실수 연산을 하고, 0 과 음수에서 틀린 답을 낸다. 여기서는 정수 연산만 쓴다.
+//
+// 자리 수: 최상위 비트 위치 * 1233 / 4096 (= log10(2) 근사)로 자리 수를 짐작하고
+//   10의 거듭제곱 표와 한 번 비교해 고친다. 반복문이나 비교 사슬이 없다.
+// 변환: "00" ~ "99" 200바이트 표로 100으로 나눌 때마다 두 자리씩 쓴다.
+//
+//   num_format_*  : 높은 자리부터 (끝에 '\0', 돌려주는 값은 길이)
+//   num_reverse_* : 낮은 자리부터
+//   num_each_digit: 자리마다 콜백 호출
+// 버퍼는 NUM_FORMAT_MAX(부호 + 20자리 + '\0') 바이트면 충분하다.
+
+#ifndef NUM_FORMAT_H
+#define NUM_FORMAT_H
+
+#include <stdint.h>
+
+#define NUM_FORMAT_MAX 22
+
+static const char num_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const uint64_t num_pow10[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+
+// 최상위 1비트 위치 + 1 (v 는 0 이 아니어야 한다)
+static inline int num_bit_width(uint64_t v)
+{
+#if defined(__GNUC__)
+    return 64 - __builtin_clzll(v);
+#else
+    int n = 0;
+    while (v)
+    {
+        v >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// 자리 수 (0 은 1자리)
+static inline int num_count_u64(uint64_t v)
+{
+    // 10의 거듭제곱(10 이상)은 짝수라서 v | 1 로 0 을 피해도 자리 수가 바뀌지 않는다
+    uint64_t x = v | 1;
+    int t = num_bit_width(x) * 1233 >> 12;
+    return t + 1 - (x < num_pow10[t]);
+}
+
+static inline int num_count_u32(uint32_t v)
+{
+    return num_count_u64(v);
+}
+
+// 자리 수를 아는 상태에서 out[0..n) 을 뒤에서부터 두 자리씩 채운다
+static inline void num_write_u64(char *out, int n, uint64_t v)
+{
+    char *p = out + n;
+    while (v >= 100)
+    {
+        const char *d = num_pairs + (v % 100) * 2;
+        v /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if (v >= 10)
+    {
+        *--p = num_pairs[v * 2 + 1];
+        *--p = num_pairs[v * 2];
+    }
+    else
+        *--p = (char)('0' + v);
+}
+
+// 32비트는 나눗셈을 32비트로 해서 조금 더 빠르다
+static inline void num_write_u32(char *out, int n, uint32_t v)
+{
+    char *p = out + n;
+    while (v >= 100)
+    {
+        const char *d = num_pairs + (v % 100) * 2;
+        v /= 100;
+        *--p = d[1];
+        *--p = d[0];
+    }
+    if (v >= 10)
+    {
+        *--p = num_pairs[v * 2 + 1];
+        *--p = num_pairs[v * 2];
+    }
+    else
+        *--p = (char)('0' + v);
+}
+
+static inline int num_format_u64(char *out, uint64_t v)
+{
+    int n = num_count_u64(v);
+    num_write_u64(out, n, v);
+    out[n] = '\0';
+    return n;
+}
+
+static inline int num_format_u32(char *out, uint32_t v)
+{
+    int n = num_count_u32(v);
+    num_write_u32(out, n, v);
+    out[n] = '\0';
+    return n;
+}
+
+// 음수는 부호 없는 정수로 바꿔 절댓값을 구한다 (INT64_MIN 도 넘치지 않는다)
+static inline int num_format_i64(char *out, int64_t v)
+{
+    uint64_t u = (uint64_t)v;
+    int neg = v < 0;
+    if (neg)
+    {
+        *out = '-';
+        u = 0 - u;
+    }
+    return neg + num_format_u64(out + neg, u);
+}
+
+static inline int num_format_i32(char *out, int32_t v)
+{
+    uint32_t u = (uint32_t)v;
+    int neg = v < 0;
+    if (neg)
+    {
+        *out = '-';
+        u = 0 - u;
+    }
+    return neg + num_format_u32(out + neg, u);
+}
+
+// 낮은 자리부터 (부호는 맨 뒤에 붙지 않고 맨 앞에 둔다: -123 -> "-321")
+static inline int num_reverse_u64(char *out, uint64_t v)
+{
+    char *p = out;
+    while (v >= 100)
+    {
+        const char *d = num_pairs + (v % 100) * 2;
+        v /= 100;
+        *p++ = d[1];
+        *p++ = d[0];
+    }
+    if (v >= 10)
+    {
+        *p++ = num_pairs[v * 2 + 1];
+        *p++ = num_pairs[v * 2];
+    }
+    else
+        *p++ = (char)('0' + v);
+    *p = '\0';
+    return (int)(p - out);
+}
+
+static inline int num_reverse_i64(char *out, int64_t v)
+{
+    uint64_t u = (uint64_t)v;
+    int neg = v < 0;
+    if (neg)
+    {
+        *out = '-';
+        u = 0 - u;
+    }
+    return neg + num_reverse_u64(out + neg, u);
+}
+
+// 자리마다 fn(자리 값 0~9, 자리 번호 0~, ctx) 호출. reverse 가 0 이 아니면 낮은 자리부터.
+// 돌려주는 값은 자리 수
+static inline int num_each_digit(uint64_t v, int reverse, void (*fn)(int digit, int index, void *ctx), void *ctx)
+{
+    char text[NUM_FORMAT_MAX];
+    int n = reverse ? num_reverse_u64(text, v) : num_format_u64(text, v), i;
+    for (i = 0; i < n; i++)
+        fn(text[i] - '0', i, ctx);
+    return n;
+}
+
+#endif
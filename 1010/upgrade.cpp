@@ -3,6 +3,8 @@
 #include <conio.h>
 #include <time.h>
 #include <windows.h>
+#include "../0926/num_format.h"
+#include "../0912/term.h"
 
 #define PERFECT_ZONE 3
 #define GOOD_ZONE 6
@@ -52,13 +54,13 @@ int main(void)
     srand(time(NULL));
     
     // ܼ â ũ 
-    system("mode con: cols=100 lines=35");
+    term_resize(100, 35);
     
     intro_game();
     
     do
     {
-        system("cls");
+        term_clear();
         draw_border();
         r_start = 20;
         turn_count = 0;
@@ -84,7 +86,7 @@ int main(void)
     }while((score_win[0]<2) && (score_win[1]<2));
     
     //   ǥ
-    system("cls");
+    term_clear();
     if(score_win[0] >= 2)
         display_winner(1);
     else
@@ -99,7 +101,7 @@ int main(void)
 
 void intro_game()
 {
-    system("cls");
+    term_clear();
     
     // ƽŰ Ʈ ΰ
     gotoxy(18, 3);
@@ -303,6 +305,8 @@ void display_game_field(int rope_pos)
 
 void display_score_board(int s_w[], int s_l[], int rope_pos)
 {
+    char win[NUM_FORMAT_MAX], lose[NUM_FORMAT_MAX];
+
     // Player 
     gotoxy(20, 5);
     set_color(COLOR_PLAYER);
@@ -311,7 +315,9 @@ void display_score_board(int s_w[], int s_l[], int rope_pos)
     printf("|    PLAYER      |");
     gotoxy(20, 7);
     set_color(COLOR_RESET);
-    printf("|  %d WIN  %d LOSE |", s_w[0], s_l[0]);
+    num_format_i32(win, s_w[0]);
+    num_format_i32(lose, s_l[0]);
+    printf("|  %s WIN  %s LOSE |", win, lose);
     gotoxy(20, 8);
     set_color(COLOR_PLAYER);
     printf("+----------------+");
@@ -333,7 +339,9 @@ void display_score_board(int s_w[], int s_l[], int rope_pos)
     printf("|      AI        |");
     gotoxy(65, 7);
     set_color(COLOR_RESET);
-    printf("|  %d WIN  %d LOSE |", s_w[1], s_l[1]);
+    num_format_i32(win, s_w[1]);
+    num_format_i32(lose, s_l[1]);
+    printf("|  %s WIN  %s LOSE |", win, lose);
     gotoxy(65, 8);
     set_color(COLOR_AI);
     printf("+----------------+");
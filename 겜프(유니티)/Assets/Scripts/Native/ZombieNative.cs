@@ -0,0 +1,436 @@
+using System;
+using System.Runtime.InteropServices;
+
+/// <summary>
+/// 네이티브 라이브러리(겜프(유니티)/Native) P/Invoke 선언
+/// libZombieNative.so / ZombieNative.dll 을 Assets/Plugins 에 넣어야 부를 수 있다
+/// 배열은 Vector2[] 를 그대로 넘긴다 (x, y float 두 개씩)
+/// </summary>
+public static class ZombieNative
+{
+    private const string Lib = "ZombieNative";
+
+    // ---- 좀비 무리 (horde.h) ----
+
+    /// <summary>
+    /// ZombieAI 의 설정값 (순서와 크기가 C++ HordeParams 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct HordeParams
+    {
+        public float wanderSpeed;
+        public float chaseSpeed;
+        public float detectionRange;
+        public float attackRange;
+        public float attackCooldown;
+        public float wanderRadius;
+        public float wanderChangeInterval;
+    }
+
+    /// <summary>
+    /// 좀비 상태 (ZombieAI.State 와 같은 순서)
+    /// </summary>
+    public const byte Wandering = 0, Chasing = 1, Attacking = 2;
+
+    [DllImport(Lib)] public static extern IntPtr horde_create(int capacity, ulong seed);
+    [DllImport(Lib)] public static extern void horde_destroy(IntPtr horde);
+    [DllImport(Lib)] public static extern void horde_set_params(IntPtr horde, ref HordeParams p);
+    [DllImport(Lib)] public static extern int horde_add(IntPtr horde, float x, float y);
+    [DllImport(Lib)] public static extern int horde_remove(IntPtr horde, int index);
+    [DllImport(Lib)] public static extern int horde_count(IntPtr horde);
+    [DllImport(Lib)] public static extern void horde_set_positions(IntPtr horde, UnityEngine.Vector2[] positions, int count);
+
+    /// <summary>
+    /// 한 프레임 (좀비 전체). 이번 프레임에 공격한 좀비 번호를 attackers 에 넣고 그 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int horde_update(IntPtr horde, float deltaTime, float time, float playerX, float playerY, int[] attackers, int max);
+    [DllImport(Lib)] public static extern void horde_get_velocities(IntPtr horde, UnityEngine.Vector2[] velocities, int count);
+    [DllImport(Lib)] public static extern void horde_get_directions(IntPtr horde, UnityEngine.Vector2[] directions, int count);
+    [DllImport(Lib)] public static extern void horde_get_states(IntPtr horde, byte[] states, int count);
+
+    /// <summary>
+    /// 추적 중인 좀비의 속도를 흐름장 방향(flow_steer)으로 바꾼다. horde_update 뒤, 속도를 읽기 전에 부른다
+    /// </summary>
+    [DllImport(Lib)] public static extern void horde_steer_chasing(IntPtr horde, UnityEngine.Vector2[] directions, int count);
+
+    // ---- 공간 격자 (spatial_grid.h) ----
+
+    /// <summary>
+    /// 격자에 넣는 물체 종류 (비트 마스크로 골라 찾는다)
+    /// </summary>
+    public const uint GridStatic = 1, GridEnemy = 2, GridPlayer = 4, GridTrigger = 8;
+
+    /// <summary>
+    /// 번호(id)는 0 ~ capacity-1 을 호출하는 쪽이 정한다. cell 은 좀비 지름의 2배 이상
+    /// </summary>
+    [DllImport(Lib)] public static extern IntPtr grid_create(int capacity, float cell);
+    [DllImport(Lib)] public static extern void grid_destroy(IntPtr grid);
+    [DllImport(Lib)] public static extern int grid_insert(IntPtr grid, int id, float x, float y, float radius, uint layer);
+    [DllImport(Lib)] public static extern void grid_remove(IntPtr grid, int id);
+    [DllImport(Lib)] public static extern void grid_move(IntPtr grid, int id, float x, float y);
+    [DllImport(Lib)] public static extern void grid_move_many(IntPtr grid, int[] ids, UnityEngine.Vector2[] positions, int count);
+    [DllImport(Lib)] public static extern int grid_count(IntPtr grid);
+
+    /// <summary>
+    /// 원과 겹치는 물체 번호를 results 에 최대 max 개 넣는다. 돌려주는 값은 찾은 전체 수 (max 보다 크면 잘림)
+    /// </summary>
+    [DllImport(Lib)] public static extern int grid_query_circle(IntPtr grid, float x, float y, float radius, uint mask, int[] results, int max);
+
+    /// <summary>
+    /// 원 안에서 (dirX, dirY) 와의 코사인이 cosHalf 보다 큰 것만 (MeleeWeapon 전방 120도 = 0.5)
+    /// </summary>
+    [DllImport(Lib)] public static extern int grid_query_sector(IntPtr grid, float x, float y, float radius, float dirX, float dirY, float cosHalf, uint mask, int[] results, int max);
+    [DllImport(Lib)] public static extern int grid_any_in_circle(IntPtr grid, float x, float y, float radius, uint mask);
+
+    // ---- 총알 풀 (projectiles.h) ----
+
+    /// <summary>
+    /// 총알이 맞은 것 하나 (순서와 크기가 C++ ProjectileHit 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ProjectileHit
+    {
+        public int target;   // 격자 번호
+        public uint layer;   // GridEnemy 이면 데미지, GridStatic 이면 벽
+        public float x, y;   // 맞은 위치
+        public float damage;
+    }
+
+    [DllImport(Lib)] public static extern IntPtr projectiles_create(int capacity, float radius);
+    [DllImport(Lib)] public static extern void projectiles_destroy(IntPtr pool);
+
+    /// <summary>
+    /// 총알 하나 쏘기. 풀이 가득 차면 -1
+    /// </summary>
+    [DllImport(Lib)] public static extern int projectiles_fire(IntPtr pool, float x, float y, float dirX, float dirY, float speed, float damage, float lifetime);
+    [DllImport(Lib)] public static extern int projectiles_count(IntPtr pool);
+    [DllImport(Lib)] public static extern void projectiles_clear(IntPtr pool);
+
+    /// <summary>
+    /// 한 프레임 (총알 전체). grid 의 mask 층에 닿은 총알 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int projectiles_update(IntPtr pool, IntPtr grid, float deltaTime, uint mask);
+    [DllImport(Lib)] public static extern int projectiles_get_hits(IntPtr pool, [Out] ProjectileHit[] hits, int max);
+    [DllImport(Lib)] public static extern void projectiles_get_positions(IntPtr pool, UnityEngine.Vector2[] positions, int count);
+    [DllImport(Lib)] public static extern void projectiles_get_velocities(IntPtr pool, UnityEngine.Vector2[] velocities, int count);
+
+    // ---- 흐름장 길찾기 (flow_field.h) ----
+
+    /// <summary>
+    /// 칸 비용: 0 = 벽, 1 = 보통, 클수록 돌아간다
+    /// </summary>
+    public const byte FlowBlocked = 0;
+
+    [DllImport(Lib)] public static extern IntPtr flow_create(int width, int height, float originX, float originY, float cell);
+    [DllImport(Lib)] public static extern void flow_destroy(IntPtr field);
+    [DllImport(Lib)] public static extern void flow_set_cost(IntPtr field, int cx, int cy, byte cost);
+    [DllImport(Lib)] public static extern void flow_set_costs(IntPtr field, byte[] costs);
+    [DllImport(Lib)] public static extern void flow_fill_circle(IntPtr field, float x, float y, float radius, byte cost);
+
+    /// <summary>
+    /// 플레이어 둘레 cells 칸까지만 계산 (0 이면 지도 전체)
+    /// </summary>
+    [DllImport(Lib)] public static extern void flow_set_range(IntPtr field, int cells);
+
+    /// <summary>
+    /// 플레이어가 다른 칸으로 갔거나 비용이 바뀌었을 때만 다시 계산한다. 다시 계산했으면 1
+    /// </summary>
+    [DllImport(Lib)] public static extern int flow_update(IntPtr field, float playerX, float playerY);
+    [DllImport(Lib)] public static extern int flow_steer(IntPtr field, UnityEngine.Vector2[] positions, UnityEngine.Vector2[] directions, int count);
+
+    // ---- 스폰 감독 (spawn_director.h) ----
+
+    /// <summary>
+    /// ZombieSpawner 의 설정값 (순서와 크기가 C++ SpawnParams 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SpawnParams
+    {
+        public float spawnInterval;
+        public int maxZombies;
+        public float difficultyIncreaseInterval; // 0 이면 난이도 고정
+        public float minSpawnInterval;
+        public float intervalScale;
+        public int maxZombiesIncrease;
+        public float minPlayerDistance;
+        public float searchRadius;
+        public int searchAttempts;
+        public int perSpawn;
+    }
+
+    /// <summary>
+    /// 스폰 하나 (순서와 크기가 C++ SpawnEvent 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SpawnEvent
+    {
+        public int agent;    // 좀비가 죽으면 director_kill 에 넘긴다
+        public int point;    // 고른 스폰 지점
+        public float x, y;   // 실제 위치
+        public float time;
+        public int wave;
+    }
+
+    [DllImport(Lib)] public static extern IntPtr director_create(int capacity, ulong seed);
+    [DllImport(Lib)] public static extern void director_destroy(IntPtr director);
+    [DllImport(Lib)] public static extern void director_default_params(out SpawnParams p);
+
+    /// <summary>
+    /// 다음 director_start 부터 적용
+    /// </summary>
+    [DllImport(Lib)] public static extern void director_set_params(IntPtr director, ref SpawnParams p);
+    [DllImport(Lib)] public static extern void director_set_seed(IntPtr director, ulong seed);
+    [DllImport(Lib)] public static extern void director_set_points(IntPtr director, UnityEngine.Vector2[] points, int count);
+    [DllImport(Lib)] public static extern void director_generate_points(IntPtr director, float playerX, float playerY, float radius, int count);
+
+    /// <summary>
+    /// grid 의 GridStatic 과 겹치는 자리에는 스폰하지 않는다 (IntPtr.Zero 이면 검사 없음)
+    /// </summary>
+    [DllImport(Lib)] public static extern void director_set_grid(IntPtr director, IntPtr grid);
+    [DllImport(Lib)] public static extern void director_start(IntPtr director, float time);
+
+    /// <summary>
+    /// now 까지 스폰할 것을 events 에 최대 max 개 적고 그 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int director_update(IntPtr director, float now, float playerX, float playerY, [Out] SpawnEvent[] events, int max);
+    [DllImport(Lib)] public static extern int director_kill(IntPtr director, int agent);
+    [DllImport(Lib)] public static extern int director_live_count(IntPtr director);
+    [DllImport(Lib)] public static extern int director_wave(IntPtr director);
+    [DllImport(Lib)] public static extern float director_spawn_interval(IntPtr director);
+    [DllImport(Lib)] public static extern int director_max_zombies(IntPtr director);
+
+    // ---- 인벤토리 (inventory.h) ----
+
+    /// <summary>
+    /// ItemData 마다 한 번 이름을 번호로 바꿔 둔다 (kind 는 (int)ItemType)
+    /// </summary>
+    [DllImport(Lib)] public static extern IntPtr registry_create();
+    [DllImport(Lib)] public static extern void registry_destroy(IntPtr registry);
+    [DllImport(Lib)] public static extern int registry_intern(IntPtr registry, string name, int kind, int stackable);
+    [DllImport(Lib)] public static extern int registry_find(IntPtr registry, string name);
+
+    [DllImport(Lib)] public static extern IntPtr inventory_create(IntPtr registry, int slots);
+    [DllImport(Lib)] public static extern void inventory_destroy(IntPtr inventory);
+
+    /// <summary>
+    /// AddItem. 넣은 슬롯, 가득 찼으면 -1
+    /// </summary>
+    [DllImport(Lib)] public static extern int inventory_add(IntPtr inventory, int id, int amount);
+
+    /// <summary>
+    /// GiveMultipleLoot 한 번에. slots 에 아이템마다 넣은 슬롯(실패 -1), 넣은 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int inventory_add_many(IntPtr inventory, int[] ids, int[] amounts, int count, [Out] int[] slots);
+    [DllImport(Lib)] public static extern int inventory_remove(IntPtr inventory, int id, int amount);
+    [DllImport(Lib)] public static extern int inventory_count(IntPtr inventory, int id);
+    [DllImport(Lib)] public static extern void inventory_clear(IntPtr inventory);
+    [DllImport(Lib)] public static extern int inventory_used(IntPtr inventory);
+    [DllImport(Lib)] public static extern void inventory_get_slots(IntPtr inventory, [Out] int[] ids, [Out] int[] amounts, int count);
+
+    /// <summary>
+    /// 프레임 끝에 한 번 (LateUpdate). 바뀐 슬롯 수를 돌려준다. 0 이 아닐 때만 OnInventoryChanged
+    /// </summary>
+    [DllImport(Lib)] public static extern int inventory_flush(IntPtr inventory, [Out] int[] slots, int maxSlots, [Out] int[] keyItems, int maxKeys, out int keyCount);
+
+    // ---- 한 판 시뮬레이션 (session_sim.h) ----
+
+    /// <summary>
+    /// 한 판 설정 (순서와 크기가 C++ SimParams 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SimParams
+    {
+        public HordeParams zombie;
+        public SpawnParams spawn;
+        public float dt;
+        public float gameDuration;
+        public float mapHalf;
+        public int containers;
+        public int requiredItems;
+        public int spawnPoints;
+        public float playerSpeed;
+        public float playerHealth;
+        public float invincibilityTime;
+        public float zombieHealth;
+        public float zombieDamage;
+        public float meleeDamage, meleeRange, meleeCooldown;
+        public float rifleDamage, rifleRange, rifleCooldown;
+        public int startingAmmo, maxAmmo;
+        public float interactRange;
+        public float escapeRange;
+        public float repairDuration;
+        public int lootMin, lootMax;
+    }
+
+    /// <summary>
+    /// 한 판 결과 (순서와 크기가 C++ SimResult 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SimResult
+    {
+        public int outcome;  // SimEscaped, SimDied, SimTimeout
+        public float time;
+        public int wave;
+        public int kills;
+        public int spawned;
+        public int items;
+        public int searched;
+        public int shots;
+        public float damageTaken;
+        public float healthLeft;
+        public int peakZombies;
+    }
+
+    public const int SimEscaped = 1, SimDied = 2, SimTimeout = 3;
+
+    /// <summary>
+    /// 봇 정책 (SimPolicy 와 같은 순서)
+    /// </summary>
+    public const int SimPolicyRush = 0, SimPolicyCautious = 1, SimPolicyTurtle = 2;
+
+    [DllImport(Lib)] public static extern void sim_get_defaults(out SimParams p);
+
+    /// <summary>
+    /// 한 판을 끝까지 돌린다 (에디터 밸런스 도구용. 같은 설정, 같은 시드면 같은 결과)
+    /// </summary>
+    [DllImport(Lib)] public static extern void sim_run(ref SimParams p, int policy, ulong seed, out SimResult result);
+
+    // ---- 이벤트 버스 (event_bus.h) ----
+
+    /// <summary>
+    /// 게임 이벤트 종류 (GameEventType 과 같은 값, 64 이상은 자유롭게)
+    /// </summary>
+    public const int EventInventoryChanged = 1, EventItemCollected = 2, EventAllItemsCollected = 3,
+        EventVehicleRepaired = 4, EventPlayerEscaped = 5, EventAmmoChanged = 6, EventHealthChanged = 7, EventTimerChanged = 8;
+
+    /// <summary>
+    /// 고정 크기 이벤트 (순서와 크기가 C++ GameEvent 와 같아야 한다, 24바이트)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct GameEvent
+    {
+        public uint type;
+        public uint key;  // 덮어쓰기 기준 (슬롯, 아이템 번호 등)
+        public int i0, i1;
+        public float f0, f1;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct EventBusStats
+    {
+        public long published;
+        public long coalesced;
+        public long dropped;
+        public long delivered;
+    }
+
+    [DllImport(Lib)] public static extern IntPtr bus_create(int capacity, int maxBatch);
+    [DllImport(Lib)] public static extern void bus_destroy(IntPtr bus);
+    [DllImport(Lib)] public static extern void bus_set_coalesce(IntPtr bus, int type, int on);
+
+    /// <summary>
+    /// OnXxx?.Invoke() 대신. 아무 스레드에서나 부를 수 있고, 가득 차서 버렸으면 0
+    /// </summary>
+    [DllImport(Lib)] public static extern int bus_publish(IntPtr bus, int type, int key, int i0, int i1, float f0, float f1);
+
+    /// <summary>
+    /// LateUpdate 에서 한 번 꺼내 구독자에게 넘긴다. 같은 (종류, key) 는 마지막 값 하나만 (탄약 8 번 바뀌어도 UI 는 한 번)
+    /// </summary>
+    [DllImport(Lib)] public static extern int bus_drain(IntPtr bus, [Out] GameEvent[] events, int max);
+    [DllImport(Lib)] public static extern void bus_get_stats(IntPtr bus, out EventBusStats stats);
+
+    // ---- 효과음 보이스 제한 (voice_limiter.h) ----
+
+    /// <summary>
+    /// 효과음 종류 (SoundCategory 와 같은 순서)
+    /// </summary>
+    public const int SoundPlayer = 0, SoundWeapon = 1, SoundZombie = 2, SoundItem = 3, SoundUI = 4, SoundEscape = 5;
+
+    /// <summary>
+    /// 보이스 제한 설정 (순서와 크기가 C++ VoiceParams 와 같아야 한다)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct VoiceParams
+    {
+        public int maxVoices;
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = 6)] public int[] categoryCap;
+        public float cooldown;
+        public float maxDistance;
+        public float panDistance;
+        public float minVolume;
+    }
+
+    /// <summary>
+    /// 재생 요청 하나. priority 는 클수록 중요 (AudioSource.priority 와 반대)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SoundRequest
+    {
+        public int clip;
+        public int category;
+        public int priority;
+        public int positional;  // 0 이면 PlayOneShot 처럼 듣는 위치에서
+        public float x, y;
+        public float volume;
+    }
+
+    /// <summary>
+    /// 틀 목록 하나: voice 번호의 AudioSource 에서 지금 것을 멈추고 clip 을 튼다
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct VoicePlay
+    {
+        public int voice;
+        public int clip;
+        public float volume;
+        public float pan;
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    public struct VoiceStats
+    {
+        public long requested;
+        public long deduped;
+        public long culled;
+        public long stolen;
+        public long played;
+        public int active;
+        public int peak;
+    }
+
+    [DllImport(Lib)] public static extern void voice_get_defaults(out VoiceParams p);
+    [DllImport(Lib)] public static extern IntPtr voice_create(ref VoiceParams p);
+    [DllImport(Lib)] public static extern void voice_destroy(IntPtr limiter);
+    [DllImport(Lib)] public static extern void voice_set_clip(IntPtr limiter, int clip, float length);
+    [DllImport(Lib)] public static extern void voice_set_listener(IntPtr limiter, float x, float y);
+    [DllImport(Lib)] public static extern void voice_request(IntPtr limiter, SoundRequest[] requests, int count);
+
+    /// <summary>
+    /// LateUpdate 에서 한 번. 틀 목록 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int voice_update(IntPtr limiter, float now, [Out] VoicePlay[] plays, int max);
+    [DllImport(Lib)] public static extern void voice_get_stats(IntPtr limiter, out VoiceStats stats);
+
+    // ---- 시야 격자 (sight_grid.h) ----
+
+    /// <summary>
+    /// sight_detect 가 돌려주는 상태 (ZombieAI.State 와 같은 순서)
+    /// </summary>
+    public const byte SightWander = 0, SightChase = 1, SightAttack = 2;
+
+    [DllImport(Lib)] public static extern IntPtr sight_create(int width, int height, float originX, float originY, float cell);
+    [DllImport(Lib)] public static extern void sight_destroy(IntPtr sight);
+    [DllImport(Lib)] public static extern void sight_set_blocked(IntPtr sight, int cx, int cy, int on);
+    [DllImport(Lib)] public static extern void sight_set_cells(IntPtr sight, byte[] cells);
+    [DllImport(Lib)] public static extern void sight_fill_circle(IntPtr sight, float x, float y, float radius, int on);
+
+    /// <summary>
+    /// 좀비 전부의 시야를 한 번에. bits 는 (count + 31) / 32 개, 보이는 수를 돌려준다
+    /// </summary>
+    [DllImport(Lib)] public static extern int sight_query(IntPtr sight, float px, float py, float[] positions, int count, float range, [Out] uint[] bits);
+
+    /// <summary>
+    /// DetectPlayer 대신 (거리 규칙 + 벽에 가리면 배회). bits 는 null 이어도 된다
+    /// </summary>
+    [DllImport(Lib)] public static extern int sight_detect(IntPtr sight, float px, float py, float[] positions, int count, float detectionRange, float attackRange, [Out] byte[] states, [Out] uint[] bits);
+}
@@ -0,0 +1,298 @@
+// event_bus.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: 덮어쓰기 종류는 (종류, key) 마다 마지막 값만 남는지, 가득 차면 버리고 세는지,
+//      여러 스레드가 넣는 동안 메인 스레드가 꺼내도 빠지거나 두 번 나오는 이벤트가 없고 스레드마다 순서가 지켜지는지,
+//      published = delivered + coalesced 인지
+//   2) 한 프레임에 탄약 8번, 체력 3번, 인벤토리 슬롯 3칸에 6번, 필수 아이템 1개, 타이머 1번이 바뀔 때
+//      C# delegate 처럼 바뀔 때마다 UI 를 다시 만드는 방식과 버스에 넣고 프레임 끝에 한 번 꺼내는 방식을 비교
+//   3) 넣는 스레드 1 ~ N 개가 쉬지 않고 넣고 메인 스레드가 꺼낼 때 처리량 (뮤텍스 + deque 큐와 비교)
+//
+// 컴파일 예: g++ -std=c++11 -O2 -pthread EventBusBench.cpp -o EventBusBench
+// 실행 예:   ./EventBusBench 100000 4   (프레임 수, 넣는 스레드 최대 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "event_bus.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+const uint32_t EVENT_TEST = 100; // 덮어쓰지 않는 종류
+
+static bool check_single()
+{
+    bool ok = true;
+    EventBus bus(64, 32);
+    GameEvent out[32];
+    for (int k = 0; k < 8; k++)
+        bus.publish(EVENT_AMMO_CHANGED, 0, 30 - k, 999);
+    bus.publish(EVENT_ITEM_COLLECTED, 7, 1, 3);
+    bus.publish(EVENT_INVENTORY_CHANGED, 2);
+    bus.publish(EVENT_INVENTORY_CHANGED, 5);
+    bus.publish(EVENT_ITEM_COLLECTED, 9, 2, 3);
+    bus.publish(EVENT_INVENTORY_CHANGED, 2);
+    bus.publish(EVENT_HEALTH_CHANGED, 0, 0, 0, 90, 100);
+    bus.publish(EVENT_HEALTH_CHANGED, 0, 0, 0, 80, 100);
+    int n = bus.drain(out, 32);
+    // 탄약 하나(마지막 값 23, 처음 자리), 아이템 둘(둘 다), 인벤토리 슬롯 2, 5, 체력 하나(80)
+    ok &= n == 6 && out[0].type == EVENT_AMMO_CHANGED && out[0].i0 == 23 && out[1].type == EVENT_ITEM_COLLECTED &&
+          out[1].key == 7 && out[2].key == 2 && out[3].key == 5 && out[4].key == 9 && out[5].f0 == 80;
+    EventBusStats s = bus.stats();
+    ok &= s.published == 15 && s.coalesced == 9 && s.delivered == 6 && s.dropped == 0 && bus.drain(out, 32) == 0;
+
+    // 가득 차면 버린다
+    EventBus small(8, 8);
+    for (int k = 0; k < 10; k++)
+        small.publish(EVENT_TEST, k, k);
+    s = small.stats();
+    ok &= s.published == 8 && s.dropped == 2;
+    // out 이 모자라면 나머지는 다음에
+    ok &= small.drain(out, 5) == 5 && out[4].i0 == 4 && small.drain(out, 8) == 3 && out[0].i0 == 5;
+    ok &= small.publish(EVENT_TEST, 0) && small.drain(out, 8) == 1;
+
+    // 덮어쓰기를 끄고 켜기
+    EventBus bus2(64, 32);
+    bus2.set_coalesce(EVENT_AMMO_CHANGED, false);
+    bus2.set_coalesce(EVENT_TEST, true);
+    for (int k = 0; k < 4; k++)
+    {
+        bus2.publish(EVENT_AMMO_CHANGED, 0, k);
+        bus2.publish(EVENT_TEST, 1, k);
+    }
+    ok &= bus2.drain(out, 32) == 5 && out[1].type == EVENT_TEST && out[1].i0 == 3;
+    return ok;
+}
+
+// 넣는 스레드 threads 개가 각각 per 번: EVENT_TEST (key 스레드, i0 순번) 와 탄약 (key 스레드, i0 순번) 을 번갈아
+static bool check_threads(int threads, int per)
+{
+    EventBus bus(1024, 256);
+    std::atomic<int> done(0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+        pool.push_back(std::thread([&, t]() {
+            for (int i = 0; i < per; i++)
+            {
+                uint32_t type = i & 1 ? (uint32_t)EVENT_AMMO_CHANGED : EVENT_TEST;
+                while (!bus.publish(type, t, i))
+                    std::this_thread::yield(); // 가득 차면 (dropped 로 세어짐) 다시
+            }
+            done.fetch_add(1);
+        }));
+    bool ok = true;
+    std::vector<int> next_test(threads, 0), last_ammo(threads, -1);
+    GameEvent out[256];
+    for (;;)
+    {
+        bool finished = done.load() == threads; // 꺼내기 전에 봐야 마지막 것을 놓치지 않는다
+        int n = bus.drain(out, 256);
+        for (int k = 0; k < n; k++)
+        {
+            int t = out[k].key;
+            if (out[k].type == EVENT_TEST)
+            {
+                ok &= out[k].i0 == next_test[t]; // 스레드마다 순서대로, 빠짐없이
+                next_test[t] += 2;
+            }
+            else
+            {
+                ok &= out[k].i0 > last_ammo[t]; // 덮어써도 늘 새 값
+                last_ammo[t] = out[k].i0;
+            }
+        }
+        if (finished && n == 0)
+            break;
+        if (n == 0)
+            std::this_thread::yield();
+    }
+    for (size_t t = 0; t < pool.size(); t++)
+        pool[t].join();
+    for (int t = 0; t < threads; t++)
+        ok &= next_test[t] >= per && last_ammo[t] == (per - 1) - ((per - 1) % 2 == 0);
+    EventBusStats s = bus.stats();
+    ok &= s.published == (long long)threads * per && s.published == s.delivered + s.coalesced;
+    printf("  넣는 스레드 %d: 넣음 %lld, 넘김 %lld, 덮어씀 %lld, 가득 차서 다시 %lld\n", threads, s.published, s.delivered,
+           s.coalesced, s.dropped);
+    return ok;
+}
+
+// UI 다시 만들기 흉내 (TextMeshPro 글자 바꾸기, 인벤토리는 슬롯 20칸)
+static volatile long long ui_sink = 0;
+
+static void rebuild_ui(const GameEvent &e)
+{
+    char text[64];
+    int len;
+    if (e.type == EVENT_INVENTORY_CHANGED)
+    {
+        len = 0;
+        for (int s = 0; s < 20; s++)
+            len += snprintf(text, sizeof(text), "x%d", s + e.i0);
+    }
+    else if (e.type == EVENT_HEALTH_CHANGED || e.type == EVENT_TIMER_CHANGED)
+        len = snprintf(text, sizeof(text), "%.0f / %.0f", e.f0, e.f1);
+    else
+        len = snprintf(text, sizeof(text), "%d / %d", e.i0, e.i1);
+    ui_sink = ui_sink + len;
+}
+
+// 한 프레임의 변화
+static void frame_events(int f, std::function<void(const GameEvent &)> emit)
+{
+    for (int k = 0; k < 8; k++)
+    {
+        GameEvent e = {EVENT_AMMO_CHANGED, 0, 30 - k, 999, 0, 0};
+        emit(e);
+    }
+    for (int k = 0; k < 3; k++)
+    {
+        GameEvent e = {EVENT_HEALTH_CHANGED, 0, 0, 0, 100.0f - k * 10, 100};
+        emit(e);
+    }
+    for (int k = 0; k < 6; k++)
+    {
+        GameEvent e = {EVENT_INVENTORY_CHANGED, (uint32_t)(k % 3), k, 0, 0, 0};
+        emit(e);
+    }
+    GameEvent item = {EVENT_ITEM_COLLECTED, (uint32_t)(f % 3), 1 + f % 3, 3, 0, 0};
+    emit(item);
+    GameEvent timer = {EVENT_TIMER_CHANGED, 0, 0, 0, 300.0f - f * 0.016f, 0};
+    emit(timer);
+}
+
+static void bench_frames(int frames)
+{
+    // delegate: 바뀔 때마다 구독자 (UI 두 개: 화면 표시, 미니 표시) 가 바로 다시 만든다
+    std::vector<std::function<void(const GameEvent &)> > subscribers;
+    long long rebuilds = 0;
+    for (int k = 0; k < 2; k++)
+        subscribers.push_back([&](const GameEvent &e) {
+            rebuild_ui(e);
+            rebuilds++;
+        });
+    double t = now_sec();
+    for (int f = 0; f < frames; f++)
+        frame_events(f, [&](const GameEvent &e) {
+            for (size_t s = 0; s < subscribers.size(); s++) // OnXxx?.Invoke()
+                subscribers[s](e);
+        });
+    double t_delegate = now_sec() - t;
+    long long delegate_rebuilds = rebuilds;
+
+    EventBus bus(4096, 256);
+    GameEvent out[256];
+    rebuilds = 0;
+    t = now_sec();
+    for (int f = 0; f < frames; f++)
+    {
+        frame_events(f, [&](const GameEvent &e) { bus.publish(e); });
+        int n = bus.drain(out, 256); // LateUpdate
+        for (int k = 0; k < n; k++)
+            for (size_t s = 0; s < subscribers.size(); s++)
+                subscribers[s](out[k]);
+    }
+    double t_bus = now_sec() - t;
+    EventBusStats st = bus.stats();
+    printf("\n프레임 %d 번 (프레임마다 이벤트 19 개, 구독 UI 2 개)\n", frames);
+    printf("  delegate 바로 호출 : 프레임당 %7.0f ns, UI 다시 만들기 프레임당 %.1f 번\n", t_delegate * 1e9 / frames,
+           (double)delegate_rebuilds / frames);
+    printf("  버스 + 프레임 끝   : 프레임당 %7.0f ns, UI 다시 만들기 프레임당 %.1f 번 (넣음 %lld, 덮어씀 %lld, 버림 %lld)\n",
+           t_bus * 1e9 / frames, (double)rebuilds / frames, st.published, st.coalesced, st.dropped);
+}
+
+// 비교용: 뮤텍스 하나로 감싼 큐
+class MutexQueue
+{
+public:
+    bool publish(const GameEvent &e)
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        items_.push_back(e);
+        return true;
+    }
+
+    int drain(GameEvent *out, int max)
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        int n = (int)items_.size() < max ? (int)items_.size() : max;
+        for (int i = 0; i < n; i++)
+        {
+            out[i] = items_.front();
+            items_.pop_front();
+        }
+        return n;
+    }
+
+private:
+    std::mutex m_;
+    std::deque<GameEvent> items_;
+};
+
+// 넣는 스레드 threads 개가 각각 per 번 넣는 동안 메인 스레드가 꺼낸다 -> 초당 백만 이벤트 (빠짐없이 다 꺼낼 때까지)
+template <typename Q>
+static double throughput(Q &q, int threads, int per)
+{
+    std::atomic<int> done(0);
+    std::vector<std::thread> pool;
+    double t = now_sec();
+    for (int k = 0; k < threads; k++)
+        pool.push_back(std::thread([&, k]() {
+            for (int i = 0; i < per; i++)
+            {
+                GameEvent e = {EVENT_TEST, (uint32_t)k, i, 0, 0, 0};
+                while (!q.publish(e))
+                    std::this_thread::yield(); // 버스가 가득 차면 메인 스레드가 꺼낼 때까지
+            }
+            done.fetch_add(1);
+        }));
+    GameEvent out[1024];
+    long long got = 0;
+    for (;;)
+    {
+        bool finished = done.load() == threads;
+        int n = q.drain(out, 1024);
+        got += n;
+        if (finished && n == 0)
+            break;
+        if (n == 0)
+            std::this_thread::yield();
+    }
+    for (size_t k = 0; k < pool.size(); k++)
+        pool[k].join();
+    return (double)got / (now_sec() - t) / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 100000;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 4;
+    bool ok = check_single();
+    for (int t = 1; t <= max_threads && ok; t *= 2)
+        ok &= check_threads(t, 200000);
+    printf("자체 검사: %s\n", ok ? "통과" : "실패");
+    if (!ok)
+        return 1;
+
+    bench_frames(frames);
+
+    printf("\n넣는 스레드 수별 처리량 (초당 백만 이벤트, 덮어쓰지 않는 종류. 버스가 가득 차면 다시 넣음)\n");
+    for (int t = 1; t <= max_threads; t *= 2)
+    {
+        EventBus bus(1 << 16, 1024);
+        MutexQueue mq;
+        double a = throughput(mq, t, 1000000 / t), b = throughput(bus, t, 1000000 / t);
+        EventBusStats s = bus.stats();
+        printf("  스레드 %2d: 뮤텍스 큐 %6.1f, 이벤트 버스 %6.1f (가득 차서 다시 %lld)\n", t, a, b, s.dropped);
+    }
+    return 0;
+}
@@ -0,0 +1,266 @@
+// flow_field.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: 버킷 다익스트라(Dial) 결과를 우선순위 큐 다익스트라와 칸마다 비교,
+//      방향을 따라가면 비용이 줄면서 플레이어 칸에 닿는지, 같은 칸이면 다시 계산하지 않는지
+//   2) 256x256, 1024x1024 지도(벽 약 20%, 진흙 칸 비용 3)에서 다시 계산 시간 (전체, 플레이어 둘레 64칸만),
+//      플레이어가 같은 칸에 있을 때 update 비용, 좀비 100000 마리 방향 읽기
+//   3) 벽에 막힌 좀비 비교: 플레이어 쪽 직선으로 갈 때와 흐름장을 따를 때 일정 시간 뒤 도착한 수
+//
+// 컴파일 예: g++ -std=c++11 -O2 FlowFieldBench.cpp -o FlowFieldBench
+// 실행 예:   ./FlowFieldBench 20   (크기마다 다시 계산 횟수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <vector>
+#include "flow_field.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static int irand(int n)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return (int)((rng_state >> 8) % (unsigned)n);
+}
+
+// 벽 사각형과 진흙을 흩어 놓는다 (가장자리 한 칸과 가운데 십자는 비워서 대부분 이어지게)
+static std::vector<uint8_t> make_map(int w, int h, unsigned seed)
+{
+    std::vector<uint8_t> c((size_t)w * h, 1);
+    rng_state = seed;
+    int walls = w * h / 200;
+    for (int k = 0; k < walls; k++)
+    {
+        int x0 = irand(w), y0 = irand(h), bw = 1 + irand(12), bh = 1 + irand(12);
+        uint8_t v = k % 4 == 0 ? 3 : FLOW_BLOCKED;
+        for (int y = y0; y < y0 + bh && y < h; y++)
+            for (int x = x0; x < x0 + bw && x < w; x++)
+                c[(size_t)y * w + x] = v;
+    }
+    for (int x = 0; x < w; x++)
+        c[x] = c[(size_t)(h - 1) * w + x] = c[(size_t)(h / 2) * w + x] = 1;
+    for (int y = 0; y < h; y++)
+        c[(size_t)y * w] = c[(size_t)y * w + w - 1] = c[(size_t)y * w + w / 2] = 1;
+    return c;
+}
+
+// 비교용: 우선순위 큐 다익스트라 (같은 규칙)
+static std::vector<uint32_t> reference(const std::vector<uint8_t> &c, int w, int h, int goal)
+{
+    std::vector<uint32_t> d(c.size(), FLOW_UNREACHED);
+    typedef std::pair<uint32_t, int> Node;
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node> > q;
+    d[goal] = 0;
+    q.push(Node(0, goal));
+    while (!q.empty())
+    {
+        Node t = q.top();
+        q.pop();
+        if (t.first != d[t.second])
+            continue;
+        int cx = t.second % w, cy = t.second / w;
+        for (int k = 0; k < 8; k++)
+        {
+            int nx = cx + FLOW_DX[k], ny = cy + FLOW_DY[k];
+            if (nx < 0 || ny < 0 || nx >= w || ny >= h || c[(size_t)ny * w + nx] == FLOW_BLOCKED)
+                continue;
+            if (k >= 4 && (c[(size_t)cy * w + nx] == FLOW_BLOCKED || c[(size_t)ny * w + cx] == FLOW_BLOCKED))
+                continue;
+            uint32_t nd = t.first + (k < 4 ? 5 : 7) * c[(size_t)ny * w + nx];
+            if (nd < d[(size_t)ny * w + nx])
+            {
+                d[(size_t)ny * w + nx] = nd;
+                q.push(Node(nd, ny * w + nx));
+            }
+        }
+    }
+    return d;
+}
+
+static bool self_check()
+{
+    const int w = 64, h = 48;
+    bool ok = true;
+    int paths = 0;
+    std::vector<uint8_t> c = make_map(w, h, 17);
+    // 비용이 여러 가지인 칸도 섞는다
+    for (size_t i = 0; i < c.size(); i += 7)
+        if (c[i] != FLOW_BLOCKED)
+            c[i] = (uint8_t)(1 + irand(255));
+    FlowField f(w, h);
+    f.set_costs(c.data());
+    for (int g = 0; g < 6 && ok; g++)
+    {
+        int gx, gy;
+        do
+        {
+            gx = irand(w);
+            gy = irand(h);
+        } while (c[(size_t)gy * w + gx] == FLOW_BLOCKED);
+        ok &= f.update(gx + 0.5f, gy + 0.5f);
+        ok &= !f.update(gx + 0.9f, gy + 0.1f); // 같은 칸
+        std::vector<uint32_t> ref = reference(c, w, h, gy * w + gx);
+        for (int y = 0; y < h && ok; y++)
+            for (int x = 0; x < w && ok; x++)
+            {
+                ok &= f.distance(x, y) == ref[(size_t)y * w + x];
+                if (f.distance(x, y) == FLOW_UNREACHED || (x == gx && y == gy))
+                    continue;
+                // 방향을 따라가면 비용이 계속 줄고 플레이어 칸에 닿는다
+                int px = x, py = y, steps = 0;
+                while ((px != gx || py != gy) && ok && steps <= w * h)
+                {
+                    int d = f.direction(px, py);
+                    ok &= d != FLOW_NONE;
+                    if (!ok)
+                        break;
+                    uint32_t before = f.distance(px, py);
+                    px += FLOW_DX[d];
+                    py += FLOW_DY[d];
+                    ok &= f.distance(px, py) < before && c[(size_t)py * w + px] != FLOW_BLOCKED;
+                    steps++;
+                }
+                paths++;
+            }
+    }
+    // 범위를 정하면 그 안만 (범위 밖은 길 없음)
+    int gx = w / 2, gy = h / 2;
+    f.set_range(10);
+    f.update(gx + 0.5f, gy + 0.5f);
+    std::vector<uint32_t> ref = reference(c, w, h, gy * w + gx);
+    for (int i = 0; i < w * h && ok; i++)
+        ok &= f.distance(i % w, i / w) == (ref[i] <= 50 ? ref[i] : FLOW_UNREACHED);
+    ok &= f.reached() < w * h;
+    f.set_range(0);
+    ok &= f.update(gx + 0.5f, gy + 0.5f) && f.distance(0, 0) == ref[0];
+
+    // 벽 하나 바꾸면 같은 칸이어도 다시 계산
+    int before = f.rebuilds();
+    f.set_cost(1, 1, FLOW_BLOCKED);
+    f.set_cost(1, 1, FLOW_BLOCKED);
+    ok &= f.update(0.5f, 0.5f) && f.rebuilds() == before + 1 && !f.update(0.5f, 0.5f);
+    printf("자체 검사: %s (길 %d 개 따라감)\n\n", ok ? "통과" : "실패", paths);
+    return ok;
+}
+
+static void bench_size(int size, int rebuilds, int range)
+{
+    FlowField f(size, size);
+    f.set_range(range);
+    std::vector<uint8_t> c = make_map(size, size, 5);
+    f.set_costs(c.data());
+    rng_state = 77;
+
+    // 플레이어가 다른 칸으로 갈 때마다 다시 계산
+    double t = now_sec();
+    for (int k = 0; k < rebuilds; k++)
+    {
+        int gx, gy;
+        do
+        {
+            gx = irand(size);
+            gy = irand(size);
+        } while (c[(size_t)gy * size + gx] == FLOW_BLOCKED);
+        f.update(gx + 0.5f, gy + 0.5f);
+    }
+    double t_rebuild = (now_sec() - t) / rebuilds;
+    int reached = f.reached();
+
+    // 같은 칸: 매 프레임 update 를 불러도 아무 일 없음
+    const int same = 1000000;
+    float px = 0.5f;
+    f.update(px, px);
+    t = now_sec();
+    for (int k = 0; k < same; k++)
+        f.update(px + (k & 1) * 0.1f, px);
+    double t_same = (now_sec() - t) / same;
+
+    // 좀비 10만 마리 방향 읽기
+    const int n = 100000;
+    std::vector<float> xy(2 * n), dir(2 * n);
+    for (int i = 0; i < n; i++)
+    {
+        xy[2 * i] = irand(size * 16) / 16.0f;
+        xy[2 * i + 1] = irand(size * 16) / 16.0f;
+    }
+    int found = 0;
+    t = now_sec();
+    for (int k = 0; k < 10; k++)
+        found = f.steer(xy.data(), dir.data(), n);
+    double t_steer = (now_sec() - t) / 10;
+
+    char label[32];
+    snprintf(label, sizeof(label), range > 0 ? "둘레 %d칸" : "전체", range);
+    printf("%4d x %-4d %-10s: 다시 계산 %8.3f ms (계산한 칸 %7d), 같은 칸 update %.1f ns, 10만 마리 방향 %.3f ms (길 있음 %d)\n",
+           size, size, label, t_rebuild * 1e3, reached, t_same * 1e9, t_steer * 1e3, found);
+}
+
+// 플레이어와 좀비 사이에 가운데만 뚫린 긴 벽: 직선으로 가면 벽에 붙어 멈춘다
+static void wall_demo()
+{
+    const int w = 64, h = 64, n = 2000;
+    FlowField f(w, h);
+    for (int x = 0; x < w; x++)
+        if (x < 28 || x > 35)
+            f.set_cost(x, 32, FLOW_BLOCKED);
+    const float gx = 32, gy = 55, speed = 3, dt = 1 / 60.0f;
+    f.update(gx, gy);
+    int arrived[2] = {0, 0};
+    for (int mode = 0; mode < 2; mode++)
+    {
+        rng_state = 3;
+        for (int i = 0; i < n; i++)
+        {
+            float x = irand(w * 16) / 16.0f, y = 2 + irand(26 * 16) / 16.0f;
+            for (int s = 0; s < 60 * 30; s++) // 30초
+            {
+                float dx = gx - x, dy = gy - y, len = std::sqrt(dx * dx + dy * dy);
+                if (len < 1)
+                {
+                    arrived[mode]++;
+                    break;
+                }
+                dx /= len;
+                dy /= len;
+                if (mode == 1)
+                {
+                    float fx, fy;
+                    if (f.sample(x, y, &fx, &fy))
+                    {
+                        dx = fx;
+                        dy = fy;
+                    }
+                }
+                float nx = x + dx * speed * dt, ny = y + dy * speed * dt;
+                // 벽 칸으로는 못 들어간다 (물리 충돌 대신)
+                if (f.inside(f.cell_x(nx), f.cell_y(ny)) && f.cost(f.cell_x(nx), f.cell_y(ny)) == FLOW_BLOCKED)
+                    continue;
+                x = nx;
+                y = ny;
+            }
+        }
+    }
+    printf("\n벽 뒤 좀비 %d 마리, 30초 뒤 플레이어에게 닿은 수: 직선 %d, 흐름장 %d\n", n, arrived[0], arrived[1]);
+}
+
+int main(int argc, char *argv[])
+{
+    int rebuilds = argc > 1 ? atoi(argv[1]) : 20;
+    if (!self_check())
+        return 1;
+    bench_size(256, rebuilds * 10, 0);
+    bench_size(1024, rebuilds, 0);
+    bench_size(256, rebuilds * 10, 64);
+    bench_size(1024, rebuilds * 10, 64);
+    wall_demo();
+    return 0;
+}
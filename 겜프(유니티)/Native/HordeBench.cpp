@@ -0,0 +1,252 @@
+// horde.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: AVX2 update 와 하나씩 계산하는 update_scalar 를 같은 시드로 여러 프레임 돌려
+//      상태, 공격 이벤트가 같고 위치 차이가 작은지
+//   2) 좀비 N 마리(기본 100000)를 플레이어 주위에 흩어 놓고 프레임마다 update + integrate
+//      좀비마다 따로 객체를 두고 Update() 를 부르는 방식(ZombieAI.cs 와 같은 구조)과 비교
+//
+// 컴파일 예: g++ -std=c++11 -O2 -mavx2 -mfma HordeBench.cpp -o HordeBench
+// 실행 예:   ./HordeBench 100000 600   (좀비 수, 프레임 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "horde.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// 비교용: ZombieAI.cs 처럼 좀비마다 객체 하나, 가상 함수 Update()
+class ZombieObject
+{
+public:
+    virtual ~ZombieObject() {}
+    virtual void Update(float dt, float time, float px, float py, int &hits) = 0;
+};
+
+class ZombieAIObject : public ZombieObject
+{
+public:
+    ZombieAIObject(float x, float y, unsigned seed) : x(x), y(y), vx(0), vy(0), dirx(0), diry(-1),
+                                                      timer(0), last_attack(-1e30f), state(0), rng(seed | 1)
+    {
+        new_target();
+    }
+
+    void Update(float dt, float time, float px, float py, int &hits)
+    {
+        const float attackRange = 1.5f, detectionRange = 8, chaseSpeed = 3, wanderSpeed = 1.5f;
+        float dist = std::sqrt((px - x) * (px - x) + (py - y) * (py - y)); // Vector2.Distance
+        float mx = 0, my = 0;
+        if (dist <= attackRange)
+        {
+            state = 2;
+            vx = vy = 0;
+            mx = (px - x) / dist;
+            my = (py - y) / dist;
+            if (time - last_attack >= 1.5f)
+            {
+                last_attack = time;
+                hits++;
+            }
+        }
+        else if (dist <= detectionRange)
+        {
+            state = 1;
+            mx = (px - x) / dist;
+            my = (py - y) / dist;
+            vx = mx * chaseSpeed;
+            vy = my * chaseSpeed;
+        }
+        else
+        {
+            state = 0;
+            timer += dt;
+            float wd = std::sqrt((wx - x) * (wx - x) + (wy - y) * (wy - y));
+            if (wd < 0.5f || timer >= 3)
+            {
+                new_target();
+                timer = 0;
+                wd = std::sqrt((wx - x) * (wx - x) + (wy - y) * (wy - y));
+            }
+            mx = wd > 0 ? (wx - x) / wd : 0;
+            my = wd > 0 ? (wy - y) / wd : 0;
+            vx = mx * wanderSpeed;
+            vy = my * wanderSpeed;
+        }
+        if (mx * mx + my * my > 0.01f)
+        {
+            dirx = mx;
+            diry = my;
+        }
+        x += vx * dt;
+        y += vy * dt;
+    }
+
+private:
+    void new_target()
+    {
+        float ux, uy;
+        do
+        {
+            rng = rng * 1103515245 + 12345;
+            ux = (rng >> 8) * (1.0f / 16777216.0f) * 2 - 1;
+            rng = rng * 1103515245 + 12345;
+            uy = (rng >> 8) * (1.0f / 16777216.0f) * 2 - 1;
+        } while (ux * ux + uy * uy > 1);
+        wx = x + ux * 10;
+        wy = y + uy * 10;
+    }
+
+    float x, y, vx, vy, dirx, diry, wx, wy, timer, last_attack;
+    int state;
+    unsigned rng;
+};
+
+static void scatter(ZombieHorde &h, int n, float radius, unsigned seed)
+{
+    for (int i = 0; i < n; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        float a = (seed >> 8) * (6.2831853f / 16777216.0f);
+        seed = seed * 1103515245 + 12345;
+        float r = std::sqrt((seed >> 8) * (1.0f / 16777216.0f)) * radius;
+        h.add(r * std::cos(a), r * std::sin(a));
+    }
+}
+
+// 플레이어는 반지름 20 원을 따라 돈다
+static void player_at(float time, float &px, float &py)
+{
+    px = 20 * std::cos(time * 0.3f);
+    py = 20 * std::sin(time * 0.3f);
+}
+
+static bool self_check()
+{
+    const int n = 1003; // 8 의 배수가 아닌 수 (끝부분 확인)
+    ZombieHorde a(n, 42), b(n, 42);
+    std::vector<int> ha(n), hb(n);
+    bool ok = true;
+    float px, py, worst = 0;
+    scatter(a, n, 30, 7);
+    scatter(b, n, 30, 7);
+    for (int f = 0; f < 600 && ok; f++)
+    {
+        float t = f / 60.0f;
+        player_at(t, px, py);
+        int na = a.update(1 / 60.0f, t, px, py, ha.data(), n);
+        int nb = b.update_scalar(1 / 60.0f, t, px, py, hb.data(), n);
+        ok &= na == nb;
+        for (int k = 0; k < na && ok; k++)
+            ok &= ha[k] == hb[k];
+        for (int i = 0; i < n && ok; i++)
+        {
+            float e = std::fabs(a.x(i) - b.x(i)) + std::fabs(a.y(i) - b.y(i));
+            worst = e > worst ? e : worst;
+            ok &= a.state(i) == b.state(i);
+        }
+        a.integrate(1 / 60.0f);
+        b.integrate(1 / 60.0f);
+        // 곱셈-덧셈 합치기(FMA) 차이로 생기는 아주 작은 오차만 허용
+        if (worst > 1e-2f)
+            ok = false;
+    }
+    // 지우기: 마지막 좀비가 빈자리로
+    int moved = a.remove(0);
+    ok &= moved == n - 1 && a.count() == n - 1 && a.x(0) == b.x(n - 1);
+    // 배열이 좀비 수보다 길어도 좀비 수만큼만 쓴다
+    std::vector<float> xy(2 * (n + 64), -7.0f);
+    a.get_positions(xy.data(), n + 64);
+    a.get_velocities(xy.data(), n + 64);
+    a.get_directions(xy.data(), n + 64);
+    for (size_t k = 2 * (n - 1); k < xy.size() && ok; k++)
+        ok &= xy[k] == -7.0f;
+    printf("자체 검사: %s (위치 최대 차이 %.2e)\n\n", ok ? "통과" : "실패", worst);
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 600;
+    const float dt = 1 / 60.0f;
+    float px, py;
+    long long attacks = 0;
+
+    if (!self_check())
+        return 1;
+
+    std::vector<int> hits(n);
+    int counts[3] = {0, 0, 0};
+    double t_simd, t_scalar, t_object;
+
+    {
+        ZombieHorde h(n, 1);
+        scatter(h, n, 150, 3);
+        double t = now_sec();
+        for (int f = 0; f < frames; f++)
+        {
+            player_at(f * dt, px, py);
+            attacks += h.update(dt, f * dt, px, py, hits.data(), n);
+            h.integrate(dt);
+        }
+        t_simd = now_sec() - t;
+        for (int i = 0; i < h.count(); i++)
+            counts[h.state(i)]++;
+    }
+    {
+        ZombieHorde h(n, 1);
+        scatter(h, n, 150, 3);
+        double t = now_sec();
+        for (int f = 0; f < frames; f++)
+        {
+            player_at(f * dt, px, py);
+            h.update_scalar(dt, f * dt, px, py, hits.data(), n);
+            h.integrate(dt);
+        }
+        t_scalar = now_sec() - t;
+    }
+    {
+        // 객체를 하나씩 new 해서 메모리에 흩어 놓는다 (GameObject 처럼)
+        std::vector<ZombieObject *> zombies(n);
+        std::vector<void *> gaps(n);
+        unsigned seed = 3;
+        for (int i = 0; i < n; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            float a = (seed >> 8) * (6.2831853f / 16777216.0f);
+            seed = seed * 1103515245 + 12345;
+            float r = std::sqrt((seed >> 8) * (1.0f / 16777216.0f)) * 150;
+            zombies[i] = new ZombieAIObject(r * std::cos(a), r * std::sin(a), i);
+            gaps[i] = malloc(64 + (seed >> 20) % 256); // 다른 컴포넌트가 사이사이에 있는 것처럼
+        }
+        int dummy = 0;
+        double t = now_sec();
+        for (int f = 0; f < frames; f++)
+        {
+            player_at(f * dt, px, py);
+            for (int i = 0; i < n; i++)
+                zombies[i]->Update(dt, f * dt, px, py, dummy);
+        }
+        t_object = now_sec() - t;
+        for (int i = 0; i < n; i++)
+        {
+            delete zombies[i];
+            free(gaps[i]);
+        }
+    }
+
+    double agent_frames = (double)n * frames;
+    printf("좀비 %d 마리, %d 프레임 (마지막 상태: 배회 %d, 추적 %d, 공격 %d, 공격 이벤트 %lld)\n", n, frames,
+           counts[0], counts[1], counts[2], attacks);
+    printf("  객체마다 Update() : %6.2f ns/마리, 프레임당 %7.3f ms\n", t_object * 1e9 / agent_frames, t_object * 1e3 / frames);
+    printf("  SoA 하나씩        : %6.2f ns/마리, 프레임당 %7.3f ms\n", t_scalar * 1e9 / agent_frames, t_scalar * 1e3 / frames);
+    printf("  SoA AVX2          : %6.2f ns/마리, 프레임당 %7.3f ms\n", t_simd * 1e9 / agent_frames, t_simd * 1e3 / frames);
+    return 0;
+}
@@ -0,0 +1,348 @@
+// inventory.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: InventorySystem.cs 와 같은 규칙으로 만든 리스트 인벤토리와 무작위 넣기/빼기/개수를 비교,
+//      이름 -> 번호가 늘어나도 그대로인지, 한 프레임에 여러 번 바뀐 슬롯과 KeyItem 이 한 번씩만 알려지는지
+//   2) 파밍 연속: 프레임마다 GiveMultipleLoot 한 번(아이템 4~8 개)과 소모품 사용 몇 번.
+//      InventorySystem 처럼 items.Find(이름 비교) + 바뀔 때마다 RefreshUI(슬롯 전부 다시 그림) 하는 방식과
+//      해시 + 프레임 끝에 바뀐 슬롯만 다시 그리는 방식을 비교. 슬롯 20 개(가방)와 1000 개(창고)
+//
+// 컴파일 예: g++ -std=c++11 -O2 InventoryBench.cpp -o InventoryBench
+// 실행 예:   ./InventoryBench 200000   (프레임 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "inventory.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static int irand(int n)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return (int)((rng_state >> 8) % (unsigned)n);
+}
+
+// ItemData 대신
+struct ItemDef
+{
+    std::string itemName;
+    int itemType;
+    bool isStackable;
+};
+
+// 아이템 종류: 10 개 중 하나는 쌓이지 않음, 50 개 중 하나는 KeyItem
+static std::vector<ItemDef> make_defs(int types)
+{
+    std::vector<ItemDef> defs(types);
+    for (int i = 0; i < types; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Item_%d", i);
+        defs[i].itemName = name;
+        defs[i].itemType = i % 50 == 7 ? ITEM_KEY_ITEM : i % 3 == 0 ? ITEM_CONSUMABLE : ITEM_MATERIAL;
+        defs[i].isStackable = i % 10 != 3;
+    }
+    return defs;
+}
+
+// 비교용: InventorySystem.cs 그대로 (List<InventoryItem>, Find 에 람다, 바뀔 때마다 이벤트)
+struct ListItem
+{
+    const ItemDef *data;
+    int amount;
+};
+
+class ListInventory
+{
+public:
+    ListInventory(int max_slots) : max_slots(max_slots), key_events(0) {}
+
+    std::function<void()> OnInventoryChanged;
+
+    ListItem *Find(const std::string &itemName)
+    {
+        std::function<bool(const ListItem *)> match = [&itemName](const ListItem *x) {
+            return x->data->itemName == itemName;
+        };
+        for (size_t i = 0; i < items.size(); i++)
+            if (match(items[i]))
+                return items[i];
+        return 0;
+    }
+
+    bool AddItem(const ItemDef *itemData, int amount)
+    {
+        if (itemData->isStackable)
+        {
+            ListItem *existing = Find(itemData->itemName);
+            if (existing)
+            {
+                existing->amount += amount;
+                if (OnInventoryChanged)
+                    OnInventoryChanged();
+                key_events += itemData->itemType == ITEM_KEY_ITEM;
+                return true;
+            }
+        }
+        if ((int)items.size() >= max_slots)
+            return false;
+        ListItem *item = new ListItem;
+        item->data = itemData;
+        item->amount = amount;
+        items.push_back(item);
+        if (OnInventoryChanged)
+            OnInventoryChanged();
+        key_events += itemData->itemType == ITEM_KEY_ITEM;
+        return true;
+    }
+
+    bool RemoveItem(const ItemDef *itemData, int amount)
+    {
+        ListItem *item = Find(itemData->itemName);
+        if (!item)
+            return false;
+        item->amount -= amount;
+        if (item->amount <= 0)
+        {
+            items.erase(std::find(items.begin(), items.end(), item));
+            delete item;
+        }
+        if (OnInventoryChanged)
+            OnInventoryChanged();
+        return true;
+    }
+
+    int GetItemCount(const std::string &itemName)
+    {
+        int total = 0; // inventory.h 와 맞춰 같은 이름 전부의 합
+        for (size_t i = 0; i < items.size(); i++)
+            if (items[i]->data->itemName == itemName)
+                total += items[i]->amount;
+        return total;
+    }
+
+    void ClearInventory()
+    {
+        for (size_t i = 0; i < items.size(); i++)
+            delete items[i];
+        items.clear();
+    }
+
+    ~ListInventory() { ClearInventory(); }
+
+    int max_slots;
+    std::vector<ListItem *> items;
+    long long key_events;
+};
+
+typedef std::multiset<std::pair<std::string, int> > Contents;
+
+static Contents contents(const ListInventory &l)
+{
+    Contents c;
+    for (size_t i = 0; i < l.items.size(); i++)
+        c.insert(std::make_pair(l.items[i]->data->itemName, l.items[i]->amount));
+    return c;
+}
+
+static Contents contents(const Inventory &inv, const ItemRegistry &reg)
+{
+    Contents c;
+    for (int s = 0; s < inv.slots(); s++)
+        if (inv.item(s) >= 0)
+            c.insert(std::make_pair(std::string(reg.name(inv.item(s))), inv.amount(s)));
+    return c;
+}
+
+static bool self_check()
+{
+    bool ok = true;
+
+    // 이름 -> 번호: 늘어나도(해시를 다시 만들어도) 같은 번호
+    ItemRegistry reg;
+    std::vector<ItemDef> defs = make_defs(5000);
+    for (int i = 0; i < 5000 && ok; i++)
+        ok &= reg.intern(defs[i].itemName.c_str(), defs[i].itemType, defs[i].isStackable) == i;
+    for (int i = 0; i < 5000 && ok; i++)
+        ok &= reg.find(defs[i].itemName.c_str()) == i && reg.intern(defs[i].itemName.c_str(), 0, false) == i &&
+              reg.stackable(i) == defs[i].isStackable && defs[i].itemName == reg.name(i);
+    ok &= reg.find("Item_5000") == -1 && reg.find("") == -1 && reg.size() == 5000;
+
+    // 무작위 넣기/빼기를 리스트 인벤토리와 비교 (종류를 적게 해서 같은 아이템이 자주 겹치게)
+    int ops = 0;
+    for (int round = 0; round < 20 && ok; round++)
+    {
+        const int slots = 4 + round * 3, types = 6 + round * 2;
+        ListInventory list(slots);
+        Inventory inv(&reg, slots);
+        rng_state = 100 + round;
+        for (int k = 0; k < 5000 && ok; k++, ops++)
+        {
+            int id = irand(types);
+            int amount = 1 + irand(5);
+            int op = irand(10);
+            if (op < 5)
+                ok &= list.AddItem(&defs[id], amount) == (inv.add(id, amount) >= 0);
+            else if (op < 9)
+                ok &= list.RemoveItem(&defs[id], amount) == inv.remove(id, amount);
+            else if (irand(100) == 0)
+            {
+                list.ClearInventory();
+                inv.clear();
+            }
+            ok &= list.GetItemCount(defs[id].itemName) == inv.count(id) && (int)list.items.size() == inv.used() &&
+                  contents(list) == contents(inv, reg);
+        }
+    }
+
+    // 알림: 한 프레임에 같은 슬롯을 여러 번 바꿔도 한 번, KeyItem 도 한 번
+    {
+        Inventory inv(&reg, 20);
+        inv.flush();
+        int key = 7; // make_defs 에서 KeyItem
+        for (int k = 0; k < 10; k++)
+        {
+            inv.add(0, 1);
+            inv.add(key, 1);
+        }
+        inv.remove(0, 3);
+        ok &= inv.changed_count() == 2 && inv.collected_count() == 1 && inv.collected()[0] == key;
+        ok &= inv.flush() == 2 && inv.flush() == 0 && inv.collected_count() == 0;
+        // 빈 칸은 앞에서부터 채운다
+        inv.add(3, 1);
+        inv.add(13, 1);
+        inv.remove(0, 100);
+        ok &= inv.item(0) == -1 && inv.add(1, 1) == 0 && inv.count(3) == 1 && inv.count(13) == 1;
+        // 모르는 번호 (registry_find 가 못 찾으면 -1): 아무것도 바꾸지 않는다
+        ok &= !inv.remove(-1, 1) && !inv.remove(5000, 1) && inv.count(-1) == 0 && inv.count(5000) == 0;
+        ok &= inv.add(-1, 1) == -1 && inv.count(3) == 1 && inv.count(13) == 1 && inv.count(1) == 1;
+    }
+    {
+        Inventory inv(&reg, 8); // 빈 인벤토리
+        ok &= !inv.remove(-1, 1) && inv.count(-1) == 0 && inv.used() == 0;
+    }
+    printf("자체 검사: %s (이름 5000 개, 넣기/빼기 %d 번)\n\n", ok ? "통과" : "실패", ops);
+    return ok;
+}
+
+// 한 프레임의 파밍: 상자 하나에서 4~8 가지, 그리고 아이템 사용 2~4 번
+struct Frame
+{
+    int loot[8], amount[8], loot_count;
+    int use[4], use_count;
+};
+
+static std::vector<Frame> make_frames(int frames, int types)
+{
+    std::vector<Frame> f(frames);
+    for (int i = 0; i < frames; i++)
+    {
+        f[i].loot_count = 4 + irand(5);
+        for (int k = 0; k < f[i].loot_count; k++)
+        {
+            f[i].loot[k] = irand(types);
+            f[i].amount[k] = 1 + irand(3);
+        }
+        f[i].use_count = 2 + irand(3);
+        for (int k = 0; k < f[i].use_count; k++)
+            f[i].use[k] = irand(types);
+    }
+    return f;
+}
+
+static void bench(int slots, int types, int frames)
+{
+    std::vector<ItemDef> defs = make_defs(types);
+    rng_state = 11;
+    std::vector<Frame> plan = make_frames(frames, types);
+    long long items = 0;
+    for (int i = 0; i < frames; i++)
+        items += plan[i].loot_count + plan[i].use_count;
+
+    // InventorySystem 식
+    double t_list;
+    long long list_redraw = 0, list_added = 0;
+    volatile long long sink = 0;
+    {
+        ListInventory list(slots);
+        list.OnInventoryChanged = [&]() {
+            // RefreshUI: 슬롯 전부 다시
+            long long s = 0;
+            for (size_t i = 0; i < list.items.size(); i++)
+                s += list.items[i]->amount;
+            sink = sink + s;
+            list_redraw++;
+        };
+        double t = now_sec();
+        for (int i = 0; i < frames; i++)
+        {
+            const Frame &f = plan[i];
+            for (int k = 0; k < f.loot_count; k++)
+                list_added += list.AddItem(&defs[f.loot[k]], f.amount[k]);
+            for (int k = 0; k < f.use_count; k++)
+                list.RemoveItem(&defs[f.use[k]], 2);
+        }
+        t_list = now_sec() - t;
+    }
+
+    // inventory.h: ItemData 를 읽을 때 한 번 번호로 바꿔 두고, 프레임 끝에 바뀐 슬롯만 다시 그림
+    double t_native;
+    long long native_redraw = 0, native_added = 0, slot_redraw = 0;
+    {
+        ItemRegistry reg;
+        std::vector<int> ids(types);
+        for (int i = 0; i < types; i++)
+            ids[i] = reg.intern(defs[i].itemName.c_str(), defs[i].itemType, defs[i].isStackable);
+        Inventory inv(&reg, slots);
+        int out[8];
+        double t = now_sec();
+        for (int i = 0; i < frames; i++)
+        {
+            const Frame &f = plan[i];
+            native_added += inv.add_many(f.loot, f.amount, f.loot_count, out);
+            for (int k = 0; k < f.use_count; k++)
+                inv.remove(f.use[k], 2);
+            int n = inv.changed_count();
+            if (n > 0)
+            {
+                long long s = 0;
+                for (int k = 0; k < n; k++)
+                    s += inv.amount(inv.changed()[k]);
+                sink = sink + s;
+                native_redraw++;
+                slot_redraw += n;
+            }
+            inv.flush();
+        }
+        t_native = now_sec() - t;
+    }
+
+    printf("슬롯 %4d, 종류 %4d, %d 프레임 (아이템 %lld 번, 들어간 수 리스트 %lld / 해시 %lld)\n", slots, types, frames, items,
+           list_added, native_added);
+    printf("  InventorySystem 식 : %8.1f ns/아이템, UI 다시 그림 %lld 번 (매번 슬롯 전부)\n", t_list * 1e9 / items,
+           list_redraw);
+    printf("  inventory.h        : %8.1f ns/아이템, UI 다시 그림 %lld 번 (바뀐 슬롯만, 합 %lld 칸)\n", t_native * 1e9 / items,
+           native_redraw, slot_redraw);
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 200000;
+    if (!self_check())
+        return 1;
+    bench(20, 40, frames);
+    bench(1000, 2000, frames / 10);
+    return 0;
+}
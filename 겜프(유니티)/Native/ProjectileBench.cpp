@@ -0,0 +1,220 @@
+// projectiles.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: segment_first 를 전부 훑어 구한 가장 가까운 충돌과 비교,
+//      한 프레임에 좀비 지름보다 멀리 가는 총알도 맞는지, 시간이 다 되면 없어지는지
+//   2) 1000x1000 지도에 좀비 20000 마리와 벽 2000 개를 두고 없어진 만큼 계속 쏴서 총알 N 발(기본 50000)을 유지한다
+//      Bullet.cs 처럼 총알마다 객체를 new/delete 하고 프레임 끝 위치에서만 겹침을 보는 방식과 비교
+//      (그 방식은 빠른 총알이 좀비를 건너뛰어 맞은 수가 적다)
+//
+// 컴파일 예: g++ -std=c++11 -O2 ProjectileBench.cpp -o ProjectileBench
+// 실행 예:   ./ProjectileBench 50000 600   (살아 있는 총알 수, 프레임 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "projectiles.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static float frand(float lo, float hi)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return lo + (rng_state >> 8) * (1.0f / 16777216.0f) * (hi - lo);
+}
+
+const float MAP = 1000, SPEED = 20, LIFETIME = 5, DT = 1 / 60.0f;
+
+// 아무 데서나 아무 방향으로 (인자 계산 순서에 따라 달라지지 않게 차례로 뽑는다)
+static void random_shot(float &x, float &y, float &vx, float &vy)
+{
+    x = frand(0, MAP);
+    y = frand(0, MAP);
+    float a = frand(0, 6.2831853f);
+    vx = std::cos(a) * SPEED;
+    vy = std::sin(a) * SPEED;
+}
+
+// 좀비와 벽을 흩어 놓는다. 번호 0 ~ zombies-1 이 좀비
+static void build_map(SpatialGrid &g, int zombies, int walls)
+{
+    for (int i = 0; i < zombies; i++)
+        g.insert(i, frand(0, MAP), frand(0, MAP), 0.3f, GRID_ENEMY);
+    for (int i = 0; i < walls; i++)
+        g.insert(zombies + i, frand(0, MAP), frand(0, MAP), frand(0.5f, 2), GRID_STATIC);
+}
+
+// 비교용: Bullet.cs 처럼 총알마다 객체 하나
+class BulletObject
+{
+public:
+    BulletObject(float x, float y, float vx, float vy, float life) : x(x), y(y), vx(vx), vy(vy), life(life) {}
+    virtual ~BulletObject() {}
+
+    // 프레임 끝 위치에서 겹치는지만 본다 (OnTriggerEnter2D). 없어져야 하면 false
+    virtual bool Update(SpatialGrid &g, int *buf, int &hits)
+    {
+        x += vx * DT;
+        y += vy * DT;
+        int n = g.query_circle(x, y, 0.05f, GRID_ENEMY | GRID_STATIC, buf, 8);
+        if (n > 0)
+        {
+            hits += g.layer(buf[0]) == GRID_ENEMY;
+            return false;
+        }
+        life -= DT;
+        return life > 0;
+    }
+
+private:
+    float x, y, vx, vy, life;
+};
+
+static bool self_check()
+{
+    bool ok = true;
+    int checked = 0;
+    SpatialGrid g(600, 1.0f, 64);
+    rng_state = 5;
+    for (int i = 0; i < 600; i++)
+        g.insert(i, frand(0, 40), frand(0, 40), i % 10 == 0 ? frand(0.6f, 3) : 0.3f,
+                 i % 10 == 0 ? GRID_STATIC : GRID_ENEMY);
+    for (int q = 0; q < 20000 && ok; q++)
+    {
+        float x0 = frand(-2, 42), y0 = frand(-2, 42), x1 = x0 + frand(-3, 3), y1 = y0 + frand(-3, 3);
+        float t = -1, best = 2;
+        int hit = g.segment_first(x0, y0, x1, y1, 0.05f, GRID_ENEMY | GRID_STATIC, &t), ref = -1;
+        // 전부 훑기: 선분을 잘게 나눠 처음 겹치는 점
+        for (int i = 0; i < 600; i++)
+        {
+            float dx = x1 - x0, dy = y1 - y0, fx = x0 - g.x(i), fy = y0 - g.y(i), rr = g.radius(i) + 0.05f;
+            float a = dx * dx + dy * dy, b = fx * dx + fy * dy, c = fx * fx + fy * fy - rr * rr, s;
+            if (c <= 0)
+                s = 0;
+            else if (b * b - a * c < 0 || b >= 0)
+                continue;
+            else
+                s = (-b - std::sqrt(b * b - a * c)) / a;
+            if (s <= 1 && s < best)
+            {
+                best = s;
+                ref = i;
+            }
+        }
+        ok &= hit == ref && (hit < 0 || std::fabs(t - best) < 1e-5f);
+        checked++;
+    }
+
+    // 좀비 하나를 향해 한 프레임에 10 씩 가는 총알: 건너뛰지 않고 맞는다
+    SpatialGrid one(4, 1.0f);
+    one.insert(0, 5.2f, 0, 0.3f, GRID_ENEMY);
+    ProjectilePool p(4);
+    p.fire(0, 0, 1, 0, 600, 25, 5);
+    int n = p.update(DT, one, GRID_ENEMY);
+    ok &= n == 1 && p.count() == 0 && p.hits()[0].target == 0 && p.hits()[0].damage == 25 &&
+          std::fabs(p.hits()[0].x - 4.85f) < 1e-3f;
+
+    // 아무것도 없으면 lifetime 뒤 없어진다
+    p.fire(0, 10, 0, 1, 20, 25, 0.5f);
+    int frames = 0;
+    while (p.count() > 0 && frames < 100)
+    {
+        p.update(DT, one, GRID_ENEMY);
+        frames++;
+    }
+    ok &= frames == 30;
+    printf("자체 검사: %s (선분 %d 개)\n\n", ok ? "통과" : "실패", checked);
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    int live = argc > 1 ? atoi(argv[1]) : 50000;
+    int frames = argc > 2 ? atoi(argv[2]) : 600;
+    const int zombies = 20000, walls = 2000;
+
+    if (!self_check())
+        return 1;
+
+    SpatialGrid grid(zombies + walls, 1.0f, 1 << 17); // 넓고 성긴 지도: 버킷을 넉넉히
+    rng_state = 3;
+    build_map(grid, zombies, walls);
+
+    double t_pool, t_object;
+    long long pool_hits = 0, object_hits = 0, pool_fired = 0, object_fired = 0;
+    float x, y, vx, vy;
+    {
+        ProjectilePool pool(live);
+        rng_state = 9;
+        // 처음부터 live 발이 날아다니도록 나이를 섞어서 쏜다
+        for (int i = 0; i < live; i++)
+        {
+            random_shot(x, y, vx, vy);
+            pool.fire(x, y, vx, vy, SPEED, 25, frand(0, LIFETIME));
+        }
+        double t = now_sec();
+        for (int f = 0; f < frames; f++)
+        {
+            while (pool.count() < live)
+            {
+                random_shot(x, y, vx, vy);
+                pool.fire(x, y, vx, vy, SPEED, 25, LIFETIME);
+                pool_fired++;
+            }
+            int n = pool.update(DT, grid, GRID_ENEMY | GRID_STATIC);
+            for (int k = 0; k < n; k++)
+                pool_hits += pool.hits()[k].layer == GRID_ENEMY;
+        }
+        t_pool = now_sec() - t;
+    }
+    {
+        std::vector<BulletObject *> bullets;
+        int buf[8];
+        rng_state = 9;
+        for (int i = 0; i < live; i++)
+        {
+            random_shot(x, y, vx, vy);
+            bullets.push_back(new BulletObject(x, y, vx, vy, frand(0, LIFETIME)));
+        }
+        double t = now_sec();
+        for (int f = 0; f < frames; f++)
+        {
+            while ((int)bullets.size() < live)
+            {
+                random_shot(x, y, vx, vy);
+                bullets.push_back(new BulletObject(x, y, vx, vy, LIFETIME)); // Instantiate
+                object_fired++;
+            }
+            int hits = 0;
+            size_t w = 0;
+            for (size_t i = 0; i < bullets.size(); i++)
+            {
+                if (bullets[i]->Update(grid, buf, hits))
+                    bullets[w++] = bullets[i];
+                else
+                    delete bullets[i]; // Destroy
+            }
+            bullets.resize(w);
+            object_hits += hits;
+        }
+        t_object = now_sec() - t;
+        for (size_t i = 0; i < bullets.size(); i++)
+            delete bullets[i];
+    }
+
+    double shots = (double)live * frames; // 총알-프레임 수
+    printf("총알 %d 발 유지, 좀비 %d, 벽 %d, %d 프레임 (새로 쏜 수: 객체 %lld, 풀 %lld)\n", live, zombies, walls, frames,
+           object_fired, pool_fired);
+    printf("  객체마다 new/delete, 끝점만 검사 : %6.2f ns/발, 프레임당 %7.3f ms, 좀비 맞음 %lld\n", t_object * 1e9 / shots,
+           t_object * 1e3 / frames, object_hits);
+    printf("  풀 + 선분 검사                   : %6.2f ns/발, 프레임당 %7.3f ms, 좀비 맞음 %lld\n", t_pool * 1e9 / shots,
+           t_pool * 1e3 / frames, pool_hits);
+    return 0;
+}
@@ -0,0 +1,229 @@
+// session_sim.h 로 한 판을 수천 번 돌려 밸런스 보기 (리눅스에서 화면 없이, CPU 만)
+//
+//   1) 자체 검사: 같은 시드면 같은 결과인지 (다시 돌려도, 스레드 수를 바꿔도),
+//      좀비가 없으면 RUSH 봇이 다치지 않고 탈출하는지, 무적 시간 때문에 받는 데미지에 상한이 있는지,
+//      직접 만든 정책 함수가 쓰이는지
+//   2) 봇 정책마다 N 판: 탈출/사망/시간 초과 비율, 버틴 시간, 처치 수, 웨이브별 부하(스폰, 처치, 평균/최대 좀비 수, 받은 데미지)
+//      그리고 시뮬레이션 속도 (시뮬레이션 초 / 실제 초)
+//
+// 컴파일 예: g++ -std=c++11 -O2 -pthread SessionSimBench.cpp -o SessionSimBench
+// 실행 예:   ./SessionSimBench 2000 8   (정책마다 판 수, 스레드 수. 스레드 0 이면 코어 수만큼)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "session_sim.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Batch
+{
+    std::vector<SimResult> results;
+    std::vector<SimWave> waves; // 웨이브별 합
+    std::vector<int> reached;   // 웨이브별 그 웨이브까지 간 판 수
+    double sim_seconds, wall_seconds;
+};
+
+// 시드 seed0 ~ seed0+n-1 을 threads 개 스레드로 (판 번호 순서대로 결과를 모아서 스레드 수와 상관없음)
+static Batch run_batch(const SimParams &p, int policy, uint64_t seed0, int n, int threads)
+{
+    Batch b;
+    b.results.resize(n);
+    std::vector<std::vector<SimWave> > waves(n);
+    std::atomic<int> next(0);
+    double t = now_sec();
+    std::vector<std::thread> pool;
+    for (int k = 0; k < threads; k++)
+        pool.push_back(std::thread([&]() {
+            SessionSim sim(p, seed0);
+            sim.set_policy(policy);
+            for (int i; (i = next.fetch_add(1)) < n;)
+            {
+                sim.reset(seed0 + i);
+                b.results[i] = sim.run();
+                waves[i] = sim.waves();
+            }
+        }));
+    for (size_t k = 0; k < pool.size(); k++)
+        pool[k].join();
+    b.wall_seconds = now_sec() - t;
+    b.sim_seconds = 0;
+    for (int i = 0; i < n; i++)
+    {
+        b.sim_seconds += b.results[i].time;
+        if (waves[i].size() > b.waves.size())
+        {
+            b.waves.resize(waves[i].size(), SimWave());
+            b.reached.resize(waves[i].size(), 0);
+        }
+        for (size_t w = 0; w < waves[i].size(); w++)
+        {
+            SimWave &s = b.waves[w];
+            s.spawned += waves[i][w].spawned;
+            s.kills += waves[i][w].kills;
+            s.peak_zombies = std::max(s.peak_zombies, waves[i][w].peak_zombies);
+            s.damage_taken += waves[i][w].damage_taken;
+            s.zombie_seconds += waves[i][w].zombie_seconds;
+            b.reached[w]++;
+        }
+    }
+    return b;
+}
+
+static bool same(const SimResult &a, const SimResult &b)
+{
+    return memcmp(&a, &b, sizeof(SimResult)) == 0;
+}
+
+// 직접 만든 정책: 늘 오른쪽으로 걷기만
+static void walk_right(const SessionSim &, SimInput *in, void *ctx)
+{
+    in->move_x = 1;
+    ++*(int *)ctx;
+}
+
+static bool self_check(const SimParams &p)
+{
+    bool ok = true;
+
+    // 다시 돌려도 같은 결과
+    for (uint64_t seed = 1; seed <= 20 && ok; seed++)
+        for (int policy = 0; policy < 3 && ok; policy++)
+        {
+            SessionSim a(p, seed), b(p, 999);
+            a.set_policy(policy);
+            b.set_policy(policy);
+            b.run(); // 다른 판을 돌린 뒤 reset 해도
+            b.reset(seed);
+            ok &= same(a.run(), b.run()) && a.waves().size() == b.waves().size();
+            for (size_t w = 0; w < a.waves().size() && ok; w++)
+                ok &= memcmp(&a.waves()[w], &b.waves()[w], sizeof(SimWave)) == 0;
+        }
+
+    // 스레드 수와 상관없이 같은 결과
+    Batch one = run_batch(p, SIM_POLICY_CAUTIOUS, 100, 64, 1), four = run_batch(p, SIM_POLICY_CAUTIOUS, 100, 64, 4);
+    for (int i = 0; i < 64 && ok; i++)
+        ok &= same(one.results[i], four.results[i]);
+
+    // 좀비가 없으면 다치지 않고 탈출 (상자를 다 돌아도 제한 시간 안)
+    SimParams calm = p;
+    calm.spawn.maxZombies = 0;
+    calm.spawn.maxZombiesIncrease = 0;
+    for (uint64_t seed = 1; seed <= 20 && ok; seed++)
+    {
+        SessionSim s(calm, seed);
+        const SimResult &r = s.run();
+        ok &= r.outcome == SIM_ESCAPED && r.damage_taken == 0 && r.items == calm.requiredItems && r.kills == 0 &&
+              r.spawned == 0 && r.time >= calm.repairDuration;
+    }
+
+    // 무적 시간: 받은 데미지 <= (버틴 시간 / 무적 시간 + 1) * 한 번 데미지
+    SimParams swarm = p;
+    swarm.spawn.spawnInterval = 0.2f;
+    swarm.spawn.maxZombies = 200;
+    for (uint64_t seed = 1; seed <= 10 && ok; seed++)
+    {
+        SessionSim s(swarm, seed);
+        s.set_policy(SIM_POLICY_TURTLE);
+        const SimResult &r = s.run();
+        ok &= r.outcome != SIM_ESCAPED && r.searched == 0 &&
+              r.damage_taken <= (r.time / swarm.invincibilityTime + 1) * swarm.zombieDamage + 1e-3f;
+    }
+
+    // 정책 함수: 불리는 횟수 = 걸음 수, 오른쪽 벽에 붙는다
+    int calls = 0;
+    SessionSim s(calm, 5);
+    s.set_policy(walk_right, &calls);
+    const SimResult &r = s.run();
+    ok &= r.outcome == SIM_TIMEOUT && s.player_x() == calm.mapHalf &&
+          calls == (int)(calm.gameDuration / calm.dt + 0.5f) && r.items == 0;
+
+    // 잘못된 dt (C# 에서 그대로 올 수 있음): SIM_MIN_DT 로 돌고 끝난다. 제한 시간이 NaN 이면 한 걸음
+    float bad_dt[3] = {0, -1, NAN};
+    for (int k = 0; k < 3 && ok; k++)
+    {
+        SimParams odd = calm;
+        odd.dt = bad_dt[k];
+        odd.gameDuration = 2;
+        calls = 0;
+        SessionSim t(odd, 5);
+        t.set_policy(walk_right, &calls);
+        ok &= t.run().outcome == SIM_TIMEOUT && t.params().dt == SIM_MIN_DT && calls == (int)(2 / SIM_MIN_DT + 0.5f);
+    }
+    SimParams endless = calm;
+    endless.gameDuration = NAN;
+    calls = 0;
+    SessionSim e(endless, 5);
+    e.set_policy(walk_right, &calls);
+    ok &= e.run().outcome == SIM_TIMEOUT && calls == 1;
+
+    printf("자체 검사: %s\n\n", ok ? "통과" : "실패");
+    return ok;
+}
+
+static void report(const char *name, const SimParams &p, const Batch &b, bool show_waves)
+{
+    int n = (int)b.results.size(), outcome[4] = {0, 0, 0, 0};
+    double kills = 0, damage = 0, items = 0;
+    std::vector<float> survived;
+    for (int i = 0; i < n; i++)
+    {
+        const SimResult &r = b.results[i];
+        outcome[r.outcome]++;
+        kills += r.kills;
+        damage += r.damage_taken;
+        items += r.items;
+        if (r.outcome == SIM_DIED)
+            survived.push_back(r.time);
+    }
+    std::sort(survived.begin(), survived.end());
+    printf("%-9s %d 판: 탈출 %5.1f%%, 사망 %5.1f%%, 시간 초과 %5.1f%% | 처치 %5.1f, 받은 데미지 %5.1f, 필수 아이템 %.2f/%d",
+           name, n, 100.0 * outcome[SIM_ESCAPED] / n, 100.0 * outcome[SIM_DIED] / n, 100.0 * outcome[SIM_TIMEOUT] / n,
+           kills / n, damage / n, items / n, p.requiredItems);
+    if (!survived.empty())
+        printf(" | 죽은 판 버틴 시간 중앙값 %.0f 초", survived[survived.size() / 2]);
+    printf("\n          속도: 시뮬레이션 %.0f 초를 %.2f 초에 = %.0f 배 (시뮬레이션 초 / 실제 초)\n", b.sim_seconds,
+           b.wall_seconds, b.sim_seconds / b.wall_seconds);
+    if (!show_waves)
+        return;
+    printf("          웨이브  도달 판  스폰/판  처치/판  평균 좀비  최대 좀비  데미지/판\n");
+    float len = p.spawn.difficultyIncreaseInterval;
+    for (size_t w = 0; w < b.waves.size(); w++)
+    {
+        const SimWave &s = b.waves[w];
+        double r = b.reached[w];
+        printf("          %5d  %7d  %7.1f  %7.1f  %9.1f  %9d  %9.1f\n", (int)w + 1, b.reached[w], s.spawned / r,
+               s.kills / r, s.zombie_seconds / r / len, s.peak_zombies, s.damage_taken / r);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 2000;
+    int threads = argc > 2 ? atoi(argv[2]) : 0;
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    SimParams p = sim_default_params();
+    if (!self_check(p))
+        return 1;
+    printf("MainGame 설정 (제한 %.0f 초, 스폰 %.0f 초마다 최대 %d, %.0f 초마다 x%.1f / +%d), 스레드 %d\n\n",
+           p.gameDuration, p.spawn.spawnInterval, p.spawn.maxZombies, p.spawn.difficultyIncreaseInterval,
+           p.spawn.intervalScale, p.spawn.maxZombiesIncrease, threads);
+    const char *names[3] = {"RUSH", "CAUTIOUS", "TURTLE"};
+    for (int policy = 0; policy < 3; policy++)
+    {
+        Batch b = run_batch(p, policy, 1, n, threads);
+        report(names[policy], p, b, policy != SIM_POLICY_RUSH);
+        printf("\n");
+    }
+    return 0;
+}
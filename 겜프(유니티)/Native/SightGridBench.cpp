@@ -0,0 +1,233 @@
+// sight_grid.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: 칸 DDA 결과를 기하 기준(선분이 칸 안쪽을 지나는지 + 꼭짓점 규칙)과 무작위 칸 쌍마다 비교,
+//      캐시를 쓴 query 가 좀비마다 줄을 그은 것과 같은지 (플레이어가 움직여도, 벽이 바뀌어도),
+//      같은 칸에 있으면 다시 긋지 않는지, detect 상태가 DetectPlayer 규칙 + 보일 때만 과 같은지
+//   2) 256x256 지도(벽 사각형), 좀비 10000 마리가 플레이어 둘레 120x120 안에 있을 때 프레임마다
+//      좀비마다 줄 긋기(Raycast 흉내)와 query (플레이어가 칸을 옮길 때 / 가만히 있을 때), detect(detectionRange 5) 비교
+//
+// 컴파일 예: g++ -std=c++11 -O2 SightGridBench.cpp -o SightGridBench
+// 실행 예:   ./SightGridBench 10000 300   (좀비 수, 프레임 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "sight_grid.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static int irand(int n)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return (int)((rng_state >> 8) % (unsigned)n);
+}
+
+static float frand() { return (float)irand(1 << 20) / (1 << 20); }
+
+// 기준: 칸 (cx, cy) 는 [cx, cx+1] x [cy, cy+1]. 선분이 막힌 칸의 안쪽을 지나거나,
+// 꼭짓점을 정확히 지나면서 옆의 두 칸이 모두 막혔으면 안 보임 (양 끝 칸 제외)
+static bool reference(const SightGrid &g, int ax, int ay, int bx, int by)
+{
+    double x0 = ax + 0.5, y0 = ay + 0.5, dx = bx - ax, dy = by - ay;
+    int lx = ax < bx ? ax : bx, hx = ax < bx ? bx : ax, ly = ay < by ? ay : by, hy = ay < by ? by : ay;
+    for (int cy = ly; cy <= hy; cy++)
+        for (int cx = lx; cx <= hx; cx++)
+        {
+            if ((cx == ax && cy == ay) || (cx == bx && cy == by) || !g.blocked(cx, cy))
+                continue;
+            // 선분 t in [0, 1] 이 열린 칸 (cx, cx+1) x (cy, cy+1) 을 지나는지 (slab)
+            double t0 = 0, t1 = 1;
+            bool hit = true;
+            double lo[2] = {(double)cx, (double)cy}, o[2] = {x0, y0}, d[2] = {dx, dy};
+            for (int a = 0; a < 2 && hit; a++)
+            {
+                if (d[a] == 0)
+                    hit = o[a] > lo[a] && o[a] < lo[a] + 1;
+                else
+                {
+                    double ta = (lo[a] - o[a]) / d[a], tb = (lo[a] + 1 - o[a]) / d[a];
+                    if (ta > tb)
+                        std::swap(ta, tb);
+                    t0 = std::max(t0, ta);
+                    t1 = std::min(t1, tb);
+                    hit = t1 - t0 > 1e-9;
+                }
+            }
+            if (hit)
+                return false;
+        }
+    // 꼭짓점 (i, j): 2 * ((i, j) - 시작) = (2i - 2ax - 1, 2j - 2ay - 1) 이 (dx, dy) 와 같은 방향이고 안쪽
+    for (int j = ly + 1; j <= hy; j++)
+        for (int i = lx + 1; i <= hx; i++)
+        {
+            long long ux = 2 * i - 2 * ax - 1, uy = 2 * j - 2 * ay - 1;
+            if (ux * (long long)dy != uy * (long long)dx)
+                continue;
+            bool same = (dx > 0) == (dy > 0);
+            bool side = same ? g.blocked(i, j - 1) && g.blocked(i - 1, j) : g.blocked(i - 1, j - 1) && g.blocked(i, j);
+            if (side)
+                return false;
+        }
+    return true;
+}
+
+static bool self_check()
+{
+    bool ok = true;
+    const int W = 48;
+    SightGrid g(W, W);
+    rng_state = 3;
+    for (int cy = 0; cy < W; cy++)
+        for (int cx = 0; cx < W; cx++)
+            g.set_blocked(cx, cy, irand(100) < 30);
+    int pairs = 0;
+    for (int k = 0; k < 200000 && ok; k++, pairs++)
+    {
+        int ax = irand(W), ay = irand(W), bx, by;
+        if (k % 3 == 0)
+        {
+            int d = irand(W), sx = irand(2) ? 1 : -1, sy = irand(2) ? 1 : -1; // 대각선 (꼭짓점을 지남)
+            bx = ax + sx * d;
+            by = ay + sy * d;
+            if (!g.inside(bx, by))
+                continue;
+        }
+        else
+        {
+            bx = irand(W);
+            by = irand(W);
+        }
+        ok &= g.trace(ax, ay, bx, by) == reference(g, ax, ay, bx, by);
+    }
+
+    // 캐시를 쓴 query 와 좀비마다 줄 긋기 비교
+    const int N = 3000;
+    std::vector<float> xy(N * 2);
+    for (int i = 0; i < N * 2; i++)
+        xy[i] = frand() * (W + 4) - 2; // 지도 밖도 조금
+    std::vector<uint32_t> bits((N + 31) / 32);
+    std::vector<uint8_t> state(N);
+    for (int f = 0; f < 40 && ok; f++)
+    {
+        float px = 5 + f * 0.9f, py = 20 + (f % 7) * 0.3f;
+        if (f == 20)
+            g.set_blocked(g.cell_x(px) + 1, g.cell_y(py), true); // 벽이 바뀌면 캐시를 버린다
+        float range = f % 2 ? 0 : 12.0f;
+        int count = g.query(px, py, &xy[0], N, range, &bits[0]), expect = 0;
+        int pcx = g.cell_x(px), pcy = g.cell_y(py);
+        for (int i = 0; i < N; i++)
+        {
+            float dx = xy[i * 2] - px, dy = xy[i * 2 + 1] - py;
+            int cx = std::min(std::max(g.cell_x(xy[i * 2]), 0), W - 1), cy = std::min(std::max(g.cell_y(xy[i * 2 + 1]), 0), W - 1);
+            bool v = (range <= 0 || dx * dx + dy * dy <= range * range) && g.trace(pcx, pcy, cx, cy);
+            ok &= ((bits[i >> 5] >> (i & 31) & 1) != 0) == v;
+            expect += v;
+        }
+        ok &= count == expect;
+
+        // 같은 칸 안에서 조금 움직이면 한 줄도 다시 긋지 않는다 (range 가 있으면 경계의 좀비가 새로 들어올 수 있어서 제자리)
+        long long traces = g.traces();
+        float nudge = range > 0 ? 0 : 0.01f;
+        ok &= g.query(px + nudge, py, &xy[0], N, range, &bits[0]) == count && g.traces() == traces;
+
+        // detect: 보일 때만, attack 안이면 공격
+        g.detect(px, py, &xy[0], N, 5.0f, 1.0f, &state[0], 0);
+        for (int i = 0; i < N; i++)
+        {
+            float dx = xy[i * 2] - px, dy = xy[i * 2 + 1] - py, d2 = dx * dx + dy * dy;
+            bool v = d2 <= 25.0f && g.visible(px, py, xy[i * 2], xy[i * 2 + 1]);
+            int expect_state = !v ? SIGHT_WANDER : d2 <= 1.0f ? SIGHT_ATTACK : SIGHT_CHASE;
+            ok &= state[i] == expect_state;
+        }
+    }
+    printf("자체 검사: %s (칸 쌍 %d 개)\n\n", ok ? "통과" : "실패", pairs);
+    return ok;
+}
+
+// 벽 사각형을 흩어 놓는다 (FlowFieldBench 와 비슷하게)
+static void make_walls(SightGrid &g, unsigned seed)
+{
+    rng_state = seed;
+    int w = g.width(), h = g.height();
+    for (int k = 0; k < w * h / 200; k++)
+    {
+        int x = irand(w), y = irand(h), len = 3 + irand(12);
+        bool horizontal = irand(2) != 0;
+        for (int i = 0; i < len; i++)
+            g.set_blocked(horizontal ? x + i : x, horizontal ? y : y + i, true);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? atoi(argv[2]) : 300;
+    if (!self_check())
+        return 1;
+
+    const int W = 256;
+    SightGrid g(W, W, -128, -128, 1);
+    make_walls(g, 17);
+    int walls = 0;
+    for (int cy = 0; cy < W; cy++)
+        for (int cx = 0; cx < W; cx++)
+            walls += g.blocked(cx, cy);
+    std::vector<float> xy(n * 2);
+    rng_state = 5;
+    for (int i = 0; i < n * 2; i++)
+        xy[i] = frand() * 120 - 60;
+    std::vector<uint32_t> bits((n + 31) / 32);
+    std::vector<uint8_t> state(n);
+    printf("지도 %dx%d (벽 %.1f%%), 좀비 %d 마리, %d 프레임\n", W, W, 100.0 * walls / (W * W), n, frames);
+
+    // 좀비는 프레임마다 조금씩 움직인다 (칸을 가끔 옮김)
+    struct Mode
+    {
+        const char *name;
+        int kind;      // 0 좀비마다 줄, 1 query, 2 detect
+        bool moving;   // 플레이어가 프레임마다 다른 칸으로
+        float range;
+    } modes[] = {
+        {"좀비마다 줄 긋기 (Raycast 흉내)", 0, true, 0},
+        {"query, 플레이어 칸 옮김", 1, true, 0},
+        {"query, 플레이어 가만히", 1, false, 0},
+        {"detect 5 / 1, 플레이어 칸 옮김", 2, true, 5},
+        {"detect 5 / 1, 플레이어 가만히", 2, false, 5},
+    };
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+    {
+        const Mode &mode = modes[m];
+        long long traces = g.traces(), hits = g.cache_hits(), seen = 0;
+        double t = 0;
+        for (int f = 0; f < frames; f++)
+        {
+            for (int i = 0; i < n * 2; i++)
+                xy[i] += (i * 7 + f) % 5 == 0 ? 0.05f : 0;
+            float px = mode.moving ? (f % 40) * 1.0f - 20 : 0.5f, py = mode.moving ? (f / 40) * 1.0f : 0.5f;
+            double t0 = now_sec();
+            if (mode.kind == 0)
+            {
+                int pcx = g.cell_x(px), pcy = g.cell_y(py);
+                for (int i = 0; i < n; i++)
+                    seen += g.trace(pcx, pcy, g.cell_x(xy[i * 2]), g.cell_y(xy[i * 2 + 1])); // traces() 에 안 잡힘
+            }
+            else if (mode.kind == 1)
+                seen += g.query(px, py, &xy[0], n, mode.range, &bits[0]);
+            else
+                seen += g.detect(px, py, &xy[0], n, mode.range, 1.0f, &state[0], &bits[0]);
+            t += now_sec() - t0;
+        }
+        long long drawn = mode.kind == 0 ? (long long)n * frames : g.traces() - traces;
+        printf("  %-40s: 프레임당 %8.1f us (마리당 %6.1f ns), 프레임당 줄 %7.0f, 캐시 %7.0f, 보임 %7.0f\n", mode.name,
+               t * 1e6 / frames, t * 1e9 / frames / n, (double)drawn / frames,
+               (double)(g.cache_hits() - hits) / frames, (double)seen / frames);
+    }
+    return 0;
+}
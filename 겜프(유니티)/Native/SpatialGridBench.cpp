@@ -0,0 +1,266 @@
+// spatial_grid.h 검사와 속도 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: 넣기/옮기기/지우기를 섞은 뒤 원, 부채꼴, any 찾기 결과가 전부 훑어본 결과와 같은지
+//   2) 물체 N 개(기본 100000: 건물/벽 20%, 좀비 80%)를 400x400 지도에 놓고 프레임마다
+//      좀비 전부 옮기기 + 스폰 위치 검사(IsPositionValid) + 근접 공격(PerformAttack) 찾기
+//      OverlapCircleAll 처럼 부를 때마다 결과 배열을 새로 만들고 전부 훑는 방식과 비교
+//
+// 컴파일 예: g++ -std=c++11 -O2 SpatialGridBench.cpp -o SpatialGridBench
+// 실행 예:   ./SpatialGridBench 100000 300   (물체 수, 프레임 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "spatial_grid.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static float frand(float lo, float hi)
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return lo + (rng_state >> 8) * (1.0f / 16777216.0f) * (hi - lo);
+}
+
+struct Body
+{
+    float x, y, r;
+    uint32_t layer;
+    bool live;
+};
+
+// 비교용: Physics2D.OverlapCircleAll 처럼 새 배열에 담아 돌려준다 (전부 훑기)
+static std::vector<int> *overlap_all(const std::vector<Body> &b, float x, float y, float r, uint32_t mask)
+{
+    std::vector<int> *hits = new std::vector<int>();
+    for (size_t i = 0; i < b.size(); i++)
+    {
+        if (!b[i].live || !(b[i].layer & mask))
+            continue;
+        float dx = b[i].x - x, dy = b[i].y - y, rr = r + b[i].r;
+        if (dx * dx + dy * dy <= rr * rr)
+            hits->push_back((int)i);
+    }
+    return hits;
+}
+
+// MeleeWeapon.PerformAttack: 원 안에서 Vector2.Dot(direction, toEnemy.normalized) > 0.5
+static std::vector<int> *melee_all(const std::vector<Body> &b, float x, float y, float r, float dx, float dy)
+{
+    std::vector<int> *hits = overlap_all(b, x, y, r, GRID_ENEMY);
+    std::vector<int> *in = new std::vector<int>();
+    for (size_t k = 0; k < hits->size(); k++)
+    {
+        const Body &e = b[(*hits)[k]];
+        float ex = e.x - x, ey = e.y - y, len = std::sqrt(ex * ex + ey * ey);
+        if (len > 0 && (ex * dx + ey * dy) / len > 0.5f)
+            in->push_back((*hits)[k]);
+    }
+    delete hits;
+    return in;
+}
+
+static void place(std::vector<Body> &b, SpatialGrid *g, int n, float size)
+{
+    b.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        Body &e = b[i];
+        e.x = frand(0, size);
+        e.y = frand(0, size);
+        // 20% 건물/벽 (반지름 0.5 ~ 3), 나머지 좀비 (0.3), 가끔 트리거
+        if (i % 5 == 0)
+        {
+            e.r = frand(0.5f, 3);
+            e.layer = i % 25 == 0 ? GRID_TRIGGER : GRID_STATIC;
+        }
+        else
+        {
+            e.r = 0.3f;
+            e.layer = GRID_ENEMY;
+        }
+        e.live = true;
+        if (g)
+            g->insert(i, e.x, e.y, e.r, e.layer);
+    }
+}
+
+static bool same(std::vector<int> &a, const int *b, int nb)
+{
+    std::vector<int> s(b, b + nb);
+    std::sort(a.begin(), a.end());
+    std::sort(s.begin(), s.end());
+    return a == s;
+}
+
+static bool self_check()
+{
+    const int n = 5000;
+    const float size = 60;
+    std::vector<Body> b;
+    SpatialGrid g(n, 1.0f, 64); // 버킷을 적게 잡아 해시 충돌도 확인
+    std::vector<int> out(n);
+    bool ok = true;
+    int checked = 0;
+    rng_state = 11;
+    place(b, &g, n, size);
+    for (int round = 0; round < 20 && ok; round++)
+    {
+        // 좀비는 걷고, 가끔 죽었다가 다시 생기고, 건물도 가끔 옮긴다
+        for (int i = 0; i < n; i++)
+        {
+            Body &e = b[i];
+            if (e.layer == GRID_ENEMY && e.live)
+            {
+                e.x += frand(-1.5f, 1.5f);
+                e.y += frand(-1.5f, 1.5f);
+                g.move(i, e.x, e.y);
+            }
+            if (frand(0, 1) < 0.02f)
+            {
+                if (e.live)
+                    g.remove(i);
+                else
+                    g.insert(i, e.x, e.y, e.r, e.layer);
+                e.live = !e.live;
+            }
+            else if (e.layer == GRID_STATIC && e.live && frand(0, 1) < 0.01f)
+            {
+                e.x = frand(0, size);
+                g.move(i, e.x, e.y);
+            }
+        }
+        for (int q = 0; q < 200 && ok; q++)
+        {
+            float x = frand(-5, size + 5), y = frand(-5, size + 5);
+            float r = q % 50 == 0 ? frand(5, 40) : frand(0, 3);
+            uint32_t mask = q % 3 == 0 ? GRID_STATIC : q % 3 == 1 ? GRID_ENEMY : GRID_STATIC | GRID_ENEMY | GRID_TRIGGER;
+            std::vector<int> *ref = overlap_all(b, x, y, r, mask);
+            int k = g.query_circle(x, y, r, mask, out.data(), n);
+            ok &= same(*ref, out.data(), k);
+            ok &= g.any_in_circle(x, y, r, mask) == !ref->empty();
+            delete ref;
+            float a = frand(0, 6.2831853f);
+            ref = melee_all(b, x, y, r, std::cos(a), std::sin(a));
+            k = g.query_sector(x, y, r, std::cos(a), std::sin(a), 0.5f, GRID_ENEMY, out.data(), n);
+            ok &= same(*ref, out.data(), k);
+            delete ref;
+            checked += 3;
+        }
+    }
+    // 자리가 모자라면 앞에서 max 개만 쓰고 전체 수를 돌려준다
+    int all = g.query_circle(size / 2, size / 2, 10, GRID_ENEMY, out.data(), n);
+    ok &= all > 4 && g.query_circle(size / 2, size / 2, 10, GRID_ENEMY, out.data(), 4) == all;
+    printf("자체 검사: %s (찾기 %d 번)\n\n", ok ? "통과" : "실패", checked);
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int frames = argc > 2 ? atoi(argv[2]) : 300;
+    const float size = 400;
+    const int spawn_checks = 200, attacks = 50; // 프레임마다
+    const int brute_queries = 200;
+
+    if (!self_check())
+        return 1;
+
+    std::vector<Body> b;
+    rng_state = 3;
+    double t = now_sec();
+    SpatialGrid g(n, 1.0f);
+    place(b, &g, n, size);
+    double t_build = now_sec() - t;
+
+    std::vector<int> ids, out(1024);
+    std::vector<float> xy;
+    for (int i = 0; i < n; i++)
+        if (b[i].layer == GRID_ENEMY)
+            ids.push_back(i);
+    xy.resize(ids.size() * 2);
+
+    double t_move = 0, t_spawn = 0, t_melee = 0;
+    long long valid = 0, hits = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        // 좀비가 한 프레임(1/60 초)에 최대 3 * dt 만큼 걷는다
+        for (size_t k = 0; k < ids.size(); k++)
+        {
+            Body &e = b[ids[k]];
+            e.x += frand(-0.05f, 0.05f);
+            e.y += frand(-0.05f, 0.05f);
+            xy[2 * k] = e.x;
+            xy[2 * k + 1] = e.y;
+        }
+        t = now_sec();
+        g.move_many(ids.data(), xy.data(), (int)ids.size());
+        t_move += now_sec() - t;
+
+        t = now_sec();
+        for (int s = 0; s < spawn_checks; s++)
+        {
+            // FindValidSpawnPosition: 원래 위치 + 3 안쪽 무작위 10번
+            float sx = frand(0, size), sy = frand(0, size);
+            for (int a = 0; a <= 10; a++)
+            {
+                float x = a == 0 ? sx : sx + frand(-3, 3), y = a == 0 ? sy : sy + frand(-3, 3);
+                if (!g.any_in_circle(x, y, 0.3f, GRID_STATIC))
+                {
+                    valid++;
+                    break;
+                }
+            }
+        }
+        t_spawn += now_sec() - t;
+
+        t = now_sec();
+        for (int a = 0; a < attacks; a++)
+        {
+            float ang = frand(0, 6.2831853f);
+            hits += std::min(g.query_sector(frand(0, size), frand(0, size), 1.5f, std::cos(ang), std::sin(ang), 0.5f,
+                                            GRID_ENEMY, out.data(), (int)out.size()),
+                             (int)out.size());
+        }
+        t_melee += now_sec() - t;
+    }
+
+    // 비교: 전부 훑기 + 새 배열
+    long long brute_hits = 0;
+    t = now_sec();
+    for (int q = 0; q < brute_queries; q++)
+    {
+        std::vector<int> *r = overlap_all(b, frand(0, size), frand(0, size), 0.3f, GRID_STATIC);
+        brute_hits += (long long)r->size();
+        delete r;
+    }
+    double t_brute = (now_sec() - t) / brute_queries;
+    t = now_sec();
+    for (int q = 0; q < brute_queries; q++)
+    {
+        float ang = frand(0, 6.2831853f);
+        std::vector<int> *r = melee_all(b, frand(0, size), frand(0, size), 1.5f, std::cos(ang), std::sin(ang));
+        brute_hits += (long long)r->size();
+        delete r;
+    }
+    double t_brute_melee = (now_sec() - t) / brute_queries;
+
+    double spawn_queries = (double)frames * spawn_checks; // 검사 한 번에 원 찾기 최대 11번
+    printf("물체 %d 개 (좀비 %d), %d 프레임, 만들기 %.1f ms (스폰 성공 %lld, 공격 맞음 %lld, 비교 %lld)\n", n,
+           (int)ids.size(), frames, t_build * 1e3, valid, hits, brute_hits);
+    printf("  좀비 전부 옮기기       : %6.2f ns/마리, 프레임당 %7.3f ms\n", t_move * 1e9 / ((double)frames * ids.size()),
+           t_move * 1e3 / frames);
+    printf("  스폰 위치 검사 (격자)  : %8.3f us/번\n", t_spawn * 1e6 / spawn_queries);
+    printf("  근접 공격 찾기 (격자)  : %8.3f us/번\n", t_melee * 1e6 / ((double)frames * attacks));
+    printf("  원 찾기 (전부 훑기)    : %8.3f us/번\n", t_brute * 1e6);
+    printf("  근접 공격 (전부 훑기)  : %8.3f us/번\n", t_brute_melee * 1e6);
+    return 0;
+}
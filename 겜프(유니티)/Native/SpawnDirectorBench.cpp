@@ -0,0 +1,369 @@
+// spawn_director.h 검사와 한 시간짜리 판 돌리기 (리눅스에서 화면 없이)
+//
+//   1) 자체 검사: 스폰/죽음을 섞어도 살아 있는 집합이 맞는지, 웨이브마다 간격/최대 수가 ZombieSpawner 와 같은지,
+//      프레임마다 update 하든 10초에 한 번 하든 같은 시드면 같은 스폰이 나오는지,
+//      플레이어 가까운 지점을 고르지 않는지, 막힌 자리면 반경 안에서 다시 찾는지
+//   2) 한 시간(3600초)짜리 판 N 번: 좀비는 스폰된 뒤 평균 15초 안에 죽는다 (플레이어가 잡음).
+//      죽음/스폰 시각에만 update 하는 방식과 60fps 로 매 프레임 update 하는 방식,
+//      ZombieSpawner.cs 처럼 매 프레임 리스트를 훑고 스폰마다 후보 리스트를 새로 만드는 방식을 비교
+//      웨이브별 스폰 수, 최대 수에 막힌 수, 가장 많이 살아 있던 수를 보여 준다 (밸런스 확인용)
+//
+// 컴파일 예: g++ -std=c++11 -O2 SpawnDirectorBench.cpp -o SpawnDirectorBench
+// 실행 예:   ./SpawnDirectorBench 100   (판 수)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <set>
+#include <vector>
+#include "spawn_director.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+const float SESSION = 3600, FRAME = 1 / 60.0f, MEAN_LIFE = 15;
+
+// 죽는 시각을 정하는 난수 (감독의 난수와 따로)
+struct KillRng
+{
+    uint64_t s;
+    explicit KillRng(uint64_t seed) : s(seed * 2654435761ULL | 1) {}
+    float life()
+    {
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        float u = (float)((s * 0x2545f4914f6cdd1dULL) >> 40) * (1.0f / 16777216.0f);
+        return -MEAN_LIFE * std::log(1 - u);
+    }
+};
+
+struct WaveStats
+{
+    int spawned, capped, peak;
+};
+
+typedef std::pair<float, int> Death; // (시각, 좀비 번호)
+typedef std::priority_queue<Death, std::vector<Death>, std::greater<Death> > DeathQueue;
+
+// 이벤트 방식: 다음 죽음과 다음 스폰 중 빠른 시각으로 바로 넘어간다
+static void run_events(SpawnDirector &d, uint64_t seed, std::vector<WaveStats> *waves)
+{
+    KillRng kr(seed);
+    DeathQueue deaths;
+    SpawnEvent ev[64];
+    d.set_seed(seed);
+    d.generate_points(0, 0);
+    d.start(0);
+    float t = 0;
+    while (t <= SESSION)
+    {
+        int prev_capped = (int)d.capped();
+        int n = d.update(t, 0, 0, ev, 64);
+        for (int k = 0; k < n; k++)
+            deaths.push(Death(ev[k].time + kr.life(), ev[k].agent));
+        if (waves)
+        {
+            if ((int)waves->size() < d.wave())
+                waves->resize(d.wave(), WaveStats());
+            for (int k = 0; k < n; k++)
+                (*waves)[ev[k].wave - 1].spawned++;
+            WaveStats &w = (*waves)[d.wave() - 1];
+            w.capped += (int)d.capped() - prev_capped;
+            w.peak = std::max(w.peak, d.live_count());
+        }
+        while (!deaths.empty() && deaths.top().first <= t)
+        {
+            d.kill(deaths.top().second);
+            deaths.pop();
+        }
+        float next = (float)d.next_spawn_time();
+        if (!deaths.empty() && deaths.top().first < next)
+            next = deaths.top().first;
+        t = next > t ? next : std::nextafter(t, 1e9f);
+    }
+}
+
+// 매 프레임 update (유니티에서 쓰는 모양)
+static long long run_frames(SpawnDirector &d, uint64_t seed)
+{
+    KillRng kr(seed);
+    DeathQueue deaths;
+    SpawnEvent ev[64];
+    long long spawned = 0;
+    d.set_seed(seed);
+    d.generate_points(0, 0);
+    d.start(0);
+    for (int f = 0; f * FRAME <= SESSION; f++)
+    {
+        float t = f * FRAME;
+        int n = d.update(t, 0, 0, ev, 64);
+        spawned += n;
+        for (int k = 0; k < n; k++)
+            deaths.push(Death(t + kr.life(), ev[k].agent));
+        while (!deaths.empty() && deaths.top().first <= t)
+        {
+            d.kill(deaths.top().second);
+            deaths.pop();
+        }
+    }
+    return spawned;
+}
+
+// 비교용: ZombieSpawner.cs 처럼 (GameObject 대신 new 한 객체, 죽으면 null)
+struct ZombieObject
+{
+    float death;
+};
+
+static long long run_spawner_like(uint64_t seed)
+{
+    KillRng kr(seed);
+    uint64_t rng = seed | 1;
+    std::vector<ZombieObject *> active;
+    std::vector<std::pair<float, float> > points;
+    for (int i = 0; i < 8; i++)
+        points.push_back(std::make_pair(std::cos(i * 0.7853982f) * 15, std::sin(i * 0.7853982f) * 15));
+    float interval = 5, next_spawn = interval, next_difficulty = 60;
+    int max_zombies = 10;
+    long long spawned = 0;
+    for (int f = 0; f * FRAME <= SESSION; f++)
+    {
+        float t = f * FRAME;
+        // 죽은 좀비 (Destroy 뒤 == null)
+        for (size_t i = 0; i < active.size(); i++)
+            if (active[i] && active[i]->death <= t)
+            {
+                delete active[i];
+                active[i] = 0;
+            }
+        // activeZombies.RemoveAll(zombie => zombie == null)
+        std::function<bool(ZombieObject *)> is_null = [](ZombieObject *z) { return z == 0; };
+        active.erase(std::remove_if(active.begin(), active.end(), is_null), active.end());
+        if (t >= next_spawn)
+        {
+            if ((int)active.size() < max_zombies)
+            {
+                // GetRandomSpawnPoint: 매번 새 리스트
+                std::vector<std::pair<float, float> > *valid = new std::vector<std::pair<float, float> >();
+                for (size_t i = 0; i < points.size(); i++)
+                    if (std::sqrt(points[i].first * points[i].first + points[i].second * points[i].second) >= 5)
+                        valid->push_back(points[i]);
+                rng ^= rng >> 12;
+                rng ^= rng << 25;
+                rng ^= rng >> 27;
+                (void)(*valid)[(rng * 0x2545f4914f6cdd1dULL >> 33) % valid->size()];
+                delete valid;
+                ZombieObject *z = new ZombieObject;
+                z->death = t + kr.life();
+                active.push_back(z);
+                spawned++;
+            }
+            next_spawn = t + interval;
+        }
+        if (t >= next_difficulty)
+        {
+            interval = std::max(1.0f, interval * 0.9f);
+            max_zombies += 2;
+            next_difficulty = t + 60;
+        }
+    }
+    for (size_t i = 0; i < active.size(); i++)
+        delete active[i];
+    return spawned;
+}
+
+static bool blocked_right(float x, float, void *)
+{
+    return x < 14; // 오른쪽 지점(15, 0) 둘레는 막힘
+}
+
+static bool self_check()
+{
+    bool ok = true;
+
+    // 살아 있는 집합: 무작위로 스폰/죽음
+    {
+        SpawnParams p = spawn_default_params();
+        p.spawnInterval = 0.1f;
+        p.maxZombies = 500;
+        p.perSpawn = 7;
+        SpawnDirector d(600, 3);
+        d.set_params(p);
+        d.generate_points(0, 0);
+        d.start(0);
+        std::set<int> ref;
+        SpawnEvent ev[16]; // 작게: 가득 차서 나눠 내는 경우도
+        KillRng kr(9);
+        for (int f = 0; f < 5000 && ok; f++)
+        {
+            int n = d.update(f * 0.05f, 0, 0, ev, 16);
+            for (int k = 0; k < n; k++)
+                ok &= ref.insert(ev[k].agent).second;
+            for (int k = 0; k < 3 && !ref.empty(); k++)
+            {
+                int a = d.live()[(int)(kr.life() * 1000) % d.live_count()];
+                ok &= d.kill(a) && ref.erase(a) == 1;
+            }
+            ok &= !d.kill(-1) && d.live_count() == (int)ref.size() && d.live_count() <= d.max_zombies();
+            for (int i = 0; i < d.live_count() && ok; i++)
+                ok &= ref.count(d.live()[i]) == 1 && d.alive(d.live()[i]);
+        }
+    }
+
+    // 웨이브: 간격 x0.9 (최소 1), 최대 수 +2. 죽지 않으면 최대 수까지만
+    {
+        SpawnDirector d(1000, 1);
+        d.generate_points(0, 0);
+        d.start(0);
+        SpawnEvent ev[64];
+        float interval = 5;
+        int total = 0;
+        for (int w = 1; w <= 30 && ok; w++)
+        {
+            total += d.update(w * 60.0f - 0.001f, 0, 0, ev, 64);
+            ok &= d.wave() == w && d.spawn_interval() == interval && d.max_zombies() == 10 + 2 * (w - 1);
+            ok &= total == std::min(d.max_zombies(), total);
+            interval = std::max(1.0f, interval * 0.9f);
+            d.update(w * 60.0f, 0, 0, ev, 64);
+            total = d.live_count();
+        }
+    }
+
+    // 간격 0 (C# 에서 그대로 올 수 있음): update 가 끝나고 최대 수까지만
+    {
+        SpawnParams p = spawn_default_params();
+        p.spawnInterval = 0;
+        p.minSpawnInterval = 0;
+        p.difficultyIncreaseInterval = 1e-30f;
+        SpawnDirector d(100, 5);
+        d.set_params(p);
+        d.generate_points(0, 0);
+        d.start(0);
+        SpawnEvent ev[64];
+        int n = d.update(1.0f, 0, 0, ev, 64);
+        ok &= n == std::min(d.max_zombies(), 64) && d.spawn_interval() >= SPAWN_MIN_INTERVAL;
+    }
+
+    // 같은 시드면 update 를 부르는 간격과 상관없이 같은 스폰
+    {
+        SpawnDirector a(5000, 77), b(5000, 77);
+        a.generate_points(0, 0);
+        b.generate_points(0, 0);
+        a.start(0);
+        b.start(0);
+        std::vector<SpawnEvent> ea, eb;
+        SpawnEvent ev[512];
+        for (int f = 0; f * FRAME <= 1800; f++)
+        {
+            int n = a.update(f * FRAME, 0, 0, ev, 512);
+            ea.insert(ea.end(), ev, ev + n);
+        }
+        for (int s = 0; s <= 180; s++)
+        {
+            int n = b.update(s * 10.0f, 0, 0, ev, 512);
+            eb.insert(eb.end(), ev, ev + n);
+        }
+        ok &= ea.size() == eb.size() && !ea.empty();
+        for (size_t i = 0; i < ea.size() && i < eb.size() && ok; i++)
+            ok &= ea[i].agent == eb[i].agent && ea[i].point == eb[i].point && ea[i].time == eb[i].time &&
+                  ea[i].wave == eb[i].wave;
+    }
+
+    // 플레이어가 (15, 0) 지점 위에 있으면 그 지점은 고르지 않는다. 막힌 자리는 3 안에서 다시
+    {
+        SpawnParams p = spawn_default_params();
+        p.spawnInterval = 0.5f;
+        p.maxZombies = 100000;
+        SpawnDirector d(100000, 5);
+        d.set_params(p);
+        d.generate_points(0, 0);
+        d.start(0);
+        SpawnEvent ev[64];
+        for (int f = 0; f < 2000 && ok; f++)
+        {
+            int n = d.update(f * 0.5f, 15, 0, ev, 64);
+            for (int k = 0; k < n; k++)
+                ok &= ev[k].point != 0;
+        }
+        ok &= d.eligible_points() == 7;
+
+        SpawnDirector v(100000, 6);
+        v.set_params(p);
+        v.set_validator(blocked_right, 0);
+        v.generate_points(0, 0);
+        v.start(0);
+        int moved = 0;
+        for (int f = 0; f < 2000 && ok; f++)
+        {
+            int n = v.update(f * 0.5f, -100, 0, ev, 64);
+            for (int k = 0; k < n; k++)
+            {
+                ok &= ev[k].x < 14;
+                if (ev[k].point == 0)
+                {
+                    moved++;
+                    ok &= std::fabs(ev[k].x - 15) <= 3.0001f && std::fabs(ev[k].y) <= 3.0001f;
+                }
+            }
+        }
+        ok &= moved > 0 && v.blocked() > 0;
+    }
+    printf("자체 검사: %s\n\n", ok ? "통과" : "실패");
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    int sessions = argc > 1 ? atoi(argv[1]) : 100;
+    if (!self_check())
+        return 1;
+
+    SpawnDirector d(100000, 1);
+    std::vector<WaveStats> waves;
+    run_events(d, 1, &waves);
+    printf("한 시간 판 (시드 1): 스폰 %lld, 최대 수에 막힘 %lld\n", d.spawned(), d.capped());
+    printf("  웨이브  간격   최대  스폰  막힘  최대 동시\n");
+    for (size_t w = 0; w < waves.size(); w += w < 10 ? 1 : 10)
+    {
+        float interval = 5;
+        for (size_t k = 0; k < w; k++)
+            interval = std::max(1.0f, interval * 0.9f);
+        printf("  %4d  %5.2f  %4d  %4d  %4d  %4d\n", (int)w + 1, interval, 10 + 2 * (int)w, waves[w].spawned,
+               waves[w].capped, waves[w].peak);
+    }
+
+    double t = now_sec();
+    long long total = 0;
+    for (int s = 0; s < sessions; s++)
+    {
+        run_events(d, s + 1, 0);
+        total += d.spawned();
+    }
+    double t_events = (now_sec() - t) / sessions;
+
+    int frame_sessions = std::max(1, sessions / 10);
+    t = now_sec();
+    for (int s = 0; s < frame_sessions; s++)
+        total += run_frames(d, s + 1);
+    double t_frames = (now_sec() - t) / frame_sessions;
+
+    t = now_sec();
+    for (int s = 0; s < frame_sessions; s++)
+        total += run_spawner_like(s + 1);
+    double t_like = (now_sec() - t) / frame_sessions;
+
+    double frames = SESSION / FRAME;
+    printf("\n한 시간 판 한 번 (평균, 스폰 합계 %lld)\n", total);
+    printf("  이벤트 시각에만 update       : %8.3f ms\n", t_events * 1e3);
+    printf("  60fps 매 프레임 update       : %8.3f ms (프레임당 %.1f ns)\n", t_frames * 1e3, t_frames * 1e9 / frames);
+    printf("  ZombieSpawner 식 (매 프레임) : %8.3f ms (프레임당 %.1f ns)\n", t_like * 1e3, t_like * 1e9 / frames);
+    return 0;
+}
@@ -0,0 +1,334 @@
+// voice_limiter.h 검사와 비교 (리눅스에서 화면, 소리 장치 없이. 결과는 PCM 숫자로)
+//
+//   1) 자체 검사: 같은 클립 cooldown, 종류별/전체 최대 보이스 수를 넘지 않는지, 가깝거나 우선순위 높은 요청이 빼앗는지,
+//      안 들리는 요청을 버리는지, 끝난 보이스를 돌려받는지, requested = played + deduped + culled,
+//      SoftMixer 가 클립 하나를 좌우 세기대로 그대로 섞는지
+//   2) 좀비 무리 장면 (60 프레임/초): 좀비 N 마리가 2 초에 한 번쯤 신음, 가까우면 공격 소리, 소총 연사, 발소리, 피격/사망.
+//      AudioManager 처럼 요청마다 바로 트는 방식과 VoiceLimiter 를 거치는 방식을 SoftMixer 로 PCM 까지 섞어 비교
+//      (동시 보이스 수, 섞는 시간, 1 을 넘어 찢어진 샘플 비율, 플레이어/무기 소리가 빠진 수)
+//
+// 컴파일 예: g++ -std=c++11 -O2 VoiceLimiterBench.cpp -o VoiceLimiterBench
+// 실행 예:   ./VoiceLimiterBench 500 20   (좀비 수, 초)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "voice_limiter.h"
+
+static double now_sec()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned rng_state = 1;
+
+static float frand()
+{
+    rng_state = rng_state * 1103515245 + 12345;
+    return (float)((rng_state >> 8) & 0xffff) / 65536.0f;
+}
+
+const int SAMPLE_RATE = 24000;
+const int FPS = 60;
+
+// 클립: 감쇠하는 사인파 (소총은 잡음). AudioManager 의 클립 묶음과 같은 구성
+enum
+{
+    CLIP_IDLE = 0,    // 신음 4 가지
+    CLIP_ATTACK = 4,  // 공격 3 가지
+    CLIP_FOOTSTEP = 7, // 발소리 4 가지
+    CLIP_RIFLE = 11,
+    CLIP_ZOMBIE_HIT = 12,
+    CLIP_ZOMBIE_DEATH = 13,
+    CLIP_PLAYER_HURT = 14,
+    CLIP_COUNT = 15
+};
+
+static std::vector<float> make_clip(int clip)
+{
+    float length = clip < CLIP_ATTACK ? 1.5f : clip < CLIP_FOOTSTEP ? 0.8f : clip < CLIP_RIFLE ? 0.2f
+                 : clip == CLIP_RIFLE ? 0.25f : clip == CLIP_ZOMBIE_DEATH ? 1.0f : 0.3f;
+    std::vector<float> pcm((int)(length * SAMPLE_RATE));
+    float hz = 80.0f + 37.0f * clip;
+    for (size_t i = 0; i < pcm.size(); i++)
+    {
+        float t = (float)i / SAMPLE_RATE, env = std::exp(-3.0f * t / length);
+        pcm[i] = clip == CLIP_RIFLE ? env * (frand() * 2 - 1) * 0.9f : env * 0.6f * std::sin(6.2831853f * hz * t);
+    }
+    return pcm;
+}
+
+static SoundRequest req(int clip, int category, int priority, float x, float y, float volume, int positional = 1)
+{
+    SoundRequest r = {clip, category, priority, positional, x, y, volume};
+    return r;
+}
+
+static bool self_check()
+{
+    bool ok = true;
+    VoicePlay out[64];
+
+    // cooldown: 같은 프레임, 다음 프레임(0.016 초)은 하나로, 0.1 초 뒤는 다시
+    {
+        VoiceLimiter v;
+        v.set_clip(0, 0.5f);
+        for (int k = 0; k < 5; k++)
+            v.request(req(0, SOUND_ZOMBIE, 10, 1, 0, 1));
+        ok &= v.update(0, out, 64) == 1;
+        v.request(req(0, SOUND_ZOMBIE, 10, 1, 0, 1));
+        ok &= v.update(0.016f, out, 64) == 0;
+        v.request(req(0, SOUND_ZOMBIE, 10, 1, 0, 1));
+        ok &= v.update(0.1f, out, 64) == 1 && v.stats().deduped == 5 && v.stats().played == 2;
+    }
+
+    // 종류별 최대: 좀비 16. 17 번째는 가장 먼 것보다 가까울 때만 그 자리를 빼앗는다
+    {
+        VoiceLimiter v;
+        for (int c = 0; c < 40; c++)
+            v.set_clip(c, 10.0f);
+        for (int k = 0; k < 16; k++)
+            v.request(req(k, SOUND_ZOMBIE, 10, 1.0f + k, 0, 1)); // 가장 먼 것: 16 m (클립 15)
+        ok &= v.update(0, out, 64) == 16;
+        int far_voice = -1;
+        for (int k = 0; k < 16; k++)
+            if (out[k].clip == 15)
+                far_voice = out[k].voice;
+        v.request(req(20, SOUND_ZOMBIE, 10, 20, 0, 1)); // 더 멀다: 버림
+        ok &= v.update(1, out, 64) == 0 && v.category_count(SOUND_ZOMBIE) == 16;
+        v.request(req(21, SOUND_ZOMBIE, 10, 0.5f, 0, 1)); // 더 가깝다: 가장 먼 보이스를 빼앗음
+        ok &= v.update(2, out, 64) == 1 && out[0].voice == far_voice && v.voice_clip(far_voice) == 21 &&
+              v.stats().stolen == 1;
+        // 우선순위가 높으면 멀어도 이긴다
+        v.request(req(22, SOUND_ZOMBIE, 11, 24, 0, 1));
+        ok &= v.update(3, out, 64) == 1 && v.category_count(SOUND_ZOMBIE) == 16;
+    }
+
+    // 전체 최대: 좀비 16 + 무기 8 + 아이템 4 + 플레이어 4 = 32 가 꽉 차면 UI 요청은 가장 낮은 보이스를 빼앗는다
+    {
+        VoiceLimiter v;
+        for (int c = 0; c < 64; c++)
+            v.set_clip(c, 10.0f);
+        int clip = 0;
+        for (int k = 0; k < 16; k++)
+            v.request(req(clip++, SOUND_ZOMBIE, 60, 5, 0, 1));
+        for (int k = 0; k < 8; k++)
+            v.request(req(clip++, SOUND_WEAPON, 180, 0, 0, 1, 0));
+        for (int k = 0; k < 4; k++)
+            v.request(req(clip++, SOUND_ITEM, 150, 0, 0, 1, 0));
+        for (int k = 0; k < 4; k++)
+            v.request(req(clip++, SOUND_PLAYER, 200, 0, 0, 1, 0));
+        ok &= v.update(0, out, 64) == 32 && v.active_count() == 32;
+        v.request(req(clip++, SOUND_UI, 255, 0, 0, 1, 0));
+        ok &= v.update(0.5f, out, 64) == 1 && v.category_count(SOUND_ZOMBIE) == 15 && v.active_count() == 32;
+        v.request(req(clip++, SOUND_ZOMBIE, 10, 0, 0, 1)); // 가장 낮음: 버림
+        ok &= v.update(1, out, 64) == 0;
+        // 끝나면 돌려받는다
+        ok &= v.update(11, out, 64) == 0 && v.active_count() == 0 && v.stats().peak == 32;
+        const VoiceStats &s = v.stats();
+        ok &= s.requested == s.played + s.deduped + s.culled;
+    }
+
+    // 안 들리는 요청 (maxDistance 밖), 듣는 위치가 움직이면 재생 중인 보이스 점수도 바뀐다
+    {
+        VoiceParams p = voice_default_params();
+        p.categoryCap[SOUND_ZOMBIE] = 1;
+        VoiceLimiter v(p);
+        v.set_clip(0, 10);
+        v.set_clip(1, 10);
+        v.request(req(0, SOUND_ZOMBIE, 10, 30, 0, 1));
+        ok &= v.update(0, out, 64) == 0 && v.stats().culled == 1;
+        v.request(req(0, SOUND_ZOMBIE, 10, 2, 0, 1));
+        ok &= v.update(1, out, 64) == 1;
+        v.set_listener(20, 0); // 클립 0 은 이제 18 m
+        v.request(req(1, SOUND_ZOMBIE, 10, 15, 0, 1)); // 5 m
+        ok &= v.update(2, out, 64) == 1 && out[0].pan < 0 && v.stats().stolen == 1;
+    }
+
+    // SoftMixer: 가운데는 좌우 같은 세기 (cos 45 도), 클립이 끝나면 쉰다
+    {
+        SoftMixer m(2);
+        float pcm[100];
+        for (int i = 0; i < 100; i++)
+            pcm[i] = (float)i / 100;
+        m.add_clip(pcm, 100);
+        VoicePlay a = {1, 0, 0.5f, 0};
+        m.play(a);
+        float buf[2 * 64];
+        m.render(buf, 64);
+        float g = 0.5f * 0.70710678f;
+        for (int i = 0; i < 64; i++)
+            ok &= std::fabs(buf[2 * i] - g * pcm[i]) < 1e-6f && std::fabs(buf[2 * i + 1] - g * pcm[i]) < 1e-6f;
+        m.render(buf, 64);
+        ok &= std::fabs(buf[2 * 35] - g * pcm[99]) < 1e-6f && buf[2 * 36] == 0 && m.active() == 0;
+    }
+
+    printf("자체 검사: %s\n\n", ok ? "통과" : "실패");
+    return ok;
+}
+
+// 한 프레임의 요청들
+struct Scene
+{
+    int zombies;
+    std::vector<float> zx, zy;
+    float px, py;
+};
+
+static void frame_requests(Scene &s, int f, std::vector<SoundRequest> &out)
+{
+    out.clear();
+    float t = (float)f / FPS;
+    // 플레이어는 천천히 원을 그리며 걷는다
+    s.px = 6.0f * std::cos(t * 0.2f);
+    s.py = 6.0f * std::sin(t * 0.2f);
+    if (f % 24 == 0)
+        out.push_back(req(CLIP_FOOTSTEP + (f / 24) % 4, SOUND_PLAYER, 200, 0, 0, 0.5f, 0));
+    bool firing = (f / 120) % 3 != 2; // 2 초 쏘고 1 초 쉼
+    if (firing && f % 18 == 0)
+        out.push_back(req(CLIP_RIFLE, SOUND_WEAPON, 180, 0, 0, 0.8f, 0));
+    for (int z = 0; z < s.zombies; z++)
+    {
+        // 플레이어 쪽으로 조금씩
+        float dx = s.px - s.zx[z], dy = s.py - s.zy[z];
+        float d = std::sqrt(dx * dx + dy * dy);
+        if (d > 0.8f)
+        {
+            s.zx[z] += dx / d * 0.02f;
+            s.zy[z] += dy / d * 0.02f;
+        }
+        if (frand() < 1.0f / (2 * FPS))
+            out.push_back(req(CLIP_IDLE + (int)(frand() * 4), SOUND_ZOMBIE, 60, s.zx[z], s.zy[z], 0.32f));
+        if (d < 1.5f && frand() < 1.0f / FPS)
+            out.push_back(req(CLIP_ATTACK + (int)(frand() * 3), SOUND_ZOMBIE, 120, s.zx[z], s.zy[z], 0.48f));
+    }
+    if (firing && f % 18 == 9)
+    {
+        out.push_back(req(CLIP_ZOMBIE_HIT, SOUND_ZOMBIE, 140, s.px + 4, s.py, 0.4f));
+        if (frand() < 0.3f)
+            out.push_back(req(CLIP_ZOMBIE_DEATH, SOUND_ZOMBIE, 140, s.px + 4, s.py, 0.48f));
+    }
+    if (f % 50 == 25)
+        out.push_back(req(CLIP_PLAYER_HURT, SOUND_PLAYER, 200, 0, 0, 1.0f, 0));
+}
+
+struct Result
+{
+    long long requested, played, important_requested, important_played;
+    int peak_voices;
+    double mix_seconds, limiter_seconds;
+    long long clipped, samples;
+    float peak_sample;
+};
+
+static Result run(int zombies, int seconds, bool limit, const std::vector<std::vector<float> > &clips)
+{
+    Scene s;
+    s.zombies = zombies;
+    rng_state = 7;
+    for (int z = 0; z < zombies; z++)
+    {
+        float a = frand() * 6.2831853f, r = 3.0f + frand() * 27.0f;
+        s.zx.push_back(r * std::cos(a));
+        s.zy.push_back(r * std::sin(a));
+    }
+    const int max_voices = 8192; // 바로 트는 쪽: 사실상 무제한 (돌아가며 씀)
+    SoftMixer mixer(limit ? voice_default_params().maxVoices : max_voices);
+    VoiceLimiter limiter;
+    for (size_t c = 0; c < clips.size(); c++)
+    {
+        mixer.add_clip(&clips[c][0], (int)clips[c].size());
+        limiter.set_clip((int)c, (float)clips[c].size() / SAMPLE_RATE);
+    }
+
+    Result r = Result();
+    std::vector<SoundRequest> reqs;
+    std::vector<VoicePlay> plays(max_voices);
+    std::vector<float> buf(SAMPLE_RATE / FPS * 2);
+    int cursor = 0;
+    for (int f = 0; f < seconds * FPS; f++)
+    {
+        frame_requests(s, f, reqs);
+        r.requested += reqs.size();
+        for (size_t k = 0; k < reqs.size(); k++)
+            r.important_requested += reqs[k].category != SOUND_ZOMBIE;
+        double t = now_sec();
+        int n = 0;
+        if (limit)
+        {
+            limiter.set_listener(s.px, s.py);
+            for (size_t k = 0; k < reqs.size(); k++)
+                limiter.request(reqs[k]);
+            n = limiter.update((float)f / FPS, &plays[0], max_voices);
+        }
+        else
+        {
+            // PlayOneShot: 요청마다 바로 (3D 감쇠, 좌우만 같은 식으로)
+            for (size_t k = 0; k < reqs.size(); k++, n++)
+            {
+                const SoundRequest &q = reqs[k];
+                float dx = q.x - s.px, dy = q.y - s.py, a = 1.0f;
+                if (q.positional)
+                    a = std::max(0.0f, 1.0f - std::sqrt(dx * dx + dy * dy) / 25.0f);
+                VoicePlay p = {cursor++ % max_voices, q.clip, q.volume * a,
+                               q.positional ? std::max(-1.0f, std::min(1.0f, dx / 8.0f)) : 0.0f};
+                plays[n] = p;
+            }
+        }
+        r.limiter_seconds += now_sec() - t;
+        for (int k = 0; k < n; k++)
+        {
+            mixer.play(plays[k]);
+            r.important_played += plays[k].clip >= CLIP_FOOTSTEP && plays[k].clip != CLIP_ZOMBIE_HIT &&
+                                  plays[k].clip != CLIP_ZOMBIE_DEATH;
+        }
+        r.played += n;
+
+        t = now_sec();
+        mixer.render(&buf[0], (int)buf.size() / 2);
+        r.mix_seconds += now_sec() - t;
+        r.peak_voices = std::max(r.peak_voices, mixer.active());
+        for (size_t i = 0; i < buf.size(); i++)
+        {
+            float a = std::fabs(buf[i]);
+            r.clipped += a > 1.0f;
+            r.peak_sample = std::max(r.peak_sample, a);
+        }
+        r.samples += buf.size();
+    }
+    if (limit)
+    {
+        const VoiceStats &st = limiter.stats();
+        printf("  VoiceLimiter: 요청 %lld = 틂 %lld + 같은 클립 %lld + 버림 %lld, 빼앗음 %lld, 최대 동시 %d\n", st.requested,
+               st.played, st.deduped, st.culled, st.stolen, st.peak);
+    }
+    return r;
+}
+
+static void print(const char *name, const Result &r, int seconds)
+{
+    printf("  %-14s: 틂 %6lld / 요청 %6lld, 플레이어/무기 %lld / %lld, 최대 동시 보이스 %5d, "
+           "섞기 %6.1f ms/초, 제한기 %5.1f us/프레임, 찢어진 샘플 %5.2f%% (최대 %.1f)\n",
+           name, r.played, r.requested, r.important_played, r.important_requested, r.peak_voices,
+           r.mix_seconds * 1000 / seconds, r.limiter_seconds * 1e6 / (seconds * FPS), 100.0 * r.clipped / r.samples,
+           r.peak_sample);
+}
+
+int main(int argc, char *argv[])
+{
+    int zombies = argc > 1 ? atoi(argv[1]) : 500;
+    int seconds = argc > 2 ? atoi(argv[2]) : 20;
+    if (!self_check())
+        return 1;
+    std::vector<std::vector<float> > clips;
+    for (int c = 0; c < CLIP_COUNT; c++)
+        clips.push_back(make_clip(c));
+    printf("좀비 %d 마리, %d 초 (%d 프레임/초, %d Hz 스테레오)\n", zombies, seconds, FPS, SAMPLE_RATE);
+    Result direct = run(zombies, seconds, false, clips);
+    Result limited = run(zombies, seconds, true, clips);
+    print("바로 틂", direct, seconds);
+    print("VoiceLimiter", limited, seconds);
+    return 0;
+}
@@ -0,0 +1,222 @@
+// 게임 이벤트 버스: 여러 스레드가 고정 크기 이벤트를 링 버퍼에 넣고, 메인 스레드가 프레임에 한 번 모아서 꺼낸다 (C++11)
+//
+// 지금은 상태가 바뀔 때마다 C# delegate 가 그 자리에서 불린다:
+// InventorySystem.OnInventoryChanged, EscapeManager.OnItemCollected / OnAllItemsCollected / OnVehicleRepaired /
+// OnPlayerEscaped, PlayerHealth.OnHealthChanged, 탄약 표시(AmmoDisplayUI). 받는 쪽은 매번 UI 를 다시 만든다.
+// 한 프레임에 총을 여러 번 쏘거나 파밍으로 아이템이 여러 개 들어오면 같은 UI 가 여러 번 다시 그려진다.
+// EventBus 는
+//   - 이벤트를 고정 크기 구조체(GameEvent, 24바이트)로 링 버퍼에 넣는다. 새로 메모리를 잡지 않는다.
+//   - 넣는 쪽은 여러 스레드여도 된다 (Vyukov 방식 제한 큐: 칸마다 순번을 두고 쓰기 위치를 CAS 로 하나씩 받는다).
+//     꺼내는 쪽은 하나 (메인 스레드) 라서 읽기 위치는 원자 변수가 아니어도 된다.
+//   - 가득 차면 기다리지 않고 버린다 (dropped 로 센다).
+//   - drain 은 쌓인 것을 한꺼번에 꺼내면서, 덮어쓰기로 정한 종류(탄약, 체력, 타이머, 인벤토리 바뀜)는
+//     같은 (종류, key) 의 마지막 값 하나만 남긴다 (coalesced 로 센다). 순서는 처음 나온 자리.
+// 넣은 수(published)는 쓰기 위치 그 자체라 따로 세지 않는다: published = delivered + coalesced + 남은 수.
+
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// 게임 이벤트 종류 (64 이상은 자유롭게)
+enum GameEventType
+{
+    EVENT_INVENTORY_CHANGED = 1, // key: 슬롯
+    EVENT_ITEM_COLLECTED = 2,    // key: 아이템 번호, i0 현재 수, i1 필요한 수
+    EVENT_ALL_ITEMS_COLLECTED = 3,
+    EVENT_VEHICLE_REPAIRED = 4,
+    EVENT_PLAYER_ESCAPED = 5,
+    EVENT_AMMO_CHANGED = 6,   // i0 현재, i1 최대
+    EVENT_HEALTH_CHANGED = 7, // f0 현재, f1 최대
+    EVENT_TIMER_CHANGED = 8,  // f0 남은 시간
+    EVENT_TYPES = 256
+};
+
+// C# 쪽 StructLayout 과 순서가 같아야 한다
+struct GameEvent
+{
+    uint32_t type;
+    uint32_t key; // 덮어쓰기 기준 (같은 종류 안에서)
+    int32_t i0, i1;
+    float f0, f1;
+};
+
+struct EventBusStats
+{
+    long long published; // 넣은 수 (버린 것 빼고)
+    long long coalesced; // 같은 key 의 새 값에 덮여 사라진 수
+    long long dropped;   // 가득 차서 버린 수
+    long long delivered; // drain 으로 넘긴 수
+};
+
+class EventBus
+{
+public:
+    // capacity: 링 버퍼 칸 수 (2의 거듭제곱으로 올림), max_batch: drain 한 번에 넘길 수 있는 최대 수
+    explicit EventBus(int capacity = 4096, int max_batch = 1024)
+        : mask_(round_up(capacity) - 1), cells_(mask_ + 1), coalesce_(EVENT_TYPES, 0), slot_key_(round_up(max_batch * 2)),
+          slot_at_(slot_key_.size()), slot_gen_(slot_key_.size(), 0), gen_(0), max_batch_(max_batch), read_(0),
+          coalesced_(0), delivered_(0)
+    {
+        for (size_t i = 0; i < cells_.size(); i++)
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        write_.v.store(0, std::memory_order_relaxed);
+        dropped_.v.store(0, std::memory_order_relaxed);
+        coalesce_[EVENT_INVENTORY_CHANGED] = coalesce_[EVENT_AMMO_CHANGED] = 1;
+        coalesce_[EVENT_HEALTH_CHANGED] = coalesce_[EVENT_TIMER_CHANGED] = 1;
+    }
+
+    // 이 종류는 drain 에서 (종류, key) 마다 마지막 값만. 넣는 스레드가 돌기 전에 정한다
+    void set_coalesce(uint32_t type, bool on)
+    {
+        if (type < EVENT_TYPES)
+            coalesce_[type] = on;
+    }
+
+    // 아무 스레드에서나. 가득 차 있으면 false (버림)
+    bool publish(const GameEvent &e)
+    {
+        uint64_t pos = write_.v.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell &c = cells_[pos & mask_];
+            uint64_t seq = c.seq.load(std::memory_order_acquire);
+            int64_t diff = (int64_t)(seq - pos);
+            if (diff == 0)
+            {
+                // 이 칸을 쓸 차례: 쓰기 위치를 하나 받는다 (실패하면 pos 가 새 값으로 바뀜)
+                if (write_.v.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    c.event = e;
+                    c.seq.store(pos + 1, std::memory_order_release); // 읽는 쪽에 보임
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // 한 바퀴 전 이벤트를 아직 안 읽음: 가득 참
+                dropped_.v.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+                pos = write_.v.load(std::memory_order_relaxed); // 다른 스레드가 먼저 가져감
+        }
+    }
+
+    bool publish(uint32_t type, uint32_t key, int32_t i0 = 0, int32_t i1 = 0, float f0 = 0, float f1 = 0)
+    {
+        GameEvent e = {type, key, i0, i1, f0, f1};
+        return publish(e);
+    }
+
+    // 메인 스레드에서 프레임에 한 번. 쌓인 이벤트를 out 에 최대 min(max, max_batch) 개 (덮어쓰기 적용), 그 수를 돌려준다.
+    // out 이 다 차면 나머지는 링에 남아 다음 drain 에서 나온다
+    int drain(GameEvent *out, int max)
+    {
+        if (max > max_batch_)
+            max = max_batch_;
+        if (++gen_ == 0)
+        {
+            std::fill(slot_gen_.begin(), slot_gen_.end(), 0); // 세대 번호가 한 바퀴 돌면 한 번 지운다
+            gen_ = 1;
+        }
+        int n = 0;
+        for (;;)
+        {
+            Cell &c = cells_[read_ & mask_];
+            if (c.seq.load(std::memory_order_acquire) != read_ + 1)
+                break; // 비었거나, 넣는 쪽이 아직 쓰는 중
+            const GameEvent &e = c.event;
+            int at = -1;
+            uint32_t h = 0;
+            if (e.type < EVENT_TYPES && coalesce_[e.type])
+            {
+                // (종류, key) -> 이번 drain 에서 넣은 자리. 세대 번호가 다르면 빈 칸 (매번 지우지 않음)
+                uint64_t k = (uint64_t)e.type << 32 | e.key;
+                uint32_t m = (uint32_t)slot_key_.size() - 1;
+                for (h = (uint32_t)((k * 0x9e3779b97f4a7c15ULL) >> 40) & m; slot_gen_[h] == gen_; h = (h + 1) & m)
+                    if (slot_key_[h] == k)
+                    {
+                        at = slot_at_[h];
+                        break;
+                    }
+                if (at < 0 && n < max)
+                {
+                    slot_gen_[h] = gen_;
+                    slot_key_[h] = k;
+                    slot_at_[h] = n;
+                }
+            }
+            if (at >= 0)
+            {
+                out[at] = e;
+                coalesced_++;
+            }
+            else if (n < max)
+                out[n++] = e;
+            else
+                break;
+            c.seq.store(read_ + mask_ + 1, std::memory_order_release); // 한 바퀴 뒤에 다시 쓸 수 있음
+            read_++;
+        }
+        delivered_ += n;
+        return n;
+    }
+
+    // published 는 메인 스레드에서 읽을 때의 값 (넣는 중인 것도 포함될 수 있음)
+    EventBusStats stats() const
+    {
+        EventBusStats s;
+        s.published = (long long)write_.v.load(std::memory_order_relaxed);
+        s.coalesced = coalesced_;
+        s.dropped = (long long)dropped_.v.load(std::memory_order_relaxed);
+        s.delivered = delivered_;
+        return s;
+    }
+
+    int capacity() const { return (int)cells_.size(); }
+
+private:
+    EventBus(const EventBus &);
+    EventBus &operator=(const EventBus &);
+
+    struct Cell
+    {
+        std::atomic<uint64_t> seq; // pos+1 이면 읽을 수 있음, pos+capacity 이면 다음 바퀴에 쓸 수 있음
+        GameEvent event;
+    };
+
+    // 여러 스레드가 고치는 값은 64바이트씩 띄워서 캐시 라인을 나눠 쓰지 않게 한다
+    struct Counter
+    {
+        std::atomic<uint64_t> v;
+        char pad[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static size_t round_up(int n)
+    {
+        size_t c = 2;
+        while ((int)c < n)
+            c *= 2;
+        return c;
+    }
+
+    uint64_t mask_;
+    std::vector<Cell> cells_;
+    Counter write_;   // 다음에 쓸 위치 (= 넣은 수)
+    Counter dropped_;
+    std::vector<uint8_t> coalesce_;
+    // drain 안에서만 쓰는 덮어쓰기 해시
+    std::vector<uint64_t> slot_key_;
+    std::vector<int> slot_at_;
+    std::vector<uint32_t> slot_gen_;
+    uint32_t gen_;
+    int max_batch_;
+    uint64_t read_; // 읽는 쪽은 하나
+    long long coalesced_, delivered_;
+};
+
+#endif
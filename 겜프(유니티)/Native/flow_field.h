@@ -0,0 +1,256 @@
+// 흐름장(flow field) 길찾기: 플레이어까지 가는 방향을 칸마다 한 번에 구해 두고 모든 좀비가 같이 읽는다 (C++11)
+//
+// ZombieAI.ChasePlayer 는 player.position 쪽으로 곧장 가서 벽 앞에 좀비가 쌓인다.
+// 좀비마다 A* 를 돌리기에는 너무 많다. FlowField 는 지도를 칸으로 나눠
+//   1) 플레이어 칸에서 바깥으로 다익스트라를 돌려 칸마다 플레이어까지의 비용(integration field)을 구하고
+//      (칸 비용이 작은 정수라 우선순위 큐 대신 비용별 버킷을 돌아가며 쓴다: Dial 알고리즘)
+//   2) 칸마다 비용이 가장 작은 이웃 쪽 방향을 적어 둔다.
+// 좀비는 자기 칸의 방향만 읽으면 되므로 몇 마리든 같은 흐름장을 읽기 전용으로 나눠 쓴다.
+// 다시 계산은 플레이어가 다른 칸으로 가거나 칸 비용이 바뀌었을 때만 한다 (update).
+// 좀비는 detectionRange 안에서만 쫓아오므로 set_range 로 플레이어 둘레만 계산할 수 있다.
+// 그때는 지난번에 값을 적은 칸만 지우므로 다시 계산 비용이 지도 크기가 아니라 범위 넓이에 비례한다.
+//
+// 이동은 8방향: 가로/세로 5, 대각선 7 (약 1.4배) 에 들어가는 칸의 비용을 곱한다.
+// 대각선은 옆의 두 칸이 모두 지나갈 수 있을 때만 간다 (벽 모서리를 파고들지 않음).
+// 안에서는 지도 둘레에 벽 칸을 한 줄 더 둘러서, 이웃을 볼 때 지도 밖인지 따로 묻지 않는다.
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#define FLOW_BLOCKED 0            // 칸 비용 0 = 벽
+#define FLOW_NONE 8               // 방향 없음 (플레이어 칸, 갈 수 없는 칸)
+#define FLOW_UNREACHED 0xffffffffu // 플레이어까지 길이 없음
+
+// 방향 0~3 가로/세로, 4~7 대각선, 8 없음
+static const int FLOW_DX[8] = {1, -1, 0, 0, 1, -1, 1, -1};
+static const int FLOW_DY[8] = {0, 0, 1, -1, 1, 1, -1, -1};
+static const float FLOW_DIR_X[9] = {1, -1, 0, 0, 0.70710678f, -0.70710678f, 0.70710678f, -0.70710678f, 0};
+static const float FLOW_DIR_Y[9] = {0, 0, 1, -1, 0.70710678f, 0.70710678f, -0.70710678f, -0.70710678f, 0};
+
+class FlowField
+{
+public:
+    // width x height 칸, (origin_x, origin_y) 가 (0, 0) 칸의 왼쪽 아래, cell 은 칸 크기(월드 단위)
+    FlowField(int width, int height, float origin_x = 0, float origin_y = 0, float cell = 1)
+        : w_(width), h_(height), pw_(width + 2), ox_(origin_x), oy_(origin_y), cell_(cell), inv_cell_(1 / cell),
+          cost_((size_t)(width + 2) * (height + 2), FLOW_BLOCKED), dist_(cost_.size(), FLOW_UNREACHED),
+          dir_(cost_.size(), FLOW_NONE), buckets_(BUCKETS), limit_(FLOW_UNREACHED), goal_(-1), dirty_(true), rebuilds_(0)
+    {
+        for (int cy = 0; cy < h_; cy++)
+            for (int cx = 0; cx < w_; cx++)
+                cost_[index(cx, cy)] = 1;
+        for (int k = 0; k < 8; k++)
+            offset_[k] = FLOW_DX[k] + FLOW_DY[k] * pw_;
+    }
+
+    int width() const { return w_; }
+    int height() const { return h_; }
+    int rebuilds() const { return rebuilds_; }
+    int reached() const { return (int)touched_.size(); } // 마지막 계산에서 값을 적은 칸 수
+
+    // 플레이어에서 곧게 cells 칸 거리(비용 1 기준)까지만 계산한다. 0 이면 지도 전체
+    void set_range(int cells)
+    {
+        uint32_t limit = cells > 0 ? (uint32_t)cells * STRAIGHT : FLOW_UNREACHED;
+        if (limit != limit_)
+        {
+            limit_ = limit;
+            dirty_ = true;
+        }
+    }
+
+    // 칸 비용 (0 = 벽, 1 = 보통, 클수록 돌아간다). 바뀌면 다음 update 에서 다시 계산
+    void set_cost(int cx, int cy, uint8_t c)
+    {
+        if (!inside(cx, cy))
+            return;
+        uint8_t &v = cost_[index(cx, cy)];
+        if (v != c)
+        {
+            v = c;
+            dirty_ = true;
+        }
+    }
+
+    uint8_t cost(int cx, int cy) const { return cost_[index(cx, cy)]; }
+
+    // 전체 비용 한꺼번에 (width * height, 아래 줄부터)
+    void set_costs(const uint8_t *c)
+    {
+        for (int cy = 0; cy < h_; cy++)
+            for (int cx = 0; cx < w_; cx++)
+                cost_[index(cx, cy)] = c[(size_t)cy * w_ + cx];
+        dirty_ = true;
+    }
+
+    // 원 (x, y, r) 에 중심이 들어가는 칸을 c 로 (벽 콜라이더를 칸으로 옮길 때)
+    void fill_circle(float x, float y, float r, uint8_t c)
+    {
+        int cx0 = cell_x(x - r), cx1 = cell_x(x + r), cy0 = cell_y(y - r), cy1 = cell_y(y + r);
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                float dx = ox_ + (cx + 0.5f) * cell_ - x, dy = oy_ + (cy + 0.5f) * cell_ - y;
+                if (dx * dx + dy * dy <= r * r)
+                    set_cost(cx, cy, c);
+            }
+    }
+
+    int cell_x(float x) const { return (int)std::floor((x - ox_) * inv_cell_); }
+    int cell_y(float y) const { return (int)std::floor((y - oy_) * inv_cell_); }
+    bool inside(int cx, int cy) const { return cx >= 0 && cy >= 0 && cx < w_ && cy < h_; }
+
+    // 플레이어 위치로 맞춘다. 다시 계산했으면 true (같은 칸이고 비용도 그대로면 아무것도 안 함)
+    bool update(float px, float py)
+    {
+        int goal = index(clamp(cell_x(px), 0, w_ - 1), clamp(cell_y(py), 0, h_ - 1));
+        if (goal == goal_ && !dirty_)
+            return false;
+        goal_ = goal;
+        dirty_ = false;
+        rebuild();
+        return true;
+    }
+
+    // 플레이어까지 비용 (FLOW_UNREACHED 이면 길 없음)
+    uint32_t distance(int cx, int cy) const { return dist_[index(cx, cy)]; }
+    int direction(int cx, int cy) const { return dir_[index(cx, cy)]; }
+
+    // 위치 (x, y) 에서 갈 방향 (단위 벡터). 지도 밖이거나 방향이 없으면 false, (0, 0)
+    bool sample(float x, float y, float *dx, float *dy) const
+    {
+        int cx = cell_x(x), cy = cell_y(y);
+        int d = inside(cx, cy) ? dir_[index(cx, cy)] : FLOW_NONE;
+        *dx = FLOW_DIR_X[d];
+        *dy = FLOW_DIR_Y[d];
+        return d != FLOW_NONE;
+    }
+
+    // 여러 좀비 한꺼번에 (xy, out 은 x, y 가 번갈아 있는 배열). 방향이 있는 수를 돌려준다
+    int steer(const float *xy, float *out, int n) const
+    {
+        int found = 0;
+        for (int i = 0; i < n; i++)
+            found += sample(xy[2 * i], xy[2 * i + 1], &out[2 * i], &out[2 * i + 1]);
+        return found;
+    }
+
+private:
+    enum
+    {
+        STRAIGHT = 5,
+        DIAGONAL = 7,
+        BUCKETS = 2048 // 2의 거듭제곱, 가장 큰 한 걸음(7 * 255)보다 크게
+    };
+
+    static int clamp(int v, int lo, int hi) { return v < lo ? lo : v > hi ? hi : v; }
+
+    int index(int cx, int cy) const { return (cy + 1) * pw_ + cx + 1; }
+
+    // c 에서 k 방향으로 갈 수 있는지 (대각선은 옆의 두 칸도 열려 있어야)
+    bool can_step(int c, int k) const
+    {
+        if (cost_[c + offset_[k]] == FLOW_BLOCKED)
+            return false;
+        return k < 4 || (cost_[c + FLOW_DX[k]] != FLOW_BLOCKED && cost_[c + FLOW_DY[k] * pw_] != FLOW_BLOCKED);
+    }
+
+    void rebuild()
+    {
+        rebuilds_++;
+        // 지난번에 적은 칸만 되돌린다 (거의 전부였으면 통째로)
+        if (touched_.size() * 4 > dist_.size())
+        {
+            std::fill(dist_.begin(), dist_.end(), FLOW_UNREACHED);
+            std::fill(dir_.begin(), dir_.end(), (uint8_t)FLOW_NONE);
+        }
+        else
+            for (size_t i = 0; i < touched_.size(); i++)
+            {
+                dist_[touched_[i]] = FLOW_UNREACHED;
+                dir_[touched_[i]] = FLOW_NONE;
+            }
+        touched_.clear();
+        for (int b = 0; b < BUCKETS; b++)
+            buckets_[b].clear();
+
+        // Dial: 비용 d 인 칸은 buckets_[d % BUCKETS] 에. 한 걸음이 BUCKETS 보다 작아서 섞이지 않는다
+        dist_[goal_] = 0;
+        buckets_[0].push_back(goal_);
+        touched_.push_back(goal_);
+        size_t pending = 1;
+        for (uint32_t d = 0; pending > 0 && d <= limit_; d++)
+        {
+            std::vector<int> &bucket = buckets_[d & (BUCKETS - 1)];
+            for (size_t i = 0; i < bucket.size(); i++)
+            {
+                int c = bucket[i];
+                if (dist_[c] != d)
+                    continue; // 더 짧은 길로 이미 처리됨
+                for (int k = 0; k < 8; k++)
+                {
+                    if (!can_step(c, k))
+                        continue;
+                    int n = c + offset_[k];
+                    uint32_t nd = d + (k < 4 ? STRAIGHT : DIAGONAL) * cost_[n];
+                    if (nd < dist_[n] && nd <= limit_)
+                    {
+                        if (dist_[n] == FLOW_UNREACHED)
+                            touched_.push_back(n);
+                        dist_[n] = nd;
+                        buckets_[nd & (BUCKETS - 1)].push_back(n);
+                        pending++;
+                    }
+                }
+            }
+            pending -= bucket.size();
+            bucket.clear();
+        }
+
+        // 값을 적은 칸마다 비용이 가장 작은 이웃으로.
+        // 지도 대부분이면 메모리 순서대로 훑는 편이 계산 순서(touched_)로 뛰어다니는 것보다 빠르다
+        if (touched_.size() * 4 > dist_.size())
+        {
+            for (int cy = 0; cy < h_; cy++)
+                for (int c = index(0, cy), end = c + w_; c < end; c++)
+                    if (dist_[c] != FLOW_UNREACHED)
+                        point(c);
+        }
+        else
+            for (size_t i = 0; i < touched_.size(); i++)
+                point(touched_[i]);
+    }
+
+    void point(int c)
+    {
+        uint32_t best = dist_[c];
+        int bd = FLOW_NONE;
+        for (int k = 0; k < 8; k++)
+            if (dist_[c + offset_[k]] < best && can_step(c, k))
+            {
+                best = dist_[c + offset_[k]];
+                bd = k;
+            }
+        dir_[c] = (uint8_t)bd; // 플레이어 칸은 더 작은 이웃이 없어 FLOW_NONE
+    }
+
+    int w_, h_, pw_; // pw_: 둘레를 더한 한 줄 길이
+    float ox_, oy_, cell_, inv_cell_;
+    int offset_[8]; // 방향별 이웃 칸까지 번호 차이
+    std::vector<uint8_t> cost_;
+    std::vector<uint32_t> dist_;
+    std::vector<uint8_t> dir_;
+    std::vector<std::vector<int> > buckets_;
+    std::vector<int> touched_; // 값을 적은 칸 (처음은 플레이어 칸)
+    uint32_t limit_;           // 이 비용까지만 계산
+    int goal_;
+    bool dirty_;
+    int rebuilds_;
+};
+
+#endif
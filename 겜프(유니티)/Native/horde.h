@@ -0,0 +1,386 @@
+// 좀비 무리 한꺼번에 움직이기 (C++11)
+//
+// ZombieAI.cs 는 좀비마다 Update() 에서 플레이어까지 거리를 재고 배회/추적/공격을 고른다.
+// 좀비가 많아지면 MonoBehaviour 호출과 객체마다 흩어진 메모리 때문에 프레임 시간이 빠르게 는다.
+// ZombieHorde 는 모든 좀비의 위치, 속도, 상태, 타이머를 항목별 배열(SoA)로 들고
+// update() 한 번으로 무리 전체를 처리한다. 규칙은 ZombieAI.cs 와 같다.
+//   거리 <= attackRange    : 공격 (멈추고 플레이어 쪽을 봄, 쿨다운마다 공격 이벤트)
+//   거리 <= detectionRange : 추적 (플레이어 쪽으로 chaseSpeed)
+//   그 밖                  : 배회 (목표에 0.5 안으로 닿거나 wanderChangeInterval 이 지나면 새 목표)
+// 거리 비교와 방향 계산은 AVX2 로 8마리씩 한다. 새 배회 목표 뽑기와 공격 이벤트처럼
+// 드물게 일어나는 일만 해당 칸을 골라 하나씩 처리한다.
+//
+// 위치는 유니티 물리(Rigidbody2D)가 옮기므로 매 프레임 set_positions 로 받고,
+// 계산한 속도를 velocities 로 돌려준다. 화면 없이 돌릴 때는 integrate(dt) 로 직접 옮긴다.
+
+#ifndef HORDE_H
+#define HORDE_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ZombieAI.cs 의 [SerializeField] 기본값
+struct HordeParams
+{
+    float wanderSpeed;
+    float chaseSpeed;
+    float detectionRange;
+    float attackRange;
+    float attackCooldown;
+    float wanderRadius;
+    float wanderChangeInterval;
+};
+
+inline HordeParams horde_default_params()
+{
+    HordeParams p = {1.5f, 3.0f, 8.0f, 1.5f, 1.5f, 10.0f, 3.0f};
+    return p;
+}
+
+enum HordeState
+{
+    HORDE_WANDERING = 0,
+    HORDE_CHASING = 1,
+    HORDE_ATTACKING = 2
+};
+
+class ZombieHorde
+{
+public:
+    explicit ZombieHorde(int capacity, uint64_t seed = 1)
+        : count_(0), capacity_(capacity), rng_(seed | 1), params_(horde_default_params())
+    {
+        // 8칸 단위로 넉넉히 잡아 두면 끝부분도 SIMD 로 읽을 수 있다
+        int cap = (capacity + 7) & ~7;
+        x_.assign(cap, 0);
+        y_.assign(cap, 0);
+        vx_.assign(cap, 0);
+        vy_.assign(cap, 0);
+        dir_x_.assign(cap, 0);
+        dir_y_.assign(cap, -1); // Vector2.down
+        wander_x_.assign(cap, 0);
+        wander_y_.assign(cap, 0);
+        wander_timer_.assign(cap, 0);
+        last_attack_.assign(cap, -1e30f);
+        state_.assign(cap, HORDE_WANDERING);
+    }
+
+    void set_params(const HordeParams &p) { params_ = p; }
+    const HordeParams &params() const { return params_; }
+
+    int count() const { return count_; }
+    int capacity() const { return capacity_; }
+
+    // 새 좀비 번호 (가득 차면 -1)
+    int add(float x, float y)
+    {
+        if (count_ >= capacity_)
+            return -1;
+        int i = count_++;
+        x_[i] = x;
+        y_[i] = y;
+        vx_[i] = vy_[i] = 0;
+        dir_x_[i] = 0;
+        dir_y_[i] = -1;
+        wander_timer_[i] = 0;
+        last_attack_[i] = -1e30f;
+        state_[i] = HORDE_WANDERING;
+        new_wander_target(i); // Awake() 의 첫 배회 목표
+        return i;
+    }
+
+    // i 번을 지우고 마지막 좀비를 그 자리로 옮긴다. 옮겨진 좀비의 예전 번호 (없으면 -1)
+    int remove(int i)
+    {
+        if (i < 0 || i >= count_)
+            return -1;
+        int last = --count_;
+        if (i == last)
+            return -1;
+        x_[i] = x_[last];
+        y_[i] = y_[last];
+        vx_[i] = vx_[last];
+        vy_[i] = vy_[last];
+        dir_x_[i] = dir_x_[last];
+        dir_y_[i] = dir_y_[last];
+        wander_x_[i] = wander_x_[last];
+        wander_y_[i] = wander_y_[last];
+        wander_timer_[i] = wander_timer_[last];
+        last_attack_[i] = last_attack_[last];
+        state_[i] = state_[last];
+        return last;
+    }
+
+    // Vector2[] 처럼 x, y 가 번갈아 있는 배열
+    void set_positions(const float *xy, int n)
+    {
+        n = n < count_ ? n : count_;
+        for (int i = 0; i < n; i++)
+        {
+            x_[i] = xy[2 * i];
+            y_[i] = xy[2 * i + 1];
+        }
+    }
+
+    // n 은 C# 배열 길이라 좀비 수보다 클 수 있다: 좀비 수만큼만 쓴다
+    void get_positions(float *xy, int n) const { interleave(x_, y_, xy, n < count_ ? n : count_); }
+    void get_velocities(float *xy, int n) const { interleave(vx_, vy_, xy, n < count_ ? n : count_); }
+    void get_directions(float *xy, int n) const { interleave(dir_x_, dir_y_, xy, n < count_ ? n : count_); }
+
+    void get_states(uint8_t *out, int n) const
+    {
+        n = n < count_ ? n : count_;
+        std::memcpy(out, state_.data(), n);
+    }
+
+    // 한 프레임. 이번 프레임에 공격한 좀비 번호를 attackers 에 (최대 max 개) 넣고 그 수를 돌려준다.
+    // time 은 Time.time (쿨다운 기준), dt 는 Time.deltaTime.
+    int update(float dt, float time, float px, float py, int *attackers, int max)
+    {
+        int i = 0, hits = 0;
+#if defined(__AVX2__)
+        for (; count_ - i >= 8; i += 8)
+            hits = update8(i, dt, time, px, py, attackers, max, hits);
+#endif
+        for (; i < count_; i++)
+            hits = update1(i, dt, time, px, py, attackers, max, hits);
+        return hits;
+    }
+
+    // SIMD 를 쓰지 않는 같은 계산 (검사용)
+    int update_scalar(float dt, float time, float px, float py, int *attackers, int max)
+    {
+        int hits = 0;
+        for (int i = 0; i < count_; i++)
+            hits = update1(i, dt, time, px, py, attackers, max, hits);
+        return hits;
+    }
+
+    // 추적 중인 좀비의 속도와 방향을 dir_xy (흐름장 방향, x, y 번갈아) 로 바꾼다.
+    // 방향이 (0, 0) 인 좀비(플레이어와 같은 칸, 길 없음)는 update 가 정한 직선 방향 그대로
+    void steer_chasing(const float *dir_xy, int n)
+    {
+        float speed = params_.chaseSpeed;
+        for (int i = 0; i < n && i < count_; i++)
+        {
+            float dx = dir_xy[2 * i], dy = dir_xy[2 * i + 1];
+            if (state_[i] != HORDE_CHASING || (dx == 0 && dy == 0))
+                continue;
+            vx_[i] = dx * speed;
+            vy_[i] = dy * speed;
+            dir_x_[i] = dx;
+            dir_y_[i] = dy;
+        }
+    }
+
+    // 화면 없이 돌릴 때: 속도대로 위치를 옮긴다 (유니티에서는 Rigidbody2D 가 한다)
+    void integrate(float dt)
+    {
+        for (int i = 0; i < count_; i++)
+        {
+            x_[i] += vx_[i] * dt;
+            y_[i] += vy_[i] * dt;
+        }
+    }
+
+    float x(int i) const { return x_[i]; }
+    float y(int i) const { return y_[i]; }
+    float vx(int i) const { return vx_[i]; }
+    float vy(int i) const { return vy_[i]; }
+    int state(int i) const { return state_[i]; }
+
+private:
+    static void interleave(const std::vector<float> &a, const std::vector<float> &b, float *xy, int n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            xy[2 * i] = a[i];
+            xy[2 * i + 1] = b[i];
+        }
+    }
+
+    // xorshift64* -> [0, 1)
+    float random01()
+    {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return (float)((rng_ * 0x2545f4914f6cdd1dULL) >> 40) * (1.0f / 16777216.0f);
+    }
+
+    // Random.insideUnitCircle * wanderRadius (원 안 고른 분포: 정사각형에서 뽑고 원 밖이면 다시)
+    void new_wander_target(int i)
+    {
+        float ux, uy;
+        do
+        {
+            ux = random01() * 2 - 1;
+            uy = random01() * 2 - 1;
+        } while (ux * ux + uy * uy > 1);
+        wander_x_[i] = x_[i] + ux * params_.wanderRadius;
+        wander_y_[i] = y_[i] + uy * params_.wanderRadius;
+    }
+
+    int update1(int i, float dt, float time, float px, float py, int *attackers, int max, int hits)
+    {
+        const HordeParams &p = params_;
+        float dx = px - x_[i], dy = py - y_[i];
+        float d2 = dx * dx + dy * dy;
+        float inv = d2 > 0 ? 1.0f / std::sqrt(d2) : 0.0f;
+        float mx, my;
+
+        if (d2 <= p.attackRange * p.attackRange)
+        {
+            state_[i] = HORDE_ATTACKING;
+            mx = dx * inv;
+            my = dy * inv;
+            vx_[i] = vy_[i] = 0;
+            if (time - last_attack_[i] >= p.attackCooldown)
+            {
+                last_attack_[i] = time;
+                if (hits < max)
+                    attackers[hits++] = i;
+            }
+        }
+        else if (d2 <= p.detectionRange * p.detectionRange)
+        {
+            state_[i] = HORDE_CHASING;
+            mx = dx * inv;
+            my = dy * inv;
+            vx_[i] = mx * p.chaseSpeed;
+            vy_[i] = my * p.chaseSpeed;
+        }
+        else
+        {
+            state_[i] = HORDE_WANDERING;
+            float t = wander_timer_[i] + dt;
+            float wx = wander_x_[i] - x_[i], wy = wander_y_[i] - y_[i];
+            if (wx * wx + wy * wy < 0.25f || t >= p.wanderChangeInterval)
+            {
+                new_wander_target(i);
+                t = 0;
+                wx = wander_x_[i] - x_[i];
+                wy = wander_y_[i] - y_[i];
+            }
+            wander_timer_[i] = t;
+            float w2 = wx * wx + wy * wy;
+            float winv = w2 > 0 ? 1.0f / std::sqrt(w2) : 0.0f;
+            mx = wx * winv;
+            my = wy * winv;
+            vx_[i] = mx * p.wanderSpeed;
+            vy_[i] = my * p.wanderSpeed;
+        }
+        // 애니메이션용 마지막 방향 (길이가 0.1 보다 클 때만)
+        if (mx * mx + my * my > 0.01f)
+        {
+            dir_x_[i] = mx;
+            dir_y_[i] = my;
+        }
+        return hits;
+    }
+
+#if defined(__AVX2__)
+    // 1 / sqrt(d2), d2 가 0 이면 0
+    static __m256 inv_length(__m256 d2)
+    {
+        __m256 zero = _mm256_setzero_ps();
+        __m256 inv = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(d2));
+        return _mm256_and_ps(inv, _mm256_cmp_ps(d2, zero, _CMP_GT_OQ));
+    }
+
+    int update8(int i, float dt, float time, float px, float py, int *attackers, int max, int hits)
+    {
+        const HordeParams &p = params_;
+        __m256 X = _mm256_loadu_ps(&x_[i]), Y = _mm256_loadu_ps(&y_[i]);
+        __m256 dx = _mm256_sub_ps(_mm256_set1_ps(px), X);
+        __m256 dy = _mm256_sub_ps(_mm256_set1_ps(py), Y);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 attack = _mm256_cmp_ps(d2, _mm256_set1_ps(p.attackRange * p.attackRange), _CMP_LE_OQ);
+        __m256 near = _mm256_cmp_ps(d2, _mm256_set1_ps(p.detectionRange * p.detectionRange), _CMP_LE_OQ);
+        __m256 chase = _mm256_andnot_ps(attack, near);
+        int wander_bits = ~_mm256_movemask_ps(near) & 0xff;
+
+        // 플레이어 방향
+        __m256 inv = inv_length(d2);
+        __m256 mx = _mm256_mul_ps(dx, inv), my = _mm256_mul_ps(dy, inv);
+        __m256 speed = _mm256_and_ps(chase, _mm256_set1_ps(p.chaseSpeed));
+
+        if (wander_bits)
+        {
+            __m256 wander = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_castps_si256(near), _mm256_setzero_si256()));
+            __m256 t = _mm256_add_ps(_mm256_loadu_ps(&wander_timer_[i]), _mm256_set1_ps(dt));
+            __m256 wx = _mm256_sub_ps(_mm256_loadu_ps(&wander_x_[i]), X);
+            __m256 wy = _mm256_sub_ps(_mm256_loadu_ps(&wander_y_[i]), Y);
+            __m256 w2 = _mm256_add_ps(_mm256_mul_ps(wx, wx), _mm256_mul_ps(wy, wy));
+            __m256 retarget = _mm256_or_ps(_mm256_cmp_ps(w2, _mm256_set1_ps(0.25f), _CMP_LT_OQ),
+                                           _mm256_cmp_ps(t, _mm256_set1_ps(p.wanderChangeInterval), _CMP_GE_OQ));
+            int bits = _mm256_movemask_ps(_mm256_and_ps(retarget, wander));
+
+            // 배회 타이머는 배회 중인 칸만 늘어난다
+            _mm256_storeu_ps(&wander_timer_[i], _mm256_blendv_ps(_mm256_loadu_ps(&wander_timer_[i]), t, wander));
+            if (bits)
+            {
+                // 새 목표는 드물다: 해당 칸만 하나씩 (난수 순서도 update1 과 같다)
+                for (int k = 0; k < 8; k++)
+                    if (bits >> k & 1)
+                    {
+                        new_wander_target(i + k);
+                        wander_timer_[i + k] = 0;
+                    }
+                wx = _mm256_sub_ps(_mm256_loadu_ps(&wander_x_[i]), X);
+                wy = _mm256_sub_ps(_mm256_loadu_ps(&wander_y_[i]), Y);
+                w2 = _mm256_add_ps(_mm256_mul_ps(wx, wx), _mm256_mul_ps(wy, wy));
+            }
+            __m256 winv = inv_length(w2);
+            mx = _mm256_blendv_ps(mx, _mm256_mul_ps(wx, winv), wander);
+            my = _mm256_blendv_ps(my, _mm256_mul_ps(wy, winv), wander);
+            speed = _mm256_blendv_ps(speed, _mm256_set1_ps(p.wanderSpeed), wander);
+        }
+
+        _mm256_storeu_ps(&vx_[i], _mm256_mul_ps(mx, speed));
+        _mm256_storeu_ps(&vy_[i], _mm256_mul_ps(my, speed));
+
+        // 마지막 방향
+        __m256 m2 = _mm256_add_ps(_mm256_mul_ps(mx, mx), _mm256_mul_ps(my, my));
+        __m256 moving = _mm256_cmp_ps(m2, _mm256_set1_ps(0.01f), _CMP_GT_OQ);
+        _mm256_storeu_ps(&dir_x_[i], _mm256_blendv_ps(_mm256_loadu_ps(&dir_x_[i]), mx, moving));
+        _mm256_storeu_ps(&dir_y_[i], _mm256_blendv_ps(_mm256_loadu_ps(&dir_y_[i]), my, moving));
+
+        // 상태: 공격 2, 추적 1, 배회 0
+        int attack_bits = _mm256_movemask_ps(attack), chase_bits = _mm256_movemask_ps(chase);
+        for (int k = 0; k < 8; k++)
+            state_[i + k] = (uint8_t)((attack_bits >> k & 1) * 2 + (chase_bits >> k & 1));
+
+        // 쿨다운이 끝난 공격
+        if (attack_bits)
+        {
+            __m256 ready = _mm256_cmp_ps(_mm256_sub_ps(_mm256_set1_ps(time), _mm256_loadu_ps(&last_attack_[i])),
+                                         _mm256_set1_ps(p.attackCooldown), _CMP_GE_OQ);
+            int bits = _mm256_movemask_ps(_mm256_and_ps(ready, attack));
+            for (int k = 0; k < 8; k++)
+                if (bits >> k & 1)
+                {
+                    last_attack_[i + k] = time;
+                    if (hits < max)
+                        attackers[hits++] = i + k;
+                }
+        }
+        return hits;
+    }
+#endif
+
+    int count_, capacity_;
+    uint64_t rng_;
+    HordeParams params_;
+    std::vector<float> x_, y_, vx_, vy_, dir_x_, dir_y_;
+    std::vector<float> wander_x_, wander_y_, wander_timer_, last_attack_;
+    std::vector<uint8_t> state_;
+};
+
+#endif
@@ -0,0 +1,354 @@
+// 인벤토리 코어: 아이템 이름을 번호로 바꿔 두고, 번호 -> 슬롯을 해시로 바로 찾는다 (C++11)
+//
+// InventorySystem.cs 의 AddItem / RemoveItem / GetItemCount 는 모두
+// items.Find(x => x.data.itemName == itemName) 로 리스트를 처음부터 훑으며 문자열을 비교하고(람다 할당),
+// 바뀔 때마다 OnInventoryChanged 를 불러 InventoryUI.RefreshUI 가 슬롯 전체를 다시 그린다.
+// InteractableObject.GiveMultipleLoot 한 번에 AddItem 이 여러 번이라 UI 도 여러 번 다시 그려진다.
+//   - ItemRegistry: 이름 -> 번호 (처음 한 번, ItemData 를 읽을 때). 이름은 한 버퍼에 이어 붙이고
+//     열린 주소법(선형 탐사) 해시로 찾는다. 번호마다 쌓이는지(isStackable), KeyItem 인지도 같이 둔다.
+//   - Inventory: 슬롯마다 아이템 번호와 개수를 평평한 배열에, 번호 -> 첫 슬롯을 열린 주소법 해시에.
+//     쌓이지 않는 아이템은 같은 번호 슬롯을 next_ 로 이어 둔다 (먼저 들어온 것이 앞).
+//     빈 슬롯은 최소 힙에 두어 가장 앞 빈 칸을 훑지 않고 꺼낸다.
+//   - 알림: 바뀐 슬롯과 새로 얻은 KeyItem 을 모아 두었다가 프레임에 한 번 flush 로 넘긴다.
+// 그래서 아이템 하나를 넣고 빼는 비용이 인벤토리 크기와 상관없이 일정하다.
+//
+// 규칙은 InventorySystem 과 같다: 쌓이는 아이템은 있던 슬롯에 더하고(maxStackSize 는 보지 않음),
+// 아니면 빈 슬롯에, 빈 슬롯이 없으면 실패. 빼기는 첫 슬롯에서 빼고 0 이하가 되면 슬롯을 비운다.
+// 다른 점: 빠진 슬롯은 빈 칸으로 남는다 (List.Remove 처럼 뒤 아이템을 당기지 않음, 새 아이템은 앞 빈 칸부터).
+// count 는 같은 번호 슬롯 전부의 합이다 (해시 자리에 같이 둔다).
+
+#ifndef INVENTORY_H
+#define INVENTORY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+// ItemType 과 같은 순서
+enum ItemKind
+{
+    ITEM_CONSUMABLE = 0,
+    ITEM_AMMO = 1,
+    ITEM_KEY = 2,
+    ITEM_MATERIAL = 3,
+    ITEM_KEY_ITEM = 4 // 탈출용 (EscapeManager.CollectKeyItem)
+};
+
+// FNV-1a
+inline uint32_t item_name_hash(const char *s, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ (uint8_t)s[i]) * 16777619u;
+    return h;
+}
+
+class ItemRegistry
+{
+public:
+    ItemRegistry() : table_(64, -1), mask_(63) {}
+
+    // 이름의 번호 (처음 보면 새로 만들고, 있으면 kind / stackable 은 그대로)
+    int intern(const char *name, int kind, bool stackable)
+    {
+        size_t len = std::strlen(name);
+        uint32_t h = item_name_hash(name, len);
+        uint32_t i = h & mask_;
+        for (; table_[i] >= 0; i = (i + 1) & mask_)
+            if (same(table_[i], h, name, len))
+                return table_[i];
+        int id = (int)hash_.size();
+        Item it = {(uint32_t)names_.size(), (uint32_t)len, (uint8_t)kind, stackable};
+        names_.insert(names_.end(), name, name + len + 1);
+        items_.push_back(it);
+        hash_.push_back(h);
+        table_[i] = id;
+        if (hash_.size() * 2 > table_.size())
+            grow();
+        return id;
+    }
+
+    // 이름으로 찾기. 없으면 -1
+    int find(const char *name) const
+    {
+        size_t len = std::strlen(name);
+        uint32_t h = item_name_hash(name, len);
+        for (uint32_t i = h & mask_; table_[i] >= 0; i = (i + 1) & mask_)
+            if (same(table_[i], h, name, len))
+                return table_[i];
+        return -1;
+    }
+
+    int size() const { return (int)items_.size(); }
+    const char *name(int id) const { return &names_[items_[id].offset]; }
+    int kind(int id) const { return items_[id].kind; }
+    bool stackable(int id) const { return items_[id].stackable; }
+    bool valid(int id) const { return id >= 0 && id < (int)items_.size(); }
+
+private:
+    struct Item
+    {
+        uint32_t offset, length; // names_ 안의 위치
+        uint8_t kind;
+        bool stackable;
+    };
+
+    bool same(int id, uint32_t h, const char *name, size_t len) const
+    {
+        return hash_[id] == h && items_[id].length == len && std::memcmp(&names_[items_[id].offset], name, len) == 0;
+    }
+
+    void grow()
+    {
+        table_.assign(table_.size() * 2, -1);
+        mask_ = (uint32_t)table_.size() - 1;
+        for (int id = 0; id < (int)hash_.size(); id++)
+        {
+            uint32_t i = hash_[id] & mask_;
+            while (table_[i] >= 0)
+                i = (i + 1) & mask_;
+            table_[i] = id;
+        }
+    }
+
+    std::vector<char> names_; // 0 으로 끝나는 이름을 이어 붙임
+    std::vector<Item> items_;
+    std::vector<uint32_t> hash_; // 번호별 이름 해시 (늘릴 때 다시 계산하지 않게)
+    std::vector<int> table_;     // 해시 자리 -> 번호, -1 은 빈 자리
+    uint32_t mask_;
+};
+
+class Inventory
+{
+public:
+    // registry 는 인벤토리보다 오래 살아야 한다. slots 는 maxSlots
+    Inventory(const ItemRegistry *registry, int slots)
+        : registry_(registry), item_(slots, -1), count_(slots, 0), next_(slots, -1), changed_flag_(slots, 0),
+          used_(0)
+    {
+        int size = 16;
+        while (size < slots * 2)
+            size *= 2; // 채움 50% 이하: 탐사가 짧다
+        keys_.assign(size, -1);
+        first_.assign(size, -1);
+        last_.assign(size, -1);
+        total_.assign(size, 0);
+        mask_ = (uint32_t)size - 1;
+        changed_.reserve(slots);
+        reset_free();
+    }
+
+    int slots() const { return (int)item_.size(); }
+    int used() const { return used_; }
+    int item(int slot) const { return item_[slot]; }   // 빈 슬롯은 -1
+    int amount(int slot) const { return count_[slot]; }
+
+    // AddItem. 넣은 슬롯, 가득 찼거나 모르는 번호면 -1
+    int add(int id, int amount)
+    {
+        if (!registry_->valid(id))
+            return -1;
+        uint32_t h = find_key(id);
+        int slot;
+        if (keys_[h] == id && registry_->stackable(id))
+        {
+            slot = first_[h];
+            count_[slot] += amount;
+            total_[h] += amount;
+        }
+        else
+        {
+            slot = take_slot();
+            if (slot < 0)
+                return -1; // Inventory is full
+            item_[slot] = id;
+            count_[slot] = amount;
+            if (keys_[h] != id)
+            {
+                keys_[h] = id;
+                first_[h] = slot;
+                total_[h] = 0;
+            }
+            else
+                next_[last_[h]] = slot; // 쌓이지 않는 아이템: 맨 뒤에 잇는다
+            last_[h] = slot;
+            total_[h] += amount;
+        }
+        mark(slot);
+        if (registry_->kind(id) == ITEM_KEY_ITEM)
+            collect_key(id);
+        return slot;
+    }
+
+    // GiveMultipleLoot: 여러 개를 한 번에. slots_out 에 넣은 슬롯(실패는 -1), 넣은 수를 돌려준다
+    int add_many(const int *ids, const int *amounts, int n, int *slots_out)
+    {
+        int added = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int slot = add(ids[i], amounts[i]);
+            if (slots_out)
+                slots_out[i] = slot;
+            added += slot >= 0;
+        }
+        return added;
+    }
+
+    // RemoveItem. 그 아이템이 없으면 false (모르는 번호도: -1 은 빈 자리와 같아서 먼저 막는다)
+    bool remove(int id, int amount)
+    {
+        if (!registry_->valid(id))
+            return false;
+        uint32_t h = find_key(id);
+        if (keys_[h] != id)
+            return false;
+        int slot = first_[h];
+        int before = count_[slot];
+        count_[slot] -= amount;
+        mark(slot);
+        total_[h] -= before - (count_[slot] > 0 ? count_[slot] : 0);
+        if (count_[slot] <= 0)
+        {
+            if (next_[slot] >= 0)
+                first_[h] = next_[slot];
+            else
+                erase_key(h);
+            next_[slot] = -1;
+            item_[slot] = -1;
+            count_[slot] = 0;
+            free_.push_back(slot);
+            std::push_heap(free_.begin(), free_.end(), std::greater<int>());
+            used_--;
+        }
+        return true;
+    }
+
+    // GetItemCount (같은 번호 슬롯 전부의 합)
+    int count(int id) const
+    {
+        if (!registry_->valid(id))
+            return 0;
+        uint32_t h = find_key(id);
+        return keys_[h] == id ? total_[h] : 0;
+    }
+
+    // ClearInventory
+    void clear()
+    {
+        for (int s = 0; s < slots(); s++)
+            if (item_[s] >= 0)
+            {
+                item_[s] = -1;
+                count_[s] = 0;
+                next_[s] = -1;
+                mark(s);
+            }
+        std::fill(keys_.begin(), keys_.end(), -1);
+        std::fill(first_.begin(), first_.end(), -1);
+        std::fill(last_.begin(), last_.end(), -1);
+        std::fill(total_.begin(), total_.end(), 0);
+        reset_free();
+        used_ = 0;
+    }
+
+    // 지난 flush 뒤 바뀐 슬롯 (여러 번 바뀌어도 한 번), 새로 얻은 KeyItem
+    int changed_count() const { return (int)changed_.size(); }
+    const int *changed() const { return changed_.data(); }
+    int collected_count() const { return (int)collected_.size(); }
+    const int *collected() const { return collected_.data(); }
+
+    // 프레임 끝에 한 번: 바뀐 슬롯 수를 돌려주고 모아 둔 것을 비운다 (0 이면 OnInventoryChanged 를 부르지 않아도 됨)
+    int flush()
+    {
+        int n = (int)changed_.size();
+        for (int i = 0; i < n; i++)
+            changed_flag_[changed_[i]] = 0;
+        changed_.clear();
+        collected_.clear();
+        return n;
+    }
+
+private:
+    // 번호 id 의 해시 자리, 없으면 그 번호가 들어갈 빈 자리
+    uint32_t find_key(int id) const
+    {
+        uint32_t i = ((uint32_t)id * 2654435761u) & mask_;
+        while (keys_[i] >= 0 && keys_[i] != id)
+            i = (i + 1) & mask_;
+        return i;
+    }
+
+    // 선형 탐사에서 지우기: 무덤 표시 대신 뒤에 밀려 있던 것을 당겨 온다
+    void erase_key(uint32_t i)
+    {
+        uint32_t j = i;
+        for (;;)
+        {
+            j = (j + 1) & mask_;
+            if (keys_[j] < 0)
+                break;
+            uint32_t home = ((uint32_t)keys_[j] * 2654435761u) & mask_;
+            // home 이 (i, j] 밖이면 i 로 옮겨도 찾을 수 있다
+            if (((j - home) & mask_) >= ((j - i) & mask_))
+            {
+                keys_[i] = keys_[j];
+                first_[i] = first_[j];
+                last_[i] = last_[j];
+                total_[i] = total_[j];
+                i = j;
+            }
+        }
+        keys_[i] = -1;
+        first_[i] = last_[i] = -1;
+        total_[i] = 0;
+    }
+
+    // 가장 앞의 빈 슬롯 (빈 슬롯 번호를 최소 힙에 둔다)
+    int take_slot()
+    {
+        if (free_.empty())
+            return -1;
+        std::pop_heap(free_.begin(), free_.end(), std::greater<int>());
+        int s = free_.back();
+        free_.pop_back();
+        used_++;
+        return s;
+    }
+
+    void reset_free()
+    {
+        free_.clear();
+        for (int s = 0; s < slots(); s++)
+            free_.push_back(s); // 오름차순은 이미 최소 힙
+    }
+
+    void mark(int slot)
+    {
+        if (!changed_flag_[slot])
+        {
+            changed_flag_[slot] = 1;
+            changed_.push_back(slot);
+        }
+    }
+
+    void collect_key(int id)
+    {
+        for (size_t i = 0; i < collected_.size(); i++)
+            if (collected_[i] == id)
+                return;
+        collected_.push_back(id);
+    }
+
+    const ItemRegistry *registry_;
+    std::vector<int> item_, count_, next_; // 슬롯별 번호, 개수, 같은 번호의 다음 슬롯
+    std::vector<uint8_t> changed_flag_;
+    std::vector<int> changed_, collected_;
+    std::vector<int> free_;         // 빈 슬롯 (최소 힙)
+    std::vector<int> keys_, first_, last_, total_; // 해시: 번호, 그 번호의 첫/마지막 슬롯, 개수 합
+    uint32_t mask_;
+    int used_;
+};
+
+#endif
@@ -0,0 +1,547 @@
+// 유니티에서 P/Invoke 로 부르는 C 함수들
+//
+// 리눅스:  g++ -std=c++11 -O2 -mavx2 -mfma -fPIC -shared native_api.cpp -o libZombieNative.so
+// Windows: cl /O2 /arch:AVX2 /LD native_api.cpp /Fe:ZombieNative.dll
+// 만든 파일을 Assets/Plugins 에 넣으면 Assets/Scripts/Native/ZombieNative.cs 에서 부를 수 있다.
+// 핸들은 C++ 객체 포인터이고, 배열은 Vector2[] 와 같은 x, y 순서의 float 배열로 주고받는다.
+
+#include "event_bus.h"
+#include "flow_field.h"
+#include "horde.h"
+#include "inventory.h"
+#include "projectiles.h"
+#include "session_sim.h"
+#include "sight_grid.h"
+#include "spawn_director.h"
+#include "spatial_grid.h"
+#include "voice_limiter.h"
+
+#if defined(_WIN32)
+#define NATIVE_API extern "C" __declspec(dllexport)
+#else
+#define NATIVE_API extern "C" __attribute__((visibility("default")))
+#endif
+
+// ---- 좀비 무리 (horde.h) ----
+
+NATIVE_API void *horde_create(int capacity, uint64_t seed)
+{
+    return new ZombieHorde(capacity, seed);
+}
+
+NATIVE_API void horde_destroy(void *h)
+{
+    delete (ZombieHorde *)h;
+}
+
+NATIVE_API void horde_set_params(void *h, const HordeParams *p)
+{
+    ((ZombieHorde *)h)->set_params(*p);
+}
+
+NATIVE_API int horde_add(void *h, float x, float y)
+{
+    return ((ZombieHorde *)h)->add(x, y);
+}
+
+NATIVE_API int horde_remove(void *h, int index)
+{
+    return ((ZombieHorde *)h)->remove(index);
+}
+
+NATIVE_API int horde_count(void *h)
+{
+    return ((ZombieHorde *)h)->count();
+}
+
+NATIVE_API void horde_set_positions(void *h, const float *xy, int n)
+{
+    ((ZombieHorde *)h)->set_positions(xy, n);
+}
+
+NATIVE_API int horde_update(void *h, float dt, float time, float px, float py, int *attackers, int max)
+{
+    return ((ZombieHorde *)h)->update(dt, time, px, py, attackers, max);
+}
+
+NATIVE_API void horde_get_velocities(void *h, float *xy, int n)
+{
+    ((ZombieHorde *)h)->get_velocities(xy, n);
+}
+
+NATIVE_API void horde_get_directions(void *h, float *xy, int n)
+{
+    ((ZombieHorde *)h)->get_directions(xy, n);
+}
+
+NATIVE_API void horde_get_states(void *h, uint8_t *states, int n)
+{
+    ((ZombieHorde *)h)->get_states(states, n);
+}
+
+// dir_xy: flow_steer 로 구한 방향 (추적 중인 좀비만 바뀐다)
+NATIVE_API void horde_steer_chasing(void *h, const float *dir_xy, int n)
+{
+    ((ZombieHorde *)h)->steer_chasing(dir_xy, n);
+}
+
+// ---- 공간 격자 (spatial_grid.h) ----
+
+NATIVE_API void *grid_create(int capacity, float cell)
+{
+    return new SpatialGrid(capacity, cell);
+}
+
+NATIVE_API void grid_destroy(void *g)
+{
+    delete (SpatialGrid *)g;
+}
+
+NATIVE_API int grid_insert(void *g, int id, float x, float y, float radius, uint32_t layer)
+{
+    return ((SpatialGrid *)g)->insert(id, x, y, radius, layer) ? 1 : 0;
+}
+
+NATIVE_API void grid_remove(void *g, int id)
+{
+    ((SpatialGrid *)g)->remove(id);
+}
+
+NATIVE_API void grid_move(void *g, int id, float x, float y)
+{
+    ((SpatialGrid *)g)->move(id, x, y);
+}
+
+NATIVE_API void grid_move_many(void *g, const int *ids, const float *xy, int n)
+{
+    ((SpatialGrid *)g)->move_many(ids, xy, n);
+}
+
+NATIVE_API int grid_count(void *g)
+{
+    return ((SpatialGrid *)g)->size();
+}
+
+NATIVE_API int grid_query_circle(void *g, float x, float y, float radius, uint32_t mask, int *out, int max)
+{
+    return ((SpatialGrid *)g)->query_circle(x, y, radius, mask, out, max);
+}
+
+NATIVE_API int grid_query_sector(void *g, float x, float y, float radius, float dx, float dy, float cos_half,
+                                 uint32_t mask, int *out, int max)
+{
+    return ((SpatialGrid *)g)->query_sector(x, y, radius, dx, dy, cos_half, mask, out, max);
+}
+
+NATIVE_API int grid_any_in_circle(void *g, float x, float y, float radius, uint32_t mask)
+{
+    return ((SpatialGrid *)g)->any_in_circle(x, y, radius, mask) ? 1 : 0;
+}
+
+// ---- 총알 풀 (projectiles.h) ----
+
+NATIVE_API void *projectiles_create(int capacity, float radius)
+{
+    return new ProjectilePool(capacity, radius);
+}
+
+NATIVE_API void projectiles_destroy(void *p)
+{
+    delete (ProjectilePool *)p;
+}
+
+NATIVE_API int projectiles_fire(void *p, float x, float y, float dx, float dy, float speed, float damage, float lifetime)
+{
+    return ((ProjectilePool *)p)->fire(x, y, dx, dy, speed, damage, lifetime);
+}
+
+NATIVE_API int projectiles_count(void *p)
+{
+    return ((ProjectilePool *)p)->count();
+}
+
+NATIVE_API void projectiles_clear(void *p)
+{
+    ((ProjectilePool *)p)->clear();
+}
+
+// grid 는 grid_create 로 만든 것 (좀비, 벽이 들어 있는 격자)
+NATIVE_API int projectiles_update(void *p, void *grid, float dt, uint32_t mask)
+{
+    return ((ProjectilePool *)p)->update(dt, *(SpatialGrid *)grid, mask);
+}
+
+// 마지막 update 에서 맞은 것을 out 에 최대 max 개 복사하고 그 수를 돌려준다
+NATIVE_API int projectiles_get_hits(void *p, ProjectileHit *out, int max)
+{
+    const ProjectilePool *pool = (const ProjectilePool *)p;
+    int n = pool->hit_count() < max ? pool->hit_count() : max;
+    for (int i = 0; i < n; i++)
+        out[i] = pool->hits()[i];
+    return n;
+}
+
+NATIVE_API void projectiles_get_positions(void *p, float *xy, int n)
+{
+    ((ProjectilePool *)p)->get_positions(xy, n);
+}
+
+NATIVE_API void projectiles_get_velocities(void *p, float *xy, int n)
+{
+    ((ProjectilePool *)p)->get_velocities(xy, n);
+}
+
+// ---- 흐름장 길찾기 (flow_field.h) ----
+
+NATIVE_API void *flow_create(int width, int height, float origin_x, float origin_y, float cell)
+{
+    return new FlowField(width, height, origin_x, origin_y, cell);
+}
+
+NATIVE_API void flow_destroy(void *f)
+{
+    delete (FlowField *)f;
+}
+
+NATIVE_API void flow_set_cost(void *f, int cx, int cy, uint8_t cost)
+{
+    ((FlowField *)f)->set_cost(cx, cy, cost);
+}
+
+NATIVE_API void flow_set_costs(void *f, const uint8_t *costs)
+{
+    ((FlowField *)f)->set_costs(costs);
+}
+
+NATIVE_API void flow_fill_circle(void *f, float x, float y, float radius, uint8_t cost)
+{
+    ((FlowField *)f)->fill_circle(x, y, radius, cost);
+}
+
+NATIVE_API void flow_set_range(void *f, int cells)
+{
+    ((FlowField *)f)->set_range(cells);
+}
+
+NATIVE_API int flow_update(void *f, float px, float py)
+{
+    return ((FlowField *)f)->update(px, py) ? 1 : 0;
+}
+
+NATIVE_API int flow_steer(void *f, const float *xy, float *dir_xy, int n)
+{
+    return ((FlowField *)f)->steer(xy, dir_xy, n);
+}
+
+// ---- 스폰 감독 (spawn_director.h) ----
+
+NATIVE_API void *director_create(int capacity, uint64_t seed)
+{
+    return new SpawnDirector(capacity, seed);
+}
+
+NATIVE_API void director_destroy(void *d)
+{
+    delete (SpawnDirector *)d;
+}
+
+// ZombieSpawner 기본값을 p 에
+NATIVE_API void director_default_params(SpawnParams *p)
+{
+    *p = spawn_default_params();
+}
+
+// 다음 start 부터 적용
+NATIVE_API void director_set_params(void *d, const SpawnParams *p)
+{
+    ((SpawnDirector *)d)->set_params(*p);
+}
+
+NATIVE_API void director_set_seed(void *d, uint64_t seed)
+{
+    ((SpawnDirector *)d)->set_seed(seed);
+}
+
+NATIVE_API void director_set_points(void *d, const float *xy, int n)
+{
+    ((SpawnDirector *)d)->set_points(xy, n);
+}
+
+NATIVE_API void director_generate_points(void *d, float px, float py, float radius, int count)
+{
+    ((SpawnDirector *)d)->generate_points(px, py, radius, count);
+}
+
+static bool grid_clear(float x, float y, void *grid)
+{
+    return !((SpatialGrid *)grid)->any_in_circle(x, y, 0.3f, GRID_STATIC);
+}
+
+// grid 의 벽(GRID_STATIC)과 겹치는 자리에는 스폰하지 않는다. grid 가 0 이면 검사 없음
+NATIVE_API void director_set_grid(void *d, void *grid)
+{
+    ((SpawnDirector *)d)->set_validator(grid ? grid_clear : 0, grid);
+}
+
+NATIVE_API void director_start(void *d, float time)
+{
+    ((SpawnDirector *)d)->start(time);
+}
+
+// now 까지 스폰할 것을 out 에 최대 max 개 적고 그 수를 돌려준다 (남은 것은 다음 update 에서)
+NATIVE_API int director_update(void *d, float now, float px, float py, SpawnEvent *out, int max)
+{
+    return ((SpawnDirector *)d)->update(now, px, py, out, max);
+}
+
+NATIVE_API int director_kill(void *d, int agent)
+{
+    return ((SpawnDirector *)d)->kill(agent) ? 1 : 0;
+}
+
+NATIVE_API int director_live_count(void *d)
+{
+    return ((SpawnDirector *)d)->live_count();
+}
+
+NATIVE_API int director_wave(void *d)
+{
+    return ((SpawnDirector *)d)->wave();
+}
+
+NATIVE_API float director_spawn_interval(void *d)
+{
+    return ((SpawnDirector *)d)->spawn_interval();
+}
+
+NATIVE_API int director_max_zombies(void *d)
+{
+    return ((SpawnDirector *)d)->max_zombies();
+}
+
+// ---- 인벤토리 (inventory.h) ----
+
+NATIVE_API void *registry_create()
+{
+    return new ItemRegistry();
+}
+
+NATIVE_API void registry_destroy(void *r)
+{
+    delete (ItemRegistry *)r;
+}
+
+// ItemData 마다 한 번. kind 는 ItemType
+NATIVE_API int registry_intern(void *r, const char *name, int kind, int stackable)
+{
+    return ((ItemRegistry *)r)->intern(name, kind, stackable != 0);
+}
+
+NATIVE_API int registry_find(void *r, const char *name)
+{
+    return ((ItemRegistry *)r)->find(name);
+}
+
+// registry 는 인벤토리보다 나중에 지운다
+NATIVE_API void *inventory_create(void *registry, int slots)
+{
+    return new Inventory((const ItemRegistry *)registry, slots);
+}
+
+NATIVE_API void inventory_destroy(void *inv)
+{
+    delete (Inventory *)inv;
+}
+
+NATIVE_API int inventory_add(void *inv, int id, int amount)
+{
+    return ((Inventory *)inv)->add(id, amount);
+}
+
+NATIVE_API int inventory_add_many(void *inv, const int *ids, const int *amounts, int n, int *slots)
+{
+    return ((Inventory *)inv)->add_many(ids, amounts, n, slots);
+}
+
+NATIVE_API int inventory_remove(void *inv, int id, int amount)
+{
+    return ((Inventory *)inv)->remove(id, amount) ? 1 : 0;
+}
+
+NATIVE_API int inventory_count(void *inv, int id)
+{
+    return ((Inventory *)inv)->count(id);
+}
+
+NATIVE_API void inventory_clear(void *inv)
+{
+    ((Inventory *)inv)->clear();
+}
+
+NATIVE_API int inventory_used(void *inv)
+{
+    return ((Inventory *)inv)->used();
+}
+
+// 슬롯마다 번호(빈 슬롯 -1)와 개수
+NATIVE_API void inventory_get_slots(void *inv, int *ids, int *amounts, int n)
+{
+    Inventory *p = (Inventory *)inv;
+    for (int s = 0; s < n && s < p->slots(); s++)
+    {
+        ids[s] = p->item(s);
+        amounts[s] = p->amount(s);
+    }
+}
+
+// 프레임 끝에 한 번: 바뀐 슬롯을 slots 에, 새로 얻은 KeyItem 번호를 keys 에 복사하고 비운다.
+// 바뀐 슬롯 수를 돌려준다 (0 이면 UI 를 다시 그릴 필요 없음)
+NATIVE_API int inventory_flush(void *inv, int *slots, int max_slots, int *keys, int max_keys, int *key_count)
+{
+    Inventory *p = (Inventory *)inv;
+    int n = std::min(p->changed_count(), max_slots), k = std::min(p->collected_count(), max_keys);
+    std::copy(p->changed(), p->changed() + n, slots);
+    std::copy(p->collected(), p->collected() + k, keys);
+    *key_count = k;
+    p->flush();
+    return n;
+}
+
+// ---- 한 판 시뮬레이션 (session_sim.h) ----
+
+// MainGame 설정을 p 에
+NATIVE_API void sim_get_defaults(SimParams *p)
+{
+    *p = sim_default_params();
+}
+
+// 한 판을 끝까지 돌려 out 에 (policy 는 SimPolicy). 여러 판은 부르는 쪽에서 스레드마다 나눠 부른다
+NATIVE_API void sim_run(const SimParams *p, int policy, uint64_t seed, SimResult *out)
+{
+    SessionSim sim(*p, seed);
+    sim.set_policy(policy);
+    *out = sim.run();
+}
+
+// ---- 이벤트 버스 (event_bus.h) ----
+
+NATIVE_API void *bus_create(int capacity, int max_batch)
+{
+    return new EventBus(capacity, max_batch);
+}
+
+NATIVE_API void bus_destroy(void *bus)
+{
+    delete (EventBus *)bus;
+}
+
+// 넣는 스레드가 돌기 전에 정한다 (기본: 인벤토리, 탄약, 체력, 타이머)
+NATIVE_API void bus_set_coalesce(void *bus, int type, int on)
+{
+    ((EventBus *)bus)->set_coalesce((uint32_t)type, on != 0);
+}
+
+// 아무 스레드에서나. 가득 차서 버렸으면 0
+NATIVE_API int bus_publish(void *bus, int type, int key, int i0, int i1, float f0, float f1)
+{
+    return ((EventBus *)bus)->publish((uint32_t)type, (uint32_t)key, i0, i1, f0, f1) ? 1 : 0;
+}
+
+// 메인 스레드에서 프레임에 한 번. 같은 (종류, key) 는 마지막 값 하나만, 꺼낸 수를 돌려준다
+NATIVE_API int bus_drain(void *bus, GameEvent *out, int max)
+{
+    return ((EventBus *)bus)->drain(out, max);
+}
+
+NATIVE_API void bus_get_stats(void *bus, EventBusStats *out)
+{
+    *out = ((EventBus *)bus)->stats();
+}
+
+// ---- 효과음 보이스 제한 (voice_limiter.h) ----
+
+NATIVE_API void voice_get_defaults(VoiceParams *p)
+{
+    *p = voice_default_params();
+}
+
+NATIVE_API void *voice_create(const VoiceParams *p)
+{
+    return new VoiceLimiter(*p);
+}
+
+NATIVE_API void voice_destroy(void *v)
+{
+    delete (VoiceLimiter *)v;
+}
+
+// 클립 번호마다 길이 (AudioClip.length)
+NATIVE_API void voice_set_clip(void *v, int clip, float length)
+{
+    ((VoiceLimiter *)v)->set_clip(clip, length);
+}
+
+NATIVE_API void voice_set_listener(void *v, float x, float y)
+{
+    ((VoiceLimiter *)v)->set_listener(x, y);
+}
+
+// 이번 프레임의 요청 count 개 (PlayOneShot 대신 모아 두었다가 한 번에)
+NATIVE_API void voice_request(void *v, const SoundRequest *requests, int count)
+{
+    VoiceLimiter *p = (VoiceLimiter *)v;
+    for (int i = 0; i < count; i++)
+        p->request(requests[i]);
+}
+
+// 프레임에 한 번. 틀 목록을 out 에 쓰고 그 수를 돌려준다 (voice 번호 = AudioSource 풀 번호)
+NATIVE_API int voice_update(void *v, float now, VoicePlay *out, int max)
+{
+    return ((VoiceLimiter *)v)->update(now, out, max);
+}
+
+NATIVE_API void voice_get_stats(void *v, VoiceStats *out)
+{
+    *out = ((VoiceLimiter *)v)->stats();
+}
+
+// ---- 시야 격자 (sight_grid.h) ----
+
+NATIVE_API void *sight_create(int width, int height, float origin_x, float origin_y, float cell)
+{
+    return new SightGrid(width, height, origin_x, origin_y, cell);
+}
+
+NATIVE_API void sight_destroy(void *s)
+{
+    delete (SightGrid *)s;
+}
+
+NATIVE_API void sight_set_blocked(void *s, int cx, int cy, int on)
+{
+    ((SightGrid *)s)->set_blocked(cx, cy, on != 0);
+}
+
+// width * height 개, 아래 줄부터, 0 이 아니면 막힘
+NATIVE_API void sight_set_cells(void *s, const uint8_t *cells)
+{
+    ((SightGrid *)s)->set_cells(cells);
+}
+
+NATIVE_API void sight_fill_circle(void *s, float x, float y, float radius, int on)
+{
+    ((SightGrid *)s)->fill_circle(x, y, radius, on != 0);
+}
+
+// 좀비 n 마리 (xy) 중 range 안(0 이하면 전부)이고 보이는 것의 비트를 bits 에 ((n + 31) / 32 개). 보이는 수를 돌려준다
+NATIVE_API int sight_query(void *s, float px, float py, const float *xy, int n, float range, uint32_t *bits)
+{
+    return ((SightGrid *)s)->query(px, py, xy, n, range, bits);
+}
+
+// DetectPlayer 대신: 좀비마다 상태 (SightState). bits 는 0 이어도 된다
+NATIVE_API int sight_detect(void *s, float px, float py, const float *xy, int n, float detection, float attack,
+                            uint8_t *states, uint32_t *bits)
+{
+    return ((SightGrid *)s)->detect(px, py, xy, n, detection, attack, states, bits);
+}
@@ -0,0 +1,145 @@
+// 총알 풀: 미리 잡아 둔 배열 안에서 쏘고, 움직이고, 맞히고, 없앤다 (C++11)
+//
+// RangedWeapon.FireBullet 은 쏠 때마다 Instantiate 로 총알 오브젝트를 만들고, Bullet 은
+// Destroy(gameObject, lifetime) 로 지워지며, 맞은 것은 OnTriggerEnter2D 에서 하나씩 처리한다.
+// 계속 쏘면 오브젝트가 생겼다 없어지기를 반복해서 GC 가 튄다.
+// ProjectilePool 은
+//   - 총알의 위치, 속도, 남은 시간, 데미지를 항목별 배열(SoA)로 두고 살아 있는 것만 앞쪽에 모은다.
+//     없어지면 마지막 총알을 빈자리로 옮긴다 (메모리를 새로 잡지 않음).
+//   - 한 프레임에 움직일 선분을 spatial_grid.h 에서 쓸어 보고(segment_first) 가장 먼저 닿은 것에 맞힌다.
+//     빠른 총알이 한 프레임에 좀비를 건너뛰는 일이 없다.
+//   - 맞은 것은 ProjectileHit 배열에 모아 두었다가 프레임마다 한 번에 넘긴다.
+// 좀비(GRID_ENEMY)에 맞으면 데미지, 벽(GRID_STATIC)에 맞으면 그냥 없어진다 (Bullet.cs 와 같음).
+
+#ifndef PROJECTILES_H
+#define PROJECTILES_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "spatial_grid.h"
+
+// 맞은 것 하나 (C# 쪽 StructLayout 과 순서가 같아야 한다)
+struct ProjectileHit
+{
+    int target;     // 격자 번호 (좀비 또는 벽)
+    uint32_t layer; // 맞은 것의 층 (GRID_ENEMY 이면 데미지)
+    float x, y;     // 맞은 위치
+    float damage;
+};
+
+class ProjectilePool
+{
+public:
+    // radius: 총알 반지름 (총알 프리팹의 콜라이더)
+    explicit ProjectilePool(int capacity, float radius = 0.05f)
+        : x_(capacity), y_(capacity), vx_(capacity), vy_(capacity), life_(capacity), damage_(capacity),
+          count_(0), capacity_(capacity), radius_(radius), dropped_(0)
+    {
+        hits_.reserve(capacity); // 한 프레임에 총알 하나가 한 번만 맞으므로 넘치지 않는다
+    }
+
+    int count() const { return count_; }
+    int capacity() const { return capacity_; }
+    int dropped() const { return dropped_; } // 풀이 가득 차서 못 쏜 수
+    float radius() const { return radius_; }
+    void set_radius(float r) { radius_ = r; }
+
+    // 쏘기 (dx, dy 는 방향, 길이는 상관없음). 풀이 가득 차면 -1
+    int fire(float x, float y, float dx, float dy, float speed, float damage, float lifetime)
+    {
+        if (count_ >= capacity_)
+        {
+            dropped_++;
+            return -1;
+        }
+        float len = std::sqrt(dx * dx + dy * dy);
+        float s = len > 0 ? speed / len : 0;
+        int i = count_++;
+        x_[i] = x;
+        y_[i] = y;
+        vx_[i] = dx * s;
+        vy_[i] = dy * s;
+        life_[i] = lifetime;
+        damage_[i] = damage;
+        return i;
+    }
+
+    void clear() { count_ = 0; }
+
+    // 한 프레임: 움직이면서 mask 층에 닿은 총알은 없애고 hits() 에 모은다. 시간이 다 된 것도 없앤다.
+    // 맞은 수를 돌려준다 (다음 update 전까지 hits() 로 읽는다)
+    int update(float dt, SpatialGrid &grid, uint32_t mask)
+    {
+        hits_.clear();
+        for (int i = 0; i < count_;)
+        {
+            float nx = x_[i] + vx_[i] * dt, ny = y_[i] + vy_[i] * dt, t;
+            int target = grid.segment_first(x_[i], y_[i], nx, ny, radius_, mask, &t);
+            if (target >= 0)
+            {
+                ProjectileHit h = {target, grid.layer(target), x_[i] + (nx - x_[i]) * t, y_[i] + (ny - y_[i]) * t,
+                                   damage_[i]};
+                hits_.push_back(h);
+                kill(i); // 마지막 총알이 i 로 왔으므로 i 를 다시 본다
+                continue;
+            }
+            x_[i] = nx;
+            y_[i] = ny;
+            life_[i] -= dt;
+            if (life_[i] <= 0)
+            {
+                kill(i);
+                continue;
+            }
+            i++;
+        }
+        return (int)hits_.size();
+    }
+
+    const ProjectileHit *hits() const { return hits_.data(); }
+    int hit_count() const { return (int)hits_.size(); }
+
+    // 그리기용 (xy 는 x, y 가 번갈아 있는 배열, n 은 count() 이하)
+    void get_positions(float *xy, int n) const
+    {
+        for (int i = 0; i < n && i < count_; i++)
+        {
+            xy[2 * i] = x_[i];
+            xy[2 * i + 1] = y_[i];
+        }
+    }
+
+    void get_velocities(float *xy, int n) const
+    {
+        for (int i = 0; i < n && i < count_; i++)
+        {
+            xy[2 * i] = vx_[i];
+            xy[2 * i + 1] = vy_[i];
+        }
+    }
+
+    float x(int i) const { return x_[i]; }
+    float y(int i) const { return y_[i]; }
+    float life(int i) const { return life_[i]; }
+
+private:
+    void kill(int i)
+    {
+        int last = --count_;
+        x_[i] = x_[last];
+        y_[i] = y_[last];
+        vx_[i] = vx_[last];
+        vy_[i] = vy_[last];
+        life_[i] = life_[last];
+        damage_[i] = damage_[last];
+    }
+
+    std::vector<float> x_, y_, vx_, vy_, life_, damage_;
+    std::vector<ProjectileHit> hits_;
+    int count_, capacity_;
+    float radius_;
+    int dropped_;
+};
+
+#endif
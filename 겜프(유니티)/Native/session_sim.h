@@ -0,0 +1,581 @@
+// 한 판("Last Night in the Village")을 화면 없이 돌리는 시뮬레이션 (C++11)
+//
+// 밸런스를 보려면 지금은 유니티에서 직접 해 봐야 한다. 규칙이 MonoBehaviour 여러 개에 흩어져 있기 때문이다:
+// ZombieSpawner(웨이브), ZombieAI(배회/추적/공격), PlayerHealth(무적 시간), 무기(맨손/방망이/소총),
+// InteractableObject(파밍), EscapeManager(필수 아이템), EscapeZone(수리 후 탈출), GameManager(제한 시간).
+// SessionSim 은 이 규칙을 고정 시간 간격(dt)으로 한 판 끝까지 돌린다.
+//   - 스폰: SpawnDirector, 좀비 이동/공격: ZombieHorde 를 그대로 쓴다 (같은 규칙, 같은 난수)
+//   - 플레이어 입력은 정책 함수가 정한다: 만들어 둔 봇(SIM_POLICY_*) 이나 sim_policy_fn 으로 직접
+//   - 같은 빌드(같은 컴파일 옵션)에서 SimParams, 시드, 정책이 같으면 어느 스레드에서 돌려도 결과가 같다
+//     (판마다 상태를 따로 가지므로 여러 판을 스레드마다 나눠 돌리면 된다)
+// 줄인 것: 벽/건물 충돌 없음(지도는 빈 사각형), 총알은 날아가는 시간 없이 조준선 위 가장 가까운 좀비에 맞음,
+// 좀비 드랍 아이템 없음. 파밍 상자는 필수 아이템 하나(있으면)와 탄약 또는 회복(반반, lootMin~lootMax)을 준다.
+
+#ifndef SESSION_SIM_H
+#define SESSION_SIM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// 걸음 간격의 최소 (초). C# 에서 dt 가 0, 음수, NaN 으로 오면 시간이 가지 않아 run 이 끝나지 않는다
+#define SIM_MIN_DT 0.001f
+#include "horde.h"
+#include "spawn_director.h"
+
+// MainGame 씬과 프리팹의 값 (C# 쪽 StructLayout 과 순서가 같아야 한다)
+struct SimParams
+{
+    HordeParams zombie;
+    SpawnParams spawn;
+    float dt;           // 고정 시간 간격 (Time.fixedDeltaTime)
+    float gameDuration; // 제한 시간, 지나면 패배
+    float mapHalf;      // 지도는 (-mapHalf, -mapHalf) ~ (mapHalf, mapHalf)
+    int containers;     // 파밍 상자 수
+    int requiredItems;  // 탈출에 필요한 아이템 수
+    int spawnPoints;
+    float playerSpeed;
+    float playerHealth;
+    float invincibilityTime;
+    float zombieHealth;
+    float zombieDamage;
+    float meleeDamage, meleeRange, meleeCooldown; // 방망이 (부채꼴 cos 0.5)
+    float rifleDamage, rifleRange, rifleCooldown;
+    int startingAmmo, maxAmmo;
+    float interactRange; // 상자
+    float escapeRange;   // 차
+    float repairDuration;
+    int lootMin, lootMax; // 탄약/회복 양
+};
+
+inline SimParams sim_default_params()
+{
+    SimParams p;
+    p.zombie = horde_default_params();
+    p.zombie.detectionRange = 5;
+    p.zombie.attackRange = 1;
+    p.spawn = spawn_default_params();
+    p.spawn.spawnInterval = 3;
+    p.spawn.maxZombies = 30;
+    p.spawn.difficultyIncreaseInterval = 30;
+    p.spawn.maxZombiesIncrease = 4;
+    p.dt = 0.02f;
+    p.gameDuration = 300;
+    p.mapHalf = 30;
+    p.containers = 24;
+    p.requiredItems = 3;
+    p.spawnPoints = 12;
+    p.playerSpeed = 5;
+    p.playerHealth = 100;
+    p.invincibilityTime = 0.5f;
+    p.zombieHealth = 50;
+    p.zombieDamage = 10;
+    p.meleeDamage = 15;
+    p.meleeRange = 1.5f;
+    p.meleeCooldown = 0.7f;
+    p.rifleDamage = 20;
+    p.rifleRange = 10;
+    p.rifleCooldown = 0.3f;
+    p.startingAmmo = 30;
+    p.maxAmmo = 999;
+    p.interactRange = 2;
+    p.escapeRange = 1.5f;
+    p.repairDuration = 1.5f;
+    p.lootMin = 5;
+    p.lootMax = 15;
+    return p;
+}
+
+enum SimOutcome
+{
+    SIM_RUNNING = 0,
+    SIM_ESCAPED = 1, // Victory
+    SIM_DIED = 2,
+    SIM_TIMEOUT = 3
+};
+
+enum SimPolicy
+{
+    SIM_POLICY_RUSH = 0,     // 가까운 상자부터 뒤지고 다 모이면 차로. 붙은 좀비만 방망이로
+    SIM_POLICY_CAUTIOUS = 1, // RUSH + 다가오는 좀비는 소총으로, 체력이 낮으면 좀비 반대쪽으로 물러남
+    SIM_POLICY_TURTLE = 2    // 제자리에서 싸우기만 (탈출하지 않음: 버티기 기준)
+};
+
+// 한 걸음의 입력
+struct SimInput
+{
+    float move_x, move_y; // 길이 1 이하
+    int attack;           // 0 없음, 1 방망이, 2 소총
+    float aim_x, aim_y;
+    bool interact; // F 누르고 있음
+};
+
+class SessionSim;
+typedef void (*sim_policy_fn)(const SessionSim &sim, SimInput *in, void *ctx);
+
+// 한 판 결과
+struct SimResult
+{
+    int outcome;
+    float time; // 끝난 시각 (버틴 시간)
+    int wave;   // 마지막 웨이브
+    int kills;
+    int spawned;
+    int items;      // 모은 필수 아이템
+    int searched;   // 뒤진 상자
+    int shots;
+    float damage_taken;
+    float health_left;
+    int peak_zombies;
+};
+
+// 웨이브별 부하
+struct SimWave
+{
+    int spawned, kills, peak_zombies;
+    float damage_taken;
+    double zombie_seconds; // 살아 있던 좀비 수를 시간으로 적분 (평균 좀비 수 = zombie_seconds / 웨이브 길이)
+};
+
+class SessionSim
+{
+public:
+    explicit SessionSim(const SimParams &params, uint64_t seed = 1, int capacity = 1024)
+        : p_(params), horde_(capacity, seed * 2 + 1), director_(capacity, seed * 2 + 2), policy_(0), policy_ctx_(0),
+          builtin_(SIM_POLICY_RUSH), rng_(seed * 0x9e3779b97f4a7c15ULL | 1), agent_(capacity, -1), health_(capacity, 0)
+    {
+        if (!(p_.dt >= SIM_MIN_DT))
+            p_.dt = SIM_MIN_DT;
+        horde_.set_params(p_.zombie);
+        director_.set_params(p_.spawn);
+        reset(seed);
+    }
+
+    // 만들어 둔 봇 (SimPolicy)
+    void set_policy(int builtin)
+    {
+        policy_ = 0;
+        builtin_ = builtin;
+    }
+
+    // 직접 만든 정책 (스크립트, 사람 입력 기록 재생 등)
+    void set_policy(sim_policy_fn fn, void *ctx)
+    {
+        policy_ = fn;
+        policy_ctx_ = ctx;
+    }
+
+    // 처음부터 다시 (지도, 아이템 위치, 좀비 난수 모두 seed 로)
+    void reset(uint64_t seed)
+    {
+        rng_ = seed * 0x9e3779b97f4a7c15ULL | 1;
+        horde_ = ZombieHorde(horde_.capacity(), seed * 2 + 1);
+        horde_.set_params(p_.zombie);
+        director_.set_seed(seed * 2 + 2);
+        time_ = 0;
+        step_ = 0;
+        px_ = py_ = 0;
+        health_player_ = p_.playerHealth;
+        last_damage_ = -1e30f;
+        last_melee_ = last_rifle_ = -1e30f;
+        ammo_ = p_.startingAmmo;
+        repair_ = 0;
+        repaired_ = false;
+        SimResult r = {};
+        result_ = r;
+        waves_.assign(1, SimWave());
+
+        // 상자와 차, 스폰 지점은 지도 안 아무 데나. 필수 아이템은 섞은 상자 앞쪽에 (SpawnRequiredItems)
+        box_x_.resize(p_.containers);
+        box_y_.resize(p_.containers);
+        box_key_.assign(p_.containers, 0);
+        box_used_.assign(p_.containers, 0);
+        for (int i = 0; i < p_.containers; i++)
+        {
+            box_x_[i] = random_range(-p_.mapHalf, p_.mapHalf);
+            box_y_[i] = random_range(-p_.mapHalf, p_.mapHalf);
+        }
+        std::vector<int> order(p_.containers);
+        for (int i = 0; i < p_.containers; i++)
+            order[i] = i;
+        for (int i = p_.containers - 1; i > 0; i--)
+            std::swap(order[i], order[random_int(i + 1)]);
+        for (int i = 0; i < p_.requiredItems && i < p_.containers; i++)
+            box_key_[order[i]] = 1;
+        car_x_ = random_range(-p_.mapHalf, p_.mapHalf);
+        car_y_ = random_range(-p_.mapHalf, p_.mapHalf);
+        std::vector<float> points(2 * p_.spawnPoints);
+        for (int i = 0; i < 2 * p_.spawnPoints; i++)
+            points[i] = random_range(-p_.mapHalf, p_.mapHalf);
+        director_.set_points(points.data(), p_.spawnPoints);
+        director_.start(0);
+    }
+
+    // 한 걸음 (dt). 끝났으면 false
+    bool step()
+    {
+        if (result_.outcome != SIM_RUNNING)
+            return false;
+        step_++;
+        time_ = (float)(step_ * (double)p_.dt); // 더해 가지 않고 곱해서: 오래 돌려도 어긋나지 않음
+        float dt = p_.dt;
+
+        // ZombieSpawner
+        SpawnEvent ev[64];
+        int n;
+        while ((n = director_.update(time_, px_, py_, ev, 64)) > 0)
+            for (int k = 0; k < n; k++)
+            {
+                int i = horde_.add(ev[k].x, ev[k].y);
+                if (i < 0)
+                {
+                    director_.kill(ev[k].agent);
+                    continue;
+                }
+                agent_[i] = ev[k].agent;
+                health_[i] = p_.zombieHealth;
+                result_.spawned++;
+                wave_stats().spawned++;
+            }
+
+        // ZombieAI: 공격한 좀비마다 PlayerHealth.TakeDamage (무적 시간 안이면 무시)
+        int attackers[256];
+        int hits = horde_.update(dt, time_, px_, py_, attackers, 256);
+        for (int k = 0; k < hits; k++)
+            damage_player(p_.zombieDamage);
+        horde_.integrate(dt);
+        if (health_player_ <= 0)
+            return finish(SIM_DIED);
+
+        // 플레이어 입력
+        SimInput in = {0, 0, 0, 0, 0, false};
+        if (policy_)
+            policy_(*this, &in, policy_ctx_);
+        else
+            builtin_policy(&in);
+        move_player(in.move_x, in.move_y, dt);
+        if (in.attack == 1)
+            melee(in.aim_x, in.aim_y);
+        else if (in.attack == 2)
+            shoot(in.aim_x, in.aim_y);
+        if (in.interact)
+            interact(dt);
+        else
+            repair_ = 0; // GetKeyUp: 수리 취소
+
+        SimWave &w = wave_stats();
+        w.zombie_seconds += horde_.count() * dt;
+        if (horde_.count() > w.peak_zombies)
+            w.peak_zombies = horde_.count();
+        if (horde_.count() > result_.peak_zombies)
+            result_.peak_zombies = horde_.count();
+
+        if (result_.outcome != SIM_RUNNING)
+            return false;
+        if (!(time_ < p_.gameDuration)) // NaN 이면 바로 끝
+            return finish(SIM_TIMEOUT);
+        return true;
+    }
+
+    // 끝날 때까지
+    const SimResult &run()
+    {
+        while (step())
+            ;
+        return result_;
+    }
+
+    const SimParams &params() const { return p_; }
+    const SimResult &result() const { return result_; }
+    const std::vector<SimWave> &waves() const { return waves_; }
+    float time() const { return time_; }
+
+    // 정책 함수가 읽는 상태
+    float player_x() const { return px_; }
+    float player_y() const { return py_; }
+    float player_health() const { return health_player_; }
+    int ammo() const { return ammo_; }
+    bool has_all_items() const { return result_.items >= p_.requiredItems; }
+    bool repaired() const { return repaired_; }
+    float car_x() const { return car_x_; }
+    float car_y() const { return car_y_; }
+    int containers() const { return p_.containers; }
+    float container_x(int i) const { return box_x_[i]; }
+    float container_y(int i) const { return box_y_[i]; }
+    bool container_used(int i) const { return box_used_[i] != 0; }
+    const ZombieHorde &horde() const { return horde_; }
+
+    // 가장 가까운 좀비 번호 (없으면 -1), 거리 제곱
+    int nearest_zombie(float *d2_out) const
+    {
+        int best = -1;
+        float bd = 1e30f;
+        for (int i = 0; i < horde_.count(); i++)
+        {
+            float dx = horde_.x(i) - px_, dy = horde_.y(i) - py_, d2 = dx * dx + dy * dy;
+            if (d2 < bd)
+            {
+                bd = d2;
+                best = i;
+            }
+        }
+        *d2_out = bd;
+        return best;
+    }
+
+    // 뒤지지 않은 가장 가까운 상자 (없으면 -1)
+    int nearest_container() const
+    {
+        int best = -1;
+        float bd = 1e30f;
+        for (int i = 0; i < p_.containers; i++)
+        {
+            if (box_used_[i])
+                continue;
+            float dx = box_x_[i] - px_, dy = box_y_[i] - py_, d2 = dx * dx + dy * dy;
+            if (d2 < bd)
+            {
+                bd = d2;
+                best = i;
+            }
+        }
+        return best;
+    }
+
+private:
+    // xorshift64* -> [0, 1)
+    float random01()
+    {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return (float)((rng_ * 0x2545f4914f6cdd1dULL) >> 40) * (1.0f / 16777216.0f);
+    }
+
+    float random_range(float lo, float hi) { return lo + random01() * (hi - lo); }
+
+    int random_int(int n)
+    {
+        int v = (int)(random01() * n);
+        return v < n ? v : n - 1;
+    }
+
+    SimWave &wave_stats()
+    {
+        while ((int)waves_.size() < director_.wave())
+            waves_.push_back(SimWave());
+        return waves_[director_.wave() - 1];
+    }
+
+    bool finish(int outcome)
+    {
+        result_.outcome = outcome;
+        result_.time = time_;
+        result_.wave = director_.wave();
+        result_.health_left = health_player_;
+        return false;
+    }
+
+    void damage_player(float damage)
+    {
+        if (time_ - last_damage_ < p_.invincibilityTime)
+            return;
+        float before = health_player_;
+        health_player_ = std::max(0.0f, health_player_ - damage);
+        last_damage_ = time_;
+        result_.damage_taken += before - health_player_;
+        wave_stats().damage_taken += before - health_player_;
+    }
+
+    void move_player(float mx, float my, float dt)
+    {
+        float len2 = mx * mx + my * my;
+        if (len2 > 1)
+        {
+            float inv = 1 / std::sqrt(len2);
+            mx *= inv;
+            my *= inv;
+        }
+        px_ = std::min(p_.mapHalf, std::max(-p_.mapHalf, px_ + mx * p_.playerSpeed * dt));
+        py_ = std::min(p_.mapHalf, std::max(-p_.mapHalf, py_ + my * p_.playerSpeed * dt));
+    }
+
+    // MeleeWeapon.PerformAttack: 반경 안, 조준 방향과 cos > 0.5 인 좀비 전부
+    void melee(float ax, float ay)
+    {
+        if (time_ - last_melee_ < p_.meleeCooldown)
+            return;
+        last_melee_ = time_;
+        float alen = std::sqrt(ax * ax + ay * ay);
+        if (alen <= 0)
+            return;
+        float r2 = p_.meleeRange * p_.meleeRange;
+        for (int i = horde_.count() - 1; i >= 0; i--) // 뒤에서부터: 지우면 마지막 좀비가 옮겨 온다
+        {
+            float dx = horde_.x(i) - px_, dy = horde_.y(i) - py_, d2 = dx * dx + dy * dy;
+            if (d2 > r2 || d2 <= 0 || (dx * ax + dy * ay) <= 0.5f * alen * std::sqrt(d2))
+                continue;
+            hit_zombie(i, p_.meleeDamage);
+        }
+    }
+
+    // RangedWeapon: 조준선에서 0.5 안쪽에 있는 가장 가까운 좀비 (사거리 안)
+    void shoot(float ax, float ay)
+    {
+        if (ammo_ <= 0 || time_ - last_rifle_ < p_.rifleCooldown)
+            return;
+        float alen = std::sqrt(ax * ax + ay * ay);
+        if (alen <= 0)
+            return;
+        last_rifle_ = time_;
+        ammo_--;
+        result_.shots++;
+        ax /= alen;
+        ay /= alen;
+        int best = -1;
+        float bt = p_.rifleRange;
+        for (int i = 0; i < horde_.count(); i++)
+        {
+            float dx = horde_.x(i) - px_, dy = horde_.y(i) - py_;
+            float t = dx * ax + dy * ay, side = dx * ay - dy * ax;
+            if (t > 0 && t < bt && side * side < 0.25f)
+            {
+                bt = t;
+                best = i;
+            }
+        }
+        if (best >= 0)
+            hit_zombie(best, p_.rifleDamage);
+    }
+
+    void hit_zombie(int i, float damage)
+    {
+        health_[i] -= damage;
+        if (health_[i] > 0)
+            return;
+        result_.kills++;
+        wave_stats().kills++;
+        director_.kill(agent_[i]);
+        int moved = horde_.remove(i);
+        if (moved >= 0)
+        {
+            agent_[i] = agent_[moved];
+            health_[i] = health_[moved];
+        }
+    }
+
+    void interact(float dt)
+    {
+        // InteractableObject: 범위 안 상자 하나를 한 번에
+        int b = nearest_container();
+        if (b >= 0)
+        {
+            float dx = box_x_[b] - px_, dy = box_y_[b] - py_;
+            if (dx * dx + dy * dy <= p_.interactRange * p_.interactRange)
+            {
+                box_used_[b] = 1;
+                result_.searched++;
+                if (box_key_[b])
+                    result_.items++; // CollectKeyItem
+                int amount = p_.lootMin + random_int(p_.lootMax - p_.lootMin + 1);
+                if (random01() > 0.5f)
+                    ammo_ = std::min(p_.maxAmmo, ammo_ + amount);
+                else
+                    health_player_ = std::min(p_.playerHealth, health_player_ + amount);
+                return;
+            }
+        }
+        // EscapeZone: 아이템이 다 있으면 누르고 있는 동안 수리, 수리됐으면 탈출
+        float dx = car_x_ - px_, dy = car_y_ - py_;
+        if (dx * dx + dy * dy > p_.escapeRange * p_.escapeRange || !has_all_items())
+        {
+            repair_ = 0;
+            return;
+        }
+        if (repaired_)
+        {
+            finish(SIM_ESCAPED);
+            return;
+        }
+        repair_ += dt;
+        if (repair_ >= p_.repairDuration)
+        {
+            repaired_ = true;
+            repair_ = 0;
+        }
+    }
+
+    void builtin_policy(SimInput *in)
+    {
+        float zd2;
+        int z = nearest_zombie(&zd2);
+        float zx = z >= 0 ? horde_.x(z) - px_ : 0, zy = z >= 0 ? horde_.y(z) - py_ : 0;
+        bool cautious = builtin_ == SIM_POLICY_CAUTIOUS;
+
+        // 싸우기: 붙으면 방망이, 조심하는 봇은 다가오는 좀비를 소총으로
+        if (z >= 0 && zd2 <= p_.meleeRange * p_.meleeRange)
+            in->attack = 1;
+        else if (z >= 0 && cautious && ammo_ > 0 && zd2 <= 0.49f * p_.rifleRange * p_.rifleRange &&
+                 horde_.state(z) != HORDE_WANDERING)
+            in->attack = 2;
+        in->aim_x = zx;
+        in->aim_y = zy;
+        if (builtin_ == SIM_POLICY_TURTLE)
+            return;
+
+        // 조심하는 봇: 체력이 낮고 좀비가 가까우면 물러난다 (상자가 회복을 줄 수 있으니 상자 쪽으로 틀어서)
+        float tx, ty;
+        int b = nearest_container();
+        if (has_all_items() || b < 0)
+        {
+            tx = car_x_;
+            ty = car_y_;
+        }
+        else
+        {
+            tx = box_x_[b];
+            ty = box_y_[b];
+        }
+        float dx = tx - px_, dy = ty - py_, d = std::sqrt(dx * dx + dy * dy);
+        if (cautious && z >= 0 && health_player_ < 0.3f * p_.playerHealth && zd2 < 9)
+        {
+            float zl = std::sqrt(zd2) + 1e-6f;
+            dx = dx / (d + 1e-6f) - 2 * zx / zl;
+            dy = dy / (d + 1e-6f) - 2 * zy / zl;
+            d = std::sqrt(dx * dx + dy * dy);
+        }
+        float stop = has_all_items() ? 0.5f * p_.escapeRange : 0.5f * p_.interactRange;
+        if (d > stop)
+        {
+            in->move_x = dx / d;
+            in->move_y = dy / d;
+        }
+        in->interact = true; // 늘 F 를 누르고 있음 (상자 범위거나 차 범위면 쓰임)
+    }
+
+    SimParams p_;
+    ZombieHorde horde_;
+    SpawnDirector director_;
+    sim_policy_fn policy_;
+    void *policy_ctx_;
+    int builtin_;
+    uint64_t rng_;
+
+    std::vector<int> agent_;      // 무리 번호 -> 감독 번호
+    std::vector<float> health_;   // 무리 번호별 ZombieHealth
+    std::vector<float> box_x_, box_y_;
+    std::vector<uint8_t> box_key_, box_used_;
+    float car_x_, car_y_;
+
+    long long step_;
+    float time_;
+    float px_, py_, health_player_, last_damage_, last_melee_, last_rifle_;
+    int ammo_;
+    float repair_;
+    bool repaired_;
+    SimResult result_;
+    std::vector<SimWave> waves_;
+};
+
+#endif
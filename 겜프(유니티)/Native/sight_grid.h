@@ -0,0 +1,226 @@
+// 시야 격자: 좀비 전부의 "플레이어가 보이는가" 를 한 번에 구한다 (C++11)
+//
+// ZombieAI.DetectPlayer 는 거리만 보고 (attackRange 안이면 공격, detectionRange 안이면 추적) 벽 너머 플레이어도 쫓는다.
+// 벽이 시야를 막게 하려면 좀비마다 매 프레임 Physics2D.Raycast 를 해야 해서 많을 때는 감당이 안 된다.
+// SightGrid 는 지도를 칸(막힘/열림)으로 나눠
+//   - 좀비 위치 배열을 한 번에 받아 보이는지를 비트(32 마리에 uint32 하나)로 돌려준다.
+//   - 한 줄은 플레이어 칸 가운데에서 좀비 칸 가운데까지 칸 단위 DDA 로 지나가는 칸만 본다 (정수만, 나눗셈 없음).
+//     양 끝 칸은 보지 않는다 (벽 칸에 걸친 좀비도 보임). 꼭짓점을 정확히 지나면 옆의 두 칸이 모두 막혔을 때만 막힌다.
+//   - 결과를 좀비 칸마다 캐시한다. 같은 칸의 좀비는 결과가 같고, 플레이어가 같은 칸에 있고 벽이 그대로면
+//     다음 프레임에도 그대로 쓴다 (세대 번호로 지워서 지도 전체를 비우지 않는다).
+//   - detectionRange 밖은 줄을 긋지 않는다.
+// detect 는 DetectPlayer 와 같은 규칙에 "보일 때만" 을 더해 상태(배회/추적/공격)까지 돌려준다.
+// 지도 밖 위치는 가장 가까운 가장자리 칸으로 본다.
+
+#ifndef SIGHT_GRID_H
+#define SIGHT_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// ZombieAI.State 와 같은 순서
+enum SightState
+{
+    SIGHT_WANDER,
+    SIGHT_CHASE,
+    SIGHT_ATTACK
+};
+
+class SightGrid
+{
+public:
+    // width x height 칸, (origin_x, origin_y) 가 (0, 0) 칸의 왼쪽 아래, cell 은 칸 크기(월드 단위)
+    SightGrid(int width, int height, float origin_x = 0, float origin_y = 0, float cell = 1)
+        : w_(width), h_(height), ox_(origin_x), oy_(origin_y), cell_(cell), inv_cell_(1 / cell),
+          blocked_((size_t)width * height, 0), cache_(blocked_.size(), 0), gen_(1), player_(-1), pcx_(0), pcy_(0),
+          traces_(0), hits_(0)
+    {
+    }
+
+    int width() const { return w_; }
+    int height() const { return h_; }
+    long long traces() const { return traces_; }    // 실제로 그은 줄 수
+    long long cache_hits() const { return hits_; } // 캐시로 답한 수
+
+    void set_blocked(int cx, int cy, bool on)
+    {
+        if (!inside(cx, cy))
+            return;
+        uint8_t &v = blocked_[index(cx, cy)];
+        if (v != (uint8_t)on)
+        {
+            v = on;
+            invalidate();
+        }
+    }
+
+    bool blocked(int cx, int cy) const { return blocked_[index(cx, cy)] != 0; }
+
+    // 전체 한꺼번에 (width * height, 아래 줄부터, 0 이 아니면 막힘)
+    void set_cells(const uint8_t *c)
+    {
+        for (size_t i = 0; i < blocked_.size(); i++)
+            blocked_[i] = c[i] != 0;
+        invalidate();
+    }
+
+    // 원 (x, y, r) 에 중심이 들어가는 칸 (벽 콜라이더를 칸으로 옮길 때)
+    void fill_circle(float x, float y, float r, bool on)
+    {
+        int cx0 = cell_x(x - r), cx1 = cell_x(x + r), cy0 = cell_y(y - r), cy1 = cell_y(y + r);
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                float dx = ox_ + (cx + 0.5f) * cell_ - x, dy = oy_ + (cy + 0.5f) * cell_ - y;
+                if (dx * dx + dy * dy <= r * r)
+                    set_blocked(cx, cy, on);
+            }
+    }
+
+    int cell_x(float x) const { return (int)std::floor((x - ox_) * inv_cell_); }
+    int cell_y(float y) const { return (int)std::floor((y - oy_) * inv_cell_); }
+    bool inside(int cx, int cy) const { return cx >= 0 && cy >= 0 && cx < w_ && cy < h_; }
+
+    // 칸 (ax, ay) 가운데에서 (bx, by) 가운데까지 막힌 칸이 없는지 (캐시 없이, 두 칸 모두 지도 안)
+    bool trace(int ax, int ay, int bx, int by) const
+    {
+        int dx = bx - ax, dy = by - ay, nx = std::abs(dx), ny = std::abs(dy);
+        int sx = dx > 0 ? 1 : -1, sy = dy > 0 ? 1 : -1, x = ax, y = ay;
+        for (int ix = 0, iy = 0; ix < nx || iy < ny;)
+        {
+            // 다음에 넘는 경계가 세로선인지 가로선인지: (ix + 0.5) / nx 와 (iy + 0.5) / ny 를 곱셈으로 비교
+            long long d = (long long)(1 + 2 * ix) * ny - (long long)(1 + 2 * iy) * nx;
+            if (d == 0)
+            {
+                if (blocked(x + sx, y) && blocked(x, y + sy))
+                    return false; // 대각선으로 맞붙은 벽 틈
+                x += sx;
+                y += sy;
+                ix++;
+                iy++;
+            }
+            else if (d < 0)
+            {
+                x += sx;
+                ix++;
+            }
+            else
+            {
+                y += sy;
+                iy++;
+            }
+            if ((x != bx || y != by) && blocked(x, y))
+                return false;
+        }
+        return true;
+    }
+
+    // 한 마리 (캐시 사용)
+    bool visible(float px, float py, float x, float y)
+    {
+        set_player(px, py);
+        return cached(clamp(cell_x(x), 0, w_ - 1), clamp(cell_y(y), 0, h_ - 1));
+    }
+
+    // xy: 좀비 n 마리 위치. 플레이어에서 range 안(0 이하면 전부)이고 보이면 bits 의 i 번째 비트를 켠다.
+    // bits 는 (n + 31) / 32 개. 보이는 수를 돌려준다
+    int query(float px, float py, const float *xy, int n, float range, uint32_t *bits)
+    {
+        set_player(px, py);
+        for (int k = 0; k < (n + 31) / 32; k++)
+            bits[k] = 0;
+        float r2 = range > 0 ? range * range : INFINITY;
+        int count = 0;
+        for (int i = 0; i < n; i++)
+        {
+            float x = xy[i * 2], y = xy[i * 2 + 1], dx = x - px, dy = y - py;
+            if (dx * dx + dy * dy > r2)
+                continue;
+            if (cached(clamp(cell_x(x), 0, w_ - 1), clamp(cell_y(y), 0, h_ - 1)))
+            {
+                bits[i >> 5] |= 1u << (i & 31);
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // DetectPlayer 와 같은 규칙 + 보일 때만: attack 안이면 SIGHT_ATTACK, detection 안이면 SIGHT_CHASE, 아니면 SIGHT_WANDER.
+    // bits 가 0 이 아니면 보이는 비트도 돌려준다. 보이는 수를 돌려준다
+    int detect(float px, float py, const float *xy, int n, float detection, float attack, uint8_t *state, uint32_t *bits)
+    {
+        if (!bits)
+        {
+            scratch_.resize((n + 31) / 32);
+            bits = scratch_.empty() ? 0 : &scratch_[0];
+        }
+        int count = query(px, py, xy, n, detection, bits);
+        float a2 = attack * attack;
+        for (int i = 0; i < n; i++)
+        {
+            if (!(bits[i >> 5] >> (i & 31) & 1))
+            {
+                state[i] = SIGHT_WANDER;
+                continue;
+            }
+            float dx = xy[i * 2] - px, dy = xy[i * 2 + 1] - py;
+            state[i] = dx * dx + dy * dy <= a2 ? SIGHT_ATTACK : SIGHT_CHASE;
+        }
+        return count;
+    }
+
+private:
+    static int clamp(int v, int lo, int hi) { return v < lo ? lo : v > hi ? hi : v; }
+    int index(int cx, int cy) const { return cy * w_ + cx; }
+
+    // 캐시 한 칸 = 세대 번호 * 2 + 보임. 세대가 다르면 비어 있는 것
+    void invalidate()
+    {
+        if (++gen_ >= 0x7fffffffu)
+        {
+            std::fill(cache_.begin(), cache_.end(), 0); // 세대 번호가 다 차면 한 번 지운다
+            gen_ = 1;
+        }
+    }
+
+    void set_player(float px, float py)
+    {
+        int pcx = clamp(cell_x(px), 0, w_ - 1), pcy = clamp(cell_y(py), 0, h_ - 1);
+        int p = index(pcx, pcy);
+        if (p != player_)
+        {
+            player_ = p;
+            pcx_ = pcx;
+            pcy_ = pcy;
+            invalidate();
+        }
+    }
+
+    bool cached(int cx, int cy)
+    {
+        uint32_t &e = cache_[index(cx, cy)];
+        if (e >> 1 == gen_)
+        {
+            hits_++;
+            return e & 1;
+        }
+        bool v = trace(pcx_, pcy_, cx, cy);
+        traces_++;
+        e = gen_ << 1 | (uint32_t)v;
+        return v;
+    }
+
+    int w_, h_;
+    float ox_, oy_, cell_, inv_cell_;
+    std::vector<uint8_t> blocked_;
+    std::vector<uint32_t> cache_;
+    std::vector<uint32_t> scratch_;
+    uint32_t gen_;
+    int player_, pcx_, pcy_;
+    long long traces_, hits_;
+};
+
+#endif
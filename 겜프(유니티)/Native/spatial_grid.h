@@ -0,0 +1,339 @@
+// 균일 격자 공간 해시: 원 안에 있는 콜라이더/좀비 찾기 (C++11)
+//
+// ZombieSpawner.IsPositionValid 와 MeleeWeapon.PerformAttack 은 Physics2D.OverlapCircleAll 로
+// 부를 때마다 새 배열을 만든다. 스폰 한 번에 최대 11번, 휘두를 때마다 한 번이다.
+// SpatialGrid 는 평면을 cell 크기의 칸으로 나누고 칸 번호를 해시해서 버킷에 담는다.
+//   - 작은 것(반지름 <= cell/2, 좀비와 플레이어): 중심이 있는 칸 하나에만 넣는다.
+//     움직여도 칸이 바뀔 때만 버킷을 옮긴다 (버킷 안에서는 마지막 것과 자리 바꾸기로 O(1) 삭제).
+//   - 큰 것(건물, 벽): 경계 상자가 걸치는 칸마다 넣는다. 거의 움직이지 않는다.
+// 찾기는 원의 경계 상자를 작은 것의 반지름(최대 cell/2)만큼 넓혀 걸치는 칸만 본다. 결과는 호출하는 쪽이 준 배열에 쓰므로
+// 메모리를 새로 잡지 않는다. 큰 것이 여러 칸에서 두 번 나오지 않도록 찾기마다 번호별 도장(stamp)을 찍는다.
+//
+// 층(layer) 비트로 종류를 나눈다. IsPositionValid 는 GRID_STATIC 만 (플레이어, 좀비, 트리거 제외),
+// 근접 공격은 GRID_ENEMY 만 본다.
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+enum GridLayer
+{
+    GRID_STATIC = 1,  // 벽, 건물 (스폰 막음)
+    GRID_ENEMY = 2,   // 좀비
+    GRID_PLAYER = 4,
+    GRID_TRIGGER = 8  // 트리거 콜라이더 (아이템, 탈출 지점)
+};
+
+class SpatialGrid
+{
+public:
+    // capacity: 번호(id)는 0 ~ capacity-1, cell: 칸 크기 (좀비 지름의 2배 이상), buckets: 2의 거듭제곱으로 올림 (기본 capacity 이상)
+    SpatialGrid(int capacity, float cell, int buckets = 0)
+        : cell_(cell), inv_cell_(1.0f / cell), small_r_(0), items_(capacity), stamp_(capacity, 0), query_(0), size_(0)
+    {
+        unsigned n = 64;
+        unsigned want = buckets > 0 ? (unsigned)buckets : (unsigned)capacity;
+        while (n < want)
+            n <<= 1;
+        mask_ = n - 1;
+        buckets_.resize(n);
+    }
+
+    int size() const { return size_; }
+    float cell() const { return cell_; }
+    bool contains(int id) const { return valid(id) && items_[id].live; }
+
+    // 넣기 (이미 있거나 번호가 범위 밖이면 false)
+    bool insert(int id, float x, float y, float r, uint32_t layer)
+    {
+        if (!valid(id) || items_[id].live)
+            return false;
+        Item &it = items_[id];
+        it.x = x;
+        it.y = y;
+        it.r = r;
+        it.layer = layer;
+        it.live = true;
+        it.large = r > cell_ * 0.5f;
+        if (!it.large && r > small_r_)
+            small_r_ = r;
+        link(id);
+        size_++;
+        return true;
+    }
+
+    void remove(int id)
+    {
+        if (!contains(id))
+            return;
+        unlink(id);
+        items_[id].live = false;
+        size_--;
+    }
+
+    // 위치 바꾸기. 작은 것은 칸이 그대로면 버킷 안 값만 고친다
+    void move(int id, float x, float y)
+    {
+        if (!contains(id))
+            return;
+        Item &it = items_[id];
+        if (!it.large && cell_of(x) == it.cx0 && cell_of(y) == it.cy0)
+        {
+            it.x = x;
+            it.y = y;
+            Entry &e = buckets_[it.bucket][it.slot];
+            e.x = x;
+            e.y = y;
+            return;
+        }
+        unlink(id);
+        it.x = x;
+        it.y = y;
+        link(id);
+    }
+
+    // 여러 개 한꺼번에 (xy 는 x, y 가 번갈아 있는 배열)
+    void move_many(const int *ids, const float *xy, int n)
+    {
+        for (int i = 0; i < n; i++)
+            move(ids[i], xy[2 * i], xy[2 * i + 1]);
+    }
+
+    // 원 (x, y, r) 과 겹치고 층이 mask 에 드는 것의 번호를 out 에 최대 max 개.
+    // 돌려주는 값은 찾은 전체 개수 (max 보다 크면 잘린 것)
+    int query_circle(float x, float y, float r, uint32_t mask, int *out, int max)
+    {
+        return query(x, y, r, mask, 0, 0, -2, out, max);
+    }
+
+    // 부채꼴: 원과 겹치고, 중심에서 그 물체 중심으로의 방향과 (dx, dy) 의 코사인이 cos_half 보다 큰 것
+    // (MeleeWeapon: 전방 120도 = cos_half 0.5). (dx, dy) 는 단위 벡터
+    int query_sector(float x, float y, float r, float dx, float dy, float cos_half, uint32_t mask, int *out, int max)
+    {
+        return query(x, y, r, mask, dx, dy, cos_half, out, max);
+    }
+
+    // 하나라도 겹치면 true (찾는 즉시 멈춘다)
+    bool any_in_circle(float x, float y, float r, uint32_t mask)
+    {
+        int dummy;
+        return query(x, y, r, mask, 0, 0, -2, &dummy, 0, true) > 0;
+    }
+
+    // 선분 (x0, y0) -> (x1, y1) 을 반지름 r 인 원이 쓸고 지나갈 때 가장 먼저 닿는 것 (총알).
+    // 닿는 것이 없으면 -1. 닿으면 *t 에 선분 위 비율 (0 = 시작점, 1 = 끝점)
+    int segment_first(float x0, float y0, float x1, float y1, float r, uint32_t mask, float *t)
+    {
+        float reach = r + small_r_;
+        int cx0 = cell_of(std::min(x0, x1) - reach), cx1 = cell_of(std::max(x0, x1) + reach);
+        int cy0 = cell_of(std::min(y0, y1) - reach), cy1 = cell_of(std::max(y0, y1) + reach);
+        float dx = x1 - x0, dy = y1 - y0, a = dx * dx + dy * dy;
+        float best = 2;
+        int hit = -1;
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                const std::vector<Entry> &v = buckets_[bucket_of(cx, cy)];
+                for (size_t k = 0; k < v.size(); k++)
+                {
+                    const Entry &e = v[k];
+                    if (!(e.layer & mask))
+                        continue;
+                    // |f + s d|^2 = R^2 의 작은 근 (f = 시작점 - 중심)
+                    float fx = x0 - e.x, fy = y0 - e.y, rr = r + e.r;
+                    float c = fx * fx + fy * fy - rr * rr, s;
+                    if (c <= 0)
+                        s = 0; // 시작부터 겹쳐 있음
+                    else
+                    {
+                        float b = fx * dx + fy * dy, disc = b * b - a * c;
+                        if (b >= 0 || disc < 0)
+                            continue; // 멀어지는 중이거나 스치지도 않음
+                        s = (-b - std::sqrt(disc)) / a;
+                        if (s > 1)
+                            continue;
+                    }
+                    // 같은 것이 여러 번 나와도 결과는 같으므로 도장은 필요 없다
+                    if (s < best || (s == best && e.id < hit))
+                    {
+                        best = s;
+                        hit = e.id;
+                    }
+                }
+            }
+        if (hit >= 0 && t)
+            *t = best;
+        return hit;
+    }
+
+    // 넣어 둔 물체 정보
+    float x(int id) const { return items_[id].x; }
+    float y(int id) const { return items_[id].y; }
+    float radius(int id) const { return items_[id].r; }
+    uint32_t layer(int id) const { return items_[id].layer; }
+
+private:
+    struct Entry
+    {
+        float x, y, r;
+        uint32_t layer;
+        int id;
+        int large; // 여러 칸에 들어 있음 (버킷 안 자리를 기록하지 않음)
+    };
+
+    struct Item
+    {
+        float x, y, r;
+        uint32_t layer;
+        int cx0, cy0, cx1, cy1; // 들어 있는 칸 범위
+        unsigned bucket;        // 작은 것: 버킷과 그 안의 자리
+        int slot;
+        bool live, large;
+        Item() : x(0), y(0), r(0), layer(0), cx0(0), cy0(0), cx1(0), cy1(0), bucket(0), slot(0), live(false), large(false) {}
+    };
+
+    bool valid(int id) const { return id >= 0 && id < (int)items_.size(); }
+
+    int cell_of(float v) const { return (int)std::floor(v * inv_cell_); }
+
+    unsigned bucket_of(int cx, int cy) const
+    {
+        return ((unsigned)cx * 73856093u ^ (unsigned)cy * 19349663u) & mask_;
+    }
+
+    void push(unsigned b, int id)
+    {
+        Item &it = items_[id];
+        Entry e = {it.x, it.y, it.r, it.layer, id, it.large ? 1 : 0};
+        it.bucket = b;
+        it.slot = (int)buckets_[b].size();
+        buckets_[b].push_back(e);
+    }
+
+    // 버킷 b 의 slot 자리를 마지막 것으로 채운다
+    void erase(unsigned b, int slot)
+    {
+        std::vector<Entry> &v = buckets_[b];
+        v[slot] = v.back();
+        v.pop_back();
+        if (slot < (int)v.size() && !v[slot].large)
+            items_[v[slot].id].slot = slot;
+    }
+
+    void link(int id)
+    {
+        Item &it = items_[id];
+        if (!it.large)
+        {
+            it.cx0 = it.cx1 = cell_of(it.x);
+            it.cy0 = it.cy1 = cell_of(it.y);
+            push(bucket_of(it.cx0, it.cy0), id);
+            return;
+        }
+        it.cx0 = cell_of(it.x - it.r);
+        it.cx1 = cell_of(it.x + it.r);
+        it.cy0 = cell_of(it.y - it.r);
+        it.cy1 = cell_of(it.y + it.r);
+        for (int cy = it.cy0; cy <= it.cy1; cy++)
+            for (int cx = it.cx0; cx <= it.cx1; cx++)
+            {
+                unsigned b = bucket_of(cx, cy);
+                // 다른 칸이 같은 버킷에 모이면 한 번만 넣는다
+                std::vector<Entry> &v = buckets_[b];
+                bool found = false;
+                for (size_t k = 0; k < v.size() && !found; k++)
+                    found = v[k].id == id;
+                if (!found)
+                    push(b, id);
+            }
+    }
+
+    void unlink(int id)
+    {
+        Item &it = items_[id];
+        if (!it.large)
+        {
+            erase(it.bucket, it.slot);
+            return;
+        }
+        for (int cy = it.cy0; cy <= it.cy1; cy++)
+            for (int cx = it.cx0; cx <= it.cx1; cx++)
+            {
+                std::vector<Entry> &v = buckets_[bucket_of(cx, cy)];
+                for (size_t k = 0; k < v.size(); k++)
+                    if (v[k].id == id)
+                    {
+                        erase(bucket_of(cx, cy), (int)k);
+                        break;
+                    }
+            }
+    }
+
+    // cos_half < -1 이면 방향을 보지 않는다. stop 이면 하나 찾으면 끝
+    int query(float x, float y, float r, uint32_t mask, float dx, float dy, float cos_half, int *out, int max,
+              bool stop = false)
+    {
+        // 작은 것은 중심 칸에만 있으므로 그 반지름(최대 cell/2)만큼 넓혀서 본다
+        float reach = r + small_r_;
+        int cx0 = cell_of(x - reach), cx1 = cell_of(x + reach);
+        int cy0 = cell_of(y - reach), cy1 = cell_of(y + reach);
+        int found = 0;
+        uint32_t q = ++query_;
+        if (q == 0)
+        {
+            // 도장 번호가 한 바퀴 돌았다
+            std::fill(stamp_.begin(), stamp_.end(), 0u);
+            q = query_ = 1;
+        }
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                const std::vector<Entry> &v = buckets_[bucket_of(cx, cy)];
+                for (size_t k = 0; k < v.size(); k++)
+                {
+                    const Entry &e = v[k];
+                    if (!(e.layer & mask))
+                        continue;
+                    float ex = e.x - x, ey = e.y - y, rr = r + e.r;
+                    float d2 = ex * ex + ey * ey;
+                    if (d2 > rr * rr || !in_cone(ex * dx + ey * dy, d2, cos_half))
+                        continue;
+                    // 큰 것, 또는 해시 충돌로 같은 버킷을 두 번 볼 때 한 번만 센다
+                    if (stamp_[e.id] == q)
+                        continue;
+                    stamp_[e.id] = q;
+                    if (found < max)
+                        out[found] = e.id;
+                    found++;
+                    if (stop)
+                        return found;
+                }
+            }
+        return found;
+    }
+
+    // dot / |d| > cos_half 를 제곱근 없이 (cos_half < -1 이면 방향을 보지 않음)
+    static bool in_cone(float dot, float d2, float cos_half)
+    {
+        if (cos_half < -1)
+            return true;
+        if (cos_half >= 0)
+            return dot > 0 && dot * dot > cos_half * cos_half * d2;
+        return dot >= 0 || dot * dot < cos_half * cos_half * d2;
+    }
+
+    float cell_, inv_cell_;
+    float small_r_; // 작은 것 중 가장 큰 반지름 (찾을 때 넓히는 양)
+    unsigned mask_;
+    std::vector<std::vector<Entry> > buckets_;
+    std::vector<Item> items_;
+    std::vector<uint32_t> stamp_;
+    uint32_t query_;
+    int size_;
+};
+
+#endif
@@ -0,0 +1,331 @@
+// 좀비 스폰 감독: 웨이브 일정표를 미리 만들고, 살아 있는 좀비를 빽빽한 배열로 관리한다 (C++11)
+//
+// ZombieSpawner.cs 는 매 프레임 activeZombies.RemoveAll(zombie => zombie == null) 로 리스트 전체를 훑고
+// (람다 할당), 스폰할 때마다 GetRandomSpawnPoint 에서 새 List<Transform> 을 만든다.
+// 난이도는 IncreaseDifficulty 의 간격 x0.9, 최대 수 +2 로만 바뀐다.
+// SpawnDirector 는 같은 규칙을
+//   - 살아 있는 좀비: 번호(핸들)를 빽빽한 배열 live_ 에 두고 slot_ 으로 자리를 찾아 마지막 것과 바꿔 O(1) 삭제
+//   - 스폰 지점: 플레이어가 움직였을 때만 최소 거리(5) 밖에 있는 지점 목록을 다시 만들어 두고 그 안에서 고른다
+//   - 난수: 시드를 정하는 xorshift64* (같은 시드, 같은 입력이면 같은 결과)
+//   - 일정: 웨이브 하나(difficultyIncreaseInterval)의 스폰 시각을 웨이브가 시작할 때 한꺼번에 만들고,
+//     update(now) 는 시각이 된 것만 꺼내 스폰한다. 그래서 프레임 없이 시각만 넘겨도 한 시간짜리 판을 몇 ms 에 돌린다.
+// 스폰 시각 규칙은 ZombieSpawner.Update 와 같다: 스폰한 시각 + 그때의 spawnInterval 이 다음 스폰,
+// 같은 시각이면 스폰을 먼저 보고 난이도를 올린다. (유니티는 프레임 단위로 늦어지지만 여기서는 정확한 시각)
+
+#ifndef SPAWN_DIRECTOR_H
+#define SPAWN_DIRECTOR_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// 스폰 간격, 웨이브 길이의 최소 (초). C# 에서 0 이 그대로 오면 next_spawn_ 이 제자리라 update 가 끝나지 않는다
+#define SPAWN_MIN_INTERVAL 0.01f
+
+// ZombieSpawner.cs 의 [SerializeField] 기본값 (C# 쪽 StructLayout 과 순서가 같아야 한다)
+struct SpawnParams
+{
+    float spawnInterval;              // 처음 스폰 간격 (초)
+    int maxZombies;                   // 처음 최대 좀비 수
+    float difficultyIncreaseInterval; // 웨이브 길이 (초), 0 이면 난이도 고정
+    float minSpawnInterval;
+    float intervalScale;              // 웨이브마다 간격에 곱함 (0.9)
+    int maxZombiesIncrease;
+    float minPlayerDistance;          // 플레이어와 이보다 가까운 지점은 고르지 않음 (5)
+    float searchRadius;               // 막힌 자리면 이 반경 안에서 다시 (3)
+    int searchAttempts;               // 다시 시도 횟수 (10)
+    int perSpawn;                     // 한 번에 스폰할 수 (ZombieSpawner 는 1)
+};
+
+inline SpawnParams spawn_default_params()
+{
+    SpawnParams p = {5.0f, 10, 60.0f, 1.0f, 0.9f, 2, 5.0f, 3.0f, 10, 1};
+    return p;
+}
+
+// update 가 돌려주는 스폰 하나 (C# 쪽 StructLayout 과 순서가 같아야 한다)
+struct SpawnEvent
+{
+    int agent;  // 좀비 번호 (kill 에 넘김)
+    int point;  // 고른 스폰 지점
+    float x, y; // 실제 위치
+    float time; // 일정표의 시각
+    int wave;
+};
+
+// 자리가 비었는지 (IsPositionValid: 벽, 건물과 겹치지 않는지). 없으면 모든 자리가 빈 것으로 본다
+typedef bool (*spawn_valid_fn)(float x, float y, void *ctx);
+
+class SpawnDirector
+{
+public:
+    SpawnDirector(int capacity, uint64_t seed = 1)
+        : slot_(capacity, -1), valid_(0), valid_ctx_(0), rng_(seed | 1), params_(spawn_default_params()),
+          player_x_(NAN), player_y_(NAN)
+    {
+        live_.reserve(capacity);
+        free_.reserve(capacity);
+        for (int i = capacity - 1; i >= 0; i--)
+            free_.push_back(i); // 0 번부터 나가도록
+        start(0);
+    }
+
+    // 바꾼 값은 다음 start 부터
+    void set_params(const SpawnParams &p) { params_ = p; }
+    const SpawnParams &params() const { return params_; }
+
+    void set_seed(uint64_t seed) { rng_ = seed | 1; }
+    void set_validator(spawn_valid_fn fn, void *ctx)
+    {
+        valid_ = fn;
+        valid_ctx_ = ctx;
+    }
+
+    // 스폰 지점 (x, y 번갈아)
+    void set_points(const float *xy, int n)
+    {
+        points_.assign(xy, xy + 2 * n);
+        player_x_ = NAN; // 다음 update 에서 고를 수 있는 지점을 다시 구함
+    }
+
+    // GenerateSpawnPoints: 플레이어 둘레 반지름 radius 원 위에 같은 간격으로 count 개
+    void generate_points(float px, float py, float radius = 15, int count = 8)
+    {
+        points_.resize(2 * count);
+        for (int i = 0; i < count; i++)
+        {
+            float rad = i * (360.0f / count) * 0.017453292f;
+            points_[2 * i] = px + std::cos(rad) * radius;
+            points_[2 * i + 1] = py + std::sin(rad) * radius;
+        }
+        player_x_ = NAN;
+    }
+
+    // 처음부터 (살아 있는 좀비를 모두 지우고 웨이브 1, 첫 스폰은 time + spawnInterval)
+    void start(float time)
+    {
+        for (size_t i = 0; i < live_.size(); i++)
+        {
+            slot_[live_[i]] = -1;
+            free_.push_back(live_[i]);
+        }
+        live_.clear();
+        wave_ = 1;
+        interval_ = at_least(params_.spawnInterval, SPAWN_MIN_INTERVAL);
+        max_zombies_ = params_.maxZombies;
+        next_spawn_ = (double)time + interval_;
+        wave_end_ = params_.difficultyIncreaseInterval > 0 ? (double)time + wave_length() : INFINITY;
+        spawned_ = capped_ = blocked_ = 0;
+        plan_wave();
+    }
+
+    // 시각 now 까지 일정표에서 꺼내 스폰하고 out 에 최대 max 개 넣는다 (넣은 수).
+    // out 이 가득 차면 남은 일정은 다음 호출에서 처리한다
+    int update(float now, float px, float py, SpawnEvent *out, int max)
+    {
+        if (px != player_x_ || py != player_y_)
+            refresh_points(px, py);
+        int n = 0;
+        while (n < max)
+        {
+            if (next_ >= schedule_.size())
+            {
+                if (next_spawn_ <= wave_end_)
+                    plan_wave(); // 이 웨이브 일정이 길어서 나눠 만든다
+                else if (wave_end_ <= now)
+                    next_wave(); // 이 웨이브가 끝났다: 난이도를 올리고 다음 웨이브 일정
+                else
+                    break;
+                continue;
+            }
+            double t = schedule_[next_];
+            if (t > now)
+                break;
+            n += spawn_at(t, out + n, max - n);
+            if (pending_ == 0)
+                next_++;
+        }
+        return n;
+    }
+
+    // 좀비가 죽었다 (없는 번호면 false)
+    bool kill(int agent)
+    {
+        if (agent < 0 || agent >= (int)slot_.size() || slot_[agent] < 0)
+            return false;
+        int s = slot_[agent], last = live_.back();
+        live_[s] = last;
+        slot_[last] = s;
+        live_.pop_back();
+        slot_[agent] = -1;
+        free_.push_back(agent);
+        return true;
+    }
+
+    int live_count() const { return (int)live_.size(); }
+    const int *live() const { return live_.data(); }
+    bool alive(int agent) const { return agent >= 0 && agent < (int)slot_.size() && slot_[agent] >= 0; }
+
+    int wave() const { return wave_; }
+    float spawn_interval() const { return interval_; }
+    int max_zombies() const { return max_zombies_; }
+    double next_spawn_time() const { return next_ < schedule_.size() ? schedule_[next_] : next_spawn_; }
+    int eligible_points() const { return (int)eligible_.size(); }
+
+    // 모은 수: 스폰함, 최대 수라서 건너뜀, 빈자리를 못 찾음
+    long long spawned() const { return spawned_; }
+    long long capped() const { return capped_; }
+    long long blocked() const { return blocked_; }
+
+private:
+    enum
+    {
+        PLAN_MAX = 4096
+    };
+
+    // NaN 도 lo 로
+    static float at_least(float v, float lo) { return v >= lo ? v : lo; }
+    float wave_length() const { return at_least(params_.difficultyIncreaseInterval, SPAWN_MIN_INTERVAL); }
+
+    // 웨이브 일정: 이 웨이브 안(끝 시각 포함)에 드는 스폰 시각 전부.
+    // 난이도가 고정이면(웨이브가 끝나지 않음) PLAN_MAX 개씩 나눠 만든다
+    void plan_wave()
+    {
+        schedule_.clear();
+        next_ = 0;
+        pending_ = 0;
+        while (next_spawn_ <= wave_end_ && schedule_.size() < PLAN_MAX)
+        {
+            schedule_.push_back(next_spawn_);
+            next_spawn_ += interval_;
+        }
+    }
+
+    // IncreaseDifficulty
+    void next_wave()
+    {
+        wave_++;
+        interval_ = interval_ * params_.intervalScale;
+        if (interval_ < params_.minSpawnInterval)
+            interval_ = params_.minSpawnInterval;
+        interval_ = at_least(interval_, SPAWN_MIN_INTERVAL);
+        max_zombies_ += params_.maxZombiesIncrease;
+        wave_end_ += wave_length();
+        plan_wave();
+    }
+
+    // GetRandomSpawnPoint 의 거리 검사를 플레이어가 움직였을 때만
+    void refresh_points(float px, float py)
+    {
+        player_x_ = px;
+        player_y_ = py;
+        eligible_.clear();
+        float min2 = params_.minPlayerDistance * params_.minPlayerDistance;
+        for (int i = 0; i < (int)points_.size() / 2; i++)
+        {
+            float dx = points_[2 * i] - px, dy = points_[2 * i + 1] - py;
+            if (dx * dx + dy * dy >= min2)
+                eligible_.push_back(i);
+        }
+    }
+
+    // 시각 t 의 스폰 (perSpawn 마리). 넣은 수. out 이 모자라면 pending_ 에 남은 수
+    int spawn_at(double t, SpawnEvent *out, int max)
+    {
+        if (pending_ == 0)
+            pending_ = params_.perSpawn;
+        int n = 0;
+        while (pending_ > 0 && n < max)
+        {
+            pending_--;
+            if ((int)live_.size() >= max_zombies_ || free_.empty())
+            {
+                capped_++; // Max zombies reached
+                continue;
+            }
+            int np = (int)points_.size() / 2;
+            if (np == 0)
+            {
+                blocked_++;
+                continue;
+            }
+            // 가까운 지점뿐이면 아무 지점이나 (ZombieSpawner 와 같음)
+            int point = eligible_.empty() ? random_int(np) : eligible_[random_int((int)eligible_.size())];
+            float x, y;
+            if (!find_position(points_[2 * point], points_[2 * point + 1], &x, &y))
+            {
+                blocked_++;
+                continue;
+            }
+            int agent = free_.back();
+            free_.pop_back();
+            slot_[agent] = (int)live_.size();
+            live_.push_back(agent);
+            spawned_++;
+            SpawnEvent e = {agent, point, x, y, (float)t, wave_};
+            out[n++] = e;
+        }
+        return n;
+    }
+
+    // FindValidSpawnPosition: 그 자리, 안 되면 searchRadius 원 안에서 searchAttempts 번
+    bool find_position(float x, float y, float *ox, float *oy)
+    {
+        if (!valid_ || valid_(x, y, valid_ctx_))
+        {
+            *ox = x;
+            *oy = y;
+            return true;
+        }
+        for (int i = 0; i < params_.searchAttempts; i++)
+        {
+            float ux, uy;
+            do
+            {
+                ux = random01() * 2 - 1;
+                uy = random01() * 2 - 1;
+            } while (ux * ux + uy * uy > 1);
+            float tx = x + ux * params_.searchRadius, ty = y + uy * params_.searchRadius;
+            if (valid_(tx, ty, valid_ctx_))
+            {
+                *ox = tx;
+                *oy = ty;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // xorshift64* -> [0, 1)
+    float random01()
+    {
+        rng_ ^= rng_ >> 12;
+        rng_ ^= rng_ << 25;
+        rng_ ^= rng_ >> 27;
+        return (float)((rng_ * 0x2545f4914f6cdd1dULL) >> 40) * (1.0f / 16777216.0f);
+    }
+
+    int random_int(int n)
+    {
+        int i = (int)(random01() * n);
+        return i < n ? i : n - 1;
+    }
+
+    std::vector<int> live_, slot_, free_;
+    std::vector<float> points_;
+    std::vector<int> eligible_;
+    std::vector<double> schedule_;
+    size_t next_;  // schedule_ 에서 다음 차례
+    int pending_;  // 지금 차례에서 아직 못 낸 수 (out 이 가득 찼을 때)
+    spawn_valid_fn valid_;
+    void *valid_ctx_;
+    uint64_t rng_;
+    SpawnParams params_;
+    float player_x_, player_y_;
+    int wave_, max_zombies_;
+    float interval_;
+    double next_spawn_, wave_end_;
+    long long spawned_, capped_, blocked_;
+};
+
+#endif
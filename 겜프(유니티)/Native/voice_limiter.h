@@ -0,0 +1,384 @@
+// 효과음 보이스 제한기: 한 프레임에 들어온 재생 요청을 골라 정해진 보이스 수 안에서만 틀고, 틀 목록을 돌려준다 (C++11)
+//
+// AudioManager.PlaySound / PlayZombieIdle / PlayZombieAttack / PlayRifleShoot / PlayFootstep 은 요청마다
+// sfxSource.PlayOneShot 을 부른다. 좀비가 많으면 한 프레임에 같은 신음 소리 수백 개가 겹쳐 소리가 뭉개지고
+// (합이 1 을 넘어 찢어짐) 유니티가 Real Voices 를 넘는 것을 아무렇게나 끈다.
+// VoiceLimiter 는
+//   - 요청을 모아 두었다가 update 에서 한꺼번에 본다. 점수 = priority + 들리는 크기(volume x 거리 감쇠, 0 ~ 1 쯤)
+//     이라서 우선순위가 먼저고, 같은 우선순위면 가깝고 큰 소리가 이긴다. 너무 작게 들리면 바로 버린다.
+//   - 같은 클립을 cooldown 안에 다시 요청하면 하나로 친다 (같은 프레임 안도).
+//   - 종류(SoundCategory)마다 최대 보이스 수가 있고, 전체 최대 보이스 수가 있다.
+//     꽉 차면 종류마다 둔 최소 힙의 맨 위(점수가 가장 낮은 보이스)와 비교해 요청이 더 높을 때만 그 보이스를 빼앗는다.
+//     전체가 꽉 찼을 때는 종류별 힙의 맨 위들 중 가장 낮은 것을 빼앗는다.
+//   - 재생 중인 보이스 점수는 매 update 에 지금 듣는 위치로 다시 매긴다 (플레이어가 멀어지면 빼앗기기 쉬움).
+//   - 결과는 (보이스 번호, 클립, 음량, 좌우) 목록 하나. 보이스 번호는 AudioSource 풀의 번호로 쓴다
+//     (같은 번호가 나오면 그 AudioSource 에서 지금 것을 멈추고 새로 튼다).
+// SoftMixer 는 그 목록을 받아 PCM 으로 섞는 작은 소프트웨어 믹서다 (유니티 없이 결과를 귀로, 숫자로 확인하는 용도).
+// 반복 재생(PlayRepair 의 loop)은 여기서 다루지 않는다.
+
+#ifndef VOICE_LIMITER_H
+#define VOICE_LIMITER_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// AudioManager 의 효과음 묶음 (Header 별)
+enum SoundCategory
+{
+    SOUND_PLAYER,
+    SOUND_WEAPON,
+    SOUND_ZOMBIE,
+    SOUND_ITEM,
+    SOUND_UI,
+    SOUND_ESCAPE,
+    SOUND_CATEGORIES
+};
+
+// C# 쪽 StructLayout 과 순서가 같아야 한다
+struct VoiceParams
+{
+    int maxVoices;                     // 전체 보이스 수 (유니티 기본 Real Voices 32)
+    int categoryCap[SOUND_CATEGORIES]; // 종류마다 최대
+    float cooldown;                    // 같은 클립을 이 시간(초) 안에 다시 요청하면 버림
+    float maxDistance;                 // 이만큼 떨어지면 들리지 않음 (직선 감쇠)
+    float panDistance;                 // 좌우로 이만큼 떨어지면 한쪽 끝
+    float minVolume;                   // 감쇠한 음량이 이보다 작으면 틀지 않음
+};
+
+inline VoiceParams voice_default_params()
+{
+    VoiceParams p = {32, {4, 8, 16, 4, 4, 2}, 0.05f, 25.0f, 8.0f, 0.02f};
+    return p;
+}
+
+// 재생 요청 하나 (C# 쪽 StructLayout 과 순서가 같아야 한다)
+struct SoundRequest
+{
+    int clip;
+    int category;   // SoundCategory
+    int priority;   // 클수록 중요 (유니티 AudioSource.priority 와 반대 방향)
+    int positional; // 0 이면 듣는 위치에서 (PlayOneShot)
+    float x, y;
+    float volume;   // volumeScale
+};
+
+// update 가 돌려주는 틀 목록 하나
+struct VoicePlay
+{
+    int voice; // 이 보이스에서 (빼앗긴 보이스면 지금 것을 멈추고)
+    int clip;
+    float volume;
+    float pan; // -1 왼쪽 ~ 1 오른쪽
+};
+
+struct VoiceStats
+{
+    long long requested;
+    long long deduped; // cooldown 안의 같은 클립
+    long long culled;  // 너무 작거나, 빼앗을 보이스가 없어서 버림
+    long long stolen;  // 재생 중에 더 높은 요청에 빼앗긴 수
+    long long played;  // requested = played + deduped + culled
+    int active;        // 지금 재생 중
+    int peak;          // 가장 많이 동시에 재생한 수
+};
+
+class VoiceLimiter
+{
+public:
+    explicit VoiceLimiter(const VoiceParams &p = voice_default_params()) : params_(p), lx_(0), ly_(0)
+    {
+        if (params_.maxVoices < 1)
+            params_.maxVoices = 1;
+        voices_.resize(params_.maxVoices);
+        for (int v = params_.maxVoices - 1; v >= 0; v--)
+            free_.push_back(v); // 0 번부터 나가도록
+        for (int c = 0; c < SOUND_CATEGORIES; c++)
+            heap_[c].reserve(params_.maxVoices);
+        stats_ = VoiceStats();
+    }
+
+    const VoiceParams &params() const { return params_; }
+
+    // 클립 길이 (초). 재생이 끝나는 시각을 알아야 보이스를 돌려받는다. 정하지 않은 클립은 1 초
+    void set_clip(int clip, float length)
+    {
+        if (clip < 0)
+            return;
+        if (clip >= (int)length_.size())
+        {
+            length_.resize(clip + 1, 1.0f);
+            last_start_.resize(clip + 1, -INFINITY);
+        }
+        length_[clip] = length;
+    }
+
+    // AudioListener 위치 (보통 플레이어)
+    void set_listener(float x, float y)
+    {
+        lx_ = x;
+        ly_ = y;
+    }
+
+    // PlayOneShot 대신. 바로 틀지 않고 다음 update 에서 고른다
+    void request(const SoundRequest &r)
+    {
+        stats_.requested++;
+        if (r.clip < 0 || r.category < 0 || r.category >= SOUND_CATEGORIES)
+        {
+            stats_.culled++;
+            return;
+        }
+        if (r.clip >= (int)length_.size())
+            set_clip(r.clip, 1.0f);
+        pending_.push_back(r);
+    }
+
+    // 프레임에 한 번. 끝난 보이스를 돌려받고, 모인 요청을 골라 out 에 틀 목록을 쓰고 그 수를 돌려준다.
+    // out 이 다 차면 나머지 요청은 버린다 (culled)
+    int update(float now, VoicePlay *out, int max)
+    {
+        for (int c = 0; c < SOUND_CATEGORIES; c++)
+            heap_[c].clear();
+        for (int v = 0; v < (int)voices_.size(); v++)
+        {
+            Voice &s = voices_[v];
+            if (!s.active)
+                continue;
+            if (now >= s.end)
+            {
+                s.active = false;
+                free_.push_back(v);
+                continue;
+            }
+            s.score = score(s.priority, s.positional, s.x, s.y, s.volume);
+            heap_[s.category].push_back(v);
+        }
+        for (int c = 0; c < SOUND_CATEGORIES; c++)
+            std::make_heap(heap_[c].begin(), heap_[c].end(), MinScore(voices_));
+
+        // 점수 높은 요청부터 (같으면 먼저 온 것)
+        order_.clear();
+        for (int i = 0; i < (int)pending_.size(); i++)
+        {
+            const SoundRequest &r = pending_[i];
+            float audible = r.volume * (r.positional ? attenuation(r.x, r.y) : 1.0f);
+            if (audible < params_.minVolume)
+            {
+                stats_.culled++;
+                continue;
+            }
+            Ranked k = {r.priority + audible, i};
+            order_.push_back(k);
+        }
+        std::sort(order_.begin(), order_.end());
+
+        int n = 0;
+        for (size_t k = 0; k < order_.size(); k++)
+        {
+            const SoundRequest &r = pending_[order_[k].index];
+            float sc = order_[k].score;
+            if (now - last_start_[r.clip] < params_.cooldown)
+            {
+                stats_.deduped++;
+                continue;
+            }
+            if (n >= max)
+            {
+                stats_.culled++;
+                continue;
+            }
+            int v = -1;
+            std::vector<int> &own = heap_[r.category];
+            if ((int)own.size() >= params_.categoryCap[r.category])
+            {
+                if (!own.empty() && voices_[own.front()].score < sc)
+                    v = steal(r.category);
+            }
+            else if (free_.empty())
+            {
+                int lowest = -1;
+                for (int c = 0; c < SOUND_CATEGORIES; c++)
+                    if (!heap_[c].empty() && (lowest < 0 || voices_[heap_[c].front()].score < voices_[heap_[lowest].front()].score))
+                        lowest = c;
+                if (lowest >= 0 && voices_[heap_[lowest].front()].score < sc)
+                    v = steal(lowest);
+            }
+            else
+            {
+                v = free_.back();
+                free_.pop_back();
+            }
+            if (v < 0)
+            {
+                stats_.culled++;
+                continue;
+            }
+
+            Voice &s = voices_[v];
+            s.active = true;
+            s.clip = r.clip;
+            s.category = r.category;
+            s.priority = r.priority;
+            s.positional = r.positional;
+            s.x = r.x;
+            s.y = r.y;
+            s.volume = r.volume;
+            s.score = sc;
+            s.end = now + length_[r.clip];
+            own.push_back(v);
+            std::push_heap(own.begin(), own.end(), MinScore(voices_));
+            last_start_[r.clip] = now;
+            stats_.played++;
+
+            VoicePlay &p = out[n++];
+            p.voice = v;
+            p.clip = r.clip;
+            p.volume = r.volume * (r.positional ? attenuation(r.x, r.y) : 1.0f);
+            p.pan = r.positional ? std::max(-1.0f, std::min(1.0f, (r.x - lx_) / params_.panDistance)) : 0.0f;
+        }
+        pending_.clear();
+
+        stats_.active = (int)voices_.size() - (int)free_.size();
+        stats_.peak = std::max(stats_.peak, stats_.active);
+        return n;
+    }
+
+    const VoiceStats &stats() const { return stats_; }
+    int active_count() const { return (int)voices_.size() - (int)free_.size(); }
+
+    // 종류마다 지금 재생 중인 수 (마지막 update 기준)
+    int category_count(int category) const { return (int)heap_[category].size(); }
+
+    // 보이스가 재생 중인 클립 (-1 이면 쉬는 중)
+    int voice_clip(int v) const { return voices_[v].active ? voices_[v].clip : -1; }
+
+private:
+    struct Voice
+    {
+        bool active;
+        int clip, category, priority, positional;
+        float x, y, volume, score, end;
+        Voice() : active(false), clip(-1), category(0), priority(0), positional(0), x(0), y(0), volume(0), score(0), end(0) {}
+    };
+
+    // 점수가 가장 낮은 보이스가 힙 맨 위
+    struct MinScore
+    {
+        const std::vector<Voice> &v;
+        explicit MinScore(const std::vector<Voice> &v) : v(v) {}
+        bool operator()(int a, int b) const { return v[a].score > v[b].score; }
+    };
+
+    struct Ranked
+    {
+        float score;
+        int index;
+        bool operator<(const Ranked &o) const { return score != o.score ? score > o.score : index < o.index; }
+    };
+
+    float attenuation(float x, float y) const
+    {
+        float dx = x - lx_, dy = y - ly_;
+        float a = 1.0f - std::sqrt(dx * dx + dy * dy) / params_.maxDistance;
+        return a > 0 ? a : 0;
+    }
+
+    float score(int priority, int positional, float x, float y, float volume) const
+    {
+        return priority + volume * (positional ? attenuation(x, y) : 1.0f);
+    }
+
+    // 종류 c 에서 점수가 가장 낮은 보이스를 빼앗아 돌려준다
+    int steal(int c)
+    {
+        std::vector<int> &h = heap_[c];
+        std::pop_heap(h.begin(), h.end(), MinScore(voices_));
+        int v = h.back();
+        h.pop_back();
+        voices_[v].active = false;
+        stats_.stolen++;
+        return v;
+    }
+
+    VoiceParams params_;
+    float lx_, ly_;
+    std::vector<Voice> voices_;
+    std::vector<int> free_;
+    std::vector<int> heap_[SOUND_CATEGORIES];
+    std::vector<float> length_, last_start_;
+    std::vector<SoundRequest> pending_;
+    std::vector<Ranked> order_;
+    VoiceStats stats_;
+};
+
+// 틀 목록을 받아 모노 클립들을 스테레오 PCM 으로 섞는다 (오프라인 확인용)
+class SoftMixer
+{
+public:
+    explicit SoftMixer(int voices) : voices_(voices) {}
+
+    // 클립 번호는 넣은 순서 (0 부터). VoiceLimiter::set_clip 에는 frames / 샘플레이트 를 넘긴다
+    int add_clip(const float *pcm, int frames)
+    {
+        clips_.push_back(std::vector<float>(pcm, pcm + frames));
+        return (int)clips_.size() - 1;
+    }
+
+    int clip_frames(int clip) const { return (int)clips_[clip].size(); }
+
+    // 보이스에서 지금 것을 멈추고 처음부터. 좌우는 같은 세기 유지(equal power)
+    void play(const VoicePlay &p)
+    {
+        Voice &v = voices_[p.voice];
+        v.clip = p.clip;
+        v.pos = 0;
+        float a = (p.pan + 1.0f) * 0.785398163f; // 0 ~ pi/2
+        v.left = p.volume * std::cos(a);
+        v.right = p.volume * std::sin(a);
+    }
+
+    // out 에 frames 개의 (왼쪽, 오른쪽) 쌍을 쓴다
+    void render(float *out, int frames)
+    {
+        std::fill(out, out + frames * 2, 0.0f);
+        for (size_t i = 0; i < voices_.size(); i++)
+        {
+            Voice &v = voices_[i];
+            if (v.clip < 0)
+                continue;
+            const std::vector<float> &pcm = clips_[v.clip];
+            int n = std::min(frames, (int)pcm.size() - v.pos);
+            const float *src = &pcm[v.pos];
+            for (int k = 0; k < n; k++)
+            {
+                out[k * 2] += v.left * src[k];
+                out[k * 2 + 1] += v.right * src[k];
+            }
+            v.pos += n;
+            if (v.pos >= (int)pcm.size())
+                v.clip = -1;
+        }
+    }
+
+    int active() const
+    {
+        int n = 0;
+        for (size_t i = 0; i < voices_.size(); i++)
+            n += voices_[i].clip >= 0;
+        return n;
+    }
+
+private:
+    struct Voice
+    {
+        int clip, pos;
+        float left, right;
+        Voice() : clip(-1), pos(0), left(0), right(0) {}
+    };
+
+    std::vector<Voice> voices_;
+    std::vector<std::vector<float> > clips_;
+};
+
+#endif